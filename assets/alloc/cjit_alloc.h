@@ -0,0 +1,65 @@
+/* CJIT https://dyne.org/cjit
+ *
+ * Copyright (C) 2025 Dyne.org foundation
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Memory allocation runtime bundled with CJIT, for the programs it
+// runs in memory (not with -o or -c).
+//
+// cjit --fast-malloc makes malloc(), free() and the rest of the family
+// use cjit_mem_alloc() and friends: a thread-caching allocator, whose
+// small blocks are taken and given back without locks. Memory which
+// comes from the C library (e.g. strdup() inside a library) can still
+// be given to free() and realloc(). The other way round is not
+// possible: a shared library must not free() or realloc() memory the
+// program allocated.
+//
+// Arenas and pools are always available. They are not thread-safe:
+// use one per thread, or lock around them.
+
+#ifndef _CJIT_ALLOC_H_
+#define _CJIT_ALLOC_H_
+
+#include <stddef.h>
+
+// the allocator of --fast-malloc, also callable directly
+void *cjit_mem_alloc(size_t size);
+void *cjit_mem_calloc(size_t nmemb, size_t size);
+void *cjit_mem_realloc(void *ptr, size_t size);
+void cjit_mem_free(void *ptr);
+void *cjit_mem_aligned(size_t alignment, size_t size);
+size_t cjit_mem_size(void *ptr);
+
+// arena: many allocations freed all at once
+typedef struct cjit_arena cjit_arena;
+// chunk: size of the blocks taken from malloc(), 0 for the default (64 KiB)
+cjit_arena *cjit_arena_new(size_t chunk);
+// 16 bytes aligned, NULL when out of memory
+void *cjit_arena_alloc(cjit_arena *arena, size_t size);
+// forget all allocations and keep the first chunk for the next ones
+void cjit_arena_reset(cjit_arena *arena);
+void cjit_arena_delete(cjit_arena *arena);
+
+// pool: blocks of one size, allocated and freed one by one
+typedef struct cjit_pool cjit_pool;
+cjit_pool *cjit_pool_new(size_t size);
+void *cjit_pool_alloc(cjit_pool *pool);
+void cjit_pool_free(cjit_pool *pool, void *ptr);
+// frees all the blocks of the pool
+void cjit_pool_delete(cjit_pool *pool);
+
+#endif
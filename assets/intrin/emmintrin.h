@@ -0,0 +1,692 @@
+/*
+ * CJIT x86 intrinsics: SSE2 <emmintrin.h>
+ */
+
+#ifndef _EMMINTRIN_H_INCLUDED
+#define _EMMINTRIN_H_INCLUDED
+
+#include <xmmintrin.h>
+
+typedef double __m128d __MM_VECTOR(16);
+typedef long long __m128i __MM_VECTOR(16);
+typedef double __m128d_u __MM_VECTOR(16);
+typedef long long __m128i_u __MM_VECTOR(16);
+
+typedef double __v2df __MM_VECTOR(16);
+typedef long long __v2di __MM_VECTOR(16);
+typedef unsigned long long __v2du __MM_VECTOR(16);
+typedef unsigned int __v4su __MM_VECTOR(16);
+typedef short __v8hi __MM_VECTOR(16);
+typedef unsigned short __v8hu __MM_VECTOR(16);
+typedef char __v16qi __MM_VECTOR(16);
+typedef signed char __v16qs __MM_VECTOR(16);
+typedef unsigned char __v16qu __MM_VECTOR(16);
+
+#define _MM_SHUFFLE2(x, y) (((x) << 1) | (y))
+
+__MM_INLINE double __mm_rint(double a)
+{
+    double c = a < 0 ? -4503599627370496.0 : 4503599627370496.0; /* 2^52 */
+    if (a >= 4503599627370496.0 || a <= -4503599627370496.0 || a != a)
+        return a;
+    return (a + c) - c;
+}
+
+/* casts */
+
+__MM_INLINE __m128 _mm_castpd_ps(__m128d a) { return (__m128)a; }
+__MM_INLINE __m128i _mm_castpd_si128(__m128d a) { return (__m128i)a; }
+__MM_INLINE __m128d _mm_castps_pd(__m128 a) { return (__m128d)a; }
+__MM_INLINE __m128i _mm_castps_si128(__m128 a) { return (__m128i)a; }
+__MM_INLINE __m128 _mm_castsi128_ps(__m128i a) { return (__m128)a; }
+__MM_INLINE __m128d _mm_castsi128_pd(__m128i a) { return (__m128d)a; }
+
+/* double precision: set, load and store */
+
+__MM_INLINE __m128d _mm_setzero_pd(void)
+{
+    __m128d r = { 0 };
+    return r;
+}
+
+__MM_INLINE __m128d _mm_set_pd(double e1, double e0)
+{
+    __m128d r = { e0, e1 };
+    return r;
+}
+
+__MM_INLINE __m128d _mm_setr_pd(double e0, double e1)
+{
+    __m128d r = { e0, e1 };
+    return r;
+}
+
+__MM_INLINE __m128d _mm_set1_pd(double a)
+{
+    __m128d r = { a, a };
+    return r;
+}
+
+__MM_INLINE __m128d _mm_set_sd(double a)
+{
+    __m128d r = { a, 0 };
+    return r;
+}
+
+#define _mm_set_pd1 _mm_set1_pd
+
+__MM_INLINE __m128d _mm_load_pd(const double *p)
+{
+    return *(const __m128d *)p;
+}
+
+#define _mm_loadu_pd _mm_load_pd
+
+__MM_INLINE __m128d _mm_load_sd(const double *p) { return _mm_set_sd(*p); }
+__MM_INLINE __m128d _mm_load1_pd(const double *p) { return _mm_set1_pd(*p); }
+__MM_INLINE __m128d _mm_loadr_pd(const double *p) { return _mm_setr_pd(p[1], p[0]); }
+__MM_INLINE __m128d _mm_loadh_pd(__m128d a, const double *p) { a[1] = *p; return a; }
+__MM_INLINE __m128d _mm_loadl_pd(__m128d a, const double *p) { a[0] = *p; return a; }
+
+#define _mm_load_pd1 _mm_load1_pd
+
+__MM_INLINE void _mm_store_pd(double *p, __m128d a)
+{
+    *(__m128d *)p = a;
+}
+
+#define _mm_storeu_pd _mm_store_pd
+#define _mm_stream_pd _mm_store_pd
+
+__MM_INLINE void _mm_store_sd(double *p, __m128d a) { *p = a[0]; }
+__MM_INLINE void _mm_store1_pd(double *p, __m128d a) { p[0] = p[1] = a[0]; }
+__MM_INLINE void _mm_storer_pd(double *p, __m128d a) { p[0] = a[1]; p[1] = a[0]; }
+__MM_INLINE void _mm_storeh_pd(double *p, __m128d a) { *p = a[1]; }
+__MM_INLINE void _mm_storel_pd(double *p, __m128d a) { *p = a[0]; }
+
+#define _mm_store_pd1 _mm_store1_pd
+
+__MM_INLINE double _mm_cvtsd_f64(__m128d a) { return a[0]; }
+__MM_INLINE __m128d _mm_move_sd(__m128d a, __m128d b) { a[0] = b[0]; return a; }
+
+/* double precision: arithmetic */
+
+__MM_INLINE __m128d _mm_add_pd(__m128d a, __m128d b) { return a + b; }
+__MM_INLINE __m128d _mm_sub_pd(__m128d a, __m128d b) { return a - b; }
+__MM_INLINE __m128d _mm_mul_pd(__m128d a, __m128d b) { return a * b; }
+__MM_INLINE __m128d _mm_div_pd(__m128d a, __m128d b) { return a / b; }
+
+__MM_INLINE __m128d _mm_add_sd(__m128d a, __m128d b) { a[0] += b[0]; return a; }
+__MM_INLINE __m128d _mm_sub_sd(__m128d a, __m128d b) { a[0] -= b[0]; return a; }
+__MM_INLINE __m128d _mm_mul_sd(__m128d a, __m128d b) { a[0] *= b[0]; return a; }
+__MM_INLINE __m128d _mm_div_sd(__m128d a, __m128d b) { a[0] /= b[0]; return a; }
+
+__MM_INLINE __m128d _mm_sqrt_pd(__m128d a)
+{
+    __asm__("movups (%0),%%xmm0\n\t"
+            ".byte 0x66,0x0f,0x51,0xc0\n\t" /* sqrtpd %xmm0,%xmm0 */
+            "movups %%xmm0,(%0)" : : "r"(&a) : "memory");
+    return a;
+}
+
+__MM_INLINE __m128d _mm_sqrt_sd(__m128d a, __m128d b)
+{
+    return _mm_move_sd(a, _mm_sqrt_pd(b));
+}
+
+__MM_INLINE __m128d _mm_min_pd(__m128d a, __m128d b)
+{
+    a[0] = a[0] < b[0] ? a[0] : b[0];
+    a[1] = a[1] < b[1] ? a[1] : b[1];
+    return a;
+}
+
+__MM_INLINE __m128d _mm_max_pd(__m128d a, __m128d b)
+{
+    a[0] = a[0] > b[0] ? a[0] : b[0];
+    a[1] = a[1] > b[1] ? a[1] : b[1];
+    return a;
+}
+
+__MM_INLINE __m128d _mm_min_sd(__m128d a, __m128d b)
+{
+    a[0] = a[0] < b[0] ? a[0] : b[0];
+    return a;
+}
+
+__MM_INLINE __m128d _mm_max_sd(__m128d a, __m128d b)
+{
+    a[0] = a[0] > b[0] ? a[0] : b[0];
+    return a;
+}
+
+__MM_INLINE __m128d _mm_and_pd(__m128d a, __m128d b) { return (__m128d)((__m128i)a & (__m128i)b); }
+__MM_INLINE __m128d _mm_andnot_pd(__m128d a, __m128d b) { return (__m128d)(~(__m128i)a & (__m128i)b); }
+__MM_INLINE __m128d _mm_or_pd(__m128d a, __m128d b) { return (__m128d)((__m128i)a | (__m128i)b); }
+__MM_INLINE __m128d _mm_xor_pd(__m128d a, __m128d b) { return (__m128d)((__m128i)a ^ (__m128i)b); }
+
+/* double precision: comparisons */
+
+__MM_INLINE __m128d _mm_cmpeq_pd(__m128d a, __m128d b) { return (__m128d)(a == b); }
+__MM_INLINE __m128d _mm_cmplt_pd(__m128d a, __m128d b) { return (__m128d)(a < b); }
+__MM_INLINE __m128d _mm_cmple_pd(__m128d a, __m128d b) { return (__m128d)(a <= b); }
+__MM_INLINE __m128d _mm_cmpgt_pd(__m128d a, __m128d b) { return (__m128d)(a > b); }
+__MM_INLINE __m128d _mm_cmpge_pd(__m128d a, __m128d b) { return (__m128d)(a >= b); }
+__MM_INLINE __m128d _mm_cmpneq_pd(__m128d a, __m128d b) { return (__m128d)(a != b); }
+__MM_INLINE __m128d _mm_cmpnlt_pd(__m128d a, __m128d b) { return (__m128d)~(__v2di)(a < b); }
+__MM_INLINE __m128d _mm_cmpnle_pd(__m128d a, __m128d b) { return (__m128d)~(__v2di)(a <= b); }
+__MM_INLINE __m128d _mm_cmpngt_pd(__m128d a, __m128d b) { return (__m128d)~(__v2di)(a > b); }
+__MM_INLINE __m128d _mm_cmpnge_pd(__m128d a, __m128d b) { return (__m128d)~(__v2di)(a >= b); }
+__MM_INLINE __m128d _mm_cmpord_pd(__m128d a, __m128d b) { return (__m128d)((a == a) & (b == b)); }
+__MM_INLINE __m128d _mm_cmpunord_pd(__m128d a, __m128d b) { return (__m128d)((a != a) | (b != b)); }
+
+#define __MM_CMP_SD(name) \
+__MM_INLINE __m128d name##_sd(__m128d a, __m128d b) \
+{ \
+    return _mm_move_sd(a, name##_pd(a, b)); \
+}
+__MM_CMP_SD(_mm_cmpeq)
+__MM_CMP_SD(_mm_cmplt)
+__MM_CMP_SD(_mm_cmple)
+__MM_CMP_SD(_mm_cmpgt)
+__MM_CMP_SD(_mm_cmpge)
+__MM_CMP_SD(_mm_cmpneq)
+__MM_CMP_SD(_mm_cmpnlt)
+__MM_CMP_SD(_mm_cmpnle)
+__MM_CMP_SD(_mm_cmpngt)
+__MM_CMP_SD(_mm_cmpnge)
+__MM_CMP_SD(_mm_cmpord)
+__MM_CMP_SD(_mm_cmpunord)
+
+__MM_INLINE int _mm_comieq_sd(__m128d a, __m128d b) { return a[0] == b[0]; }
+__MM_INLINE int _mm_comilt_sd(__m128d a, __m128d b) { return a[0] < b[0]; }
+__MM_INLINE int _mm_comile_sd(__m128d a, __m128d b) { return a[0] <= b[0]; }
+__MM_INLINE int _mm_comigt_sd(__m128d a, __m128d b) { return a[0] > b[0]; }
+__MM_INLINE int _mm_comige_sd(__m128d a, __m128d b) { return a[0] >= b[0]; }
+__MM_INLINE int _mm_comineq_sd(__m128d a, __m128d b) { return a[0] != b[0]; }
+
+#define _mm_ucomieq_sd _mm_comieq_sd
+#define _mm_ucomilt_sd _mm_comilt_sd
+#define _mm_ucomile_sd _mm_comile_sd
+#define _mm_ucomigt_sd _mm_comigt_sd
+#define _mm_ucomige_sd _mm_comige_sd
+#define _mm_ucomineq_sd _mm_comineq_sd
+
+/* double precision: shuffles */
+
+__MM_INLINE __m128d _mm_shuffle_pd(__m128d a, __m128d b, int imm)
+{
+    return _mm_setr_pd(a[imm & 1], b[(imm >> 1) & 1]);
+}
+
+__MM_INLINE __m128d _mm_unpacklo_pd(__m128d a, __m128d b) { return _mm_setr_pd(a[0], b[0]); }
+__MM_INLINE __m128d _mm_unpackhi_pd(__m128d a, __m128d b) { return _mm_setr_pd(a[1], b[1]); }
+
+__MM_INLINE int _mm_movemask_pd(__m128d a)
+{
+    __v2di v = (__v2di)a;
+    return (v[0] < 0) | (v[1] < 0) << 1;
+}
+
+/* conversions */
+
+__MM_INLINE __m128d _mm_cvtepi32_pd(__m128i a)
+{
+    __v4si v = (__v4si)a;
+    return _mm_setr_pd(v[0], v[1]);
+}
+
+__MM_INLINE __m128 _mm_cvtepi32_ps(__m128i a)
+{
+    __v4si v = (__v4si)a;
+    return _mm_setr_ps(v[0], v[1], v[2], v[3]);
+}
+
+__MM_INLINE __m128i _mm_cvtpd_epi32(__m128d a)
+{
+    __v4si r = { (int)__mm_rint(a[0]), (int)__mm_rint(a[1]), 0, 0 };
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_cvttpd_epi32(__m128d a)
+{
+    __v4si r = { (int)a[0], (int)a[1], 0, 0 };
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_cvtps_epi32(__m128 a)
+{
+    __v4si r;
+    int i;
+    for (i = 0; i < 4; i++)
+        r[i] = (int)__mm_rintf(a[i]);
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_cvttps_epi32(__m128 a)
+{
+    __v4si r = { (int)a[0], (int)a[1], (int)a[2], (int)a[3] };
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128 _mm_cvtpd_ps(__m128d a) { return _mm_setr_ps(a[0], a[1], 0, 0); }
+__MM_INLINE __m128d _mm_cvtps_pd(__m128 a) { return _mm_setr_pd(a[0], a[1]); }
+__MM_INLINE int _mm_cvtsd_si32(__m128d a) { return (int)__mm_rint(a[0]); }
+__MM_INLINE int _mm_cvttsd_si32(__m128d a) { return (int)a[0]; }
+__MM_INLINE long long _mm_cvtsd_si64(__m128d a) { return (long long)__mm_rint(a[0]); }
+__MM_INLINE long long _mm_cvttsd_si64(__m128d a) { return (long long)a[0]; }
+__MM_INLINE __m128 _mm_cvtsd_ss(__m128 a, __m128d b) { a[0] = b[0]; return a; }
+__MM_INLINE __m128d _mm_cvtss_sd(__m128d a, __m128 b) { a[0] = b[0]; return a; }
+__MM_INLINE __m128d _mm_cvtsi32_sd(__m128d a, int b) { a[0] = b; return a; }
+__MM_INLINE __m128d _mm_cvtsi64_sd(__m128d a, long long b) { a[0] = b; return a; }
+
+#define _mm_cvtsd_si64x _mm_cvtsd_si64
+#define _mm_cvttsd_si64x _mm_cvttsd_si64
+#define _mm_cvtsi64x_sd _mm_cvtsi64_sd
+
+/* integer: set, load and store */
+
+__MM_INLINE __m128i _mm_setzero_si128(void)
+{
+    __m128i r = { 0 };
+    return r;
+}
+
+__MM_INLINE __m128i _mm_set_epi64x(long long e1, long long e0)
+{
+    __m128i r = { e0, e1 };
+    return r;
+}
+
+__MM_INLINE __m128i _mm_set_epi32(int e3, int e2, int e1, int e0)
+{
+    __v4si r = { e0, e1, e2, e3 };
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_set_epi16(short e7, short e6, short e5, short e4,
+                                  short e3, short e2, short e1, short e0)
+{
+    __v8hi r = { e0, e1, e2, e3, e4, e5, e6, e7 };
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_set_epi8(char e15, char e14, char e13, char e12,
+                                 char e11, char e10, char e9, char e8,
+                                 char e7, char e6, char e5, char e4,
+                                 char e3, char e2, char e1, char e0)
+{
+    __v16qi r = { e0, e1, e2, e3, e4, e5, e6, e7,
+                  e8, e9, e10, e11, e12, e13, e14, e15 };
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_setr_epi32(int e0, int e1, int e2, int e3)
+{
+    return _mm_set_epi32(e3, e2, e1, e0);
+}
+
+__MM_INLINE __m128i _mm_setr_epi16(short e0, short e1, short e2, short e3,
+                                   short e4, short e5, short e6, short e7)
+{
+    return _mm_set_epi16(e7, e6, e5, e4, e3, e2, e1, e0);
+}
+
+__MM_INLINE __m128i _mm_setr_epi8(char e0, char e1, char e2, char e3,
+                                  char e4, char e5, char e6, char e7,
+                                  char e8, char e9, char e10, char e11,
+                                  char e12, char e13, char e14, char e15)
+{
+    return _mm_set_epi8(e15, e14, e13, e12, e11, e10, e9, e8,
+                        e7, e6, e5, e4, e3, e2, e1, e0);
+}
+
+__MM_INLINE __m128i _mm_set1_epi64x(long long a) { return _mm_set_epi64x(a, a); }
+__MM_INLINE __m128i _mm_set1_epi32(int a) { return _mm_set_epi32(a, a, a, a); }
+__MM_INLINE __m128i _mm_set1_epi16(short a) { return _mm_set_epi16(a, a, a, a, a, a, a, a); }
+
+__MM_INLINE __m128i _mm_set1_epi8(char a)
+{
+    return _mm_set_epi8(a, a, a, a, a, a, a, a, a, a, a, a, a, a, a, a);
+}
+
+__MM_INLINE __m128i _mm_load_si128(const __m128i *p)
+{
+    return *p;
+}
+
+#define _mm_loadu_si128 _mm_load_si128
+#define _mm_lddqu_si128 _mm_load_si128
+
+__MM_INLINE __m128i _mm_loadl_epi64(const __m128i *p)
+{
+    return _mm_set_epi64x(0, *(const long long *)p);
+}
+
+__MM_INLINE __m128i _mm_loadu_si64(const void *p)
+{
+    return _mm_set_epi64x(0, *(const long long *)p);
+}
+
+__MM_INLINE __m128i _mm_loadu_si32(const void *p)
+{
+    return _mm_set_epi32(0, 0, 0, *(const int *)p);
+}
+
+__MM_INLINE void _mm_store_si128(__m128i *p, __m128i a)
+{
+    *p = a;
+}
+
+#define _mm_storeu_si128 _mm_store_si128
+#define _mm_stream_si128 _mm_store_si128
+
+__MM_INLINE void _mm_storel_epi64(__m128i *p, __m128i a)
+{
+    *(long long *)p = a[0];
+}
+
+__MM_INLINE void _mm_storeu_si64(void *p, __m128i a)
+{
+    *(long long *)p = a[0];
+}
+
+__MM_INLINE void _mm_storeu_si32(void *p, __m128i a)
+{
+    *(int *)p = ((__v4si)a)[0];
+}
+
+__MM_INLINE void _mm_stream_si32(int *p, int a) { *p = a; }
+__MM_INLINE void _mm_stream_si64(long long *p, long long a) { *p = a; }
+
+__MM_INLINE void _mm_maskmoveu_si128(__m128i a, __m128i mask, char *p)
+{
+    __v16qi v = (__v16qi)a, m = (__v16qi)mask;
+    int i;
+    for (i = 0; i < 16; i++)
+        if (m[i] < 0)
+            p[i] = v[i];
+}
+
+__MM_INLINE __m128i _mm_cvtsi32_si128(int a) { return _mm_set_epi32(0, 0, 0, a); }
+__MM_INLINE __m128i _mm_cvtsi64_si128(long long a) { return _mm_set_epi64x(0, a); }
+__MM_INLINE int _mm_cvtsi128_si32(__m128i a) { return ((__v4si)a)[0]; }
+__MM_INLINE long long _mm_cvtsi128_si64(__m128i a) { return a[0]; }
+__MM_INLINE __m128i _mm_move_epi64(__m128i a) { a[1] = 0; return a; }
+
+#define _mm_cvtsi64x_si128 _mm_cvtsi64_si128
+#define _mm_cvtsi128_si64x _mm_cvtsi128_si64
+
+/* integer: arithmetic */
+
+__MM_INLINE __m128i _mm_add_epi8(__m128i a, __m128i b) { return (__m128i)((__v16qi)a + (__v16qi)b); }
+__MM_INLINE __m128i _mm_add_epi16(__m128i a, __m128i b) { return (__m128i)((__v8hi)a + (__v8hi)b); }
+__MM_INLINE __m128i _mm_add_epi32(__m128i a, __m128i b) { return (__m128i)((__v4si)a + (__v4si)b); }
+__MM_INLINE __m128i _mm_add_epi64(__m128i a, __m128i b) { return a + b; }
+__MM_INLINE __m128i _mm_sub_epi8(__m128i a, __m128i b) { return (__m128i)((__v16qi)a - (__v16qi)b); }
+__MM_INLINE __m128i _mm_sub_epi16(__m128i a, __m128i b) { return (__m128i)((__v8hi)a - (__v8hi)b); }
+__MM_INLINE __m128i _mm_sub_epi32(__m128i a, __m128i b) { return (__m128i)((__v4si)a - (__v4si)b); }
+__MM_INLINE __m128i _mm_sub_epi64(__m128i a, __m128i b) { return a - b; }
+__MM_INLINE __m128i _mm_mullo_epi16(__m128i a, __m128i b) { return (__m128i)((__v8hi)a * (__v8hi)b); }
+
+#define __MM_SATURATE(name, vt, n, wt, lo, hi, op) \
+__MM_INLINE __m128i name(__m128i a, __m128i b) \
+{ \
+    vt x = (vt)a, y = (vt)b; \
+    wt t; \
+    int i; \
+    for (i = 0; i < n; i++) { \
+        t = (wt)x[i] op (wt)y[i]; \
+        x[i] = t < lo ? lo : t > hi ? hi : t; \
+    } \
+    return (__m128i)x; \
+}
+__MM_SATURATE(_mm_adds_epi8, __v16qs, 16, int, -128, 127, +)
+__MM_SATURATE(_mm_adds_epi16, __v8hi, 8, int, -32768, 32767, +)
+__MM_SATURATE(_mm_adds_epu8, __v16qu, 16, int, 0, 255, +)
+__MM_SATURATE(_mm_adds_epu16, __v8hu, 8, int, 0, 65535, +)
+__MM_SATURATE(_mm_subs_epi8, __v16qs, 16, int, -128, 127, -)
+__MM_SATURATE(_mm_subs_epi16, __v8hi, 8, int, -32768, 32767, -)
+__MM_SATURATE(_mm_subs_epu8, __v16qu, 16, int, 0, 255, -)
+__MM_SATURATE(_mm_subs_epu16, __v8hu, 8, int, 0, 65535, -)
+
+#define __MM_ELEMENTWISE(name, vt, n, expr) \
+__MM_INLINE __m128i name(__m128i a, __m128i b) \
+{ \
+    vt x = (vt)a, y = (vt)b; \
+    int i; \
+    for (i = 0; i < n; i++) \
+        x[i] = (expr); \
+    return (__m128i)x; \
+}
+__MM_ELEMENTWISE(_mm_mulhi_epi16, __v8hi, 8, ((int)x[i] * y[i]) >> 16)
+__MM_ELEMENTWISE(_mm_mulhi_epu16, __v8hu, 8, ((unsigned)x[i] * y[i]) >> 16)
+__MM_ELEMENTWISE(_mm_avg_epu8, __v16qu, 16, (x[i] + y[i] + 1) >> 1)
+__MM_ELEMENTWISE(_mm_avg_epu16, __v8hu, 8, (x[i] + y[i] + 1) >> 1)
+__MM_ELEMENTWISE(_mm_min_epu8, __v16qu, 16, x[i] < y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_max_epu8, __v16qu, 16, x[i] > y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_min_epi16, __v8hi, 8, x[i] < y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_max_epi16, __v8hi, 8, x[i] > y[i] ? x[i] : y[i])
+
+__MM_INLINE __m128i _mm_mul_epu32(__m128i a, __m128i b)
+{
+    __v4su x = (__v4su)a, y = (__v4su)b;
+    __v2du r = { (unsigned long long)x[0] * y[0],
+                 (unsigned long long)x[2] * y[2] };
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_madd_epi16(__m128i a, __m128i b)
+{
+    __v8hi x = (__v8hi)a, y = (__v8hi)b;
+    __v4si r;
+    int i;
+    for (i = 0; i < 4; i++)
+        r[i] = x[2*i] * y[2*i] + x[2*i+1] * y[2*i+1];
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_sad_epu8(__m128i a, __m128i b)
+{
+    __v16qu x = (__v16qu)a, y = (__v16qu)b;
+    __v2di r = { 0 };
+    int i;
+    for (i = 0; i < 16; i++)
+        r[i >> 3] += x[i] > y[i] ? x[i] - y[i] : y[i] - x[i];
+    return (__m128i)r;
+}
+
+/* integer: logic */
+
+__MM_INLINE __m128i _mm_and_si128(__m128i a, __m128i b) { return a & b; }
+__MM_INLINE __m128i _mm_andnot_si128(__m128i a, __m128i b) { return ~a & b; }
+__MM_INLINE __m128i _mm_or_si128(__m128i a, __m128i b) { return a | b; }
+__MM_INLINE __m128i _mm_xor_si128(__m128i a, __m128i b) { return a ^ b; }
+
+/* integer: comparisons */
+
+__MM_INLINE __m128i _mm_cmpeq_epi8(__m128i a, __m128i b) { return (__m128i)((__v16qs)a == (__v16qs)b); }
+__MM_INLINE __m128i _mm_cmpeq_epi16(__m128i a, __m128i b) { return (__m128i)((__v8hi)a == (__v8hi)b); }
+__MM_INLINE __m128i _mm_cmpeq_epi32(__m128i a, __m128i b) { return (__m128i)((__v4si)a == (__v4si)b); }
+__MM_INLINE __m128i _mm_cmpgt_epi8(__m128i a, __m128i b) { return (__m128i)((__v16qs)a > (__v16qs)b); }
+__MM_INLINE __m128i _mm_cmpgt_epi16(__m128i a, __m128i b) { return (__m128i)((__v8hi)a > (__v8hi)b); }
+__MM_INLINE __m128i _mm_cmpgt_epi32(__m128i a, __m128i b) { return (__m128i)((__v4si)a > (__v4si)b); }
+__MM_INLINE __m128i _mm_cmplt_epi8(__m128i a, __m128i b) { return (__m128i)((__v16qs)a < (__v16qs)b); }
+__MM_INLINE __m128i _mm_cmplt_epi16(__m128i a, __m128i b) { return (__m128i)((__v8hi)a < (__v8hi)b); }
+__MM_INLINE __m128i _mm_cmplt_epi32(__m128i a, __m128i b) { return (__m128i)((__v4si)a < (__v4si)b); }
+
+/* integer: shifts */
+
+#define __MM_SHIFT(name, vt, n, bits, op, fill) \
+__MM_INLINE __m128i name##i_##vt(__m128i a, int count) \
+{ \
+    vt x = (vt)a; \
+    int i; \
+    if ((unsigned)count >= bits) \
+        return (__m128i)((x op (bits - 1)) op fill); \
+    return (__m128i)(x op count); \
+} \
+__MM_INLINE __m128i name##_##vt(__m128i a, __m128i count) \
+{ \
+    return name##i_##vt(a, \
+        (unsigned long long)count[0] > bits ? bits : (int)count[0]); \
+}
+__MM_SHIFT(_mm_sll, __v8hu, 8, 16, <<, 1)
+__MM_SHIFT(_mm_sll, __v4su, 4, 32, <<, 1)
+__MM_SHIFT(_mm_sll, __v2du, 2, 64, <<, 1)
+__MM_SHIFT(_mm_srl, __v8hu, 8, 16, >>, 1)
+__MM_SHIFT(_mm_srl, __v4su, 4, 32, >>, 1)
+__MM_SHIFT(_mm_srl, __v2du, 2, 64, >>, 1)
+__MM_SHIFT(_mm_sra, __v8hi, 8, 16, >>, 0)
+__MM_SHIFT(_mm_sra, __v4si, 4, 32, >>, 0)
+
+#define _mm_slli_epi16 _mm_slli___v8hu
+#define _mm_slli_epi32 _mm_slli___v4su
+#define _mm_slli_epi64 _mm_slli___v2du
+#define _mm_srli_epi16 _mm_srli___v8hu
+#define _mm_srli_epi32 _mm_srli___v4su
+#define _mm_srli_epi64 _mm_srli___v2du
+#define _mm_srai_epi16 _mm_srai___v8hi
+#define _mm_srai_epi32 _mm_srai___v4si
+#define _mm_sll_epi16 _mm_sll___v8hu
+#define _mm_sll_epi32 _mm_sll___v4su
+#define _mm_sll_epi64 _mm_sll___v2du
+#define _mm_srl_epi16 _mm_srl___v8hu
+#define _mm_srl_epi32 _mm_srl___v4su
+#define _mm_srl_epi64 _mm_srl___v2du
+#define _mm_sra_epi16 _mm_sra___v8hi
+#define _mm_sra_epi32 _mm_sra___v4si
+
+__MM_INLINE __m128i _mm_slli_si128(__m128i a, int imm)
+{
+    __v16qu x = (__v16qu)a, r = { 0 };
+    int i;
+    for (i = imm & 0xff; i < 16; i++)
+        r[i] = x[i - imm];
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_srli_si128(__m128i a, int imm)
+{
+    __v16qu x = (__v16qu)a, r = { 0 };
+    int i;
+    for (i = 0; i + (imm & 0xff) < 16; i++)
+        r[i] = x[i + imm];
+    return (__m128i)r;
+}
+
+#define _mm_bslli_si128 _mm_slli_si128
+#define _mm_bsrli_si128 _mm_srli_si128
+
+/* integer: pack, unpack and shuffle */
+
+#define __MM_PACK(name, vt, n, rt, lo, hi) \
+__MM_INLINE __m128i name(__m128i a, __m128i b) \
+{ \
+    vt x = (vt)a, y = (vt)b; \
+    rt r; \
+    int i, t; \
+    for (i = 0; i < 2 * n; i++) { \
+        t = i < n ? x[i] : y[i - n]; \
+        r[i] = t < lo ? lo : t > hi ? hi : t; \
+    } \
+    return (__m128i)r; \
+}
+__MM_PACK(_mm_packs_epi16, __v8hi, 8, __v16qs, -128, 127)
+__MM_PACK(_mm_packus_epi16, __v8hi, 8, __v16qu, 0, 255)
+__MM_PACK(_mm_packs_epi32, __v4si, 4, __v8hi, -32768, 32767)
+
+#define __MM_UNPACK(name, vt, n, base) \
+__MM_INLINE __m128i name(__m128i a, __m128i b) \
+{ \
+    vt x = (vt)a, y = (vt)b, r; \
+    int i; \
+    for (i = 0; i < n / 2; i++) { \
+        r[2 * i] = x[base + i]; \
+        r[2 * i + 1] = y[base + i]; \
+    } \
+    return (__m128i)r; \
+}
+__MM_UNPACK(_mm_unpacklo_epi8, __v16qi, 16, 0)
+__MM_UNPACK(_mm_unpackhi_epi8, __v16qi, 16, 8)
+__MM_UNPACK(_mm_unpacklo_epi16, __v8hi, 8, 0)
+__MM_UNPACK(_mm_unpackhi_epi16, __v8hi, 8, 4)
+__MM_UNPACK(_mm_unpacklo_epi32, __v4si, 4, 0)
+__MM_UNPACK(_mm_unpackhi_epi32, __v4si, 4, 2)
+__MM_UNPACK(_mm_unpacklo_epi64, __v2di, 2, 0)
+__MM_UNPACK(_mm_unpackhi_epi64, __v2di, 2, 1)
+
+__MM_INLINE __m128i _mm_shuffle_epi32(__m128i a, int imm)
+{
+    __v4si x = (__v4si)a, r;
+    r[0] = x[imm & 3];
+    r[1] = x[(imm >> 2) & 3];
+    r[2] = x[(imm >> 4) & 3];
+    r[3] = x[(imm >> 6) & 3];
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_shufflelo_epi16(__m128i a, int imm)
+{
+    __v8hi x = (__v8hi)a, r = x;
+    r[0] = x[imm & 3];
+    r[1] = x[(imm >> 2) & 3];
+    r[2] = x[(imm >> 4) & 3];
+    r[3] = x[(imm >> 6) & 3];
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_shufflehi_epi16(__m128i a, int imm)
+{
+    __v8hi x = (__v8hi)a, r = x;
+    r[4] = x[4 + (imm & 3)];
+    r[5] = x[4 + ((imm >> 2) & 3)];
+    r[6] = x[4 + ((imm >> 4) & 3)];
+    r[7] = x[4 + ((imm >> 6) & 3)];
+    return (__m128i)r;
+}
+
+__MM_INLINE int _mm_extract_epi16(__m128i a, int imm)
+{
+    return ((__v8hu)a)[imm & 7];
+}
+
+__MM_INLINE __m128i _mm_insert_epi16(__m128i a, int b, int imm)
+{
+    __v8hi x = (__v8hi)a;
+    x[imm & 7] = b;
+    return (__m128i)x;
+}
+
+__MM_INLINE int _mm_movemask_epi8(__m128i a)
+{
+    __v16qs x = (__v16qs)a;
+    int i, r = 0;
+    for (i = 0; i < 16; i++)
+        r |= (x[i] < 0) << i;
+    return r;
+}
+
+/* cache and memory ordering */
+
+__MM_INLINE void _mm_clflush(const void *p)
+{
+    __asm__ __volatile__("clflush %0" : : "m"(*(const char *)p));
+}
+
+__MM_INLINE void _mm_lfence(void)
+{
+    __asm__ __volatile__("lfence" : : : "memory");
+}
+
+__MM_INLINE void _mm_mfence(void)
+{
+    __asm__ __volatile__("mfence" : : : "memory");
+}
+
+__MM_INLINE void _mm_pause(void)
+{
+    __asm__ __volatile__("pause");
+}
+
+#endif /* _EMMINTRIN_H_INCLUDED */
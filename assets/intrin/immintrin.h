@@ -0,0 +1,1002 @@
+/*
+ * CJIT x86 intrinsics: AVX, AVX2 and FMA <immintrin.h>
+ *
+ * 256 bit vectors are lowered as pairs of 128 bit SSE2 operations, so
+ * code using these intrinsics runs on any x86-64 CPU. FMA intrinsics
+ * round twice, like separate multiply and add instructions.
+ */
+
+#ifndef _IMMINTRIN_H_INCLUDED
+#define _IMMINTRIN_H_INCLUDED
+
+#include <nmmintrin.h>
+
+typedef float __m256 __MM_VECTOR(32);
+typedef double __m256d __MM_VECTOR(32);
+typedef long long __m256i __MM_VECTOR(32);
+typedef float __m256_u __MM_VECTOR(32);
+typedef double __m256d_u __MM_VECTOR(32);
+typedef long long __m256i_u __MM_VECTOR(32);
+
+typedef float __v8sf __MM_VECTOR(32);
+typedef double __v4df __MM_VECTOR(32);
+typedef long long __v4di __MM_VECTOR(32);
+typedef unsigned long long __v4du __MM_VECTOR(32);
+typedef int __v8si __MM_VECTOR(32);
+typedef unsigned int __v8su __MM_VECTOR(32);
+typedef short __v16hi __MM_VECTOR(32);
+typedef unsigned short __v16hu __MM_VECTOR(32);
+typedef char __v32qi __MM_VECTOR(32);
+typedef signed char __v32qs __MM_VECTOR(32);
+typedef unsigned char __v32qu __MM_VECTOR(32);
+
+/* 128 bit halves of a 256 bit lvalue */
+#define __MM256_HALF(t, v, i) (((t *)&(v))[i])
+
+#define __MM256_BINARY(name, t256, t128, f128) \
+__MM_INLINE t256 name(t256 a, t256 b) \
+{ \
+    t256 r; \
+    __MM256_HALF(t128, r, 0) = f128(__MM256_HALF(t128, a, 0), __MM256_HALF(t128, b, 0)); \
+    __MM256_HALF(t128, r, 1) = f128(__MM256_HALF(t128, a, 1), __MM256_HALF(t128, b, 1)); \
+    return r; \
+}
+
+#define __MM256_UNARY(name, t256, t128, f128) \
+__MM_INLINE t256 name(t256 a) \
+{ \
+    t256 r; \
+    __MM256_HALF(t128, r, 0) = f128(__MM256_HALF(t128, a, 0)); \
+    __MM256_HALF(t128, r, 1) = f128(__MM256_HALF(t128, a, 1)); \
+    return r; \
+}
+
+#define __MM256_IMM(name, t256, t128, f128) \
+__MM_INLINE t256 name(t256 a, int imm) \
+{ \
+    t256 r; \
+    __MM256_HALF(t128, r, 0) = f128(__MM256_HALF(t128, a, 0), imm); \
+    __MM256_HALF(t128, r, 1) = f128(__MM256_HALF(t128, a, 1), imm); \
+    return r; \
+}
+
+#define __MM256_BINARY_IMM(name, t256, t128, f128) \
+__MM_INLINE t256 name(t256 a, t256 b, int imm) \
+{ \
+    t256 r; \
+    __MM256_HALF(t128, r, 0) = f128(__MM256_HALF(t128, a, 0), __MM256_HALF(t128, b, 0), imm); \
+    __MM256_HALF(t128, r, 1) = f128(__MM256_HALF(t128, a, 1), __MM256_HALF(t128, b, 1), imm); \
+    return r; \
+}
+
+/* comparison predicates */
+
+#define _CMP_EQ_OQ    0x00
+#define _CMP_LT_OS    0x01
+#define _CMP_LE_OS    0x02
+#define _CMP_UNORD_Q  0x03
+#define _CMP_NEQ_UQ   0x04
+#define _CMP_NLT_US   0x05
+#define _CMP_NLE_US   0x06
+#define _CMP_ORD_Q    0x07
+#define _CMP_EQ_UQ    0x08
+#define _CMP_NGE_US   0x09
+#define _CMP_NGT_US   0x0a
+#define _CMP_FALSE_OQ 0x0b
+#define _CMP_NEQ_OQ   0x0c
+#define _CMP_GE_OS    0x0d
+#define _CMP_GT_OS    0x0e
+#define _CMP_TRUE_UQ  0x0f
+#define _CMP_EQ_OS    0x10
+#define _CMP_LT_OQ    0x11
+#define _CMP_LE_OQ    0x12
+#define _CMP_UNORD_S  0x13
+#define _CMP_NEQ_US   0x14
+#define _CMP_NLT_UQ   0x15
+#define _CMP_NLE_UQ   0x16
+#define _CMP_ORD_S    0x17
+#define _CMP_EQ_US    0x18
+#define _CMP_NGE_UQ   0x19
+#define _CMP_NGT_UQ   0x1a
+#define _CMP_FALSE_OS 0x1b
+#define _CMP_NEQ_OS   0x1c
+#define _CMP_GE_OQ    0x1d
+#define _CMP_GT_OQ    0x1e
+#define _CMP_TRUE_US  0x1f
+
+/* signaling and quiet predicates only differ in exceptions */
+__MM_INLINE int __mm_cmp(double a, double b, int p)
+{
+    int unord = a != a || b != b;
+    switch (p & 15) {
+    case _CMP_EQ_OQ: return a == b;
+    case _CMP_LT_OS: return a < b;
+    case _CMP_LE_OS: return a <= b;
+    case _CMP_UNORD_Q: return unord;
+    case _CMP_NEQ_UQ: return a != b;
+    case _CMP_NLT_US: return !(a < b);
+    case _CMP_NLE_US: return !(a <= b);
+    case _CMP_ORD_Q: return !unord;
+    case _CMP_EQ_UQ: return unord || a == b;
+    case _CMP_NGE_US: return !(a >= b);
+    case _CMP_NGT_US: return !(a > b);
+    case _CMP_FALSE_OQ: return 0;
+    case _CMP_NEQ_OQ: return !unord && a != b;
+    case _CMP_GE_OS: return a >= b;
+    case _CMP_GT_OS: return a > b;
+    default: return 1;
+    }
+}
+
+__MM_INLINE __m128 _mm_cmp_ps(__m128 a, __m128 b, int p)
+{
+    __v4si r;
+    int i;
+    for (i = 0; i < 4; i++)
+        r[i] = -__mm_cmp(a[i], b[i], p);
+    return (__m128)r;
+}
+
+__MM_INLINE __m128d _mm_cmp_pd(__m128d a, __m128d b, int p)
+{
+    __v2di r = { -__mm_cmp(a[0], b[0], p), -__mm_cmp(a[1], b[1], p) };
+    return (__m128d)r;
+}
+
+__MM_INLINE __m128 _mm_cmp_ss(__m128 a, __m128 b, int p)
+{
+    return _mm_move_ss(a, _mm_cmp_ps(a, b, p));
+}
+
+__MM_INLINE __m128d _mm_cmp_sd(__m128d a, __m128d b, int p)
+{
+    return _mm_move_sd(a, _mm_cmp_pd(a, b, p));
+}
+
+__MM256_BINARY_IMM(_mm256_cmp_ps, __m256, __m128, _mm_cmp_ps)
+__MM256_BINARY_IMM(_mm256_cmp_pd, __m256d, __m128d, _mm_cmp_pd)
+
+/* AVX: casts */
+
+__MM_INLINE __m256 _mm256_castpd_ps(__m256d a) { return (__m256)a; }
+__MM_INLINE __m256i _mm256_castpd_si256(__m256d a) { return (__m256i)a; }
+__MM_INLINE __m256d _mm256_castps_pd(__m256 a) { return (__m256d)a; }
+__MM_INLINE __m256i _mm256_castps_si256(__m256 a) { return (__m256i)a; }
+__MM_INLINE __m256 _mm256_castsi256_ps(__m256i a) { return (__m256)a; }
+__MM_INLINE __m256d _mm256_castsi256_pd(__m256i a) { return (__m256d)a; }
+
+__MM_INLINE __m128 _mm256_castps256_ps128(__m256 a) { return __MM256_HALF(__m128, a, 0); }
+__MM_INLINE __m128d _mm256_castpd256_pd128(__m256d a) { return __MM256_HALF(__m128d, a, 0); }
+__MM_INLINE __m128i _mm256_castsi256_si128(__m256i a) { return __MM256_HALF(__m128i, a, 0); }
+
+__MM_INLINE __m256 _mm256_castps128_ps256(__m128 a)
+{
+    __m256 r = { 0 };
+    __MM256_HALF(__m128, r, 0) = a;
+    return r;
+}
+
+__MM_INLINE __m256d _mm256_castpd128_pd256(__m128d a)
+{
+    __m256d r = { 0 };
+    __MM256_HALF(__m128d, r, 0) = a;
+    return r;
+}
+
+__MM_INLINE __m256i _mm256_castsi128_si256(__m128i a)
+{
+    __m256i r = { 0 };
+    __MM256_HALF(__m128i, r, 0) = a;
+    return r;
+}
+
+#define _mm256_zextps128_ps256 _mm256_castps128_ps256
+#define _mm256_zextpd128_pd256 _mm256_castpd128_pd256
+#define _mm256_zextsi128_si256 _mm256_castsi128_si256
+
+/* AVX: set, load and store */
+
+__MM_INLINE __m256 _mm256_setzero_ps(void) { __m256 r = { 0 }; return r; }
+__MM_INLINE __m256d _mm256_setzero_pd(void) { __m256d r = { 0 }; return r; }
+__MM_INLINE __m256i _mm256_setzero_si256(void) { __m256i r = { 0 }; return r; }
+
+__MM_INLINE __m256 _mm256_set_ps(float e7, float e6, float e5, float e4,
+                                 float e3, float e2, float e1, float e0)
+{
+    __m256 r = { e0, e1, e2, e3, e4, e5, e6, e7 };
+    return r;
+}
+
+__MM_INLINE __m256 _mm256_setr_ps(float e0, float e1, float e2, float e3,
+                                  float e4, float e5, float e6, float e7)
+{
+    __m256 r = { e0, e1, e2, e3, e4, e5, e6, e7 };
+    return r;
+}
+
+__MM_INLINE __m256d _mm256_set_pd(double e3, double e2, double e1, double e0)
+{
+    __m256d r = { e0, e1, e2, e3 };
+    return r;
+}
+
+__MM_INLINE __m256d _mm256_setr_pd(double e0, double e1, double e2, double e3)
+{
+    __m256d r = { e0, e1, e2, e3 };
+    return r;
+}
+
+__MM_INLINE __m256i _mm256_set_epi32(int e7, int e6, int e5, int e4,
+                                     int e3, int e2, int e1, int e0)
+{
+    __v8si r = { e0, e1, e2, e3, e4, e5, e6, e7 };
+    return (__m256i)r;
+}
+
+__MM_INLINE __m256i _mm256_setr_epi32(int e0, int e1, int e2, int e3,
+                                      int e4, int e5, int e6, int e7)
+{
+    __v8si r = { e0, e1, e2, e3, e4, e5, e6, e7 };
+    return (__m256i)r;
+}
+
+__MM_INLINE __m256i _mm256_set_epi64x(long long e3, long long e2,
+                                      long long e1, long long e0)
+{
+    __m256i r = { e0, e1, e2, e3 };
+    return r;
+}
+
+__MM_INLINE __m256i _mm256_setr_epi64x(long long e0, long long e1,
+                                       long long e2, long long e3)
+{
+    __m256i r = { e0, e1, e2, e3 };
+    return r;
+}
+
+__MM_INLINE __m256 _mm256_set1_ps(float a) { return _mm256_set_ps(a, a, a, a, a, a, a, a); }
+__MM_INLINE __m256d _mm256_set1_pd(double a) { return _mm256_set_pd(a, a, a, a); }
+__MM_INLINE __m256i _mm256_set1_epi32(int a) { return _mm256_set_epi32(a, a, a, a, a, a, a, a); }
+__MM_INLINE __m256i _mm256_set1_epi64x(long long a) { return _mm256_set_epi64x(a, a, a, a); }
+
+__MM_INLINE __m256i _mm256_set_m128i(__m128i hi, __m128i lo)
+{
+    __m256i r;
+    __MM256_HALF(__m128i, r, 0) = lo;
+    __MM256_HALF(__m128i, r, 1) = hi;
+    return r;
+}
+
+__MM_INLINE __m256i _mm256_set1_epi16(short a)
+{
+    __m128i h = _mm_set1_epi16(a);
+    return _mm256_set_m128i(h, h);
+}
+
+__MM_INLINE __m256i _mm256_set1_epi8(char a)
+{
+    __m128i h = _mm_set1_epi8(a);
+    return _mm256_set_m128i(h, h);
+}
+
+__MM_INLINE __m256 _mm256_set_m128(__m128 hi, __m128 lo)
+{
+    return (__m256)_mm256_set_m128i((__m128i)hi, (__m128i)lo);
+}
+
+__MM_INLINE __m256d _mm256_set_m128d(__m128d hi, __m128d lo)
+{
+    return (__m256d)_mm256_set_m128i((__m128i)hi, (__m128i)lo);
+}
+
+#define _mm256_setr_m128(lo, hi) _mm256_set_m128((hi), (lo))
+#define _mm256_setr_m128d(lo, hi) _mm256_set_m128d((hi), (lo))
+#define _mm256_setr_m128i(lo, hi) _mm256_set_m128i((hi), (lo))
+
+__MM_INLINE __m256 _mm256_load_ps(const float *p) { return *(const __m256 *)p; }
+__MM_INLINE __m256d _mm256_load_pd(const double *p) { return *(const __m256d *)p; }
+__MM_INLINE __m256i _mm256_load_si256(const __m256i *p) { return *p; }
+__MM_INLINE void _mm256_store_ps(float *p, __m256 a) { *(__m256 *)p = a; }
+__MM_INLINE void _mm256_store_pd(double *p, __m256d a) { *(__m256d *)p = a; }
+__MM_INLINE void _mm256_store_si256(__m256i *p, __m256i a) { *p = a; }
+
+#define _mm256_loadu_ps _mm256_load_ps
+#define _mm256_loadu_pd _mm256_load_pd
+#define _mm256_loadu_si256 _mm256_load_si256
+#define _mm256_lddqu_si256 _mm256_load_si256
+#define _mm256_stream_load_si256 _mm256_load_si256
+#define _mm256_storeu_ps _mm256_store_ps
+#define _mm256_storeu_pd _mm256_store_pd
+#define _mm256_storeu_si256 _mm256_store_si256
+#define _mm256_stream_ps _mm256_store_ps
+#define _mm256_stream_pd _mm256_store_pd
+#define _mm256_stream_si256 _mm256_store_si256
+
+__MM_INLINE __m256 _mm256_loadu2_m128(const float *hi, const float *lo)
+{
+    return _mm256_set_m128(_mm_loadu_ps(hi), _mm_loadu_ps(lo));
+}
+
+__MM_INLINE void _mm256_storeu2_m128(float *hi, float *lo, __m256 a)
+{
+    _mm_storeu_ps(lo, __MM256_HALF(__m128, a, 0));
+    _mm_storeu_ps(hi, __MM256_HALF(__m128, a, 1));
+}
+
+__MM_INLINE __m128 _mm_broadcast_ss(const float *p) { return _mm_set1_ps(*p); }
+__MM_INLINE __m256 _mm256_broadcast_ss(const float *p) { return _mm256_set1_ps(*p); }
+__MM_INLINE __m256d _mm256_broadcast_sd(const double *p) { return _mm256_set1_pd(*p); }
+
+__MM_INLINE __m256 _mm256_broadcast_ps(const __m128 *p)
+{
+    return _mm256_set_m128(*p, *p);
+}
+
+__MM_INLINE __m256d _mm256_broadcast_pd(const __m128d *p)
+{
+    return _mm256_set_m128d(*p, *p);
+}
+
+#define __MM_MASKLOAD(name, vt, mt, et, n) \
+__MM_INLINE vt name(const et *p, mt mask) \
+{ \
+    vt r = { 0 }; \
+    int i; \
+    for (i = 0; i < n; i++) \
+        if (mask[i] < 0) \
+            r[i] = p[i]; \
+    return r; \
+}
+__MM_MASKLOAD(__mm_maskload_ps, __m128, __v4si, float, 4)
+__MM_MASKLOAD(__mm_maskload_pd, __m128d, __v2di, double, 2)
+__MM_MASKLOAD(__mm256_maskload_ps, __m256, __v8si, float, 8)
+__MM_MASKLOAD(__mm256_maskload_pd, __m256d, __v4di, double, 4)
+__MM_MASKLOAD(__mm_maskload_epi32, __v4si, __v4si, int, 4)
+__MM_MASKLOAD(__mm_maskload_epi64, __v2di, __v2di, long long, 2)
+__MM_MASKLOAD(__mm256_maskload_epi32, __v8si, __v8si, int, 8)
+__MM_MASKLOAD(__mm256_maskload_epi64, __v4di, __v4di, long long, 4)
+
+#define _mm_maskload_ps(p, m) __mm_maskload_ps((p), (__v4si)(m))
+#define _mm_maskload_pd(p, m) __mm_maskload_pd((p), (__v2di)(m))
+#define _mm256_maskload_ps(p, m) __mm256_maskload_ps((p), (__v8si)(m))
+#define _mm256_maskload_pd(p, m) __mm256_maskload_pd((p), (__v4di)(m))
+#define _mm_maskload_epi32(p, m) \
+    ((__m128i)__mm_maskload_epi32((const int *)(p), (__v4si)(m)))
+#define _mm_maskload_epi64(p, m) \
+    ((__m128i)__mm_maskload_epi64((const long long *)(p), (__v2di)(m)))
+#define _mm256_maskload_epi32(p, m) \
+    ((__m256i)__mm256_maskload_epi32((const int *)(p), (__v8si)(m)))
+#define _mm256_maskload_epi64(p, m) \
+    ((__m256i)__mm256_maskload_epi64((const long long *)(p), (__v4di)(m)))
+
+#define __MM_MASKSTORE(name, vt, mt, et, n) \
+__MM_INLINE void name(et *p, mt mask, vt a) \
+{ \
+    int i; \
+    for (i = 0; i < n; i++) \
+        if (mask[i] < 0) \
+            p[i] = a[i]; \
+}
+__MM_MASKSTORE(__mm_maskstore_ps, __m128, __v4si, float, 4)
+__MM_MASKSTORE(__mm_maskstore_pd, __m128d, __v2di, double, 2)
+__MM_MASKSTORE(__mm256_maskstore_ps, __m256, __v8si, float, 8)
+__MM_MASKSTORE(__mm256_maskstore_pd, __m256d, __v4di, double, 4)
+__MM_MASKSTORE(__mm_maskstore_epi32, __v4si, __v4si, int, 4)
+__MM_MASKSTORE(__mm_maskstore_epi64, __v2di, __v2di, long long, 2)
+__MM_MASKSTORE(__mm256_maskstore_epi32, __v8si, __v8si, int, 8)
+__MM_MASKSTORE(__mm256_maskstore_epi64, __v4di, __v4di, long long, 4)
+
+#define _mm_maskstore_ps(p, m, a) __mm_maskstore_ps((p), (__v4si)(m), (a))
+#define _mm_maskstore_pd(p, m, a) __mm_maskstore_pd((p), (__v2di)(m), (a))
+#define _mm256_maskstore_ps(p, m, a) __mm256_maskstore_ps((p), (__v8si)(m), (a))
+#define _mm256_maskstore_pd(p, m, a) __mm256_maskstore_pd((p), (__v4di)(m), (a))
+#define _mm_maskstore_epi32(p, m, a) \
+    __mm_maskstore_epi32((int *)(p), (__v4si)(m), (__v4si)(a))
+#define _mm_maskstore_epi64(p, m, a) \
+    __mm_maskstore_epi64((long long *)(p), (__v2di)(m), (__v2di)(a))
+#define _mm256_maskstore_epi32(p, m, a) \
+    __mm256_maskstore_epi32((int *)(p), (__v8si)(m), (__v8si)(a))
+#define _mm256_maskstore_epi64(p, m, a) \
+    __mm256_maskstore_epi64((long long *)(p), (__v4di)(m), (__v4di)(a))
+
+__MM_INLINE float _mm256_cvtss_f32(__m256 a) { return a[0]; }
+__MM_INLINE double _mm256_cvtsd_f64(__m256d a) { return a[0]; }
+__MM_INLINE int _mm256_cvtsi256_si32(__m256i a) { return ((__v8si)a)[0]; }
+
+/* AVX: arithmetic and logic */
+
+__MM_INLINE __m256 _mm256_add_ps(__m256 a, __m256 b) { return a + b; }
+__MM_INLINE __m256 _mm256_sub_ps(__m256 a, __m256 b) { return a - b; }
+__MM_INLINE __m256 _mm256_mul_ps(__m256 a, __m256 b) { return a * b; }
+__MM_INLINE __m256 _mm256_div_ps(__m256 a, __m256 b) { return a / b; }
+__MM_INLINE __m256d _mm256_add_pd(__m256d a, __m256d b) { return a + b; }
+__MM_INLINE __m256d _mm256_sub_pd(__m256d a, __m256d b) { return a - b; }
+__MM_INLINE __m256d _mm256_mul_pd(__m256d a, __m256d b) { return a * b; }
+__MM_INLINE __m256d _mm256_div_pd(__m256d a, __m256d b) { return a / b; }
+
+__MM256_BINARY(_mm256_min_ps, __m256, __m128, _mm_min_ps)
+__MM256_BINARY(_mm256_max_ps, __m256, __m128, _mm_max_ps)
+__MM256_BINARY(_mm256_min_pd, __m256d, __m128d, _mm_min_pd)
+__MM256_BINARY(_mm256_max_pd, __m256d, __m128d, _mm_max_pd)
+__MM256_BINARY(_mm256_addsub_ps, __m256, __m128, _mm_addsub_ps)
+__MM256_BINARY(_mm256_addsub_pd, __m256d, __m128d, _mm_addsub_pd)
+__MM256_BINARY(_mm256_hadd_ps, __m256, __m128, _mm_hadd_ps)
+__MM256_BINARY(_mm256_hadd_pd, __m256d, __m128d, _mm_hadd_pd)
+__MM256_BINARY(_mm256_hsub_ps, __m256, __m128, _mm_hsub_ps)
+__MM256_BINARY(_mm256_hsub_pd, __m256d, __m128d, _mm_hsub_pd)
+__MM256_UNARY(_mm256_sqrt_ps, __m256, __m128, _mm_sqrt_ps)
+__MM256_UNARY(_mm256_sqrt_pd, __m256d, __m128d, _mm_sqrt_pd)
+__MM256_UNARY(_mm256_rcp_ps, __m256, __m128, _mm_rcp_ps)
+__MM256_UNARY(_mm256_rsqrt_ps, __m256, __m128, _mm_rsqrt_ps)
+__MM256_UNARY(_mm256_movehdup_ps, __m256, __m128, _mm_movehdup_ps)
+__MM256_UNARY(_mm256_moveldup_ps, __m256, __m128, _mm_moveldup_ps)
+__MM256_UNARY(_mm256_movedup_pd, __m256d, __m128d, _mm_movedup_pd)
+__MM256_IMM(_mm256_round_ps, __m256, __m128, _mm_round_ps)
+__MM256_IMM(_mm256_round_pd, __m256d, __m128d, _mm_round_pd)
+__MM256_BINARY_IMM(_mm256_dp_ps, __m256, __m128, _mm_dp_ps)
+
+#define _mm256_ceil_ps(a) _mm256_round_ps((a), _MM_FROUND_CEIL)
+#define _mm256_ceil_pd(a) _mm256_round_pd((a), _MM_FROUND_CEIL)
+#define _mm256_floor_ps(a) _mm256_round_ps((a), _MM_FROUND_FLOOR)
+#define _mm256_floor_pd(a) _mm256_round_pd((a), _MM_FROUND_FLOOR)
+
+__MM_INLINE __m256 _mm256_and_ps(__m256 a, __m256 b) { return (__m256)((__v8si)a & (__v8si)b); }
+__MM_INLINE __m256 _mm256_andnot_ps(__m256 a, __m256 b) { return (__m256)(~(__v8si)a & (__v8si)b); }
+__MM_INLINE __m256 _mm256_or_ps(__m256 a, __m256 b) { return (__m256)((__v8si)a | (__v8si)b); }
+__MM_INLINE __m256 _mm256_xor_ps(__m256 a, __m256 b) { return (__m256)((__v8si)a ^ (__v8si)b); }
+__MM_INLINE __m256d _mm256_and_pd(__m256d a, __m256d b) { return (__m256d)((__v4di)a & (__v4di)b); }
+__MM_INLINE __m256d _mm256_andnot_pd(__m256d a, __m256d b) { return (__m256d)(~(__v4di)a & (__v4di)b); }
+__MM_INLINE __m256d _mm256_or_pd(__m256d a, __m256d b) { return (__m256d)((__v4di)a | (__v4di)b); }
+__MM_INLINE __m256d _mm256_xor_pd(__m256d a, __m256d b) { return (__m256d)((__v4di)a ^ (__v4di)b); }
+
+/* FMA */
+
+__MM_INLINE __m128 _mm_fmadd_ps(__m128 a, __m128 b, __m128 c) { return a * b + c; }
+__MM_INLINE __m128 _mm_fmsub_ps(__m128 a, __m128 b, __m128 c) { return a * b - c; }
+__MM_INLINE __m128 _mm_fnmadd_ps(__m128 a, __m128 b, __m128 c) { return c - a * b; }
+__MM_INLINE __m128 _mm_fnmsub_ps(__m128 a, __m128 b, __m128 c) { return -(a * b) - c; }
+__MM_INLINE __m128d _mm_fmadd_pd(__m128d a, __m128d b, __m128d c) { return a * b + c; }
+__MM_INLINE __m128d _mm_fmsub_pd(__m128d a, __m128d b, __m128d c) { return a * b - c; }
+__MM_INLINE __m128d _mm_fnmadd_pd(__m128d a, __m128d b, __m128d c) { return c - a * b; }
+__MM_INLINE __m128d _mm_fnmsub_pd(__m128d a, __m128d b, __m128d c) { return -(a * b) - c; }
+__MM_INLINE __m256 _mm256_fmadd_ps(__m256 a, __m256 b, __m256 c) { return a * b + c; }
+__MM_INLINE __m256 _mm256_fmsub_ps(__m256 a, __m256 b, __m256 c) { return a * b - c; }
+__MM_INLINE __m256 _mm256_fnmadd_ps(__m256 a, __m256 b, __m256 c) { return c - a * b; }
+__MM_INLINE __m256 _mm256_fnmsub_ps(__m256 a, __m256 b, __m256 c) { return -(a * b) - c; }
+__MM_INLINE __m256d _mm256_fmadd_pd(__m256d a, __m256d b, __m256d c) { return a * b + c; }
+__MM_INLINE __m256d _mm256_fmsub_pd(__m256d a, __m256d b, __m256d c) { return a * b - c; }
+__MM_INLINE __m256d _mm256_fnmadd_pd(__m256d a, __m256d b, __m256d c) { return c - a * b; }
+__MM_INLINE __m256d _mm256_fnmsub_pd(__m256d a, __m256d b, __m256d c) { return -(a * b) - c; }
+
+/* AVX: blend, shuffle and permute */
+
+__MM_INLINE __m256 _mm256_blend_ps(__m256 a, __m256 b, int imm)
+{
+    int i;
+    for (i = 0; i < 8; i++)
+        if (imm & (1 << i))
+            a[i] = b[i];
+    return a;
+}
+
+__MM_INLINE __m256d _mm256_blend_pd(__m256d a, __m256d b, int imm)
+{
+    int i;
+    for (i = 0; i < 4; i++)
+        if (imm & (1 << i))
+            a[i] = b[i];
+    return a;
+}
+
+__MM_INLINE __m256 _mm256_blendv_ps(__m256 a, __m256 b, __m256 mask)
+{
+    __v8si m = (__v8si)mask >> 31;
+    return (__m256)(((__v8si)a & ~m) | ((__v8si)b & m));
+}
+
+__MM_INLINE __m256d _mm256_blendv_pd(__m256d a, __m256d b, __m256d mask)
+{
+    __v4di m = (__v4di)mask >> 63;
+    return (__m256d)(((__v4di)a & ~m) | ((__v4di)b & m));
+}
+
+__MM256_BINARY_IMM(_mm256_shuffle_ps, __m256, __m128, _mm_shuffle_ps)
+__MM256_BINARY(_mm256_unpacklo_ps, __m256, __m128, _mm_unpacklo_ps)
+__MM256_BINARY(_mm256_unpackhi_ps, __m256, __m128, _mm_unpackhi_ps)
+__MM256_BINARY(_mm256_unpacklo_pd, __m256d, __m128d, _mm_unpacklo_pd)
+__MM256_BINARY(_mm256_unpackhi_pd, __m256d, __m128d, _mm_unpackhi_pd)
+
+__MM_INLINE __m256d _mm256_shuffle_pd(__m256d a, __m256d b, int imm)
+{
+    return _mm256_setr_pd(a[imm & 1], b[(imm >> 1) & 1],
+                          a[2 + ((imm >> 2) & 1)], b[2 + ((imm >> 3) & 1)]);
+}
+
+__MM_INLINE __m128 _mm_permute_ps(__m128 a, int imm)
+{
+    return _mm_shuffle_ps(a, a, imm);
+}
+
+__MM_INLINE __m128d _mm_permute_pd(__m128d a, int imm)
+{
+    return _mm_setr_pd(a[imm & 1], a[(imm >> 1) & 1]);
+}
+
+__MM256_IMM(_mm256_permute_ps, __m256, __m128, _mm_permute_ps)
+
+__MM_INLINE __m256d _mm256_permute_pd(__m256d a, int imm)
+{
+    return _mm256_setr_pd(a[imm & 1], a[(imm >> 1) & 1],
+                          a[2 + ((imm >> 2) & 1)], a[2 + ((imm >> 3) & 1)]);
+}
+
+__MM_INLINE __m256i _mm256_permute2x128_si256(__m256i a, __m256i b, int imm)
+{
+    __m256i r;
+    int i, s;
+    for (i = 0; i < 2; i++, imm >>= 4) {
+        s = imm & 3;
+        if (imm & 8)
+            __MM256_HALF(__m128i, r, i) = _mm_setzero_si128();
+        else
+            __MM256_HALF(__m128i, r, i) = s < 2 ? __MM256_HALF(__m128i, a, s)
+                                                : __MM256_HALF(__m128i, b, s - 2);
+    }
+    return r;
+}
+
+#define _mm256_permute2f128_si256 _mm256_permute2x128_si256
+#define _mm256_permute2f128_ps(a, b, imm) \
+    ((__m256)_mm256_permute2x128_si256((__m256i)(a), (__m256i)(b), (imm)))
+#define _mm256_permute2f128_pd(a, b, imm) \
+    ((__m256d)_mm256_permute2x128_si256((__m256i)(a), (__m256i)(b), (imm)))
+
+__MM_INLINE __m128i _mm256_extractf128_si256(__m256i a, int imm)
+{
+    return __MM256_HALF(__m128i, a, imm & 1);
+}
+
+__MM_INLINE __m256i _mm256_insertf128_si256(__m256i a, __m128i b, int imm)
+{
+    __MM256_HALF(__m128i, a, imm & 1) = b;
+    return a;
+}
+
+#define _mm256_extracti128_si256 _mm256_extractf128_si256
+#define _mm256_inserti128_si256 _mm256_insertf128_si256
+#define _mm256_extractf128_ps(a, imm) \
+    ((__m128)_mm256_extractf128_si256((__m256i)(a), (imm)))
+#define _mm256_extractf128_pd(a, imm) \
+    ((__m128d)_mm256_extractf128_si256((__m256i)(a), (imm)))
+#define _mm256_insertf128_ps(a, b, imm) \
+    ((__m256)_mm256_insertf128_si256((__m256i)(a), (__m128i)(b), (imm)))
+#define _mm256_insertf128_pd(a, b, imm) \
+    ((__m256d)_mm256_insertf128_si256((__m256i)(a), (__m128i)(b), (imm)))
+
+__MM_INLINE int _mm256_movemask_ps(__m256 a)
+{
+    return _mm_movemask_ps(__MM256_HALF(__m128, a, 0))
+        | _mm_movemask_ps(__MM256_HALF(__m128, a, 1)) << 4;
+}
+
+__MM_INLINE int _mm256_movemask_pd(__m256d a)
+{
+    return _mm_movemask_pd(__MM256_HALF(__m128d, a, 0))
+        | _mm_movemask_pd(__MM256_HALF(__m128d, a, 1)) << 2;
+}
+
+/* AVX: conversions */
+
+#define __MM256_CONVERT(name, rt, rt128, at, at128, f128) \
+__MM_INLINE rt name(at a) \
+{ \
+    rt r; \
+    __MM256_HALF(rt128, r, 0) = f128(__MM256_HALF(at128, a, 0)); \
+    __MM256_HALF(rt128, r, 1) = f128(__MM256_HALF(at128, a, 1)); \
+    return r; \
+}
+__MM256_CONVERT(_mm256_cvtepi32_ps, __m256, __m128, __m256i, __m128i, _mm_cvtepi32_ps)
+__MM256_CONVERT(_mm256_cvtps_epi32, __m256i, __m128i, __m256, __m128, _mm_cvtps_epi32)
+__MM256_CONVERT(_mm256_cvttps_epi32, __m256i, __m128i, __m256, __m128, _mm_cvttps_epi32)
+
+__MM_INLINE __m256d _mm256_cvtepi32_pd(__m128i a)
+{
+    __v4si v = (__v4si)a;
+    return _mm256_setr_pd(v[0], v[1], v[2], v[3]);
+}
+
+__MM_INLINE __m256d _mm256_cvtps_pd(__m128 a)
+{
+    return _mm256_setr_pd(a[0], a[1], a[2], a[3]);
+}
+
+__MM_INLINE __m128 _mm256_cvtpd_ps(__m256d a)
+{
+    return _mm_setr_ps(a[0], a[1], a[2], a[3]);
+}
+
+__MM_INLINE __m128i _mm256_cvtpd_epi32(__m256d a)
+{
+    return _mm_setr_epi32((int)__mm_rint(a[0]), (int)__mm_rint(a[1]),
+                          (int)__mm_rint(a[2]), (int)__mm_rint(a[3]));
+}
+
+__MM_INLINE __m128i _mm256_cvttpd_epi32(__m256d a)
+{
+    return _mm_setr_epi32((int)a[0], (int)a[1], (int)a[2], (int)a[3]);
+}
+
+/* AVX: tests and misc */
+
+__MM_INLINE int _mm256_testz_si256(__m256i a, __m256i b)
+{
+    __m256i t = a & b;
+    return !(t[0] | t[1] | t[2] | t[3]);
+}
+
+__MM_INLINE int _mm256_testc_si256(__m256i a, __m256i b)
+{
+    __m256i t = ~a & b;
+    return !(t[0] | t[1] | t[2] | t[3]);
+}
+
+__MM_INLINE int _mm256_testnzc_si256(__m256i a, __m256i b)
+{
+    return !_mm256_testz_si256(a, b) && !_mm256_testc_si256(a, b);
+}
+
+__MM_INLINE void _mm256_zeroupper(void) { }
+__MM_INLINE void _mm256_zeroall(void) { }
+
+/* AVX2: integer arithmetic and logic, on both 128 bit lanes */
+
+__MM_INLINE __m256i _mm256_add_epi8(__m256i a, __m256i b) { return (__m256i)((__v32qi)a + (__v32qi)b); }
+__MM_INLINE __m256i _mm256_add_epi16(__m256i a, __m256i b) { return (__m256i)((__v16hi)a + (__v16hi)b); }
+__MM_INLINE __m256i _mm256_add_epi32(__m256i a, __m256i b) { return (__m256i)((__v8si)a + (__v8si)b); }
+__MM_INLINE __m256i _mm256_add_epi64(__m256i a, __m256i b) { return a + b; }
+__MM_INLINE __m256i _mm256_sub_epi8(__m256i a, __m256i b) { return (__m256i)((__v32qi)a - (__v32qi)b); }
+__MM_INLINE __m256i _mm256_sub_epi16(__m256i a, __m256i b) { return (__m256i)((__v16hi)a - (__v16hi)b); }
+__MM_INLINE __m256i _mm256_sub_epi32(__m256i a, __m256i b) { return (__m256i)((__v8si)a - (__v8si)b); }
+__MM_INLINE __m256i _mm256_sub_epi64(__m256i a, __m256i b) { return a - b; }
+__MM_INLINE __m256i _mm256_mullo_epi16(__m256i a, __m256i b) { return (__m256i)((__v16hi)a * (__v16hi)b); }
+__MM_INLINE __m256i _mm256_mullo_epi32(__m256i a, __m256i b) { return (__m256i)((__v8si)a * (__v8si)b); }
+__MM_INLINE __m256i _mm256_and_si256(__m256i a, __m256i b) { return a & b; }
+__MM_INLINE __m256i _mm256_andnot_si256(__m256i a, __m256i b) { return ~a & b; }
+__MM_INLINE __m256i _mm256_or_si256(__m256i a, __m256i b) { return a | b; }
+__MM_INLINE __m256i _mm256_xor_si256(__m256i a, __m256i b) { return a ^ b; }
+
+__MM_INLINE __m256i _mm256_cmpeq_epi8(__m256i a, __m256i b) { return (__m256i)((__v32qs)a == (__v32qs)b); }
+__MM_INLINE __m256i _mm256_cmpeq_epi16(__m256i a, __m256i b) { return (__m256i)((__v16hi)a == (__v16hi)b); }
+__MM_INLINE __m256i _mm256_cmpeq_epi32(__m256i a, __m256i b) { return (__m256i)((__v8si)a == (__v8si)b); }
+__MM_INLINE __m256i _mm256_cmpeq_epi64(__m256i a, __m256i b) { return (__m256i)(a == b); }
+__MM_INLINE __m256i _mm256_cmpgt_epi8(__m256i a, __m256i b) { return (__m256i)((__v32qs)a > (__v32qs)b); }
+__MM_INLINE __m256i _mm256_cmpgt_epi16(__m256i a, __m256i b) { return (__m256i)((__v16hi)a > (__v16hi)b); }
+__MM_INLINE __m256i _mm256_cmpgt_epi32(__m256i a, __m256i b) { return (__m256i)((__v8si)a > (__v8si)b); }
+__MM_INLINE __m256i _mm256_cmpgt_epi64(__m256i a, __m256i b) { return (__m256i)(a > b); }
+
+__MM256_BINARY(_mm256_adds_epi8, __m256i, __m128i, _mm_adds_epi8)
+__MM256_BINARY(_mm256_adds_epi16, __m256i, __m128i, _mm_adds_epi16)
+__MM256_BINARY(_mm256_adds_epu8, __m256i, __m128i, _mm_adds_epu8)
+__MM256_BINARY(_mm256_adds_epu16, __m256i, __m128i, _mm_adds_epu16)
+__MM256_BINARY(_mm256_subs_epi8, __m256i, __m128i, _mm_subs_epi8)
+__MM256_BINARY(_mm256_subs_epi16, __m256i, __m128i, _mm_subs_epi16)
+__MM256_BINARY(_mm256_subs_epu8, __m256i, __m128i, _mm_subs_epu8)
+__MM256_BINARY(_mm256_subs_epu16, __m256i, __m128i, _mm_subs_epu16)
+__MM256_BINARY(_mm256_mulhi_epi16, __m256i, __m128i, _mm_mulhi_epi16)
+__MM256_BINARY(_mm256_mulhi_epu16, __m256i, __m128i, _mm_mulhi_epu16)
+__MM256_BINARY(_mm256_mulhrs_epi16, __m256i, __m128i, _mm_mulhrs_epi16)
+__MM256_BINARY(_mm256_mul_epu32, __m256i, __m128i, _mm_mul_epu32)
+__MM256_BINARY(_mm256_mul_epi32, __m256i, __m128i, _mm_mul_epi32)
+__MM256_BINARY(_mm256_madd_epi16, __m256i, __m128i, _mm_madd_epi16)
+__MM256_BINARY(_mm256_maddubs_epi16, __m256i, __m128i, _mm_maddubs_epi16)
+__MM256_BINARY(_mm256_avg_epu8, __m256i, __m128i, _mm_avg_epu8)
+__MM256_BINARY(_mm256_avg_epu16, __m256i, __m128i, _mm_avg_epu16)
+__MM256_BINARY(_mm256_sad_epu8, __m256i, __m128i, _mm_sad_epu8)
+__MM256_BINARY(_mm256_min_epi8, __m256i, __m128i, _mm_min_epi8)
+__MM256_BINARY(_mm256_max_epi8, __m256i, __m128i, _mm_max_epi8)
+__MM256_BINARY(_mm256_min_epi16, __m256i, __m128i, _mm_min_epi16)
+__MM256_BINARY(_mm256_max_epi16, __m256i, __m128i, _mm_max_epi16)
+__MM256_BINARY(_mm256_min_epi32, __m256i, __m128i, _mm_min_epi32)
+__MM256_BINARY(_mm256_max_epi32, __m256i, __m128i, _mm_max_epi32)
+__MM256_BINARY(_mm256_min_epu8, __m256i, __m128i, _mm_min_epu8)
+__MM256_BINARY(_mm256_max_epu8, __m256i, __m128i, _mm_max_epu8)
+__MM256_BINARY(_mm256_min_epu16, __m256i, __m128i, _mm_min_epu16)
+__MM256_BINARY(_mm256_max_epu16, __m256i, __m128i, _mm_max_epu16)
+__MM256_BINARY(_mm256_min_epu32, __m256i, __m128i, _mm_min_epu32)
+__MM256_BINARY(_mm256_max_epu32, __m256i, __m128i, _mm_max_epu32)
+__MM256_BINARY(_mm256_sign_epi8, __m256i, __m128i, _mm_sign_epi8)
+__MM256_BINARY(_mm256_sign_epi16, __m256i, __m128i, _mm_sign_epi16)
+__MM256_BINARY(_mm256_sign_epi32, __m256i, __m128i, _mm_sign_epi32)
+__MM256_BINARY(_mm256_hadd_epi16, __m256i, __m128i, _mm_hadd_epi16)
+__MM256_BINARY(_mm256_hadd_epi32, __m256i, __m128i, _mm_hadd_epi32)
+__MM256_BINARY(_mm256_hadds_epi16, __m256i, __m128i, _mm_hadds_epi16)
+__MM256_BINARY(_mm256_hsub_epi16, __m256i, __m128i, _mm_hsub_epi16)
+__MM256_BINARY(_mm256_hsub_epi32, __m256i, __m128i, _mm_hsub_epi32)
+__MM256_BINARY(_mm256_hsubs_epi16, __m256i, __m128i, _mm_hsubs_epi16)
+__MM256_UNARY(_mm256_abs_epi8, __m256i, __m128i, _mm_abs_epi8)
+__MM256_UNARY(_mm256_abs_epi16, __m256i, __m128i, _mm_abs_epi16)
+__MM256_UNARY(_mm256_abs_epi32, __m256i, __m128i, _mm_abs_epi32)
+
+/* AVX2: shifts */
+
+__MM256_IMM(_mm256_slli_epi16, __m256i, __m128i, _mm_slli_epi16)
+__MM256_IMM(_mm256_slli_epi32, __m256i, __m128i, _mm_slli_epi32)
+__MM256_IMM(_mm256_slli_epi64, __m256i, __m128i, _mm_slli_epi64)
+__MM256_IMM(_mm256_srli_epi16, __m256i, __m128i, _mm_srli_epi16)
+__MM256_IMM(_mm256_srli_epi32, __m256i, __m128i, _mm_srli_epi32)
+__MM256_IMM(_mm256_srli_epi64, __m256i, __m128i, _mm_srli_epi64)
+__MM256_IMM(_mm256_srai_epi16, __m256i, __m128i, _mm_srai_epi16)
+__MM256_IMM(_mm256_srai_epi32, __m256i, __m128i, _mm_srai_epi32)
+__MM256_IMM(_mm256_slli_si256, __m256i, __m128i, _mm_slli_si128)
+__MM256_IMM(_mm256_srli_si256, __m256i, __m128i, _mm_srli_si128)
+
+#define _mm256_bslli_epi128 _mm256_slli_si256
+#define _mm256_bsrli_epi128 _mm256_srli_si256
+
+#define __MM256_SHIFT(name, f128) \
+__MM_INLINE __m256i name(__m256i a, __m128i count) \
+{ \
+    __m256i r; \
+    __MM256_HALF(__m128i, r, 0) = f128(__MM256_HALF(__m128i, a, 0), count); \
+    __MM256_HALF(__m128i, r, 1) = f128(__MM256_HALF(__m128i, a, 1), count); \
+    return r; \
+}
+__MM256_SHIFT(_mm256_sll_epi16, _mm_sll_epi16)
+__MM256_SHIFT(_mm256_sll_epi32, _mm_sll_epi32)
+__MM256_SHIFT(_mm256_sll_epi64, _mm_sll_epi64)
+__MM256_SHIFT(_mm256_srl_epi16, _mm_srl_epi16)
+__MM256_SHIFT(_mm256_srl_epi32, _mm_srl_epi32)
+__MM256_SHIFT(_mm256_srl_epi64, _mm_srl_epi64)
+__MM256_SHIFT(_mm256_sra_epi16, _mm_sra_epi16)
+__MM256_SHIFT(_mm256_sra_epi32, _mm_sra_epi32)
+
+#define __MM_SHIFTV(name, vt, n, bits, expr) \
+__MM_INLINE vt name(vt x, vt y) \
+{ \
+    int i; \
+    for (i = 0; i < n; i++) \
+        x[i] = (expr); \
+    return x; \
+}
+__MM_SHIFTV(__mm_sllv_epi32, __v4su, 4, 32, y[i] < 32 ? x[i] << y[i] : 0)
+__MM_SHIFTV(__mm_srlv_epi32, __v4su, 4, 32, y[i] < 32 ? x[i] >> y[i] : 0)
+__MM_SHIFTV(__mm_srav_epi32, __v4si, 4, 32, x[i] >> ((unsigned)y[i] < 32 ? y[i] : 31))
+__MM_SHIFTV(__mm_sllv_epi64, __v2du, 2, 64, y[i] < 64 ? x[i] << y[i] : 0)
+__MM_SHIFTV(__mm_srlv_epi64, __v2du, 2, 64, y[i] < 64 ? x[i] >> y[i] : 0)
+__MM_SHIFTV(__mm256_sllv_epi32, __v8su, 8, 32, y[i] < 32 ? x[i] << y[i] : 0)
+__MM_SHIFTV(__mm256_srlv_epi32, __v8su, 8, 32, y[i] < 32 ? x[i] >> y[i] : 0)
+__MM_SHIFTV(__mm256_srav_epi32, __v8si, 8, 32, x[i] >> ((unsigned)y[i] < 32 ? y[i] : 31))
+__MM_SHIFTV(__mm256_sllv_epi64, __v4du, 4, 64, y[i] < 64 ? x[i] << y[i] : 0)
+__MM_SHIFTV(__mm256_srlv_epi64, __v4du, 4, 64, y[i] < 64 ? x[i] >> y[i] : 0)
+
+#define _mm_sllv_epi32(a, b) ((__m128i)__mm_sllv_epi32((__v4su)(a), (__v4su)(b)))
+#define _mm_srlv_epi32(a, b) ((__m128i)__mm_srlv_epi32((__v4su)(a), (__v4su)(b)))
+#define _mm_srav_epi32(a, b) ((__m128i)__mm_srav_epi32((__v4si)(a), (__v4si)(b)))
+#define _mm_sllv_epi64(a, b) ((__m128i)__mm_sllv_epi64((__v2du)(a), (__v2du)(b)))
+#define _mm_srlv_epi64(a, b) ((__m128i)__mm_srlv_epi64((__v2du)(a), (__v2du)(b)))
+#define _mm256_sllv_epi32(a, b) ((__m256i)__mm256_sllv_epi32((__v8su)(a), (__v8su)(b)))
+#define _mm256_srlv_epi32(a, b) ((__m256i)__mm256_srlv_epi32((__v8su)(a), (__v8su)(b)))
+#define _mm256_srav_epi32(a, b) ((__m256i)__mm256_srav_epi32((__v8si)(a), (__v8si)(b)))
+#define _mm256_sllv_epi64(a, b) ((__m256i)__mm256_sllv_epi64((__v4du)(a), (__v4du)(b)))
+#define _mm256_srlv_epi64(a, b) ((__m256i)__mm256_srlv_epi64((__v4du)(a), (__v4du)(b)))
+
+/* AVX2: pack, unpack, shuffle and permute */
+
+__MM256_BINARY(_mm256_packs_epi16, __m256i, __m128i, _mm_packs_epi16)
+__MM256_BINARY(_mm256_packs_epi32, __m256i, __m128i, _mm_packs_epi32)
+__MM256_BINARY(_mm256_packus_epi16, __m256i, __m128i, _mm_packus_epi16)
+__MM256_BINARY(_mm256_packus_epi32, __m256i, __m128i, _mm_packus_epi32)
+__MM256_BINARY(_mm256_unpacklo_epi8, __m256i, __m128i, _mm_unpacklo_epi8)
+__MM256_BINARY(_mm256_unpackhi_epi8, __m256i, __m128i, _mm_unpackhi_epi8)
+__MM256_BINARY(_mm256_unpacklo_epi16, __m256i, __m128i, _mm_unpacklo_epi16)
+__MM256_BINARY(_mm256_unpackhi_epi16, __m256i, __m128i, _mm_unpackhi_epi16)
+__MM256_BINARY(_mm256_unpacklo_epi32, __m256i, __m128i, _mm_unpacklo_epi32)
+__MM256_BINARY(_mm256_unpackhi_epi32, __m256i, __m128i, _mm_unpackhi_epi32)
+__MM256_BINARY(_mm256_unpacklo_epi64, __m256i, __m128i, _mm_unpacklo_epi64)
+__MM256_BINARY(_mm256_unpackhi_epi64, __m256i, __m128i, _mm_unpackhi_epi64)
+__MM256_BINARY(_mm256_shuffle_epi8, __m256i, __m128i, _mm_shuffle_epi8)
+__MM256_IMM(_mm256_shuffle_epi32, __m256i, __m128i, _mm_shuffle_epi32)
+__MM256_IMM(_mm256_shufflelo_epi16, __m256i, __m128i, _mm_shufflelo_epi16)
+__MM256_IMM(_mm256_shufflehi_epi16, __m256i, __m128i, _mm_shufflehi_epi16)
+__MM256_BINARY_IMM(_mm256_alignr_epi8, __m256i, __m128i, _mm_alignr_epi8)
+__MM256_BINARY_IMM(_mm256_blend_epi16, __m256i, __m128i, _mm_blend_epi16)
+
+__MM_INLINE __m256i _mm256_blend_epi32(__m256i a, __m256i b, int imm)
+{
+    __v8si x = (__v8si)a, y = (__v8si)b;
+    int i;
+    for (i = 0; i < 8; i++)
+        if (imm & (1 << i))
+            x[i] = y[i];
+    return (__m256i)x;
+}
+
+__MM_INLINE __m128i _mm_blend_epi32(__m128i a, __m128i b, int imm)
+{
+    return _mm_castps_si128(_mm_blend_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), imm));
+}
+
+__MM_INLINE __m256i _mm256_blendv_epi8(__m256i a, __m256i b, __m256i mask)
+{
+    __m256i m = (__m256i)((__v32qs)mask < 0);
+    return (a & ~m) | (b & m);
+}
+
+__MM_INLINE __m256i _mm256_permute4x64_epi64(__m256i a, int imm)
+{
+    return _mm256_setr_epi64x(a[imm & 3], a[(imm >> 2) & 3],
+                              a[(imm >> 4) & 3], a[(imm >> 6) & 3]);
+}
+
+__MM_INLINE __m256d _mm256_permute4x64_pd(__m256d a, int imm)
+{
+    return _mm256_setr_pd(a[imm & 3], a[(imm >> 2) & 3],
+                          a[(imm >> 4) & 3], a[(imm >> 6) & 3]);
+}
+
+__MM_INLINE __m256i _mm256_permutevar8x32_epi32(__m256i a, __m256i idx)
+{
+    __v8si x = (__v8si)a, n = (__v8si)idx, r;
+    int i;
+    for (i = 0; i < 8; i++)
+        r[i] = x[n[i] & 7];
+    return (__m256i)r;
+}
+
+__MM_INLINE __m256 _mm256_permutevar8x32_ps(__m256 a, __m256i idx)
+{
+    return (__m256)_mm256_permutevar8x32_epi32((__m256i)a, idx);
+}
+
+__MM_INLINE int _mm256_movemask_epi8(__m256i a)
+{
+    return _mm_movemask_epi8(__MM256_HALF(__m128i, a, 0))
+        | _mm_movemask_epi8(__MM256_HALF(__m128i, a, 1)) << 16;
+}
+
+__MM_INLINE int _mm256_extract_epi8(__m256i a, int imm) { return ((__v32qu)a)[imm & 31]; }
+__MM_INLINE int _mm256_extract_epi16(__m256i a, int imm) { return ((__v16hu)a)[imm & 15]; }
+__MM_INLINE int _mm256_extract_epi32(__m256i a, int imm) { return ((__v8si)a)[imm & 7]; }
+__MM_INLINE long long _mm256_extract_epi64(__m256i a, int imm) { return a[imm & 3]; }
+
+__MM_INLINE __m256i _mm256_insert_epi8(__m256i a, int b, int imm)
+{
+    __v32qi x = (__v32qi)a;
+    x[imm & 31] = b;
+    return (__m256i)x;
+}
+
+__MM_INLINE __m256i _mm256_insert_epi16(__m256i a, int b, int imm)
+{
+    __v16hi x = (__v16hi)a;
+    x[imm & 15] = b;
+    return (__m256i)x;
+}
+
+__MM_INLINE __m256i _mm256_insert_epi32(__m256i a, int b, int imm)
+{
+    __v8si x = (__v8si)a;
+    x[imm & 7] = b;
+    return (__m256i)x;
+}
+
+__MM_INLINE __m256i _mm256_insert_epi64(__m256i a, long long b, int imm)
+{
+    a[imm & 3] = b;
+    return a;
+}
+
+/* AVX2: broadcasts and widening conversions */
+
+__MM_INLINE __m128i _mm_broadcastb_epi8(__m128i a) { return _mm_set1_epi8(((__v16qi)a)[0]); }
+__MM_INLINE __m128i _mm_broadcastw_epi16(__m128i a) { return _mm_set1_epi16(((__v8hi)a)[0]); }
+__MM_INLINE __m128i _mm_broadcastd_epi32(__m128i a) { return _mm_set1_epi32(((__v4si)a)[0]); }
+__MM_INLINE __m128i _mm_broadcastq_epi64(__m128i a) { return _mm_set1_epi64x(a[0]); }
+__MM_INLINE __m256i _mm256_broadcastb_epi8(__m128i a) { return _mm256_set1_epi8(((__v16qi)a)[0]); }
+__MM_INLINE __m256i _mm256_broadcastw_epi16(__m128i a) { return _mm256_set1_epi16(((__v8hi)a)[0]); }
+__MM_INLINE __m256i _mm256_broadcastd_epi32(__m128i a) { return _mm256_set1_epi32(((__v4si)a)[0]); }
+__MM_INLINE __m256i _mm256_broadcastq_epi64(__m128i a) { return _mm256_set1_epi64x(a[0]); }
+__MM_INLINE __m256i _mm256_broadcastsi128_si256(__m128i a) { return _mm256_set_m128i(a, a); }
+__MM_INLINE __m128 _mm_broadcastss_ps(__m128 a) { return _mm_set1_ps(a[0]); }
+__MM_INLINE __m128d _mm_broadcastsd_pd(__m128d a) { return _mm_set1_pd(a[0]); }
+__MM_INLINE __m256 _mm256_broadcastss_ps(__m128 a) { return _mm256_set1_ps(a[0]); }
+__MM_INLINE __m256d _mm256_broadcastsd_pd(__m128d a) { return _mm256_set1_pd(a[0]); }
+
+#define _mm_broadcastsi128_si256 _mm256_broadcastsi128_si256
+
+#define __MM256_EXTEND(name, st, rt, n) \
+__MM_INLINE __m256i name(__m128i a) \
+{ \
+    st x = (st)a; \
+    rt r; \
+    int i; \
+    for (i = 0; i < n; i++) \
+        r[i] = x[i]; \
+    return (__m256i)r; \
+}
+__MM256_EXTEND(_mm256_cvtepi8_epi16, __v16qs, __v16hi, 16)
+__MM256_EXTEND(_mm256_cvtepi8_epi32, __v16qs, __v8si, 8)
+__MM256_EXTEND(_mm256_cvtepi8_epi64, __v16qs, __v4di, 4)
+__MM256_EXTEND(_mm256_cvtepi16_epi32, __v8hi, __v8si, 8)
+__MM256_EXTEND(_mm256_cvtepi16_epi64, __v8hi, __v4di, 4)
+__MM256_EXTEND(_mm256_cvtepi32_epi64, __v4si, __v4di, 4)
+__MM256_EXTEND(_mm256_cvtepu8_epi16, __v16qu, __v16hi, 16)
+__MM256_EXTEND(_mm256_cvtepu8_epi32, __v16qu, __v8si, 8)
+__MM256_EXTEND(_mm256_cvtepu8_epi64, __v16qu, __v4di, 4)
+__MM256_EXTEND(_mm256_cvtepu16_epi32, __v8hu, __v8si, 8)
+__MM256_EXTEND(_mm256_cvtepu16_epi64, __v8hu, __v4di, 4)
+__MM256_EXTEND(_mm256_cvtepu32_epi64, __v4su, __v4di, 4)
+
+/* AVX2: gathers */
+
+#define __MM_GATHER(name, rt, it, et, n) \
+__MM_INLINE rt name(const et *base, it idx, int scale) \
+{ \
+    rt r; \
+    int i; \
+    for (i = 0; i < n; i++) \
+        r[i] = *(const et *)((const char *)base + (long long)idx[i] * scale); \
+    return r; \
+}
+__MM_GATHER(__mm_i32gather_epi32, __v4si, __v4si, int, 4)
+__MM_GATHER(__mm_i32gather_ps, __m128, __v4si, float, 4)
+__MM_GATHER(__mm_i32gather_pd, __m128d, __v4si, double, 2)
+__MM_GATHER(__mm_i64gather_epi64, __v2di, __v2di, long long, 2)
+__MM_GATHER(__mm256_i32gather_epi32, __v8si, __v8si, int, 8)
+__MM_GATHER(__mm256_i32gather_ps, __m256, __v8si, float, 8)
+__MM_GATHER(__mm256_i32gather_pd, __m256d, __v4si, double, 4)
+__MM_GATHER(__mm256_i64gather_epi64, __v4di, __v4di, long long, 4)
+__MM_GATHER(__mm256_i64gather_pd, __m256d, __v4di, double, 4)
+
+#define _mm_i32gather_epi32(p, i, s) \
+    ((__m128i)__mm_i32gather_epi32((const int *)(p), (__v4si)(i), (s)))
+#define _mm_i32gather_ps(p, i, s) __mm_i32gather_ps((p), (__v4si)(i), (s))
+#define _mm_i32gather_pd(p, i, s) __mm_i32gather_pd((p), (__v4si)(i), (s))
+#define _mm_i64gather_epi64(p, i, s) \
+    ((__m128i)__mm_i64gather_epi64((const long long *)(p), (__v2di)(i), (s)))
+#define _mm256_i32gather_epi32(p, i, s) \
+    ((__m256i)__mm256_i32gather_epi32((const int *)(p), (__v8si)(i), (s)))
+#define _mm256_i32gather_ps(p, i, s) __mm256_i32gather_ps((p), (__v8si)(i), (s))
+#define _mm256_i32gather_pd(p, i, s) __mm256_i32gather_pd((p), (__v4si)(i), (s))
+#define _mm256_i64gather_epi64(p, i, s) \
+    ((__m256i)__mm256_i64gather_epi64((const long long *)(p), (__v4di)(i), (s)))
+#define _mm256_i64gather_pd(p, i, s) __mm256_i64gather_pd((p), (__v4di)(i), (s))
+
+/* BMI, LZCNT and POPCNT */
+
+__MM_INLINE unsigned int _tzcnt_u32(unsigned int a)
+{
+    unsigned int n = 0;
+    if (!a)
+        return 32;
+    while (!(a & 1))
+        a >>= 1, n++;
+    return n;
+}
+
+__MM_INLINE unsigned long long _tzcnt_u64(unsigned long long a)
+{
+    unsigned int lo = (unsigned int)a;
+    return lo ? _tzcnt_u32(lo) : 32 + _tzcnt_u32((unsigned int)(a >> 32));
+}
+
+__MM_INLINE unsigned int _lzcnt_u32(unsigned int a)
+{
+    unsigned int n = 0;
+    if (!a)
+        return 32;
+    while (!(a & 0x80000000u))
+        a <<= 1, n++;
+    return n;
+}
+
+__MM_INLINE unsigned long long _lzcnt_u64(unsigned long long a)
+{
+    unsigned int hi = (unsigned int)(a >> 32);
+    return hi ? _lzcnt_u32(hi) : 32 + _lzcnt_u32((unsigned int)a);
+}
+
+#define _popcnt32 _mm_popcnt_u32
+#define _popcnt64 _mm_popcnt_u64
+
+#endif /* _IMMINTRIN_H_INCLUDED */
@@ -0,0 +1,33 @@
+/*
+ * CJIT x86 intrinsics: aligned allocation <mm_malloc.h>
+ */
+
+#ifndef _MM_MALLOC_H_INCLUDED
+#define _MM_MALLOC_H_INCLUDED
+
+#include <stdlib.h>
+
+#if defined _WIN32
+#include <malloc.h>
+#define _mm_malloc(size, align) _aligned_malloc((size), (align))
+#define _mm_free(p) _aligned_free(p)
+#else
+int posix_memalign(void **, size_t, size_t);
+
+static __inline void *_mm_malloc(size_t size, size_t align)
+{
+    void *p;
+    if (align < sizeof(void *))
+        align = sizeof(void *);
+    if (posix_memalign(&p, align, size))
+        return NULL;
+    return p;
+}
+
+static __inline void _mm_free(void *p)
+{
+    free(p);
+}
+#endif
+
+#endif /* _MM_MALLOC_H_INCLUDED */
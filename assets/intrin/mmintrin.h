@@ -0,0 +1,48 @@
+/*
+ * CJIT x86 intrinsics: MMX <mmintrin.h>
+ *
+ * Intrinsics are plain static inline functions working on GNU C
+ * vector types, which tinycc lowers to SSE2 instructions. Operations
+ * without a direct lowering are written element by element.
+ */
+
+#ifndef _MMINTRIN_H_INCLUDED
+#define _MMINTRIN_H_INCLUDED
+
+#if !defined __x86_64__ && !defined __i386__
+#error "x86 intrinsics headers used on a non-x86 target"
+#endif
+
+/* note: spelled '__attribute' because libc headers may turn
+   '__attribute__' into nothing when __GNUC__ is not defined */
+#define __MM_INLINE static __inline
+#define __MM_VECTOR(n) __attribute((vector_size(n)))
+
+typedef long long __m64 __MM_VECTOR(8);
+typedef int __v2si __MM_VECTOR(8);
+typedef short __v4hi __MM_VECTOR(8);
+typedef signed char __v8qi __MM_VECTOR(8);
+
+__MM_INLINE void _mm_empty(void)
+{
+    __asm__ __volatile__("emms");
+}
+
+__MM_INLINE __m64 _mm_setzero_si64(void)
+{
+    __m64 r = { 0 };
+    return r;
+}
+
+__MM_INLINE __m64 _mm_cvtsi32_si64(int a)
+{
+    __v2si r = { a, 0 };
+    return (__m64)r;
+}
+
+__MM_INLINE int _mm_cvtsi64_si32(__m64 a)
+{
+    return ((__v2si)a)[0];
+}
+
+#endif /* _MMINTRIN_H_INCLUDED */
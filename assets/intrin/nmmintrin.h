@@ -0,0 +1,57 @@
+/*
+ * CJIT x86 intrinsics: SSE4.2 <nmmintrin.h>
+ */
+
+#ifndef _NMMINTRIN_H_INCLUDED
+#define _NMMINTRIN_H_INCLUDED
+
+#include <smmintrin.h>
+
+__MM_INLINE __m128i _mm_cmpgt_epi64(__m128i a, __m128i b)
+{
+    return (__m128i)(a > b);
+}
+
+/* CRC-32C (Castagnoli), bit by bit */
+__MM_INLINE unsigned int __mm_crc32c(unsigned int crc, unsigned long long v, int bytes)
+{
+    int i;
+    for (i = 0; i < bytes * 8; i++, v >>= 1)
+        crc = (crc ^ (unsigned int)(v & 1)) & 1
+            ? (crc >> 1) ^ 0x82f63b78 : crc >> 1;
+    return crc;
+}
+
+__MM_INLINE unsigned int _mm_crc32_u8(unsigned int crc, unsigned char v)
+{
+    return __mm_crc32c(crc, v, 1);
+}
+
+__MM_INLINE unsigned int _mm_crc32_u16(unsigned int crc, unsigned short v)
+{
+    return __mm_crc32c(crc, v, 2);
+}
+
+__MM_INLINE unsigned int _mm_crc32_u32(unsigned int crc, unsigned int v)
+{
+    return __mm_crc32c(crc, v, 4);
+}
+
+__MM_INLINE unsigned long long _mm_crc32_u64(unsigned long long crc, unsigned long long v)
+{
+    return __mm_crc32c((unsigned int)crc, v, 8);
+}
+
+__MM_INLINE int _mm_popcnt_u32(unsigned int a)
+{
+    a = a - ((a >> 1) & 0x55555555);
+    a = (a & 0x33333333) + ((a >> 2) & 0x33333333);
+    return (((a + (a >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
+}
+
+__MM_INLINE long long _mm_popcnt_u64(unsigned long long a)
+{
+    return _mm_popcnt_u32((unsigned int)a) + _mm_popcnt_u32((unsigned int)(a >> 32));
+}
+
+#endif /* _NMMINTRIN_H_INCLUDED */
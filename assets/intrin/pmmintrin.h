@@ -0,0 +1,57 @@
+/*
+ * CJIT x86 intrinsics: SSE3 <pmmintrin.h>
+ */
+
+#ifndef _PMMINTRIN_H_INCLUDED
+#define _PMMINTRIN_H_INCLUDED
+
+#include <emmintrin.h>
+
+__MM_INLINE __m128 _mm_addsub_ps(__m128 a, __m128 b)
+{
+    return _mm_setr_ps(a[0] - b[0], a[1] + b[1], a[2] - b[2], a[3] + b[3]);
+}
+
+__MM_INLINE __m128d _mm_addsub_pd(__m128d a, __m128d b)
+{
+    return _mm_setr_pd(a[0] - b[0], a[1] + b[1]);
+}
+
+__MM_INLINE __m128 _mm_hadd_ps(__m128 a, __m128 b)
+{
+    return _mm_setr_ps(a[0] + a[1], a[2] + a[3], b[0] + b[1], b[2] + b[3]);
+}
+
+__MM_INLINE __m128 _mm_hsub_ps(__m128 a, __m128 b)
+{
+    return _mm_setr_ps(a[0] - a[1], a[2] - a[3], b[0] - b[1], b[2] - b[3]);
+}
+
+__MM_INLINE __m128d _mm_hadd_pd(__m128d a, __m128d b)
+{
+    return _mm_setr_pd(a[0] + a[1], b[0] + b[1]);
+}
+
+__MM_INLINE __m128d _mm_hsub_pd(__m128d a, __m128d b)
+{
+    return _mm_setr_pd(a[0] - a[1], b[0] - b[1]);
+}
+
+__MM_INLINE __m128 _mm_movehdup_ps(__m128 a)
+{
+    return _mm_setr_ps(a[1], a[1], a[3], a[3]);
+}
+
+__MM_INLINE __m128 _mm_moveldup_ps(__m128 a)
+{
+    return _mm_setr_ps(a[0], a[0], a[2], a[2]);
+}
+
+__MM_INLINE __m128d _mm_movedup_pd(__m128d a)
+{
+    return _mm_setr_pd(a[0], a[0]);
+}
+
+#define _mm_loaddup_pd _mm_load1_pd
+
+#endif /* _PMMINTRIN_H_INCLUDED */
@@ -0,0 +1,288 @@
+/*
+ * CJIT x86 intrinsics: SSE4.1 <smmintrin.h>
+ */
+
+#ifndef _SMMINTRIN_H_INCLUDED
+#define _SMMINTRIN_H_INCLUDED
+
+#include <tmmintrin.h>
+
+#define _MM_FROUND_TO_NEAREST_INT 0x00
+#define _MM_FROUND_TO_NEG_INF     0x01
+#define _MM_FROUND_TO_POS_INF     0x02
+#define _MM_FROUND_TO_ZERO        0x03
+#define _MM_FROUND_CUR_DIRECTION  0x04
+#define _MM_FROUND_RAISE_EXC      0x00
+#define _MM_FROUND_NO_EXC         0x08
+#define _MM_FROUND_NINT      (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_FLOOR     (_MM_FROUND_TO_NEG_INF | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_CEIL      (_MM_FROUND_TO_POS_INF | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_TRUNC     (_MM_FROUND_TO_ZERO | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_RINT      (_MM_FROUND_CUR_DIRECTION | _MM_FROUND_RAISE_EXC)
+#define _MM_FROUND_NEARBYINT (_MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC)
+
+/* rounding */
+
+__MM_INLINE double __mm_round(double a, int mode)
+{
+    /* r is within 1 of a in any rounding mode */
+    double r = __mm_rint(a);
+    switch (mode & 7) {
+    case _MM_FROUND_TO_NEG_INF:
+        return r > a ? r - 1 : r;
+    case _MM_FROUND_TO_POS_INF:
+        return r < a ? r + 1 : r;
+    case _MM_FROUND_TO_ZERO:
+        if (a < 0)
+            return r < a ? r + 1 : r;
+        return r > a ? r - 1 : r;
+    default:
+        return r;
+    }
+}
+
+__MM_INLINE __m128d _mm_round_pd(__m128d a, int mode)
+{
+    return _mm_setr_pd(__mm_round(a[0], mode), __mm_round(a[1], mode));
+}
+
+__MM_INLINE __m128 _mm_round_ps(__m128 a, int mode)
+{
+    int i;
+    for (i = 0; i < 4; i++)
+        a[i] = (float)__mm_round(a[i], mode);
+    return a;
+}
+
+__MM_INLINE __m128d _mm_round_sd(__m128d a, __m128d b, int mode)
+{
+    a[0] = __mm_round(b[0], mode);
+    return a;
+}
+
+__MM_INLINE __m128 _mm_round_ss(__m128 a, __m128 b, int mode)
+{
+    a[0] = (float)__mm_round(b[0], mode);
+    return a;
+}
+
+#define _mm_ceil_pd(a) _mm_round_pd((a), _MM_FROUND_CEIL)
+#define _mm_ceil_ps(a) _mm_round_ps((a), _MM_FROUND_CEIL)
+#define _mm_ceil_sd(a, b) _mm_round_sd((a), (b), _MM_FROUND_CEIL)
+#define _mm_ceil_ss(a, b) _mm_round_ss((a), (b), _MM_FROUND_CEIL)
+#define _mm_floor_pd(a) _mm_round_pd((a), _MM_FROUND_FLOOR)
+#define _mm_floor_ps(a) _mm_round_ps((a), _MM_FROUND_FLOOR)
+#define _mm_floor_sd(a, b) _mm_round_sd((a), (b), _MM_FROUND_FLOOR)
+#define _mm_floor_ss(a, b) _mm_round_ss((a), (b), _MM_FROUND_FLOOR)
+
+/* blend */
+
+__MM_INLINE __m128 _mm_blend_ps(__m128 a, __m128 b, int imm)
+{
+    int i;
+    for (i = 0; i < 4; i++)
+        if (imm & (1 << i))
+            a[i] = b[i];
+    return a;
+}
+
+__MM_INLINE __m128d _mm_blend_pd(__m128d a, __m128d b, int imm)
+{
+    if (imm & 1)
+        a[0] = b[0];
+    if (imm & 2)
+        a[1] = b[1];
+    return a;
+}
+
+__MM_INLINE __m128i _mm_blend_epi16(__m128i a, __m128i b, int imm)
+{
+    __v8hi x = (__v8hi)a, y = (__v8hi)b;
+    int i;
+    for (i = 0; i < 8; i++)
+        if (imm & (1 << i))
+            x[i] = y[i];
+    return (__m128i)x;
+}
+
+__MM_INLINE __m128 _mm_blendv_ps(__m128 a, __m128 b, __m128 mask)
+{
+    __v4si m = (__v4si)mask >> 31;
+    return (__m128)(((__v4si)a & ~m) | ((__v4si)b & m));
+}
+
+__MM_INLINE __m128d _mm_blendv_pd(__m128d a, __m128d b, __m128d mask)
+{
+    __v2di m = (__v2di)mask >> 63;
+    return (__m128d)(((__v2di)a & ~m) | ((__v2di)b & m));
+}
+
+__MM_INLINE __m128i _mm_blendv_epi8(__m128i a, __m128i b, __m128i mask)
+{
+    __m128i m = (__m128i)((__v16qs)mask < 0);
+    return (a & ~m) | (b & m);
+}
+
+/* dot product */
+
+__MM_INLINE __m128 _mm_dp_ps(__m128 a, __m128 b, int imm)
+{
+    float s = 0;
+    int i;
+    for (i = 0; i < 4; i++)
+        if (imm & (0x10 << i))
+            s += a[i] * b[i];
+    for (i = 0; i < 4; i++)
+        a[i] = imm & (1 << i) ? s : 0;
+    return a;
+}
+
+__MM_INLINE __m128d _mm_dp_pd(__m128d a, __m128d b, int imm)
+{
+    double s = 0;
+    if (imm & 0x10)
+        s += a[0] * b[0];
+    if (imm & 0x20)
+        s += a[1] * b[1];
+    a[0] = imm & 1 ? s : 0;
+    a[1] = imm & 2 ? s : 0;
+    return a;
+}
+
+/* integer min/max, multiply, compare and pack */
+
+__MM_ELEMENTWISE(_mm_min_epi8, __v16qs, 16, x[i] < y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_max_epi8, __v16qs, 16, x[i] > y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_min_epu16, __v8hu, 8, x[i] < y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_max_epu16, __v8hu, 8, x[i] > y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_min_epi32, __v4si, 4, x[i] < y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_max_epi32, __v4si, 4, x[i] > y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_min_epu32, __v4su, 4, x[i] < y[i] ? x[i] : y[i])
+__MM_ELEMENTWISE(_mm_max_epu32, __v4su, 4, x[i] > y[i] ? x[i] : y[i])
+
+__MM_INLINE __m128i _mm_mullo_epi32(__m128i a, __m128i b)
+{
+    return (__m128i)((__v4si)a * (__v4si)b);
+}
+
+__MM_INLINE __m128i _mm_mul_epi32(__m128i a, __m128i b)
+{
+    __v4si x = (__v4si)a, y = (__v4si)b;
+    return _mm_set_epi64x((long long)x[2] * y[2], (long long)x[0] * y[0]);
+}
+
+__MM_INLINE __m128i _mm_cmpeq_epi64(__m128i a, __m128i b)
+{
+    return (__m128i)(a == b);
+}
+
+__MM_PACK(_mm_packus_epi32, __v4si, 4, __v8hu, 0, 65535)
+
+__MM_INLINE __m128i _mm_minpos_epu16(__m128i a)
+{
+    __v8hu x = (__v8hu)a, r = { 0 };
+    int i;
+    r[0] = x[0];
+    for (i = 1; i < 8; i++)
+        if (x[i] < r[0])
+            r[0] = x[i], r[1] = i;
+    return (__m128i)r;
+}
+
+/* sign and zero extension */
+
+#define __MM_EXTEND(name, st, rt, n) \
+__MM_INLINE __m128i name(__m128i a) \
+{ \
+    st x = (st)a; \
+    rt r; \
+    int i; \
+    for (i = 0; i < n; i++) \
+        r[i] = x[i]; \
+    return (__m128i)r; \
+}
+__MM_EXTEND(_mm_cvtepi8_epi16, __v16qs, __v8hi, 8)
+__MM_EXTEND(_mm_cvtepi8_epi32, __v16qs, __v4si, 4)
+__MM_EXTEND(_mm_cvtepi8_epi64, __v16qs, __v2di, 2)
+__MM_EXTEND(_mm_cvtepi16_epi32, __v8hi, __v4si, 4)
+__MM_EXTEND(_mm_cvtepi16_epi64, __v8hi, __v2di, 2)
+__MM_EXTEND(_mm_cvtepi32_epi64, __v4si, __v2di, 2)
+__MM_EXTEND(_mm_cvtepu8_epi16, __v16qu, __v8hi, 8)
+__MM_EXTEND(_mm_cvtepu8_epi32, __v16qu, __v4si, 4)
+__MM_EXTEND(_mm_cvtepu8_epi64, __v16qu, __v2di, 2)
+__MM_EXTEND(_mm_cvtepu16_epi32, __v8hu, __v4si, 4)
+__MM_EXTEND(_mm_cvtepu16_epi64, __v8hu, __v2di, 2)
+__MM_EXTEND(_mm_cvtepu32_epi64, __v4su, __v2di, 2)
+
+/* insert and extract */
+
+__MM_INLINE int _mm_extract_epi8(__m128i a, int imm) { return ((__v16qu)a)[imm & 15]; }
+__MM_INLINE int _mm_extract_epi32(__m128i a, int imm) { return ((__v4si)a)[imm & 3]; }
+__MM_INLINE long long _mm_extract_epi64(__m128i a, int imm) { return a[imm & 1]; }
+
+__MM_INLINE int _mm_extract_ps(__m128 a, int imm)
+{
+    return ((__v4si)a)[imm & 3];
+}
+
+__MM_INLINE __m128i _mm_insert_epi8(__m128i a, int b, int imm)
+{
+    __v16qi x = (__v16qi)a;
+    x[imm & 15] = b;
+    return (__m128i)x;
+}
+
+__MM_INLINE __m128i _mm_insert_epi32(__m128i a, int b, int imm)
+{
+    __v4si x = (__v4si)a;
+    x[imm & 3] = b;
+    return (__m128i)x;
+}
+
+__MM_INLINE __m128i _mm_insert_epi64(__m128i a, long long b, int imm)
+{
+    a[imm & 1] = b;
+    return a;
+}
+
+__MM_INLINE __m128 _mm_insert_ps(__m128 a, __m128 b, int imm)
+{
+    int i;
+    a[(imm >> 4) & 3] = b[(imm >> 6) & 3];
+    for (i = 0; i < 4; i++)
+        if (imm & (1 << i))
+            a[i] = 0;
+    return a;
+}
+
+#define _MM_EXTRACT_FLOAT(d, x, imm) \
+    ((d) = ((__m128)(x))[(imm) & 3])
+#define _MM_MK_INSERTPS_NDX(src, dst, zmask) \
+    (((src) << 6) | ((dst) << 4) | (zmask))
+
+/* tests */
+
+__MM_INLINE int _mm_testz_si128(__m128i a, __m128i b)
+{
+    __m128i t = a & b;
+    return !(t[0] | t[1]);
+}
+
+__MM_INLINE int _mm_testc_si128(__m128i a, __m128i b)
+{
+    __m128i t = ~a & b;
+    return !(t[0] | t[1]);
+}
+
+__MM_INLINE int _mm_testnzc_si128(__m128i a, __m128i b)
+{
+    return !_mm_testz_si128(a, b) && !_mm_testc_si128(a, b);
+}
+
+#define _mm_test_all_zeros(m, v) _mm_testz_si128((m), (v))
+#define _mm_test_all_ones(v) _mm_testc_si128((v), _mm_set1_epi32(-1))
+#define _mm_test_mix_ones_zeros(m, v) _mm_testnzc_si128((m), (v))
+
+#define _mm_stream_load_si128 _mm_load_si128
+
+#endif /* _SMMINTRIN_H_INCLUDED */
@@ -0,0 +1,81 @@
+/*
+ * CJIT x86 intrinsics: SSSE3 <tmmintrin.h>
+ */
+
+#ifndef _TMMINTRIN_H_INCLUDED
+#define _TMMINTRIN_H_INCLUDED
+
+#include <pmmintrin.h>
+
+#define __MM_UNARY(name, vt, n, expr) \
+__MM_INLINE __m128i name(__m128i a) \
+{ \
+    vt x = (vt)a; \
+    int i; \
+    for (i = 0; i < n; i++) \
+        x[i] = (expr); \
+    return (__m128i)x; \
+}
+__MM_UNARY(_mm_abs_epi8, __v16qs, 16, x[i] < 0 ? -x[i] : x[i])
+__MM_UNARY(_mm_abs_epi16, __v8hi, 8, x[i] < 0 ? -x[i] : x[i])
+__MM_UNARY(_mm_abs_epi32, __v4si, 4, x[i] < 0 ? -x[i] : x[i])
+
+__MM_ELEMENTWISE(_mm_sign_epi8, __v16qs, 16, y[i] < 0 ? -x[i] : y[i] ? x[i] : 0)
+__MM_ELEMENTWISE(_mm_sign_epi16, __v8hi, 8, y[i] < 0 ? -x[i] : y[i] ? x[i] : 0)
+__MM_ELEMENTWISE(_mm_sign_epi32, __v4si, 4, y[i] < 0 ? -x[i] : y[i] ? x[i] : 0)
+__MM_ELEMENTWISE(_mm_mulhrs_epi16, __v8hi, 8, (((int)x[i] * y[i] >> 14) + 1) >> 1)
+
+__MM_INLINE __m128i _mm_shuffle_epi8(__m128i a, __m128i b)
+{
+    __v16qs x = (__v16qs)a, y = (__v16qs)b, r;
+    int i;
+    for (i = 0; i < 16; i++)
+        r[i] = y[i] < 0 ? 0 : x[y[i] & 15];
+    return (__m128i)r;
+}
+
+#define __MM_HORIZONTAL(name, vt, n, wt, lo, hi, op) \
+__MM_INLINE __m128i name(__m128i a, __m128i b) \
+{ \
+    vt x = (vt)a, y = (vt)b, r; \
+    wt t; \
+    int i; \
+    for (i = 0; i < n; i++) { \
+        t = i < n / 2 ? (wt)x[2 * i] op x[2 * i + 1] \
+                      : (wt)y[2 * i - n] op y[2 * i - n + 1]; \
+        r[i] = t < lo ? lo : t > hi ? hi : t; \
+    } \
+    return (__m128i)r; \
+}
+__MM_HORIZONTAL(_mm_hadd_epi16, __v8hi, 8, short, -32768, 32767, +)
+__MM_HORIZONTAL(_mm_hsub_epi16, __v8hi, 8, short, -32768, 32767, -)
+__MM_HORIZONTAL(_mm_hadds_epi16, __v8hi, 8, int, -32768, 32767, +)
+__MM_HORIZONTAL(_mm_hsubs_epi16, __v8hi, 8, int, -32768, 32767, -)
+__MM_HORIZONTAL(_mm_hadd_epi32, __v4si, 4, int, -2147483647 - 1, 2147483647, +)
+__MM_HORIZONTAL(_mm_hsub_epi32, __v4si, 4, int, -2147483647 - 1, 2147483647, -)
+
+__MM_INLINE __m128i _mm_maddubs_epi16(__m128i a, __m128i b)
+{
+    __v16qu x = (__v16qu)a;
+    __v16qs y = (__v16qs)b;
+    __v8hi r;
+    int i, t;
+    for (i = 0; i < 8; i++) {
+        t = x[2 * i] * y[2 * i] + x[2 * i + 1] * y[2 * i + 1];
+        r[i] = t < -32768 ? -32768 : t > 32767 ? 32767 : t;
+    }
+    return (__m128i)r;
+}
+
+__MM_INLINE __m128i _mm_alignr_epi8(__m128i a, __m128i b, int n)
+{
+    __v16qu x = (__v16qu)a, y = (__v16qu)b, r;
+    int i, k;
+    for (i = 0; i < 16; i++) {
+        k = i + n;
+        r[i] = k < 16 ? y[k] : k < 32 ? x[k - 16] : 0;
+    }
+    return (__m128i)r;
+}
+
+#endif /* _TMMINTRIN_H_INCLUDED */
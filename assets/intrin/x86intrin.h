@@ -0,0 +1,10 @@
+/*
+ * CJIT x86 intrinsics: <x86intrin.h>
+ */
+
+#ifndef _X86INTRIN_H_INCLUDED
+#define _X86INTRIN_H_INCLUDED
+
+#include <immintrin.h>
+
+#endif /* _X86INTRIN_H_INCLUDED */
@@ -0,0 +1,435 @@
+/*
+ * CJIT x86 intrinsics: SSE <xmmintrin.h>
+ */
+
+#ifndef _XMMINTRIN_H_INCLUDED
+#define _XMMINTRIN_H_INCLUDED
+
+#include <mmintrin.h>
+#include <mm_malloc.h>
+
+typedef float __m128 __MM_VECTOR(16);
+typedef float __m128_u __MM_VECTOR(16);
+typedef float __v4sf __MM_VECTOR(16);
+typedef int __v4si __MM_VECTOR(16);
+
+#define _MM_SHUFFLE(z, y, x, w) (((z) << 6) | ((y) << 4) | ((x) << 2) | (w))
+
+#define _MM_HINT_ET0 7
+#define _MM_HINT_ET1 6
+#define _MM_HINT_T0  3
+#define _MM_HINT_T1  2
+#define _MM_HINT_T2  1
+#define _MM_HINT_NTA 0
+
+#define _MM_EXCEPT_INVALID    0x0001
+#define _MM_EXCEPT_DENORM     0x0002
+#define _MM_EXCEPT_DIV_ZERO   0x0004
+#define _MM_EXCEPT_OVERFLOW   0x0008
+#define _MM_EXCEPT_UNDERFLOW  0x0010
+#define _MM_EXCEPT_INEXACT    0x0020
+#define _MM_EXCEPT_MASK       0x003f
+
+#define _MM_MASK_INVALID      0x0080
+#define _MM_MASK_DENORM       0x0100
+#define _MM_MASK_DIV_ZERO     0x0200
+#define _MM_MASK_OVERFLOW     0x0400
+#define _MM_MASK_UNDERFLOW    0x0800
+#define _MM_MASK_INEXACT      0x1000
+#define _MM_MASK_MASK         0x1f80
+
+#define _MM_ROUND_NEAREST     0x0000
+#define _MM_ROUND_DOWN        0x2000
+#define _MM_ROUND_UP          0x4000
+#define _MM_ROUND_TOWARD_ZERO 0x6000
+#define _MM_ROUND_MASK        0x6000
+
+#define _MM_FLUSH_ZERO_MASK   0x8000
+#define _MM_FLUSH_ZERO_ON     0x8000
+#define _MM_FLUSH_ZERO_OFF    0x0000
+
+/* round to integral value in the current rounding mode */
+__MM_INLINE float __mm_rintf(float a)
+{
+    float c = a < 0 ? -8388608.0f : 8388608.0f; /* 2^23 */
+    if (a >= 8388608.0f || a <= -8388608.0f || a != a)
+        return a;
+    return (a + c) - c;
+}
+
+/* control/status register */
+
+__MM_INLINE unsigned int _mm_getcsr(void)
+{
+    unsigned int r;
+    __asm__ __volatile__("stmxcsr %0" : "=m"(r));
+    return r;
+}
+
+__MM_INLINE void _mm_setcsr(unsigned int a)
+{
+    __asm__ __volatile__("ldmxcsr %0" : : "m"(a));
+}
+
+#define _MM_GET_EXCEPTION_STATE() (_mm_getcsr() & _MM_EXCEPT_MASK)
+#define _MM_GET_EXCEPTION_MASK() (_mm_getcsr() & _MM_MASK_MASK)
+#define _MM_GET_ROUNDING_MODE() (_mm_getcsr() & _MM_ROUND_MASK)
+#define _MM_GET_FLUSH_ZERO_MODE() (_mm_getcsr() & _MM_FLUSH_ZERO_MASK)
+#define _MM_SET_EXCEPTION_STATE(m) \
+    _mm_setcsr((_mm_getcsr() & ~_MM_EXCEPT_MASK) | (m))
+#define _MM_SET_EXCEPTION_MASK(m) \
+    _mm_setcsr((_mm_getcsr() & ~_MM_MASK_MASK) | (m))
+#define _MM_SET_ROUNDING_MODE(m) \
+    _mm_setcsr((_mm_getcsr() & ~_MM_ROUND_MASK) | (m))
+#define _MM_SET_FLUSH_ZERO_MODE(m) \
+    _mm_setcsr((_mm_getcsr() & ~_MM_FLUSH_ZERO_MASK) | (m))
+
+/* set, load and store */
+
+__MM_INLINE __m128 _mm_setzero_ps(void)
+{
+    __m128 r = { 0 };
+    return r;
+}
+
+__MM_INLINE __m128 _mm_set_ps(float e3, float e2, float e1, float e0)
+{
+    __m128 r = { e0, e1, e2, e3 };
+    return r;
+}
+
+__MM_INLINE __m128 _mm_setr_ps(float e0, float e1, float e2, float e3)
+{
+    __m128 r = { e0, e1, e2, e3 };
+    return r;
+}
+
+__MM_INLINE __m128 _mm_set1_ps(float a)
+{
+    __m128 r = { a, a, a, a };
+    return r;
+}
+
+__MM_INLINE __m128 _mm_set_ss(float a)
+{
+    __m128 r = { a, 0, 0, 0 };
+    return r;
+}
+
+#define _mm_set_ps1 _mm_set1_ps
+
+__MM_INLINE __m128 _mm_load_ps(const float *p)
+{
+    return *(const __m128 *)p;
+}
+
+/* tinycc never emits alignment-checking loads and stores */
+#define _mm_loadu_ps _mm_load_ps
+
+__MM_INLINE __m128 _mm_load_ss(const float *p)
+{
+    return _mm_set_ss(*p);
+}
+
+__MM_INLINE __m128 _mm_load1_ps(const float *p)
+{
+    return _mm_set1_ps(*p);
+}
+
+#define _mm_load_ps1 _mm_load1_ps
+
+__MM_INLINE __m128 _mm_loadr_ps(const float *p)
+{
+    return _mm_setr_ps(p[3], p[2], p[1], p[0]);
+}
+
+__MM_INLINE __m128 _mm_loadh_pi(__m128 a, const __m64 *p)
+{
+    const float *f = (const float *)p;
+    a[2] = f[0];
+    a[3] = f[1];
+    return a;
+}
+
+__MM_INLINE __m128 _mm_loadl_pi(__m128 a, const __m64 *p)
+{
+    const float *f = (const float *)p;
+    a[0] = f[0];
+    a[1] = f[1];
+    return a;
+}
+
+__MM_INLINE void _mm_store_ps(float *p, __m128 a)
+{
+    *(__m128 *)p = a;
+}
+
+#define _mm_storeu_ps _mm_store_ps
+#define _mm_stream_ps _mm_store_ps
+
+__MM_INLINE void _mm_store_ss(float *p, __m128 a)
+{
+    *p = a[0];
+}
+
+__MM_INLINE void _mm_store1_ps(float *p, __m128 a)
+{
+    p[0] = p[1] = p[2] = p[3] = a[0];
+}
+
+#define _mm_store_ps1 _mm_store1_ps
+
+__MM_INLINE void _mm_storer_ps(float *p, __m128 a)
+{
+    p[0] = a[3];
+    p[1] = a[2];
+    p[2] = a[1];
+    p[3] = a[0];
+}
+
+__MM_INLINE void _mm_storeh_pi(__m64 *p, __m128 a)
+{
+    float *f = (float *)p;
+    f[0] = a[2];
+    f[1] = a[3];
+}
+
+__MM_INLINE void _mm_storel_pi(__m64 *p, __m128 a)
+{
+    float *f = (float *)p;
+    f[0] = a[0];
+    f[1] = a[1];
+}
+
+__MM_INLINE float _mm_cvtss_f32(__m128 a)
+{
+    return a[0];
+}
+
+__MM_INLINE __m128 _mm_move_ss(__m128 a, __m128 b)
+{
+    a[0] = b[0];
+    return a;
+}
+
+/* arithmetic */
+
+__MM_INLINE __m128 _mm_add_ps(__m128 a, __m128 b) { return a + b; }
+__MM_INLINE __m128 _mm_sub_ps(__m128 a, __m128 b) { return a - b; }
+__MM_INLINE __m128 _mm_mul_ps(__m128 a, __m128 b) { return a * b; }
+__MM_INLINE __m128 _mm_div_ps(__m128 a, __m128 b) { return a / b; }
+
+__MM_INLINE __m128 _mm_add_ss(__m128 a, __m128 b) { a[0] += b[0]; return a; }
+__MM_INLINE __m128 _mm_sub_ss(__m128 a, __m128 b) { a[0] -= b[0]; return a; }
+__MM_INLINE __m128 _mm_mul_ss(__m128 a, __m128 b) { a[0] *= b[0]; return a; }
+__MM_INLINE __m128 _mm_div_ss(__m128 a, __m128 b) { a[0] /= b[0]; return a; }
+
+__MM_INLINE __m128 _mm_sqrt_ps(__m128 a)
+{
+    __asm__("movups (%0),%%xmm0\n\t"
+            "sqrtps %%xmm0,%%xmm0\n\t"
+            "movups %%xmm0,(%0)" : : "r"(&a) : "memory");
+    return a;
+}
+
+__MM_INLINE __m128 _mm_rcp_ps(__m128 a)
+{
+    return 1.0f / a;
+}
+
+__MM_INLINE __m128 _mm_rsqrt_ps(__m128 a)
+{
+    return 1.0f / _mm_sqrt_ps(a);
+}
+
+__MM_INLINE __m128 _mm_sqrt_ss(__m128 a)
+{
+    return _mm_move_ss(a, _mm_sqrt_ps(a));
+}
+
+__MM_INLINE __m128 _mm_rcp_ss(__m128 a)
+{
+    a[0] = 1.0f / a[0];
+    return a;
+}
+
+__MM_INLINE __m128 _mm_rsqrt_ss(__m128 a)
+{
+    return _mm_move_ss(a, _mm_rsqrt_ps(a));
+}
+
+__MM_INLINE __m128 _mm_min_ps(__m128 a, __m128 b)
+{
+    int i;
+    for (i = 0; i < 4; i++)
+        a[i] = a[i] < b[i] ? a[i] : b[i];
+    return a;
+}
+
+__MM_INLINE __m128 _mm_max_ps(__m128 a, __m128 b)
+{
+    int i;
+    for (i = 0; i < 4; i++)
+        a[i] = a[i] > b[i] ? a[i] : b[i];
+    return a;
+}
+
+__MM_INLINE __m128 _mm_min_ss(__m128 a, __m128 b)
+{
+    a[0] = a[0] < b[0] ? a[0] : b[0];
+    return a;
+}
+
+__MM_INLINE __m128 _mm_max_ss(__m128 a, __m128 b)
+{
+    a[0] = a[0] > b[0] ? a[0] : b[0];
+    return a;
+}
+
+/* logic */
+
+__MM_INLINE __m128 _mm_and_ps(__m128 a, __m128 b)
+{
+    return (__m128)((__v4si)a & (__v4si)b);
+}
+
+__MM_INLINE __m128 _mm_andnot_ps(__m128 a, __m128 b)
+{
+    return (__m128)(~(__v4si)a & (__v4si)b);
+}
+
+__MM_INLINE __m128 _mm_or_ps(__m128 a, __m128 b)
+{
+    return (__m128)((__v4si)a | (__v4si)b);
+}
+
+__MM_INLINE __m128 _mm_xor_ps(__m128 a, __m128 b)
+{
+    return (__m128)((__v4si)a ^ (__v4si)b);
+}
+
+/* comparisons */
+
+__MM_INLINE __m128 _mm_cmpeq_ps(__m128 a, __m128 b) { return (__m128)(a == b); }
+__MM_INLINE __m128 _mm_cmplt_ps(__m128 a, __m128 b) { return (__m128)(a < b); }
+__MM_INLINE __m128 _mm_cmple_ps(__m128 a, __m128 b) { return (__m128)(a <= b); }
+__MM_INLINE __m128 _mm_cmpgt_ps(__m128 a, __m128 b) { return (__m128)(a > b); }
+__MM_INLINE __m128 _mm_cmpge_ps(__m128 a, __m128 b) { return (__m128)(a >= b); }
+__MM_INLINE __m128 _mm_cmpneq_ps(__m128 a, __m128 b) { return (__m128)(a != b); }
+__MM_INLINE __m128 _mm_cmpnlt_ps(__m128 a, __m128 b) { return (__m128)~(__v4si)(a < b); }
+__MM_INLINE __m128 _mm_cmpnle_ps(__m128 a, __m128 b) { return (__m128)~(__v4si)(a <= b); }
+__MM_INLINE __m128 _mm_cmpngt_ps(__m128 a, __m128 b) { return (__m128)~(__v4si)(a > b); }
+__MM_INLINE __m128 _mm_cmpnge_ps(__m128 a, __m128 b) { return (__m128)~(__v4si)(a >= b); }
+__MM_INLINE __m128 _mm_cmpord_ps(__m128 a, __m128 b) { return (__m128)((a == a) & (b == b)); }
+__MM_INLINE __m128 _mm_cmpunord_ps(__m128 a, __m128 b) { return (__m128)((a != a) | (b != b)); }
+
+#define __MM_CMP_SS(name) \
+__MM_INLINE __m128 name##_ss(__m128 a, __m128 b) \
+{ \
+    return _mm_move_ss(a, name##_ps(a, b)); \
+}
+__MM_CMP_SS(_mm_cmpeq)
+__MM_CMP_SS(_mm_cmplt)
+__MM_CMP_SS(_mm_cmple)
+__MM_CMP_SS(_mm_cmpgt)
+__MM_CMP_SS(_mm_cmpge)
+__MM_CMP_SS(_mm_cmpneq)
+__MM_CMP_SS(_mm_cmpnlt)
+__MM_CMP_SS(_mm_cmpnle)
+__MM_CMP_SS(_mm_cmpngt)
+__MM_CMP_SS(_mm_cmpnge)
+__MM_CMP_SS(_mm_cmpord)
+__MM_CMP_SS(_mm_cmpunord)
+
+__MM_INLINE int _mm_comieq_ss(__m128 a, __m128 b) { return a[0] == b[0]; }
+__MM_INLINE int _mm_comilt_ss(__m128 a, __m128 b) { return a[0] < b[0]; }
+__MM_INLINE int _mm_comile_ss(__m128 a, __m128 b) { return a[0] <= b[0]; }
+__MM_INLINE int _mm_comigt_ss(__m128 a, __m128 b) { return a[0] > b[0]; }
+__MM_INLINE int _mm_comige_ss(__m128 a, __m128 b) { return a[0] >= b[0]; }
+__MM_INLINE int _mm_comineq_ss(__m128 a, __m128 b) { return a[0] != b[0]; }
+
+#define _mm_ucomieq_ss _mm_comieq_ss
+#define _mm_ucomilt_ss _mm_comilt_ss
+#define _mm_ucomile_ss _mm_comile_ss
+#define _mm_ucomigt_ss _mm_comigt_ss
+#define _mm_ucomige_ss _mm_comige_ss
+#define _mm_ucomineq_ss _mm_comineq_ss
+
+/* conversions */
+
+__MM_INLINE int _mm_cvtss_si32(__m128 a) { return (int)__mm_rintf(a[0]); }
+__MM_INLINE int _mm_cvttss_si32(__m128 a) { return (int)a[0]; }
+__MM_INLINE __m128 _mm_cvtsi32_ss(__m128 a, int b) { a[0] = b; return a; }
+__MM_INLINE long long _mm_cvtss_si64(__m128 a) { return (long long)__mm_rintf(a[0]); }
+__MM_INLINE long long _mm_cvttss_si64(__m128 a) { return (long long)a[0]; }
+__MM_INLINE __m128 _mm_cvtsi64_ss(__m128 a, long long b) { a[0] = b; return a; }
+
+#define _mm_cvt_ss2si _mm_cvtss_si32
+#define _mm_cvtt_ss2si _mm_cvttss_si32
+#define _mm_cvt_si2ss _mm_cvtsi32_ss
+#define _mm_cvtss_si64x _mm_cvtss_si64
+#define _mm_cvttss_si64x _mm_cvttss_si64
+#define _mm_cvtsi64x_ss _mm_cvtsi64_ss
+
+/* shuffles */
+
+__MM_INLINE __m128 _mm_shuffle_ps(__m128 a, __m128 b, int imm)
+{
+    __m128 r;
+    r[0] = a[imm & 3];
+    r[1] = a[(imm >> 2) & 3];
+    r[2] = b[(imm >> 4) & 3];
+    r[3] = b[(imm >> 6) & 3];
+    return r;
+}
+
+__MM_INLINE __m128 _mm_unpacklo_ps(__m128 a, __m128 b)
+{
+    return _mm_setr_ps(a[0], b[0], a[1], b[1]);
+}
+
+__MM_INLINE __m128 _mm_unpackhi_ps(__m128 a, __m128 b)
+{
+    return _mm_setr_ps(a[2], b[2], a[3], b[3]);
+}
+
+__MM_INLINE __m128 _mm_movehl_ps(__m128 a, __m128 b)
+{
+    return _mm_setr_ps(b[2], b[3], a[2], a[3]);
+}
+
+__MM_INLINE __m128 _mm_movelh_ps(__m128 a, __m128 b)
+{
+    return _mm_setr_ps(a[0], a[1], b[0], b[1]);
+}
+
+__MM_INLINE int _mm_movemask_ps(__m128 a)
+{
+    __v4si v = (__v4si)a;
+    return (v[0] < 0) | (v[1] < 0) << 1 | (v[2] < 0) << 2 | (v[3] < 0) << 3;
+}
+
+#define _MM_TRANSPOSE4_PS(r0, r1, r2, r3) do { \
+    __m128 __t0 = _mm_unpacklo_ps((r0), (r1)); \
+    __m128 __t1 = _mm_unpacklo_ps((r2), (r3)); \
+    __m128 __t2 = _mm_unpackhi_ps((r0), (r1)); \
+    __m128 __t3 = _mm_unpackhi_ps((r2), (r3)); \
+    (r0) = _mm_movelh_ps(__t0, __t1); \
+    (r1) = _mm_movehl_ps(__t1, __t0); \
+    (r2) = _mm_movelh_ps(__t2, __t3); \
+    (r3) = _mm_movehl_ps(__t3, __t2); \
+} while (0)
+
+/* cache and memory ordering */
+
+__MM_INLINE void _mm_prefetch(const void *p, int hint)
+{
+    (void)p, (void)hint;
+}
+
+__MM_INLINE void _mm_sfence(void)
+{
+    __asm__ __volatile__("sfence" : : : "memory");
+}
+
+#endif /* _XMMINTRIN_H_INCLUDED */
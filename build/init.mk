@@ -16,10 +16,11 @@ CFLAGS ?= -O2 -fomit-frame-pointer ${cflags_stack_protect}
 cflags := ${CFLAGS} ${cflags_includes}
 
 SOURCES := src/file.o src/cjit.o \
-           src/main.o src/assets.o \
+           src/main.o src/assets.o src/alloc.o \
            src/cwalk.o src/repl.o \
            src/muntar.o src/tinflate.o src/tinfgzip.o \
-           src/embed_libtcc1.a.o src/embed_include.o
+           src/embed_libtcc1.a.o src/embed_include.o \
+           src/embed_intrin.o src/embed_alloc.o
 #src/embed_source.o
 
 
@@ -36,6 +37,8 @@ embed-posix: lib/tinycc/libtcc1.a
 	bash build/init-assets.sh
 	bash build/embed-asset-path.sh lib/tinycc/libtcc1.a
 	bash build/embed-asset-path.sh lib/tinycc/include
+	bash build/embed-asset-path.sh assets/intrin
+	bash build/embed-asset-path.sh assets/alloc
 	@echo                 >> src/assets.c
 	@echo "return(true);" >> src/assets.c
 	@echo "}"             >> src/assets.c
@@ -47,6 +50,8 @@ embed-posix-source: lib/tinycc/libtcc1.a
 	bash build/init-assets.sh
 	bash build/embed-asset-path.sh lib/tinycc/libtcc1.a
 	bash build/embed-asset-path.sh lib/tinycc/include
+	bash build/embed-asset-path.sh assets/intrin
+	bash build/embed-asset-path.sh assets/alloc
 	bash build/embed-source.sh
 	@echo                 >> src/assets.c
 	@echo "return(true);" >> src/assets.c
@@ -60,6 +65,8 @@ embed-win: lib/tinycc/libtcc.a lib/tinycc/libtcc1.a
 	bash build/init-assets.sh
 	bash build/embed-asset-path.sh lib/tinycc/libtcc1.a
 	bash build/embed-asset-path.sh lib/tinycc/include
+	bash build/embed-asset-path.sh assets/intrin
+	bash build/embed-asset-path.sh assets/alloc
 	bash build/embed-asset-path.sh lib/tinycc/win32/include tinycc_win32
 	bash build/embed-asset-path.sh assets/win32ports
 	@echo                 >> src/assets.c
@@ -73,6 +80,8 @@ embed-musl: lib/tinycc/libtcc1.a
 	bash build/init-assets.sh
 	bash build/embed-asset-path.sh lib/tinycc/libtcc1.a
 	bash build/embed-asset-path.sh lib/tinycc/include
+	bash build/embed-asset-path.sh assets/intrin
+	bash build/embed-asset-path.sh assets/alloc
 	bash build/embed-asset-path.sh /lib/x86_64-linux-musl/libc.so
 	@echo                 >> src/assets.c
 	@echo "return(true);" >> src/assets.c
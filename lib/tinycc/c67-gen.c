@@ -116,11 +116,11 @@ enum {
 #define USING_GLOBALS
 #include "tcc.h"
 
-ST_DATA const char * const target_machine_defs =
+ST_SHARED const char * const target_machine_defs =
     "__C67__\0"
     ;
 
-ST_DATA const int reg_classes[NB_REGS] = {
+ST_SHARED const int reg_classes[NB_REGS] = {
     /* eax */ RC_INT | RC_FLOAT | RC_EAX,
     // only allow even regs for floats (allow for doubles)
     /* ecx */ RC_INT | RC_ECX,
@@ -176,11 +176,11 @@ do {\
 } while (0)
 
 /******************************************************/
-static unsigned long func_sub_sp_offset;
-static int func_ret_sub;
+static ST_TLS unsigned long func_sub_sp_offset;
+static ST_TLS int func_ret_sub;
 
-static BOOL C67_invert_test;
-static int C67_compare_reg;
+static ST_TLS BOOL C67_invert_test;
+static ST_TLS int C67_compare_reg;
 
 #ifdef ASSEMBLY_LISTING_C67
 FILE *f = NULL;
@@ -263,14 +263,12 @@ ST_FUNC void relocate(TCCState *s1, ElfW_Rel *rel, int type, unsigned char *ptr,
 
                 if (memcmp (ptr-3, expect, sizeof(expect)) == 0) {
                     ElfW(Sym) *sym;
-                    Section *sec;
                     int32_t x;
 
                     memcpy(ptr-3, replace, sizeof(replace));
                     rel[1].r_info = ELFW(R_INFO)(0, R_386_NONE);
                     sym = &((ElfW(Sym) *)symtab_section->data)[sym_index];
-                    sec = s1->sections[sym->st_shndx];
-                    x = sym->st_value - sec->sh_addr - sec->data_offset;
+                    x = tls_tpoff(s1, sym->st_value);
                     add32le(ptr + 5, -x);
                 }
                 else
@@ -303,13 +301,11 @@ ST_FUNC void relocate(TCCState *s1, ElfW_Rel *rel, int type, unsigned char *ptr,
         case R_386_TLS_LDO_32:
         case R_386_TLS_LE:
             {
-                ElfW(Sym) *sym;
-                Section *sec;
-                int32_t x;
+                /* in code, LDO is added to the thread pointer that the
+                   relaxed TLS_LDM sequence above loads */
+                int32_t x = type == R_386_TLS_LDO_32 && !s1->reloc_code
+                    ? tls_dtpoff(s1, val) : tls_tpoff(s1, val);
 
-                sym = &((ElfW(Sym) *)symtab_section->data)[sym_index];
-                sec = s1->sections[sym->st_shndx];
-                x = val - sec->sh_addr - sec->data_offset;
                 add32le(ptr, x);
             }
             return;
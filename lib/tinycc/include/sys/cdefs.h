@@ -0,0 +1,6 @@
+/* glibc's <sys/cdefs.h> defines __attribute__ away for compilers other
+   than gcc and clang, tcc understands it: keep the keyword. */
+#include_next <sys/cdefs.h>
+#ifdef __GLIBC__
+#undef __attribute__
+#endif
@@ -341,6 +341,36 @@ static Tree *tree_free_list;
 static alloca_list_type *alloca_list;
 static jmp_list_type *jmp_list;
 
+#if HAVE_TLS_VAR || (HAVE_TLS_FUNC && !defined(_WIN32))
+/* Regions found by __bound_ptr_add() and __bound_ptr_indir*() are cached
+   per thread, so that most checks neither take the lock nor splay the
+   shared tree.  A cached region is valid while the generation of its
+   start address is unchanged: deleting or freeing a region bumps it. */
+#define REGION_CACHE            (1)
+#define REGION_CACHE_SIZE       (4)
+#define REGION_GEN_SIZE         (4096)
+#define REGION_GEN(start)       region_gen[((start) >> 3 ^ (start) >> 15) \
+                                           & (REGION_GEN_SIZE - 1)]
+#define REGION_CHANGED(start)   { ++REGION_GEN(start); \
+                                  __asm__ volatile ("" ::: "memory"); }
+
+typedef struct region_entry_struct {
+    size_t start;
+    size_t size;
+    unsigned int gen;
+} region_entry_type;
+
+typedef struct region_cache_struct {
+    region_entry_type entry[REGION_CACHE_SIZE];
+    unsigned int next;
+} region_cache_type;
+
+static volatile unsigned int region_gen[REGION_GEN_SIZE];
+#else
+#define REGION_CACHE            (0)
+#define REGION_CHANGED(start)
+#endif
+
 static unsigned char inited;
 static unsigned char print_warn_ptr_add;
 static unsigned char print_calls;
@@ -368,12 +398,18 @@ static DWORD no_checking_key;
                               *p = v;                                         \
                             }
 #else
-static int no_checking = 0;
+/* per thread data, no_checking first */
+typedef struct bound_tls_struct {
+    int no_checking;
+    region_cache_type region_cache;
+} bound_tls_type;
+
+static bound_tls_type bound_main_tls;
 static pthread_key_t no_checking_key;
 #define NO_CHECKING_CHECK() if (!p) {                                         \
-                                  p = (int *) BOUND_MALLOC(sizeof(int));      \
+                                  p = (int *) BOUND_CALLOC(1,                 \
+                                                  sizeof(bound_tls_type));    \
                                   if (!p) bound_alloc_error("tls malloc");    \
-                                  *p = 0;                                     \
                                   pthread_setspecific(no_checking_key, p);    \
                             }
 #define NO_CHECKING_GET()   ({ int *p = pthread_getspecific(no_checking_key); \
@@ -384,11 +420,18 @@ static pthread_key_t no_checking_key;
                               NO_CHECKING_CHECK();                            \
                               *p = v;                                         \
                             }
+#define REGION_CACHE_GET(nc) ({ int *p = pthread_getspecific(no_checking_key);\
+                               NO_CHECKING_CHECK();                           \
+                               nc = *p;                                       \
+                               &((bound_tls_type *) p)->region_cache;         \
+                            })
 #endif
 #elif HAVE_TLS_VAR
 static __thread int no_checking = 0;
+static __thread region_cache_type region_cache;
 #define NO_CHECKING_GET()  no_checking
 #define NO_CHECKING_SET(v) no_checking = v 
+#define REGION_CACHE_GET(nc) (nc = no_checking, &region_cache)
 #else
 static int no_checking = 0;
 #define NO_CHECKING_GET()  no_checking
@@ -529,12 +572,57 @@ void __bound_never_fatal (int neverfatal)
     fetch_and_add (&never_fatal, neverfatal);
 }
 
+#if REGION_CACHE
+/* 1 if [addr, addr + end) is inside a region cached by this thread,
+   -1 if checking is disabled for this thread */
+static int region_cache_find(size_t addr, size_t end)
+{
+    region_cache_type *c;
+    region_entry_type *e;
+    int no_check;
+
+    c = REGION_CACHE_GET(no_check);
+    if (no_check)
+        return -1;
+    for (e = c->entry; e < c->entry + REGION_CACHE_SIZE; e++)
+        if (addr - e->start < e->size && e->gen == REGION_GEN(e->start))
+            return addr - e->start + end <= e->size && !print_calls;
+    return 0;
+}
+
+/* called with the lock held */
+static void region_cache_add(Tree *t)
+{
+    region_cache_type *c;
+    region_entry_type *e;
+    int no_check;
+
+    c = REGION_CACHE_GET(no_check);
+    e = &c->entry[c->next++ % REGION_CACHE_SIZE];
+    e->start = t->start;
+    e->size = t->size;
+    e->gen = REGION_GEN(t->start);
+}
+
+#define BOUND_PTR_CACHED(addr, end) region_cache_find(addr, end)
+#define BOUND_PTR_CACHE_ADD(t)      region_cache_add(t)
+#else
+#define BOUND_PTR_CACHED(addr, end) 0
+#define BOUND_PTR_CACHE_ADD(t)
+#endif
+
 /* return '(p + offset)' for pointer arithmetic (a pointer can reach
    the end of a region in this case */
 void * __bound_ptr_add(void *p, size_t offset)
 {
     size_t addr = (size_t)p;
+    int cached;
 
+    if ((cached = BOUND_PTR_CACHED(addr, offset))) {
+        if (cached > 0)
+            INCR_COUNT(bound_ptr_add_count);
+        return p + offset;
+    }
     if (NO_CHECKING_GET())
         return p + offset;
 
@@ -564,6 +652,7 @@ void * __bound_ptr_add(void *p, size_t offset)
                     return INVALID_POINTER; /* return an invalid pointer */
                 return p + offset;
             }
+            BOUND_PTR_CACHE_ADD(tree);
         }
         else if (p) { /* Allow NULL + offset. offsetoff is using it. */
             INCR_COUNT(bound_not_found);
@@ -582,7 +671,13 @@ void * __bound_ptr_add(void *p, size_t offset)
 void * __bound_ptr_indir ## dsize (void *p, size_t offset)                     \
 {                                                                              \
     size_t addr = (size_t)p;                                                   \
+    int cached;                                                                \
                                                                                \
+    if ((cached = BOUND_PTR_CACHED(addr, offset + dsize))) {                   \
+        if (cached > 0)                                                        \
+            INCR_COUNT(bound_ptr_indir ## dsize ## _count);                    \
+        return p + offset;                                                     \
+    }                                                                          \
     if (NO_CHECKING_GET())                                                     \
         return p + offset;                                                     \
                                                                                \
@@ -610,6 +705,7 @@ void * __bound_ptr_indir ## dsize (void *p, size_t offset)                     \
                     return INVALID_POINTER; /* return an invalid pointer */    \
                 return p + offset;                                             \
             }                                                                  \
+            BOUND_PTR_CACHE_ADD(tree);                                         \
         }                                                                      \
         else {                                                                 \
             INCR_COUNT(bound_not_found);                                       \
@@ -956,7 +1052,7 @@ void __bound_init(size_t *p, int mode)
     TlsSetValue(no_checking_key, &no_checking);
 #else
     pthread_key_create(&no_checking_key, NULL);
-    pthread_setspecific(no_checking_key, &no_checking);
+    pthread_setspecific(no_checking_key, &bound_main_tls);
 #endif
 #endif
     NO_CHECKING_SET(1);
@@ -1320,10 +1416,9 @@ static void *bound_thread_create(void *bdata)
     bound_thread_create_type *data = (bound_thread_create_type *) bdata;
     void *retval;
 #if HAVE_TLS_FUNC
-    int *p = (int *) BOUND_MALLOC(sizeof(int));
+    int *p = (int *) BOUND_CALLOC(1, sizeof(bound_tls_type));
   
     if (!p) bound_alloc_error("bound_thread_create malloc");
-    *p = 0;
     pthread_setspecific(no_checking_key, p);
 #endif
     pthread_sigmask(SIG_SETMASK, &data->old_mask, NULL);
@@ -1586,6 +1681,7 @@ void __bound_free(void *ptr, const void *caller)
                 bound_error("freeing invalid region");
                 return;
             }
+            REGION_CHANGED(addr);
             tree->is_invalid = 1;
             memset (ptr, 0x5a, tree->size);
             p = free_reuse_list[free_reuse_index];
@@ -2246,6 +2342,7 @@ static Tree * splay_delete(size_t addr, Tree *t)
     if (t==NULL) return NULL;
     t = splay(addr,t);
     if (compare_destroy(addr, t->start) == 0) {        /* found it */
+        REGION_CHANGED(addr);
         if (t->left == NULL) {
             x = t->right;
         } else {
@@ -54,6 +54,7 @@ void __bt_exit(rt_context *p)
             *pp = rc->next;
             break;
         }
+    rt_lines_free(p);
     rt_post_sem();
 }
 
@@ -0,0 +1,177 @@
+/* runtime for tcc -finstrument-functions: the entries and exits of the
+   functions, recorded by each thread in a ring buffer of its own, and
+   written at exit as Chrome trace events (for chrome://tracing or
+   https://ui.perfetto.dev) to the file named by TCC_TRACE, default
+   trace.json */
+
+#ifndef _WIN32
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define EVENTS (1 << 16) /* kept per thread, the older ones are overwritten */
+
+typedef struct event {
+    void *fn;
+    unsigned long long t; /* nanoseconds << 1, | 1 for an exit */
+} event;
+
+typedef struct ring {
+    struct ring *next;
+    unsigned long long n; /* events recorded */
+    int tid;
+    event ev[EVENTS];
+} ring;
+
+/* the names, see gen_instrument_name() in tccgen.c */
+typedef struct func {
+    void *fn;
+    const char *name;
+} func;
+
+extern char __start___tcc_funcs[] __attribute__((weak));
+extern char __stop___tcc_funcs[] __attribute__((weak));
+
+static ring *rings; /* of all the threads, also those which are gone */
+static int nb_rings;
+/* a pthread key rather than __thread, which objects compiled by tcc only
+   support in executables, not with -run */
+static pthread_key_t ring_key;
+static pthread_once_t ring_once = PTHREAD_ONCE_INIT;
+
+static void ring_key_init(void)
+{
+    pthread_key_create(&ring_key, NULL);
+}
+
+static ring *new_ring(void)
+{
+    ring *r = calloc(1, sizeof *r);
+
+    if (!r)
+        return NULL;
+    r->tid = __atomic_add_fetch(&nb_rings, 1, __ATOMIC_RELAXED);
+    r->next = rings;
+    while (!__atomic_compare_exchange(&rings, &r->next, &r, 1,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+    return r;
+}
+
+static void record(void *fn, int exit)
+{
+    struct timespec ts;
+    event *e;
+    ring *r;
+
+    pthread_once(&ring_once, ring_key_init);
+    r = pthread_getspecific(ring_key);
+    if (!r) {
+        if (!(r = new_ring()))
+            return;
+        pthread_setspecific(ring_key, r);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    e = &r->ev[r->n++ & (EVENTS - 1)];
+    e->fn = fn;
+    e->t = (ts.tv_sec * 1000000000ULL + ts.tv_nsec) << 1 | exit;
+}
+
+void __cyg_profile_func_enter(void *fn, void *call_site)
+{
+    record(fn, 0);
+}
+
+void __cyg_profile_func_exit(void *fn, void *call_site)
+{
+    record(fn, 1);
+}
+
+static int func_cmp(const void *a, const void *b)
+{
+    const func *p = a, *q = b;
+    return p->fn < q->fn ? -1 : p->fn > q->fn;
+}
+
+/* address and name of each function, aligned to the size of a pointer */
+static func *read_funcs(int *pn)
+{
+    char *p = __start___tcc_funcs, *name;
+    func *f = NULL;
+    int n = 0, m = 0;
+
+    while (p && p < __stop___tcc_funcs) {
+        if (n == m) {
+            m = m ? m * 2 : 256;
+            f = realloc(f, m * sizeof *f);
+            if (!f)
+                break;
+        }
+        name = p + sizeof (void *);
+        f[n].fn = *(void **)p;
+        f[n++].name = name;
+        p = name + strlen(name) + 1;
+        p += -(p - __start___tcc_funcs) & (sizeof (void *) - 1);
+    }
+    if (f)
+        qsort(f, n, sizeof *f, func_cmp);
+    *pn = f ? n : 0;
+    return f;
+}
+
+/* from the .fini_array, and called by hosts which do not run it */
+__attribute__((destructor)) void __tcc_trace_write(void)
+{
+    const char *filename = getenv("TCC_TRACE");
+    unsigned long long i, t = 0;
+    int n, depth, pid = getpid(), exit;
+    const char *sep = "";
+    func *f, *found, key;
+    char addr[32];
+    event *e;
+    ring *r;
+    FILE *fp;
+
+    fp = fopen(filename ? filename : "trace.json", "w");
+    if (!fp) {
+        perror(filename ? filename : "trace.json");
+        return;
+    }
+    f = read_funcs(&n);
+    fprintf(fp, "{\"traceEvents\":[\n");
+    __atomic_load(&rings, &r, __ATOMIC_ACQUIRE);
+    for (; r; r = r->next) {
+        depth = 0;
+        i = r->n > EVENTS ? r->n - EVENTS : 0;
+        for (; i < r->n; i++) {
+            e = &r->ev[i & (EVENTS - 1)];
+            exit = e->t & 1;
+            t = e->t >> 1;
+            /* exits of calls which were overwritten */
+            if (exit && 0 == depth)
+                continue;
+            depth += exit ? -1 : 1;
+            key.fn = e->fn;
+            found = n ? bsearch(&key, f, n, sizeof *f, func_cmp) : NULL;
+            if (!found)
+                snprintf(addr, sizeof addr, "%p", e->fn);
+            fprintf(fp, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,"
+                    "\"pid\":%d,\"tid\":%d}", sep, found ? found->name : addr,
+                    exit ? 'E' : 'B', t / 1000, (unsigned)(t % 1000),
+                    pid, r->tid);
+            sep = ",\n";
+        }
+        /* the calls still running */
+        for (; depth > 0; depth--)
+            fprintf(fp, ",\n{\"ph\":\"E\",\"ts\":%llu.%03u,\"pid\":%d,"
+                    "\"tid\":%d}", t / 1000, (unsigned)(t % 1000), pid, r->tid);
+    }
+    fprintf(fp, "\n]}\n");
+    fclose(fp);
+    free(f);
+}
+#endif
@@ -63,12 +63,19 @@
 #define TCC_SEM_IMPL 1
 #include "tcc.h"
 
+#ifndef _WIN32
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
+
 /********************************************************/
 /* global variables */
 
 /* XXX: get rid of this ASAP (or maybe not) */
 ST_DATA struct TCCState *tcc_state;
+#if !CONFIG_TCC_REENTRANT
 TCC_SEM(static tcc_compile_sem);
+#endif
 /* an array of pointers to memory to be free'd after errors */
 ST_DATA void** stk_data;
 ST_DATA int nb_stk_data;
@@ -127,7 +134,9 @@ PUB_FUNC void tcc_enter_state(TCCState *s1)
 {
     if (s1->error_set_jmp_enabled)
         return;
+#if !CONFIG_TCC_REENTRANT
     WAIT_SEM(&tcc_compile_sem);
+#endif
     tcc_state = s1;
 }
 
@@ -136,7 +145,9 @@ PUB_FUNC void tcc_exit_state(TCCState *s1)
     if (s1->error_set_jmp_enabled)
         return;
     tcc_state = NULL;
+#if !CONFIG_TCC_REENTRANT
     POST_SEM(&tcc_compile_sem);
+#endif
 }
 
 /********************************************************/
@@ -518,7 +529,7 @@ static void tcc_split_path(TCCState *s, void *p_ary, int *p_nb_ary, const char *
 {
     const char *p;
     do {
-        int c;
+        int c, i;
         CString str;
 
         cstr_new(&str);
@@ -544,7 +555,12 @@ static void tcc_split_path(TCCState *s, void *p_ary, int *p_nb_ary, const char *
         }
         if (str.size) {
             cstr_ccat(&str, '\0');
-            dynarray_add(p_ary, p_nb_ary, tcc_strdup(str.data));
+            /* searching the same directory twice is useless */
+            for (i = 0; i < *p_nb_ary; ++i)
+                if (0 == PATHCMP((*(char ***)p_ary)[i], str.data))
+                    break;
+            if (i == *p_nb_ary)
+                dynarray_add(p_ary, p_nb_ary, tcc_strdup(str.data));
         }
         cstr_free(&str);
         in = p+1;
@@ -624,6 +640,8 @@ static void error1(int mode, const char *fmt, va_list ap)
     cstr_free(&cs);
     if (mode != ERROR_WARN)
         s1->nb_errors++;
+    else
+        s1->nb_warnings++;
     if (mode == ERROR_ERROR && s1->error_set_jmp_enabled) {
         while (nb_stk_data)
             tcc_free(*(void**)stk_data[--nb_stk_data]);
@@ -692,6 +710,44 @@ ST_FUNC void tcc_open_bf(TCCState *s1, const char *filename, int initlen)
     tok_flags = TOK_FLAG_BOL | TOK_FLAG_BOF;
 }
 
+/* make the input file on 'fd' readable as a whole: regular files larger
+   than IO_BUF_SIZE are mapped into memory rather than read in chunks.
+   The page before the file takes what the lexer ungets at its start,
+   the byte after it (always mapped) the CH_EOB. */
+static void tcc_open_fd(TCCState *s1, const char *filename, int fd)
+{
+#ifndef _WIN32
+    struct stat st;
+    size_t page, size;
+    uint8_t *p;
+#endif
+
+    tcc_open_bf(s1, filename, 0);
+    file->fd = fd;
+#ifndef _WIN32
+    if (fd <= 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)
+        || st.st_size <= IO_BUF_SIZE || st.st_size >= 0x7fffffff)
+        return;
+    page = sysconf(_SC_PAGESIZE);
+    size = page + ((st.st_size + page) & -page);
+    p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+        return;
+    if (mmap(p + page, st.st_size, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(p, size);
+        return;
+    }
+    file->map = p;
+    file->map_size = size;
+    file->buf_ptr = p + page;
+    file->buf_end = p + page + st.st_size;
+    file->buf_end[0] = CH_EOB;
+    total_bytes += st.st_size;
+#endif
+}
+
 ST_FUNC void tcc_close(void)
 {
     TCCState *s1 = tcc_state;
@@ -700,6 +756,10 @@ ST_FUNC void tcc_close(void)
         close(bf->fd);
         total_lines += bf->line_num - 1;
     }
+#ifndef _WIN32
+    if (bf->map)
+        munmap(bf->map, bf->map_size);
+#endif
     if (bf->true_filename != bf->filename)
         tcc_free(bf->true_filename);
     file = bf->prev;
@@ -725,20 +785,18 @@ ST_FUNC int tcc_open(TCCState *s1, const char *filename)
     int fd = _tcc_open(s1, filename);
     if (fd < 0)
         return -1;
-    tcc_open_bf(s1, filename, 0);
-    file->fd = fd;
+    tcc_open_fd(s1, filename, fd);
     return 0;
 }
 
 /* compile the file opened in 'file'. Return non zero if errors. */
-static int tcc_compile(TCCState *s1, int filetype, const char *str, int fd)
+static int tcc_compile(TCCState *s1, int filetype, const char *str, int fd,
+                       const char *name, int line)
 {
     /* Here we enter the code section where we use the global variables for
        parsing and code generation (tccpp.c, tccgen.c, <target>-gen.c).
-       Other threads need to wait until we're done.
-
-       Alternatively we could use thread local storage for those global
-       variables, which may or may not have advantages */
+       With CONFIG_TCC_REENTRANT these are thread local (ST_DATA/ST_TLS),
+       otherwise other threads need to wait until we're done. */
 
     tcc_enter_state(s1);
     s1->error_set_jmp_enabled = 1;
@@ -751,8 +809,12 @@ static int tcc_compile(TCCState *s1, int filetype, const char *str, int fd)
             tcc_open_bf(s1, "<string>", len);
             memcpy(file->buffer, str, len);
         } else {
-            tcc_open_bf(s1, str, 0);
-            file->fd = fd;
+            tcc_open_fd(s1, str, fd);
+            /* as with '#line <line> "<name>"' at its top */
+            if (name)
+                pstrcpy(file->filename, sizeof file->filename, name);
+            if (line)
+                file->line_num = line;
         }
 
         preprocess_start(s1, filetype);
@@ -779,7 +841,22 @@ static int tcc_compile(TCCState *s1, int filetype, const char *str, int fd)
 
 LIBTCCAPI int tcc_compile_string(TCCState *s, const char *str)
 {
-    return tcc_compile(s, s->filetype, str, -1);
+    return tcc_compile(s, s->filetype, str, -1, NULL, 0);
+}
+
+LIBTCCAPI int tcc_compile_file(TCCState *s1, const char *filename,
+                               const char *name, int line)
+{
+    int fd, ret;
+
+    fd = _tcc_open(s1, filename);
+    if (fd < 0)
+        return tcc_error_noabort("file '%s' not found", filename);
+    s1->current_filename = filename;
+    dynarray_add(&s1->target_deps, &s1->nb_target_deps, tcc_strdup(filename));
+    ret = tcc_compile(s1, AFF_TYPE_C, filename, fd, name, line);
+    s1->current_filename = NULL;
+    return ret;
 }
 
 /* define a preprocessor symbol. value can be NULL, sym can be "sym=val" */
@@ -799,6 +876,12 @@ LIBTCCAPI void tcc_undefine_symbol(TCCState *s1, const char *sym)
     cstr_printf(&s1->cmdline_defs, "#undef %s\n", sym);
 }
 
+LIBTCCAPI void tcc_set_pch_dir(TCCState *s1, const char *dir)
+{
+    tcc_free(s1->pch_dir);
+    s1->pch_dir = dir ? tcc_strdup(dir) : NULL;
+}
+
 
 LIBTCCAPI TCCState *tcc_new(void)
 {
@@ -818,6 +901,7 @@ LIBTCCAPI TCCState *tcc_new(void)
     s->warn_implicit_function_declaration = 1;
     s->warn_discarded_qualifiers = 1;
     s->ms_extensions = 1;
+    s->inline_limit = 64;
 
 #ifdef CHAR_IS_UNSIGNED
     s->char_is_unsigned = 1;
@@ -845,6 +929,8 @@ LIBTCCAPI TCCState *tcc_new(void)
 
 LIBTCCAPI void tcc_delete(TCCState *s1)
 {
+    int i;
+
     /* free sections */
     tccelf_delete(s1);
 
@@ -855,6 +941,10 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
     /* free include paths */
     dynarray_reset(&s1->include_paths, &s1->nb_include_paths);
     dynarray_reset(&s1->sysinclude_paths, &s1->nb_sysinclude_paths);
+    for (i = 0; i < s1->nb_include_dirs; i++)
+        dynarray_reset(&s1->include_dirs[i]->names,
+                       &s1->include_dirs[i]->nb_names);
+    dynarray_reset(&s1->include_dirs, &s1->nb_include_dirs);
 
     tcc_free(s1->tcc_lib_path);
     tcc_free(s1->soname);
@@ -865,20 +955,24 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
     tcc_free(s1->mapfile);
     tcc_free(s1->outfile);
     tcc_free(s1->deps_outfile);
+    tcc_free(s1->pch_dir);
 #if defined TCC_TARGET_MACHO
     tcc_free(s1->install_name);
 #endif
     dynarray_reset(&s1->files, &s1->nb_files);
     dynarray_reset(&s1->target_deps, &s1->nb_target_deps);
+    dynarray_reset(&s1->missing_deps, &s1->nb_missing_deps);
     dynarray_reset(&s1->pragma_libs, &s1->nb_pragma_libs);
     dynarray_reset(&s1->argv, &s1->argc);
     cstr_free(&s1->cmdline_defs);
     cstr_free(&s1->cmdline_incl);
     cstr_free(&s1->linker_arg);
     tcc_free(s1->dState);
+    dynarray_reset(&s1->profile, &s1->nb_profile);
 #ifdef TCC_IS_NATIVE
     /* free runtime memory */
     tcc_run_free(s1);
+    tcc_free(s1->run_imports);
 #endif
     /* free loaded dlls array */
     dynarray_reset(&s1->loaded_dlls, &s1->nb_loaded_dlls);
@@ -1112,7 +1206,7 @@ check_success:
     } else {
         /* update target deps */
         dynarray_add(&s1->target_deps, &s1->nb_target_deps, tcc_strdup(filename));
-        ret = tcc_compile(s1, flags, filename, fd);
+        ret = tcc_compile(s1, flags, filename, fd, NULL, 0);
     }
     s1->current_filename = NULL;
     return ret;
@@ -1143,6 +1237,21 @@ LIBTCCAPI int tcc_add_file(TCCState *s, const char *filename)
     return tcc_add_file_internal(s, filename, filetype | AFF_PRINT_ERROR);
 }
 
+LIBTCCAPI void tcc_list_deps(TCCState *s, void *ctx,
+    void (*dep_cb)(void *ctx, const char *filename, int missing))
+{
+    int i, k;
+    for (i = 0; i < s->nb_target_deps; ++i) {
+        for (k = 0; k < i; ++k)
+            if (0 == strcmp(s->target_deps[i], s->target_deps[k]))
+                break;
+        if (k == i)
+            dep_cb(ctx, s->target_deps[i], 0);
+    }
+    for (i = 0; i < s->nb_missing_deps; ++i)
+        dep_cb(ctx, s->missing_deps[i], 1);
+}
+
 LIBTCCAPI int tcc_add_library_path(TCCState *s, const char *pathname)
 {
     tcc_split_path(s, &s->library_paths, &s->nb_library_paths, pathname);
@@ -1467,6 +1576,8 @@ static int tcc_set_linker(TCCState *s, const char *option)
                 s->filetype |= AFF_WHOLE_ARCHIVE;
             else
                 s->filetype &= ~AFF_WHOLE_ARCHIVE;
+        } else if (ret = link_option(option, "?gc-sections", &p), ret) {
+            s->gc_sections = ret > 0;
         } else if (link_option(option, "z=", &p)) {
             ignoring = 1;
         } else if (p) {
@@ -1539,6 +1650,7 @@ enum {
     TCC_OPTION_MM,
     TCC_OPTION_MMD,
     TCC_OPTION_MP,
+    TCC_OPTION_pch_dir,
     TCC_OPTION_x,
     TCC_OPTION_ar,
     TCC_OPTION_impdef,
@@ -1592,6 +1704,7 @@ static const TCCOption tcc_options[] = {
     { "shared", TCC_OPTION_shared, 0 },
     { "soname", TCC_OPTION_soname, TCC_OPTION_HAS_ARG },
     { "o", TCC_OPTION_o, TCC_OPTION_HAS_ARG },
+    { "pch-dir", TCC_OPTION_pch_dir, TCC_OPTION_HAS_ARG },
     { "pthread", TCC_OPTION_pthread, 0},
     { "run", TCC_OPTION_run, TCC_OPTION_HAS_ARG | TCC_OPTION_NOSEP },
     { "rdynamic", TCC_OPTION_rdynamic, 0 },
@@ -1669,6 +1782,13 @@ static const FlagDef options_f[] = {
     { offsetof(TCCState, ms_extensions), 0, "ms-extensions" },
     { offsetof(TCCState, dollars_in_identifiers), 0, "dollars-in-identifiers" },
     { offsetof(TCCState, test_coverage), 0, "test-coverage" },
+    { offsetof(TCCState, instrument_functions), 0, "instrument-functions" },
+    { offsetof(TCCState, inline_functions), 0, "inline-small-functions" },
+    { offsetof(TCCState, sibling_calls), 0, "optimize-sibling-calls" },
+    { offsetof(TCCState, function_sections), 0, "function-sections" },
+    { offsetof(TCCState, data_sections), 0, "data-sections" },
+    { offsetof(TCCState, run_huge_pages), 0, "huge-pages" },
+    { offsetof(TCCState, run_lazy_binding), 0, "lazy-binding" },
     { 0, 0, NULL }
 };
 
@@ -2021,6 +2141,15 @@ dorun:
             ++noaction;
             break;
         case TCC_OPTION_f:
+            if (strstart("inline-limit=", &optarg)) {
+                s->inline_limit = atoi(optarg);
+                break;
+            }
+            if (strstart("profile-use=", &optarg)) {
+                if (tcc_tcov_load_profile(s, optarg) < 0)
+                    return -1;
+                break;
+            }
             if (set_flag(s, options_f, optarg) < 0)
                 goto unsupported_option;
             break;
@@ -2092,6 +2221,9 @@ dorun:
         case TCC_OPTION_MF:
             s->deps_outfile = tcc_strdup(optarg);
             break;
+        case TCC_OPTION_pch_dir:
+            tcc_set_pch_dir(s, optarg);
+            break;
         case TCC_OPTION_MP:
             s->gen_phony_deps = 1;
             break;
@@ -2162,6 +2294,13 @@ unsupported_option:
         r = s->linker_arg.data;
         goto arg_err;
     }
+#if defined TCC_TARGET_PE || defined TCC_TARGET_MACHO
+    if (s->nb_profile)
+        tcc_warning("-fprofile-use: no layout for this target");
+#else
+    if (s->nb_profile && s->do_debug)
+        tcc_warning("-fprofile-use: no layout with debug information");
+#endif
     *pargc = argc - arg_start;
     *pargv = argv + arg_start;
     if (tool)
@@ -48,6 +48,11 @@ LIBTCCAPI void tcc_define_symbol(TCCState *s, const char *sym, const char *value
 /* undefine preprocess symbol 'sym' */
 LIBTCCAPI void tcc_undefine_symbol(TCCState *s, const char *sym);
 
+/* save what the #include lines at the top of each compiled C file
+   produce in directory 'dir', and reuse it while they and the headers
+   they read do not change (NULL to disable) */
+LIBTCCAPI void tcc_set_pch_dir(TCCState *s, const char *dir);
+
 /*****************************/
 /* compiling */
 
@@ -60,6 +65,13 @@ LIBTCCAPI int tcc_compile_string(TCCState *s, const char *buf);
 /* Tip: to have more specific errors/warnings from tcc_compile_string(),
    you can prefix the string with "#line <num> \"<filename>\"\n" */
 
+/* compile a C source file whatever its extension. Messages and debug
+   info name it 'name' and count its lines from 'line', as if it started
+   with a #line directive (NULL and 0 to keep the defaults). Return -1 if
+   error. */
+LIBTCCAPI int tcc_compile_file(TCCState *s, const char *filename,
+                               const char *name, int line);
+
 /*****************************/
 /* linking commands */
 
@@ -84,6 +96,17 @@ LIBTCCAPI int tcc_add_symbol(TCCState *s, const char *name, const void *val);
    tcc_relocate() before. */
 LIBTCCAPI int tcc_output_file(TCCState *s, const char *filename);
 
+/* output what was compiled so far as an object file, whatever the
+   output type, e.g. to add it to another state with tcc_add_file() */
+LIBTCCAPI int tcc_output_object(TCCState *s, const char *filename);
+
+/* list the files read so far via 'dep_cb()', as -MD would write them
+   (needs tcc_set_options(s, "-MD") before compiling), then with
+   'missing' set the places where headers were searched for before
+   being found, or not found at all */
+LIBTCCAPI void tcc_list_deps(TCCState *s, void *ctx,
+    void (*dep_cb)(void *ctx, const char *filename, int missing));
+
 /* link and run main() function and return its value. DO NOT call
    tcc_relocate() before. */
 LIBTCCAPI int tcc_run(TCCState *s, int argc, char **argv);
@@ -98,6 +121,19 @@ LIBTCCAPI void *tcc_get_symbol(TCCState *s, const char *name);
 LIBTCCAPI void tcc_list_symbols(TCCState *s, void *ctx,
     void (*symbol_cb)(void *ctx, const char *name, const void *val));
 
+/* list the counters of a program compiled with -ftest-coverage, after
+   tcc_relocate(s) and running it: one per block of code, which spans
+   the lines 'line' to 'last' of 'file' and was entered 'count' times */
+LIBTCCAPI void tcc_list_coverage(TCCState *s, void *ctx,
+    void (*cov_cb)(void *ctx, const char *file, const char *func,
+                   int line, int last, unsigned long long count));
+
+/* resolve what the program in 's' uses but does not define with the
+   global symbols of 'from', already relocated, before looking in the
+   libraries (multiple supported, first match wins, call before
+   tcc_relocate(s)). 'from' must not be deleted before 's'. */
+LIBTCCAPI int tcc_import_symbols(TCCState *s, TCCState *from);
+
 /* experimental/advanced section (see libtcc_test_mt.c for an example) */
 
 /* catch runtime exceptions (optionally limit backtraces at top_func),
@@ -76,6 +76,7 @@ static const char help[] =
     "  -M[M]D       generate make dependency file [ignore system files]\n"
     "  -M[M]        as above but no other output\n"
     "  -MF file     specify dependency file name\n"
+    "  -pch-dir dir cache preprocessed headers in dir\n"
 #if defined(TCC_TARGET_I386) || defined(TCC_TARGET_X86_64)
     "  -m32/64      defer to i386/x86_64 cross compiler\n"
 #endif
@@ -117,6 +118,16 @@ static const char help2[] =
     "  ms-extensions                 allow anonymous struct in struct\n"
     "  dollars-in-identifiers        allow '$' in C symbols\n"
     "  test-coverage                 create code coverage code\n"
+    "  inline-small-functions        expand calls to small inline functions\n"
+    "  inline-limit=N                their size limit in tokens (64)\n"
+    "  profile-use=FILE.tcov         lay functions out hot first, per a\n"
+    "                                run of a -ftest-coverage executable\n"
+    "  optimize-sibling-calls        turn 'return f();' into a jump\n"
+    "  function-sections             each function in a section of its own\n"
+    "  data-sections                 each variable in a section of its own\n"
+    "  huge-pages                    -run code in transparent huge pages\n"
+    "  lazy-binding                  -run looks library functions up when called\n"
+    "  instrument-functions          trace function entries and exits\n"
     "-m... target specific options:\n"
     "  ms-bitfields                  use MSVC bitfield layout\n"
 #ifdef TCC_TARGET_ARM
@@ -128,6 +139,7 @@ static const char help2[] =
     "-Wl,... linker options:\n"
     "  -nostdlib                     do not link with standard crt/libs\n"
     "  -[no-]whole-archive           load lib(s) fully/only as needed\n"
+    "  -[no-]gc-sections             drop unreferenced functions and data\n"
     "  -export-all-symbols           same as -rdynamic\n"
     "  -export-dynamic               same as -rdynamic\n"
     "  -image-base= -Ttext=          set base address of executable\n"
@@ -38,6 +38,14 @@
 #include <fcntl.h>
 #include <setjmp.h>
 #include <time.h>
+/* vector compares for the preprocessor's comment and block skipping */
+#if defined __GNUC__ && !defined __TINYC__
+# if defined __SSE2__
+#  include <emmintrin.h>
+# elif defined __aarch64__ && defined __ARM_NEON
+#  include <arm_neon.h>
+# endif
+#endif
 
 #ifndef _WIN32
 # include <unistd.h>
@@ -378,14 +386,35 @@ extern long double strtold (const char *__nptr, char **__endptr);
 # define CONFIG_TCC_SEMLOCK 1
 #endif
 
+/* keep the global variables of the compiler per thread, so that
+   threads can compile different TCCStates at the same time */
+#ifndef CONFIG_TCC_REENTRANT
+# if (defined __GNUC__ && !defined __TINYC__) || defined _MSC_VER
+#  define CONFIG_TCC_REENTRANT CONFIG_TCC_SEMLOCK
+# else
+#  define CONFIG_TCC_REENTRANT 0
+# endif
+#endif
+
+#if !CONFIG_TCC_REENTRANT
+# define ST_TLS
+#elif defined _MSC_VER
+# define ST_TLS __declspec(thread)
+#else
+# define ST_TLS __thread
+#endif
+
+/* ST_DATA: compiler state, ST_SHARED: constant tables */
 #if ONE_SOURCE
 #define ST_INLN static inline
 #define ST_FUNC static
-#define ST_DATA static
+#define ST_DATA static ST_TLS
+#define ST_SHARED static
 #else
 #define ST_INLN
 #define ST_FUNC
-#define ST_DATA extern
+#define ST_DATA extern ST_TLS
+#define ST_SHARED extern
 #endif
 
 #ifdef TCC_PROFILE /* profile all functions */
@@ -537,7 +566,8 @@ struct SymAttr {
     dllimport   : 1,
     addrtaken   : 1,
     nodebug     : 1,
-    xxxx        : 2; /* not used */
+    vector      : 1, /* struct stands for a GNU C vector type */
+    tls         : 1; /* thread local variable */
 };
 
 /* function attributes or temporary attributes for parsing */
@@ -550,7 +580,8 @@ struct FuncAttr {
     func_dtor   : 1, /* attribute((destructor)) */
     func_args   : 8, /* PE __stdcall args */
     func_alwinl : 1, /* always_inline */
-    xxxx        : 15;
+    func_noinstr : 1, /* no_instrument_function */
+    xxxx        : 14;
 };
 
 /* symbol management */
@@ -604,7 +635,11 @@ typedef struct Section {
     struct Section *link;    /* link to another section */
     struct Section *reloc;   /* corresponding section for relocation, if any */
     struct Section *hash;    /* hash table for symbols */
+    unsigned int *lookup;    /* symbols in the hash table: open addressing */
+    unsigned int lookup_mask, lookup_count; /* of (gnu hash, index) pairs */
     struct Section *prev;    /* previous section on section stack */
+    struct Section *parent;  /* -ffunction-sections: split from, see gc_sections() */
+    unsigned long long hot;  /* -fprofile-use: count of the function in it */
     char name[1];           /* section name */
 } Section;
 
@@ -669,6 +704,8 @@ typedef struct BufferedFile {
     int prev_tok_flags; /* saved tok_flags */
     char filename[1024];    /* filename */
     char *true_filename; /* filename not modified by # line directive */
+    uint8_t *map; /* whole file mapped into memory, see tcc_open_fd() */
+    size_t map_size;
     unsigned char unget[4];
     unsigned char buffer[1]; /* extra size for CH_EOB char */
 } BufferedFile;
@@ -699,12 +736,14 @@ typedef struct AttributeDef {
     int alias_target; /* token */
     int asm_label; /* associated asm label */
     char attr_mode; /* __attribute__((__mode__(...))) */
+    short vector_size; /* __attribute__((__vector_size__(...))) */
 } AttributeDef;
 
 /* inline functions */
 typedef struct InlineFunc {
     TokenString *func_str;
     Sym *sym;
+    int tokens; /* body size, -1 if it can't be expanded at call sites */
     char filename[1];
 } InlineFunc;
 
@@ -713,12 +752,21 @@ typedef struct InlineFunc {
 typedef struct CachedInclude {
     int ifndef_macro;
     int once;
+    int missing; /* open() failed for that path */
     int hash_next; /* -1 if none */
     char filename[1]; /* path specified in #include */
 } CachedInclude;
 
 #define CACHED_INCLUDES_HASH_SIZE 32
 
+/* listing of an include directory, so that most headers that are not
+   in it are skipped without a failing open() call */
+typedef struct IncludeDir {
+    char **names; /* sorted entries, or NULL if not listed */
+    int nb_names;
+    char path[1];
+} IncludeDir;
+
 #ifdef CONFIG_TCC_ASM
 typedef struct ExprValue {
     uint64_t v;
@@ -761,6 +809,7 @@ struct TCCState {
     unsigned char nocommon; /* if true, do not use common symbols for .bss data */
     unsigned char static_link; /* if true, static linking is performed */
     unsigned char rdynamic; /* if true, all symbols are exported */
+    unsigned char gc_sections; /* -Wl,--gc-sections: drop unreferenced code and data */
     unsigned char symbolic; /* if true, resolve symbols in the current module first */
     unsigned char filetype; /* file type for compilation (NONE,C,ASM) */
     unsigned char optimize; /* only to #define __OPTIMIZE__ */
@@ -802,6 +851,16 @@ struct TCCState {
     unsigned char do_bounds_check;
 #endif
     unsigned char test_coverage;  /* generate test coverage code */
+    unsigned char instrument_functions; /* call __cyg_profile_func_enter/exit */
+    void **profile; /* -fprofile-use: function counts, see tccdbg.c */
+    int nb_profile;
+    unsigned char inline_functions; /* expand calls to small inline functions */
+    int inline_limit; /* size limit for that, in tokens */
+    unsigned char sibling_calls; /* generate 'return f();' as a jump */
+    unsigned char function_sections; /* each function in a section of its own */
+    unsigned char data_sections; /* each variable in a section of its own */
+    unsigned char run_huge_pages; /* -run code in transparent huge pages */
+    unsigned char run_lazy_binding; /* -run binds library functions on first call */
 
     /* use GNU C extensions */
     unsigned char gnu_ext;
@@ -850,6 +909,9 @@ struct TCCState {
 
     char **sysinclude_paths;
     int nb_sysinclude_paths;
+    /* contents of include directories, kept for the life of the state */
+    IncludeDir **include_dirs;
+    int nb_include_dirs;
 
     /* library paths */
     char **library_paths;
@@ -870,6 +932,7 @@ struct TCCState {
     int error_set_jmp_enabled;
     jmp_buf error_jmp_buf;
     int nb_errors;
+    int nb_warnings;
 
     /* output file for preprocessing (-E) */
     FILE *ppfp;
@@ -877,6 +940,10 @@ struct TCCState {
     /* for -MD/-MF: collected dependencies for this compilation */
     char **target_deps;
     int nb_target_deps;
+    /* and where headers were searched for and not found, for
+       tcc_list_deps() */
+    char **missing_deps;
+    int nb_missing_deps;
 
     /* compilation */
     BufferedFile *include_stack[INCLUDE_STACK_SIZE];
@@ -947,6 +1014,8 @@ struct TCCState {
     /* ptr to next reloc entry reused */
     ElfW_Rel *qrel;
     #define qrel s1->qrel
+    /* the section being relocated is code, see relocate() */
+    int reloc_code;
 
 #ifdef TCC_TARGET_RISCV64
     struct pcrel_hi { addr_t addr, val; } last_hi;
@@ -983,15 +1052,24 @@ struct TCCState {
     int dt_verneednum;
     Section *versym_section;
     Section *verneed_section;
+    /* libraries whose symbols are entered in dynsymtab when looked up */
+    struct dll_symbols **dll_symbols;
+    int nb_dll_symbols;
+    int dll_symbols_eager;
 #endif
 
 #ifdef TCC_IS_NATIVE
     const char *run_main; /* entry for tcc_run() */
     void *run_ptr; /* runtime_memory */
     unsigned run_size; /* size of runtime_memory  */
+    unsigned char run_mapped; /* runtime_memory is from mmap() */
 #ifdef _WIN64
     void *run_function_table; /* unwind data */
 #endif
+    void *run_tls; /* thread local storage for -run, see tccrun.c */
+    void *run_lazy; /* functions bound on first call, see tccrun.c */
+    struct TCCState **run_imports; /* see tcc_import_symbols() */
+    int nb_run_imports;
     struct TCCState *next;
     struct rt_context *rc; /* pointer to backtrace info block */
     void *run_lj, *run_jb; /* sj/lj for tcc_setjmp()/tcc_run() */
@@ -1024,6 +1102,7 @@ struct TCCState {
     int nb_libraries; /* number of libs thereof */
     char *outfile; /* output filename */
     char *deps_outfile; /* option -MF */
+    char *pch_dir; /* option -pch-dir */
     int argc;
     char **argv;
     CString linker_arg; /* collect -Wl options */
@@ -1549,6 +1628,9 @@ ST_FUNC void section_realloc(Section *sec, unsigned long new_size);
 ST_FUNC size_t section_add(Section *sec, addr_t size, int align);
 ST_FUNC void *section_ptr_add(Section *sec, addr_t size);
 ST_FUNC Section *find_section(TCCState *s1, const char *name);
+ST_FUNC Section *tls_section(TCCState *s1, int nobits);
+ST_FUNC addr_t tls_tpoff(TCCState *s1, addr_t addr);
+ST_FUNC addr_t tls_dtpoff(TCCState *s1, addr_t addr);
 ST_FUNC void free_section(Section *s);
 ST_FUNC Section *new_symtab(TCCState *s1, const char *symtab_name, int sh_type, int sh_flags, const char *strtab_name, const char *hash_name, int hash_sh_flags);
 ST_FUNC void init_symtab(Section *s);
@@ -1561,6 +1643,8 @@ ST_FUNC void put_elf_reloc(Section *symtab, Section *s, unsigned long offset, in
 ST_FUNC void put_elf_reloca(Section *symtab, Section *s, unsigned long offset, int type, int symbol, addr_t addend);
 
 ST_FUNC void resolve_common_syms(TCCState *s1);
+ST_FUNC void gc_sections(TCCState *s1);
+ST_FUNC void tcc_tcov_add_file(TCCState *s1, const char *filename);
 ST_FUNC void relocate_syms(TCCState *s1, Section *symtab, int do_resolve);
 ST_FUNC void relocate_sections(TCCState *s1);
 
@@ -1620,8 +1704,8 @@ ST_FUNC void build_got_entries(TCCState *s1, int got_sym); /* in tccelf.c */
 ST_FUNC void relocate(TCCState *s1, ElfW_Rel *rel, int type, unsigned char *ptr, addr_t addr, addr_t val);
 
 /* ------------ xxx-gen.c ------------ */
-ST_DATA const char * const target_machine_defs;
-ST_DATA const int reg_classes[NB_REGS];
+ST_SHARED const char * const target_machine_defs;
+ST_SHARED const int reg_classes[NB_REGS];
 
 ST_FUNC void gsym_addr(int t, int a);
 ST_FUNC void gsym(int t);
@@ -1842,6 +1926,8 @@ ST_FUNC void tcc_tcov_check_line(TCCState *s1, int start);
 ST_FUNC void tcc_tcov_block_end(TCCState *s1, int line);
 ST_FUNC void tcc_tcov_block_begin(TCCState *s1);
 ST_FUNC void tcc_tcov_reset_ind(TCCState *s1);
+ST_FUNC int tcc_tcov_load_profile(TCCState *s1, const char *filename);
+ST_FUNC unsigned long long tcc_tcov_profile(TCCState *s1, const char *filename, const char *name);
 
 #define stab_section            s1->stab_section
 #define stabstr_section         stab_section->link
@@ -1897,10 +1983,13 @@ ST_FUNC void post_sem(TCCSem *p);
 
 /********************************************************/
 #undef ST_DATA
+#undef ST_SHARED
 #if ONE_SOURCE
-#define ST_DATA static
+#define ST_DATA static ST_TLS
+#define ST_SHARED static
 #else
-#define ST_DATA
+#define ST_DATA ST_TLS
+#define ST_SHARED
 #endif
 /********************************************************/
 
@@ -1949,11 +2038,51 @@ PUB_FUNC void tcc_exit_state(TCCState *s1);
 
 #if CONFIG_TCC_SEMLOCK && TCC_SEM_IMPL
 #undef TCC_SEM_IMPL
+/* Without the compile lock, threads can take a TCCSem for the first time
+   together (mem_sem of MEM_DEBUG from tcc_new(), rt_sem, rt_tls.sem):
+   'init' goes from 0 to 1 (being initialized) to 2 (ready). sem_first()
+   returns 1 to the one thread that must initialize, which then calls
+   sem_ready(). */
+static int sem_first(int *init)
+{
+#if !CONFIG_TCC_REENTRANT
+    return !*init;
+#elif defined _MSC_VER
+    volatile long *v = (volatile long *)init;
+    if (_InterlockedCompareExchange(v, 1, 0) == 0)
+        return 1;
+    while (_InterlockedCompareExchange(v, 2, 2) != 2)
+        ;
+    return 0;
+#else
+    int z = 0;
+    if (__atomic_load_n(init, __ATOMIC_ACQUIRE) == 2)
+        return 0;
+    if (__atomic_compare_exchange_n(init, &z, 1, 0,
+            __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        return 1;
+    while (__atomic_load_n(init, __ATOMIC_ACQUIRE) != 2)
+        ;
+    return 0;
+#endif
+}
+
+static void sem_ready(int *init)
+{
+#if !CONFIG_TCC_REENTRANT
+    *init = 2;
+#elif defined _MSC_VER
+    _InterlockedExchange((volatile long *)init, 2);
+#else
+    __atomic_store_n(init, 2, __ATOMIC_RELEASE);
+#endif
+}
+
 #if defined _WIN32
 ST_FUNC void wait_sem(TCCSem *p)
 {
-    if (!p->init)
-        InitializeCriticalSection(&p->cr), p->init = 1;
+    if (sem_first(&p->init))
+        InitializeCriticalSection(&p->cr), sem_ready(&p->init);
     EnterCriticalSection(&p->cr);
 }
 ST_FUNC void post_sem(TCCSem *p)
@@ -1963,8 +2092,8 @@ ST_FUNC void post_sem(TCCSem *p)
 #elif defined __APPLE__
 ST_FUNC void wait_sem(TCCSem *p)
 {
-    if (!p->init)
-        p->sem = dispatch_semaphore_create(1), p->init = 1;
+    if (sem_first(&p->init))
+        p->sem = dispatch_semaphore_create(1), sem_ready(&p->init);
     dispatch_semaphore_wait(p->sem, DISPATCH_TIME_FOREVER);
 }
 ST_FUNC void post_sem(TCCSem *p)
@@ -1974,8 +2103,8 @@ ST_FUNC void post_sem(TCCSem *p)
 #else
 ST_FUNC void wait_sem(TCCSem *p)
 {
-    if (!p->init)
-        sem_init(&p->sem, 0, 1), p->init = 1;
+    if (sem_first(&p->init))
+        sem_init(&p->sem, 0, 1), sem_ready(&p->init);
     while (sem_wait(&p->sem) < 0 && errno == EINTR);
 }
 ST_FUNC void post_sem(TCCSem *p)
@@ -2166,6 +2166,121 @@ ST_FUNC void tcc_tcov_reset_ind(TCCState *s1)
     tcov_data.ind = 0;
 }
 
+/* -fprofile-use=file.tcov: the counts of the functions, as listed by
+   lib/tcov.c after a run of a -ftest-coverage program:
+        -:    0:Function:name 50.00%
+       12:   34:    line of code
+    #####:   35:    line of code never run
+   The count of a function is the sum of the counts of its lines. The
+   functions are told apart by file too: static functions of different
+   files can have the same name. */
+
+typedef struct ProfileFunc {
+    unsigned long long count;
+    const char *file; /* after the name */
+    char name[1];
+} ProfileFunc;
+
+static int profile_cmp(const void *a, const void *b)
+{
+    ProfileFunc *f = *(ProfileFunc **)a, *g = *(ProfileFunc **)b;
+    int c = strcmp(f->name, g->name);
+    return c ? c : strcmp(f->file, g->file);
+}
+
+/* the listing has the absolute paths of the run, the compiler the
+   paths of its command line: the same file when one ends with the
+   other after a slash */
+static int profile_same_file(const char *a, const char *b)
+{
+    size_t la, lb;
+
+    while (a[0] == '.' && a[1] == '/')
+        a += 2;
+    while (b[0] == '.' && b[1] == '/')
+        b += 2;
+    la = strlen(a), lb = strlen(b);
+    if (la < lb)
+        return profile_same_file(b, a);
+    return !strcmp(a + la - lb, b) && (la == lb || a[la - lb - 1] == '/');
+}
+
+ST_FUNC int tcc_tcov_load_profile(TCCState *s1, const char *filename)
+{
+    char line[1024], srcfile[1024], *p, *q;
+    ProfileFunc *f = NULL, **fp;
+    unsigned long long n;
+    int i, j;
+    FILE *in;
+
+    in = fopen(filename, "r");
+    if (!in)
+        return tcc_error_noabort("file '%s' not found", filename);
+    dynarray_reset(&s1->profile, &s1->nb_profile);
+    srcfile[0] = 0;
+    while (fgets(line, sizeof line, in)) {
+        p = strchr(line, ':');
+        q = p ? strchr(p + 1, ':') : NULL;
+        if (!q)
+            continue;
+        if (!strncmp(q + 1, "Function:", 9)) {
+            q += 10;
+            p = q + strcspn(q, " \n");
+            *p = 0;
+            f = tcc_mallocz(sizeof *f + (p - q) + 1 + strlen(srcfile));
+            strcpy(f->name, q);
+            f->file = strcpy(f->name + (p - q) + 1, srcfile);
+            dynarray_add(&s1->profile, &s1->nb_profile, f);
+        } else if (!strncmp(q + 1, "File:", 5)) {
+            q += 6;
+            q[strcspn(q, " \n")] = 0;
+            pstrcpy(srcfile, sizeof srcfile, q);
+            f = NULL;
+        } else if (f) {
+            p = line + strspn(line, " ");
+            n = strtoull(p, &q, 10);
+            if (q != p && (*q == ':' || *q == '*'))
+                f->count += n;
+        }
+    }
+    fclose(in);
+    /* the same function in several .tcov runs */
+    fp = (ProfileFunc **)s1->profile;
+    qsort(fp, s1->nb_profile, sizeof *fp, profile_cmp);
+    for (i = j = 0; i < s1->nb_profile; i++) {
+        if (j && !profile_cmp(&fp[j - 1], &fp[i])) {
+            fp[j - 1]->count += fp[i]->count;
+            tcc_free(fp[i]);
+        } else
+            fp[j++] = fp[i];
+    }
+    s1->nb_profile = j;
+    return 0;
+}
+
+/* the count of function 'name' of source 'filename', 0 when not run or
+   unknown */
+ST_FUNC unsigned long long tcc_tcov_profile(TCCState *s1,
+                                            const char *filename,
+                                            const char *name)
+{
+    ProfileFunc **fp = (ProfileFunc **)s1->profile;
+    int lo = 0, hi = s1->nb_profile, m;
+
+    /* the first one with this name */
+    while (lo < hi) {
+        m = (lo + hi) / 2;
+        if (strcmp(fp[m]->name, name) < 0)
+            lo = m + 1;
+        else
+            hi = m;
+    }
+    for (; lo < s1->nb_profile && !strcmp(fp[lo]->name, name); lo++)
+        if (profile_same_file(fp[lo]->file, filename))
+            return fp[lo]->count;
+    return 0;
+}
+
 /* ------------------------------------------------------------------------- */
 #undef last_line_num
 #undef new_file
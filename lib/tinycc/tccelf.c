@@ -20,6 +20,11 @@
 
 #include "tcc.h"
 
+#ifndef _WIN32
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
+
 /* Define this to get some debug output during relocation processing.  */
 #undef DEBUG_RELOC
 
@@ -34,6 +39,20 @@ struct sym_version {
     int prev_same_lib;
 };
 
+/* dynamic symbols of a library mapped by tcc_load_dll() */
+struct dll_symbols {
+    void *map;
+    size_t map_size;
+    ElfW(Sym) *dynsym;
+    char *dynstr;
+    int nb_syms;
+    Elf32_Word *gnu_hash;
+    ElfW(Half) *versym;
+    int nb_local_ver, *local_ver;
+    /* gnu hash and index of the symbols left out of gnu_hash */
+    unsigned int *unhashed, unhashed_mask;
+};
+
 #define nb_sym_versions     s1->nb_sym_versions
 #define sym_versions        s1->sym_versions
 #define nb_sym_to_version   s1->nb_sym_to_version
@@ -47,6 +66,12 @@ struct sym_version {
 /* section is dynsymtab_section */
 #define SHF_DYNSYM 0x40000000
 
+#ifndef ELF_OBJ_ONLY
+static int find_dll_sym(TCCState *s1, const char *name);
+static int find_dll_alias(TCCState *s1, addr_t value);
+static void dll_symbols_free(struct dll_symbols *d);
+#endif
+
 #ifdef TCC_TARGET_PE
 #define shf_RELRO SHF_ALLOC
 static const char rdata[] = ".rdata";
@@ -112,6 +137,8 @@ ST_FUNC void free_section(Section *s)
     tcc_free(s->data);
     s->data = NULL;
     s->data_allocated = s->data_offset = 0;
+    tcc_free(s->lookup);
+    s->lookup = NULL;
 }
 
 ST_FUNC void tccelf_delete(TCCState *s1)
@@ -126,6 +153,9 @@ ST_FUNC void tccelf_delete(TCCState *s1)
     }
     tcc_free(sym_versions);
     tcc_free(sym_to_version);
+    for (i = 0; i < s1->nb_dll_symbols; i++)
+        dll_symbols_free(s1->dll_symbols[i]);
+    tcc_free(s1->dll_symbols);
 #endif
 
     /* free all sections */
@@ -200,6 +230,12 @@ ST_FUNC void tccelf_end_file(TCCState *s1)
         s = s1->sections[i + 1];
         s1->total_output[i] += s->data_offset - s->sh_offset;
     }
+    for (i = 1; i < s1->nb_sections; i++) {
+        s = s1->sections[i];
+        if (s->parent && s->parent->sh_num <= 4)
+            s1->total_output[s->parent->sh_num - 1]
+                += s->data_offset - s->sh_offset;
+    }
 }
 
 ST_FUNC Section *new_section(TCCState *s1, const char *name, int sh_type, int sh_flags)
@@ -244,9 +280,12 @@ ST_FUNC Section *new_section(TCCState *s1, const char *name, int sh_type, int sh
     return sec;
 }
 
+static void lookup_reset(Section *s, unsigned int size);
+
 ST_FUNC void init_symtab(Section *s)
 {
     int *ptr, nb_buckets = 1;
+    lookup_reset(s, 0);
     put_elf_str(s->link, "");
     section_ptr_add(s, sizeof (ElfW(Sym)));
     ptr = section_ptr_add(s->hash, (2 + nb_buckets + 1) * sizeof(int));
@@ -348,6 +387,53 @@ ST_FUNC Section *find_section(TCCState *s1, const char *name)
     return new_section(s1, name, SHT_PROGBITS, SHF_ALLOC);
 }
 
+/* sections for thread local variables, created on first use */
+ST_FUNC Section *tls_section(TCCState *s1, int nobits)
+{
+    const char *name = nobits ? ".tbss" : ".tdata";
+    Section *sec = have_section(s1, name);
+    if (sec)
+        return sec;
+    return new_section(s1, name, nobits ? SHT_NOBITS : SHT_PROGBITS,
+                       SHF_ALLOC | SHF_WRITE | SHF_TLS);
+}
+
+/* offset of 'addr' from the thread pointer, which points to the
+   (aligned) end of the TLS segment on i386 and x86_64 */
+ST_FUNC addr_t tls_tpoff(TCCState *s1, addr_t addr)
+{
+    addr_t start = (addr_t)-1, end = 0, align = 1;
+    Section *s;
+    int i;
+
+    for (i = 1; i < s1->nb_sections; i++) {
+        s = s1->sections[i];
+        if (!(s->sh_flags & SHF_TLS))
+            continue;
+        if (s->sh_addr < start)
+            start = s->sh_addr;
+        if (s->sh_addr + s->sh_size > end)
+            end = s->sh_addr + s->sh_size;
+        if (s->sh_addralign > align)
+            align = s->sh_addralign;
+    }
+    return addr - start - ((end - start + align - 1) & -align);
+}
+
+/* offset of 'addr' in the TLS segment, that is from the start of the
+   copy of each thread */
+ST_FUNC addr_t tls_dtpoff(TCCState *s1, addr_t addr)
+{
+    addr_t start = (addr_t)-1;
+    int i;
+
+    for (i = 1; i < s1->nb_sections; i++)
+        if ((s1->sections[i]->sh_flags & SHF_TLS)
+            && s1->sections[i]->sh_addr < start)
+            start = s1->sections[i]->sh_addr;
+    return addr - start;
+}
+
 /* ------------------------------------------------------------------------- */
 
 ST_FUNC int put_elf_str(Section *s, const char *sym)
@@ -377,6 +463,67 @@ static ElfW(Word) elf_hash(const unsigned char *name)
     return h;
 }
 
+static Elf32_Word elf_gnu_hash (const unsigned char *name)
+{
+    Elf32_Word h = 5381;
+    unsigned char c;
+
+    while ((c = *name++))
+        h = h * 33 + c;
+    return h;
+}
+
+/* Symbols are looked up in an open addressing table of (gnu hash,
+   symbol index) pairs, which mostly compares hashes in one cache line
+   before any name.  The SysV table in s->hash is only kept up to date
+   for the symbol tables that are output (.dynsym), the private ones
+   use the lookup table alone.  As with the SysV chains, the last of
+   symbols with the same name is found. */
+static void lookup_reset(Section *s, unsigned int size)
+{
+    tcc_free(s->lookup);
+    s->lookup = size ? tcc_mallocz(2 * size * sizeof(int)) : NULL;
+    s->lookup_mask = size - 1;
+    s->lookup_count = 0;
+}
+
+static void lookup_add(Section *s, const char *name, int sym_index)
+{
+    unsigned int h, i, j, n, *e, *old;
+    ElfW(Sym) *sym;
+
+    if (2 * (s->lookup_count + 1) > s->lookup_mask + 1) {
+        /* grow, at most half full */
+        old = s->lookup, n = old ? s->lookup_mask + 1 : 0;
+        s->lookup = NULL;
+        lookup_reset(s, n ? 2 * n : 64);
+        for (i = 0; i < n; i++) {
+            if (!old[2 * i + 1])
+                continue;
+            j = old[2 * i] & s->lookup_mask;
+            while (s->lookup[2 * j + 1])
+                j = (j + 1) & s->lookup_mask;
+            s->lookup[2 * j] = old[2 * i];
+            s->lookup[2 * j + 1] = old[2 * i + 1];
+            s->lookup_count++;
+        }
+        tcc_free(old);
+    }
+    h = elf_gnu_hash((const unsigned char *)name);
+    for (i = h & s->lookup_mask;; i = (i + 1) & s->lookup_mask) {
+        e = s->lookup + 2 * i;
+        if (!e[1])
+            break;
+        sym = &((ElfW(Sym) *)s->data)[e[1]];
+        if (e[0] == h && !strcmp(name, (char *)s->link->data + sym->st_name)) {
+            e[1] = sym_index;
+            return;
+        }
+    }
+    e[0] = h, e[1] = sym_index;
+    s->lookup_count++;
+}
+
 /* rebuild hash table of section s */
 /* NOTE: we do factorize the hash table code to go faster */
 static void rebuild_hash(Section *s, unsigned int nb_buckets)
@@ -387,6 +534,7 @@ static void rebuild_hash(Section *s, unsigned int nb_buckets)
 
     strtab = s->link->data;
     nb_syms = s->data_offset / sizeof(ElfW(Sym));
+    lookup_reset(s, 0);
 
     if (!nb_buckets)
         nb_buckets = ((int*)s->hash->data)[0];
@@ -406,6 +554,7 @@ static void rebuild_hash(Section *s, unsigned int nb_buckets)
             h = elf_hash(strtab + sym->st_name) % nb_buckets;
             *ptr = hash[h];
             hash[h] = sym_index;
+            lookup_add(s, (char *)strtab + sym->st_name, sym_index);
         } else {
             *ptr = 0;
         }
@@ -437,7 +586,11 @@ ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size,
     sym->st_shndx = shndx;
     sym_index = sym - (ElfW(Sym) *)s->data;
     hs = s->hash;
-    if (hs) {
+    if (hs && (hs->sh_flags & SHF_PRIVATE)) {
+        /* only add global or weak symbols. */
+        if (ELFW(ST_BIND)(info) != STB_LOCAL)
+            lookup_add(s, (char *)s->link->data + name_offset, sym_index);
+    } else if (hs) {
         int *ptr, *base;
         ptr = section_ptr_add(hs, sizeof(int));
         base = (int *)hs->data;
@@ -449,6 +602,7 @@ ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size,
             *ptr = base[2 + h];
             base[2 + h] = sym_index;
             base[1]++;
+            lookup_add(s, (char *)s->link->data + name_offset, sym_index);
             /* we resize the hash table */
             hs->nb_hashed_syms++;
             if (hs->nb_hashed_syms > 2 * nbuckets) {
@@ -465,24 +619,21 @@ ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size,
 ST_FUNC int find_elf_sym(Section *s, const char *name)
 {
     ElfW(Sym) *sym;
-    Section *hs;
-    int nbuckets, sym_index, h;
-    const char *name1;
+    unsigned int h, i, *e;
 
-    hs = s->hash;
-    if (!hs)
+    if (!s->hash || !s->lookup)
         return 0;
-    nbuckets = ((int *)hs->data)[0];
-    h = elf_hash((unsigned char *) name) % nbuckets;
-    sym_index = ((int *)hs->data)[2 + h];
-    while (sym_index != 0) {
-        sym = &((ElfW(Sym) *)s->data)[sym_index];
-        name1 = (char *) s->link->data + sym->st_name;
-        if (!strcmp(name, name1))
-            return sym_index;
-        sym_index = ((int *)hs->data)[2 + nbuckets + sym_index];
+    h = elf_gnu_hash((const unsigned char *)name);
+    for (i = h & s->lookup_mask;; i = (i + 1) & s->lookup_mask) {
+        e = s->lookup + 2 * i;
+        if (!e[1])
+            return 0;
+        if (e[0] == h) {
+            sym = &((ElfW(Sym) *)s->data)[e[1]];
+            if (!strcmp(name, (char *)s->link->data + sym->st_name))
+                return e[1];
+        }
     }
-    return 0;
 }
 
 /* return elf symbol value, signal error if 'err' is nonzero, decorate
@@ -578,7 +729,7 @@ version_add (TCCState *s1)
         if (sym->st_shndx != SHN_UNDEF)
             continue; /* defined symbol doesn't need library version */
         name = (char *) symtab->link->data + sym->st_name;
-        dllindex = find_elf_sym(s1->dynsymtab_section, name);
+        dllindex = find_dll_sym(s1, name);
         verndx = (dllindex && dllindex < nb_sym_to_version)
                  ? sym_to_version[dllindex] : -1;
         if (verndx >= 0) {
@@ -643,6 +794,14 @@ version_add (TCCState *s1)
 }
 #endif /* ndef ELF_OBJ_ONLY */
 
+/* common or bss, also a bss section of its own from -fdata-sections */
+static int tentative_shndx(TCCState *s1, int shndx)
+{
+    return shndx == SHN_COMMON || shndx == bss_section->sh_num
+        || (shndx < s1->nb_sections
+            && s1->sections[shndx]->parent == bss_section);
+}
+
 /* add an elf symbol : check if it is already defined and patch
    it. Return symbol index. NOTE that sh_num can be SHN_UNDEF. */
 ST_FUNC int set_elf_sym(Section *s, addr_t value, unsigned long size,
@@ -692,13 +851,12 @@ ST_FUNC int set_elf_sym(Section *s, addr_t value, unsigned long size,
                 /* keep first-found weak definition, ignore subsequents */
             } else if (sym_vis == STV_HIDDEN || sym_vis == STV_INTERNAL) {
                 /* ignore hidden symbols after */
-            } else if ((esym->st_shndx == SHN_COMMON
-                            || esym->st_shndx == bss_section->sh_num)
+            } else if (tentative_shndx(s1, esym->st_shndx)
                         && (shndx < SHN_LORESERVE
-                            && shndx != bss_section->sh_num)) {
+                            && !tentative_shndx(s1, shndx))) {
                 /* data symbol gets precedence over common/bss */
                 goto do_patch;
-            } else if (shndx == SHN_COMMON || shndx == bss_section->sh_num) {
+            } else if (tentative_shndx(s1, shndx)) {
                 /* data symbol keeps precedence over common/bss */
             } else if (s->sh_flags & SHF_DYNSYM) {
                 /* we accept that two DLL define the same symbol */
@@ -898,16 +1056,6 @@ static Section *create_gnu_hash(TCCState *s1)
     return gnu_hash;
 }
 
-static Elf32_Word elf_gnu_hash (const unsigned char *name)
-{
-    Elf32_Word h = 5381;
-    unsigned char c;
-
-    while ((c = *name++))
-        h = h * 33 + c;
-    return h;
-}
-
 static void update_gnu_hash(TCCState *s1, Section *gnu_hash)
 {
     int *old_to_new_syms;
@@ -1095,6 +1243,7 @@ static void relocate_section(TCCState *s1, Section *s, Section *sr)
     int is_dwarf = s->sh_num >= s1->dwlo && s->sh_num < s1->dwhi;
 
     qrel = (ElfW_Rel *)sr->data;
+    s1->reloc_code = !!(s->sh_flags & SHF_EXECINSTR);
     for_each_elem(sr, 0, rel, ElfW_Rel) {
         ptr = s->data + rel->r_offset;
         sym_index = ELFW(R_SYM)(rel->r_info);
@@ -1606,7 +1755,9 @@ ST_FUNC void tcc_add_btstub(TCCState *s1)
     p = section_ptr_add(s, 2 * sizeof (int));
     p[0] = s1->rt_num_callers;
     p[1] = s1->dwarf;
-    // if (s->data_offset - o != 10*PTR_SIZE + 2*sizeof (int)) exit(99);
+    /* lines, built at run time */
+    section_ptr_add(s, PTR_SIZE);
+    // if (s->data_offset - o != 11*PTR_SIZE + 2*sizeof (int)) exit(99);
 
     if (s1->output_type == TCC_OUTPUT_MEMORY) {
         set_global_sym(s1, __rt_info, s, o);
@@ -1638,7 +1789,9 @@ ST_FUNC void tcc_add_btstub(TCCState *s1)
 }
 #endif /* def CONFIG_TCC_BACKTRACE */
 
-static void tcc_tcov_add_file(TCCState *s1, const char *filename)
+/* end the .tcov section with the name of the .tcov file to write at
+   exit, or with no name for tcc_relocate(), see tcc_list_coverage() */
+ST_FUNC void tcc_tcov_add_file(TCCState *s1, const char *filename)
 {
     CString cstr;
     void *ptr;
@@ -1648,6 +1801,11 @@ static void tcc_tcov_add_file(TCCState *s1, const char *filename)
         return;
     section_ptr_add(tcov_section, 1);
     write32le (tcov_section->data, tcov_section->data_offset);
+    if (NULL == filename) {
+        section_ptr_add(tcov_section, 1);
+        set_global_sym(s1, &"___tcov_data"[!s1->leading_underscore], tcov_section, 0);
+        return;
+    }
 
     cstr_new (&cstr);
     if (filename[0] == '/')
@@ -1864,6 +2022,187 @@ ST_FUNC void resolve_common_syms(TCCState *s1)
 }
 
 #ifndef ELF_OBJ_ONLY
+/* sections which -Wl,--gc-sections may drop: those from
+   -ffunction-sections and -fdata-sections, also from other compilers */
+static int gc_candidate(Section *s)
+{
+    static const char *const prefix[] = {
+        ".text.", ".data.", ".rodata.", ".bss.", ".tdata.", ".tbss.", NULL
+    };
+    int i;
+
+    if (s->parent)
+        return 1;
+    if (!(s->sh_flags & SHF_ALLOC)
+        || (s->sh_type != SHT_PROGBITS && s->sh_type != SHT_NOBITS))
+        return 0;
+    for (i = 0; prefix[i]; i++)
+        if (!strncmp(s->name, prefix[i], strlen(prefix[i])))
+            return 1;
+    return 0;
+}
+
+static void gc_keep(TCCState *s1, ElfW(Sym) *sym, char *keep, int *stack, int *sp)
+{
+    int i = sym->st_shndx;
+
+    if (i != SHN_UNDEF && i < s1->nb_sections && !keep[i])
+        keep[i] = 1, stack[(*sp)++] = i;
+}
+
+static int gc_hot_first(const void *a, const void *b)
+{
+    Section *s = *(Section **)a, *t = *(Section **)b;
+
+    if (s->hot != t->hot)
+        return s->hot < t->hot ? 1 : -1;
+    return s->sh_num - t->sh_num;
+}
+
+/* with -Wl,--gc-sections, drop the candidate sections which cannot be
+   reached through relocations from the entry point, the exported
+   symbols or the other sections, then append the split sections which
+   are kept to their parent again, the hottest first with -fprofile-use.
+   Done before the common symbols and the linker symbols (_etext, _end
+   ...) get their values. */
+ST_FUNC void gc_sections(TCCState *s1)
+{
+    Section *s, *p;
+    ElfW(Sym) *sym;
+    ElfW_Rel *rel;
+    const char *name;
+    const char *entry[4];
+    char *keep, *used;
+    int *stack, sp, i, j, n, nb_sections, nb_syms, sym_index;
+    addr_t offset, addend, *moved;
+    Section **order;
+
+    /* sections for the relocations of the parents may be added */
+    nb_sections = s1->nb_sections;
+    for (i = 1; i < nb_sections; i++)
+        if (s1->sections[i]->parent)
+            break;
+    if (i == nb_sections && !s1->gc_sections)
+        return;
+    nb_syms = symtab_section->data_offset / sizeof (ElfW(Sym));
+    keep = tcc_mallocz(nb_sections);
+    used = tcc_mallocz(nb_syms);
+    stack = tcc_malloc(nb_sections * sizeof *stack);
+    moved = tcc_mallocz(nb_sections * sizeof *moved);
+    sp = 0;
+    for (i = 1; i < nb_sections; i++)
+        if (!s1->gc_sections || !gc_candidate(s1->sections[i]))
+            keep[i] = 1, stack[sp++] = i;
+
+    entry[0] = "main", entry[1] = "_start", entry[2] = s1->elf_entryname;
+    entry[3] = NULL;
+#ifdef TCC_IS_NATIVE
+    entry[3] = s1->run_main;
+#endif
+    for (i = 0; i < 4; i++)
+        if (entry[i] && (sym_index = find_elf_sym(symtab_section, entry[i])))
+            gc_keep(s1, (ElfW(Sym) *)symtab_section->data + sym_index,
+                    keep, stack, &sp);
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (ELFW(ST_BIND)(sym->st_info) == STB_LOCAL
+            || ELFW(ST_VISIBILITY)(sym->st_other) == STV_HIDDEN)
+            continue;
+        name = (char *)symtab_section->link->data + sym->st_name;
+        /* exported, or needed by the shared libraries */
+        if (s1->output_type == TCC_OUTPUT_DLL || s1->rdynamic
+            || (s1->output_type != TCC_OUTPUT_MEMORY && !s1->static_link
+                && sym->st_shndx != SHN_UNDEF && find_dll_sym(s1, name)))
+            gc_keep(s1, sym, keep, stack, &sp);
+    }
+
+    while (sp) {
+        s = s1->sections[stack[--sp]];
+        /* debug info does not keep code */
+        if (!s->reloc || !(s->sh_flags & SHF_ALLOC))
+            continue;
+        for_each_elem(s->reloc, 0, rel, ElfW_Rel) {
+            sym_index = ELFW(R_SYM)(rel->r_info);
+            used[sym_index] = 1;
+            gc_keep(s1, (ElfW(Sym) *)symtab_section->data + sym_index,
+                    keep, stack, &sp);
+        }
+    }
+
+    /* -fprofile-use: the functions which were run first, the most
+       used first, so that they share the fewest pages */
+    order = tcc_malloc(nb_sections * sizeof *order);
+    for (i = 1, n = 0; i < nb_sections; i++)
+        if (!keep[i] || s1->sections[i]->parent)
+            order[n++] = s1->sections[i];
+    qsort(order, n, sizeof *order, gc_hot_first);
+
+    for (j = 0; j < n; j++) {
+        s = order[j];
+        i = s->sh_num;
+        p = s->parent;
+        if (keep[i]) {
+            /* append the section to its parent */
+            offset = section_add(p, s->data_offset, s->sh_addralign);
+            if (s->sh_type != SHT_NOBITS)
+                memcpy(p->data + offset, s->data, s->data_offset);
+            if (s->reloc) {
+                for_each_elem(s->reloc, 0, rel, ElfW_Rel) {
+#if SHT_RELX == SHT_RELA
+                    addend = rel->r_addend;
+#else
+                    addend = 0;
+#endif
+                    put_elf_reloca(symtab_section, p, rel->r_offset + offset,
+                                   ELFW(R_TYPE)(rel->r_info),
+                                   ELFW(R_SYM)(rel->r_info), addend);
+                }
+            }
+            moved[i] = offset;
+        } else if (s->reloc) {
+            for_each_elem(s->reloc, 0, rel, ElfW_Rel)
+                used[ELFW(R_SYM)(rel->r_info)] |= 2;
+        }
+        /* not to be laid out, nor written */
+        s->data_offset = 0;
+        s->sh_flags = 0;
+        if (s->reloc)
+            s->reloc->data_offset = 0;
+    }
+
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        i = sym->st_shndx;
+        if (i == SHN_UNDEF || i >= nb_sections
+            || (keep[i] && !s1->sections[i]->parent))
+            continue;
+        s = s1->sections[i];
+        if (keep[i]) {
+            sym->st_shndx = s->parent->sh_num;
+            sym->st_value += moved[i];
+        } else {
+            /* dropped: cannot be used any longer, nor be a definition
+               for tcc_import_symbols() */
+            sym->st_info = ELFW(ST_INFO)(STB_LOCAL, ELFW(ST_TYPE)(sym->st_info));
+            sym->st_shndx = SHN_ABS;
+            sym->st_value = sym->st_size = 0;
+        }
+    }
+
+    /* undefined symbols only used by code which was dropped need not be
+       found any longer */
+    for (sym_index = 1; sym_index < nb_syms; sym_index++) {
+        sym = (ElfW(Sym) *)symtab_section->data + sym_index;
+        if (sym->st_shndx == SHN_UNDEF && used[sym_index] == 2) {
+            sym->st_info = ELFW(ST_INFO)(STB_LOCAL, ELFW(ST_TYPE)(sym->st_info));
+            sym->st_shndx = SHN_ABS, sym->st_value = 0;
+        }
+    }
+    tcc_free(keep);
+    tcc_free(used);
+    tcc_free(stack);
+    tcc_free(moved);
+    tcc_free(order);
+}
+
 ST_FUNC void fill_got_entry(TCCState *s1, ElfW_Rel *rel)
 {
     int sym_index = ELFW(R_SYM) (rel->r_info);
@@ -1950,7 +2289,7 @@ static void bind_exe_dynsyms(TCCState *s1, int is_PIE)
     for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
         if (sym->st_shndx == SHN_UNDEF) {
             name = (char *) symtab_section->link->data + sym->st_name;
-            sym_index = find_elf_sym(s1->dynsymtab_section, name);
+            sym_index = find_dll_sym(s1, name);
             if (sym_index) {
                 if (is_PIE)
                     continue;
@@ -1984,17 +2323,15 @@ static void bind_exe_dynsyms(TCCState *s1, int is_PIE)
 
                     /* Ensure R_COPY works for weak symbol aliases */
                     if (ELFW(ST_BIND)(esym->st_info) == STB_WEAK) {
-                        for_each_elem(s1->dynsymtab_section, 1, dynsym, ElfW(Sym)) {
-                            if ((dynsym->st_value == esym->st_value)
-                                && (ELFW(ST_BIND)(dynsym->st_info) == STB_GLOBAL)) {
-                                char *dynname = (char *) s1->dynsymtab_section->link->data
-                                                + dynsym->st_name;
-                                put_elf_sym(s1->dynsym, offset, dynsym->st_size,
-                                            dynsym->st_info, 0,
-                                            bss_section->sh_num, dynname);
-                                break;
-                            }
+                        int alias = find_dll_alias(s1, esym->st_value);
+                        if (alias) {
+                            dynsym = (ElfW(Sym) *)s1->dynsymtab_section->data + alias;
+                            put_elf_sym(s1->dynsym, offset, dynsym->st_size,
+                                        dynsym->st_info, 0, bss_section->sh_num,
+                                        (char *) s1->dynsymtab_section->link->data
+                                        + dynsym->st_name);
                         }
+                        esym = (ElfW(Sym) *)s1->dynsymtab_section->data + sym_index;
                     }
 
                     put_elf_reloc(s1->dynsym, bss_section,
@@ -2028,7 +2365,7 @@ static void bind_libs_dynsyms(TCCState *s1)
 
     for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
         name = (char *)symtab_section->link->data + sym->st_name;
-        dynsym_index = find_elf_sym(s1->dynsymtab_section, name);
+        dynsym_index = find_dll_sym(s1, name);
         if (sym->st_shndx != SHN_UNDEF) {
             if (ELFW(ST_BIND)(sym->st_info) != STB_LOCAL
                 && (dynsym_index || s1->rdynamic))
@@ -2129,6 +2466,9 @@ struct dyn_inf {
 
     /* read only segment mapping for GNU_RELRO */
     Section _roinf, *roinf;
+    /* thread local storage segment: sh_size and data_offset are the
+       memory and file sizes of the PT_TLS header */
+    Section _tlsinf, *tlsinf;
 };
 
 /* Decide the layout of sections loaded in memory. This must be done before
@@ -2264,6 +2604,16 @@ static int layout_sections(TCCState *s1, int *sec_order, struct dyn_inf *d)
         ++phnum;
     if (d->roinf)
         ++phnum;
+    for (i = 1; i < s1->nb_sections; i++) {
+        s = s1->sections[i];
+        if ((s->sh_flags & (SHF_ALLOC | SHF_TLS)) == (SHF_ALLOC | SHF_TLS)) {
+            /* start the segment at its largest alignment */
+            if (!d->tlsinf)
+                d->tlsinf = &d->_tlsinf, ++phnum;
+            if (s->sh_addralign > d->tlsinf->sh_addralign)
+                d->tlsinf->sh_addralign = s->sh_addralign;
+        }
+    }
     d->phnum = phnum;
     d->phdr = tcc_mallocz(phnum * sizeof(ElfW(Phdr)));
 
@@ -2301,6 +2651,8 @@ static int layout_sections(TCCState *s1, int *sec_order, struct dyn_inf *d)
         s = s1->sections[sec_order[i]];
         f = sec_order[i + s1->nb_sections];
         align = s->sh_addralign - 1;
+        if ((f & SHF_TLS) && d->tlsinf->sh_size == 0)
+            align = d->tlsinf->sh_addralign - 1;
 
         if (f == 0) { /* no alloc */
             file_offset = (file_offset + align) & ~align;
@@ -2313,6 +2665,9 @@ static int layout_sections(TCCState *s1, int *sec_order, struct dyn_inf *d)
         if ((f & 1<<8) && n) {
             /* different rwx section flags */
             if (s1->output_format == TCC_OUTPUT_FORMAT_ELF) {
+                /* a preceding .bss moved the address but not the file
+                   offset: restore their congruence for the new segment */
+                addr += (file_offset - addr) & (s_align - 1);
                 /* if in the middle of a page, w e duplicate the page in
                    memory so that one copy is RX and the other is RW */
                 if ((addr & (s_align - 1)) != 0)
@@ -2338,10 +2693,6 @@ static int layout_sections(TCCState *s1, int *sec_order, struct dyn_inf *d)
                 ph->p_flags |= PF_W;
             if (f & SHF_EXECINSTR)
                 ph->p_flags |= PF_X;
-            if (f & SHF_TLS) {
-                ph->p_type = PT_TLS;
-                ph->p_align = align + 1;
-            }
 
             ph->p_offset = file_offset;
             ph->p_vaddr = addr;
@@ -2367,6 +2718,17 @@ static int layout_sections(TCCState *s1, int *sec_order, struct dyn_inf *d)
             roinf->sh_size = (addr - roinf->sh_addr) + s->sh_size;
         }
 
+        if (f & SHF_TLS) {
+            Section *tlsinf = d->tlsinf;
+            if (tlsinf->sh_size == 0) {
+                tlsinf->sh_offset = s->sh_offset;
+                tlsinf->sh_addr = s->sh_addr;
+            }
+            tlsinf->sh_size = (addr - tlsinf->sh_addr) + s->sh_size;
+            if (s->sh_type != SHT_NOBITS)
+                tlsinf->data_offset = tlsinf->sh_size;
+        }
+
         addr += s->sh_size;
         if (s->sh_type != SHT_NOBITS)
             file_offset += s->sh_size;
@@ -2382,6 +2744,10 @@ static int layout_sections(TCCState *s1, int *sec_order, struct dyn_inf *d)
         fill_phdr(++ph, PT_DYNAMIC, d->dynamic)->p_flags |= PF_W;
     if (d->roinf)
         fill_phdr(++ph, PT_GNU_RELRO, d->roinf)->p_flags |= PF_W;
+    if (d->tlsinf) {
+        fill_phdr(++ph, PT_TLS, d->tlsinf)->p_filesz = d->tlsinf->data_offset;
+        ph->p_memsz = d->tlsinf->sh_size;
+    }
     if (d->interp)
         fill_phdr(&d->phdr[1], PT_INTERP, d->interp);
     if (phfill) {
@@ -2826,6 +3192,7 @@ static int elf_output_file(TCCState *s1, const char *filename)
 #endif
         /* if linking, also link in runtime libraries (libc, libgcc, etc.) */
         tcc_add_runtime(s1);
+        gc_sections(s1);
 	resolve_common_syms(s1);
 
         if (!s1->static_link) {
@@ -3013,6 +3380,18 @@ LIBTCCAPI int tcc_output_file(TCCState *s, const char *filename)
 #endif
 }
 
+LIBTCCAPI int tcc_output_object(TCCState *s, const char *filename)
+{
+    int ret, output_type = s->output_type, output_format = s->output_format;
+    /* always elf for objects */
+    s->output_type = TCC_OUTPUT_OBJ;
+    s->output_format = TCC_OUTPUT_FORMAT_ELF;
+    ret = elf_output_obj(s, filename);
+    s->output_type = output_type;
+    s->output_format = output_format;
+    return ret;
+}
+
 ST_FUNC ssize_t full_read(int fd, void *buf, size_t count) {
     char *cbuf = buf;
     size_t rnum = 0;
@@ -3607,21 +3986,183 @@ static void store_version(TCCState *s1, struct versym_info *v, char *dynstr)
 #endif
 }
 
+/* enter symbol 'i' of a library in dynsymtab, with its version */
+static void dll_import(TCCState *s1, struct dll_symbols *d, int i)
+{
+    ElfW(Sym) *sym = d->dynsym + i;
+    int sym_index;
+
+    if (ELFW(ST_BIND)(sym->st_info) == STB_LOCAL)
+        return;
+    sym_index = set_elf_sym(s1->dynsymtab_section, sym->st_value, sym->st_size,
+                            sym->st_info, sym->st_other, sym->st_shndx,
+                            d->dynstr + sym->st_name);
+    if (d->versym) {
+        ElfW(Half) vsym = d->versym[i];
+        if ((vsym & 0x8000) == 0 && vsym > 0 && vsym < d->nb_local_ver)
+            set_sym_version(s1, sym_index, d->local_ver[vsym]);
+    }
+}
+
+/* enter the symbols called 'name' of a mapped library, in the order of
+   its dynsym like tcc_load_dll() does for all symbols: first those the
+   .gnu.hash section leaves out, then the hashed ones */
+static void dll_import_name(TCCState *s1, struct dll_symbols *d,
+                            const char *name, Elf32_Word hash)
+{
+    Elf32_Word *h = d->gnu_hash, symoffset = h[1], *buckets, *chain, h2;
+    addr_t *bloom = (addr_t *)(h + 4), mask;
+    unsigned int i, idx;
+
+    for (i = hash & d->unhashed_mask; (idx = d->unhashed[2 * i + 1]) != 0;
+         i = (i + 1) & d->unhashed_mask)
+        if (d->unhashed[2 * i] == hash
+            && !strcmp(name, d->dynstr + d->dynsym[idx].st_name))
+            dll_import(s1, d, idx);
+
+    mask = (addr_t)1 << (hash % ELFCLASS_BITS)
+         | (addr_t)1 << ((hash >> h[3]) % ELFCLASS_BITS);
+    if ((bloom[(hash / ELFCLASS_BITS) % h[2]] & mask) != mask)
+        return;
+    buckets = (Elf32_Word *)(bloom + h[2]);
+    chain = buckets + h[0];
+    idx = buckets[hash % h[0]];
+    if (idx < symoffset)
+        return;
+    do {
+        h2 = chain[idx - symoffset];
+        if ((h2 | 1) == (hash | 1)
+            && !strcmp(name, d->dynstr + d->dynsym[idx].st_name))
+            dll_import(s1, d, idx);
+        idx++;
+    } while (!(h2 & 1) && idx < d->nb_syms);
+}
+
+static void dll_symbols_free(struct dll_symbols *d)
+{
+#ifndef _WIN32
+    munmap(d->map, d->map_size);
+#endif
+    tcc_free(d->local_ver);
+    tcc_free(d->unhashed);
+    tcc_free(d);
+}
+
+/* enter all symbols of the libraries still mapped, in the order the
+   libraries were loaded, and enter those of the next ones at load time */
+static void dll_import_all(TCCState *s1)
+{
+    struct dll_symbols *d;
+    int i, j;
+
+    for (i = 0; i < s1->nb_dll_symbols; i++) {
+        d = s1->dll_symbols[i];
+        for (j = 1; j < d->nb_syms; j++)
+            dll_import(s1, d, j);
+        dll_symbols_free(d);
+    }
+    tcc_free(s1->dll_symbols);
+    s1->dll_symbols = NULL;
+    s1->nb_dll_symbols = 0;
+    s1->dll_symbols_eager = 1;
+}
+
+/* index in dynsymtab of symbol 'name' of the loaded libraries.  Symbols
+   of mapped libraries are entered there when first looked up. */
+static int find_dll_sym(TCCState *s1, const char *name)
+{
+    int i, sym_index = find_elf_sym(s1->dynsymtab_section, name);
+    Elf32_Word hash;
+
+    if (sym_index || !s1->nb_dll_symbols)
+        return sym_index;
+    /* a library loaded from now on could come before in dynsymtab */
+    s1->dll_symbols_eager = 1;
+    hash = elf_gnu_hash((const unsigned char *)name);
+    for (i = 0; i < s1->nb_dll_symbols; i++)
+        dll_import_name(s1, s1->dll_symbols[i], name, hash);
+    return find_elf_sym(s1->dynsymtab_section, name);
+}
+
+/* first global symbol of the loaded libraries at 'value', looked for in
+   the order of dynsymtab if all symbols were entered at load time */
+static int find_dll_alias(TCCState *s1, addr_t value)
+{
+    struct dll_symbols *d;
+    ElfW(Sym) *esym;
+    int i, j, sym_index;
+
+    for (i = 0; i < s1->nb_dll_symbols; i++) {
+        d = s1->dll_symbols[i];
+        for (j = 1; j < d->nb_syms; j++) {
+            if (ELFW(ST_BIND)(d->dynsym[j].st_info) == STB_LOCAL)
+                continue;
+            sym_index = find_dll_sym(s1, d->dynstr + d->dynsym[j].st_name);
+            esym = (ElfW(Sym) *)s1->dynsymtab_section->data + sym_index;
+            if (esym->st_value == value
+                && ELFW(ST_BIND)(esym->st_info) == STB_GLOBAL)
+                return sym_index;
+        }
+    }
+    for_each_elem(s1->dynsymtab_section, 1, esym, ElfW(Sym))
+        if (esym->st_value == value
+            && ELFW(ST_BIND)(esym->st_info) == STB_GLOBAL)
+            return esym - (ElfW(Sym) *)s1->dynsymtab_section->data;
+    return 0;
+}
+
+/* set up the lookup by name of the symbols of a mapped library, from its
+   .gnu.hash section and an index of the symbols left out of it */
+static int dll_symbols_init(struct dll_symbols *d, ElfW(Shdr) *sh)
+{
+    Elf32_Word *h = (Elf32_Word *)((char *)d->map + sh->sh_offset), hash;
+    unsigned int i, j, n;
+
+    if (sh->sh_size < 4 * sizeof(Elf32_Word) || !h[0] || !h[2]
+        || h[1] > (unsigned)d->nb_syms
+        || (sh->sh_size - 4 * sizeof(Elf32_Word)) / sizeof(Elf32_Word)
+           < (unsigned long)h[2] * (sizeof(addr_t) / sizeof(Elf32_Word))
+             + h[0] + d->nb_syms - h[1])
+        return 0;
+    d->gnu_hash = h;
+    for (n = 8; n < 2 * h[1]; n *= 2)
+        ;
+    d->unhashed = tcc_mallocz(2 * n * sizeof(unsigned int));
+    d->unhashed_mask = n - 1;
+    for (i = 1; i < h[1]; i++) {
+        if (ELFW(ST_BIND)(d->dynsym[i].st_info) == STB_LOCAL)
+            continue;
+        hash = elf_gnu_hash((unsigned char *)d->dynstr + d->dynsym[i].st_name);
+        for (j = hash & d->unhashed_mask; d->unhashed[2 * j + 1];
+             j = (j + 1) & d->unhashed_mask)
+            ;
+        d->unhashed[2 * j] = hash;
+        d->unhashed[2 * j + 1] = i;
+    }
+    return 1;
+}
+
 /* load a library / DLL
    'level = 0' means that the DLL is referenced by the user
-   (so it should be added as DT_NEEDED in the generated ELF file) */
+   (so it should be added as DT_NEEDED in the generated ELF file).
+   The library stays mapped and its symbols are entered in dynsymtab when
+   looked up, through its .gnu.hash section: a few page faults instead of
+   reading and entering thousands of symbols, most of them never used. */
 ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
 {
     ElfW(Ehdr) ehdr;
-    ElfW(Shdr) *shdr, *sh, *sh1;
-    int i, nb_syms, nb_dts, sym_bind, ret = -1;
-    ElfW(Sym) *sym, *dynsym;
+    ElfW(Shdr) *shdr, *sh, *sh1, *symsh, *gnush;
+    int i, nb_syms, nb_dts, ret = -1;
+    ElfW(Sym) *dynsym;
     ElfW(Dyn) *dt, *dynamic;
 
     char *dynstr;
-    int sym_index;
-    const char *name, *soname;
+    const char *soname;
     struct versym_info v;
+    struct dll_symbols dll, *d;
+    void *map = NULL;
+    size_t map_size = 0;
+    int mapped = 0;
 
     full_read(fd, &ehdr, sizeof(ehdr));
 
@@ -3634,35 +4175,60 @@ ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
     /* read sections */
     shdr = load_data(fd, ehdr.e_shoff, sizeof(ElfW(Shdr)) * ehdr.e_shnum);
 
+#ifndef _WIN32
+    {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            map_size = st.st_size;
+            map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED)
+                map = NULL;
+        }
+        for(i = 0, sh = shdr; map && i < ehdr.e_shnum; i++, sh++)
+            if (sh->sh_type != SHT_NOBITS
+                && (sh->sh_offset > map_size
+                    || sh->sh_size > map_size - sh->sh_offset))
+                munmap(map, map_size), map = NULL;
+        mapped = map != NULL;
+    }
+#endif
+#define DLL_DATA(sh) (mapped ? (void *)((char *)map + (sh)->sh_offset) \
+                             : load_data(fd, (sh)->sh_offset, (sh)->sh_size))
+
     /* load dynamic section and dynamic symbols */
     nb_syms = 0;
     nb_dts = 0;
     dynamic = NULL;
     dynsym = NULL; /* avoid warning */
     dynstr = NULL; /* avoid warning */
+    symsh = gnush = NULL;
     memset(&v, 0, sizeof v);
 
     for(i = 0, sh = shdr; i < ehdr.e_shnum; i++, sh++) {
         switch(sh->sh_type) {
         case SHT_DYNAMIC:
             nb_dts = sh->sh_size / sizeof(ElfW(Dyn));
-            dynamic = load_data(fd, sh->sh_offset, sh->sh_size);
+            dynamic = DLL_DATA(sh);
             break;
         case SHT_DYNSYM:
             nb_syms = sh->sh_size / sizeof(ElfW(Sym));
-            dynsym = load_data(fd, sh->sh_offset, sh->sh_size);
+            dynsym = DLL_DATA(sh);
             sh1 = &shdr[sh->sh_link];
-            dynstr = load_data(fd, sh1->sh_offset, sh1->sh_size);
+            dynstr = DLL_DATA(sh1);
+            symsh = sh;
+            break;
+        case SHT_GNU_HASH:
+            gnush = sh;
             break;
         case SHT_GNU_verdef:
-	    v.verdef = load_data(fd, sh->sh_offset, sh->sh_size);
+	    v.verdef = DLL_DATA(sh);
 	    break;
         case SHT_GNU_verneed:
-	    v.verneed = load_data(fd, sh->sh_offset, sh->sh_size);
+	    v.verneed = DLL_DATA(sh);
 	    break;
         case SHT_GNU_versym:
             v.nb_versyms = sh->sh_size / sizeof(ElfW(Half));
-	    v.versym = load_data(fd, sh->sh_offset, sh->sh_size);
+	    v.versym = DLL_DATA(sh);
 	    break;
         default:
             break;
@@ -3682,26 +4248,39 @@ ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
     if (tcc_add_dllref(s1, soname, level)->found)
         goto ret_success;
 
-    if (v.nb_versyms != nb_syms)
-        tcc_free (v.versym), v.versym = NULL;
-    else
+    if (v.nb_versyms != nb_syms) {
+        if (!mapped)
+            tcc_free(v.versym);
+        v.versym = NULL;
+    } else
         store_version(s1, &v, dynstr);
 
-    /* add dynamic symbols in dynsym_section */
-    for(i = 1, sym = dynsym + 1; i < nb_syms; i++, sym++) {
-        sym_bind = ELFW(ST_BIND)(sym->st_info);
-        if (sym_bind == STB_LOCAL)
-            continue;
-        name = dynstr + sym->st_name;
-        sym_index = set_elf_sym(s1->dynsymtab_section, sym->st_value, sym->st_size,
-                                sym->st_info, sym->st_other, sym->st_shndx, name);
-        if (v.versym) {
-            ElfW(Half) vsym = v.versym[i];
-            if ((vsym & 0x8000) == 0 && vsym > 0 && vsym < v.nb_local_ver)
-                set_sym_version(s1, sym_index, v.local_ver[vsym]);
+    memset(&dll, 0, sizeof dll);
+    dll.dynsym = dynsym;
+    dll.dynstr = dynstr;
+    dll.nb_syms = nb_syms;
+    dll.versym = v.versym;
+    dll.nb_local_ver = v.nb_local_ver;
+    dll.local_ver = v.local_ver;
+
+    if (mapped && !s1->dll_symbols_eager && gnush
+        && gnush->sh_link == symsh - shdr) {
+        dll.map = map;
+        dll.map_size = map_size;
+        if (dll_symbols_init(&dll, gnush)) {
+            d = tcc_malloc(sizeof *d);
+            *d = dll;
+            dynarray_add(&s1->dll_symbols, &s1->nb_dll_symbols, d);
+            map = NULL, v.local_ver = NULL; /* now owned by 'd' */
+            goto ret_success;
         }
     }
 
+    /* add dynamic symbols in dynsym_section */
+    dll_import_all(s1);
+    for(i = 1; i < nb_syms; i++)
+        dll_import(s1, &dll, i);
+
     /* do not load all referenced libraries
        (recursive loading can break linking of libraries) */
     /* following DT_NEEDED is needed for the dynamic loader (libdl.so),
@@ -3732,16 +4311,23 @@ ST_FUNC int tcc_load_dll(TCCState *s1, int fd, const char *filename, int level)
  ret_success:
     ret = 0;
  the_end:
-    tcc_free(dynstr);
-    tcc_free(dynsym);
-    tcc_free(dynamic);
+    if (!mapped) {
+        tcc_free(dynstr);
+        tcc_free(dynsym);
+        tcc_free(dynamic);
+        tcc_free(v.verdef);
+        tcc_free(v.verneed);
+        tcc_free(v.versym);
+    }
+#ifndef _WIN32
+    if (map)
+        munmap(map, map_size);
+#endif
     tcc_free(shdr);
     tcc_free(v.local_ver);
-    tcc_free(v.verdef);
-    tcc_free(v.verneed);
-    tcc_free(v.versym);
     return ret;
 }
+#undef DLL_DATA
 
 #define LD_TOK_NAME 256
 #define LD_TOK_EOF  (-1)
@@ -37,16 +37,16 @@ ST_DATA Sym *define_stack;
 ST_DATA Sym *global_label_stack;
 ST_DATA Sym *local_label_stack;
 
-static Sym *sym_free_first;
-static void **sym_pools;
-static int nb_sym_pools;
+static ST_TLS Sym *sym_free_first;
+static ST_TLS void **sym_pools;
+static ST_TLS int nb_sym_pools;
 
-static Sym *all_cleanups, *pending_gotos;
-static int local_scope;
+static ST_TLS Sym *all_cleanups, *pending_gotos;
+static ST_TLS int local_scope;
 ST_DATA char debug_modes;
 
 ST_DATA SValue *vtop;
-static SValue _vstack[1 + VSTACK_SIZE];
+static ST_TLS SValue *_vstack;
 #define vstack (_vstack + 1)
 
 ST_DATA int nocode_wanted; /* no code generation wanted */
@@ -74,7 +74,7 @@ ST_DATA int func_vc;
 ST_DATA int func_ind;
 ST_DATA const char *funcname;
 ST_DATA CType int_type, func_old_type, char_type, char_pointer_type;
-static CString initstr;
+static ST_TLS CString initstr;
 
 #if PTR_SIZE == 4
 #define VT_SIZE_T (VT_INT | VT_UNSIGNED)
@@ -87,7 +87,7 @@ static CString initstr;
 #define VT_PTRDIFF_T (VT_LONG | VT_LLONG)
 #endif
 
-static struct switch_t {
+static ST_TLS struct switch_t {
     struct case_t {
         int64_t v1, v2;
 	int sym;
@@ -102,14 +102,14 @@ static struct switch_t {
 
 #define MAX_TEMP_LOCAL_VARIABLE_NUMBER 8
 /*list of temporary local variables on the stack in current function. */
-static struct temp_local_variable {
+static ST_TLS struct temp_local_variable {
 	int location; //offset on stack. Svalue.c.i
 	short size;
 	short align;
 } arr_temp_local_vars[MAX_TEMP_LOCAL_VARIABLE_NUMBER];
-static int nb_temp_local_vars;
+static ST_TLS int nb_temp_local_vars;
 
-static struct scope {
+static ST_TLS struct scope {
     struct scope *prev;
     struct { int loc, locorig, num; } vla;
     struct { Sym *s; int n; } cl;
@@ -117,6 +117,25 @@ static struct scope {
     Sym *lstk, *llstk;
 } *cur_scope, *loop_scope, *root_scope;
 
+/* inline expansion of a function call in progress */
+static ST_TLS struct inline_call {
+    InlineFunc *fn;
+    int ret; /* location of the return value */
+    int level; /* local_scope of the function body */
+    struct inline_call *prev;
+} *cur_inline;
+
+#define INLINE_DEPTH_MAX 8
+
+/* a 'return' expression starts at the next unary() */
+static ST_TLS int tail_call_pos;
+/* the address of something in the stack frame may have been taken */
+static ST_TLS int func_frame_escapes;
+/* the current function, if it calls the -finstrument-functions hooks */
+static ST_TLS Sym *func_instrument;
+/* tail calls generated in the current function */
+static ST_TLS int *func_tail_calls, nb_func_tail_calls;
+
 typedef struct {
     Section *sec;
     int local_offset;
@@ -139,9 +158,12 @@ static int is_compatible_types(CType *type1, CType *type2);
 static int parse_btype(CType *type, AttributeDef *ad, int ignore_label);
 static CType *type_decl(CType *type, AttributeDef *ad, int *v, int td);
 static void parse_expr_type(CType *type);
+static void make_vector_type(CType *type, int size);
 static void init_putv(init_params *p, CType *type, unsigned long c);
 static void decl_initializer(init_params *p, CType *type, unsigned long c, int flags);
 static void decl_initializer_alloc(CType *type, AttributeDef *ad, int r, int has_init, int v, int scope);
+static Section *sym_section(Section *sec, int v, int split);
+static void gen_instrument(int v);
 static int decl(int l);
 static void expr_eq(void);
 static void vpush_type_size(CType *type, int *a);
@@ -158,6 +180,7 @@ static int get_temp_local_var(int size,int align);
 static void clear_temp_local_var_list();
 static void cast_error(CType *st, CType *dt);
 static void end_switch(void);
+static int gen_inline_call(void);
 
 /* ------------------------------------------------------------------------- */
 /* Automagical code suppression */
@@ -219,6 +242,17 @@ static inline int is_integer_btype(int bt)
         || bt == VT_LLONG;
 }
 
+/* GNU C vector types are structs holding one array of 'n' elements */
+static inline int is_vector_type(CType *type)
+{
+    return (type->t & VT_BTYPE) == VT_STRUCT && type->ref->a.vector;
+}
+
+static inline CType *vector_elem_type(CType *type)
+{
+    return &type->ref->next->type.ref->type;
+}
+
 static int btype_size(int bt)
 {
     return bt == VT_BYTE || bt == VT_BOOL ? 1 :
@@ -358,6 +392,7 @@ void pv (const char *lbl, int a, int b)
 /* initialize vstack and types.  This must be done also for tcc -E */
 ST_FUNC void tccgen_init(TCCState *s1)
 {
+    _vstack = tcc_malloc((1 + VSTACK_SIZE) * sizeof (SValue));
     vtop = vstack - 1;
     memset(vtop, 0, sizeof *vtop);
 
@@ -419,6 +454,8 @@ ST_FUNC void tccgen_finish(TCCState *s1)
     dynarray_reset(&sym_pools, &nb_sym_pools);
     cstr_free(&initstr);
     dynarray_reset(&stk_data, &nb_stk_data);
+    tcc_free(_vstack);
+    _vstack = NULL;
     while (cur_switch)
         end_switch();
     local_scope = 0;
@@ -426,6 +463,9 @@ ST_FUNC void tccgen_finish(TCCState *s1)
     all_cleanups = NULL;
     pending_gotos = NULL;
     nb_temp_local_vars = 0;
+    tcc_free(func_tail_calls);
+    func_tail_calls = NULL;
+    nb_func_tail_calls = 0;
     global_label_stack = NULL;
     local_label_stack = NULL;
     cur_text_section = NULL;
@@ -505,6 +545,8 @@ ST_FUNC void put_extern_sym2(Sym *sym, int sh_num,
             sym_type = STT_NOTYPE;
             if ((t & (VT_BTYPE|VT_ASM_FUNC)) == VT_ASM_FUNC)
                 sym_type = STT_FUNC;
+        } else if (sym->a.tls) {
+            sym_type = STT_TLS;
         } else {
             sym_type = STT_OBJECT;
         }
@@ -1152,6 +1194,7 @@ static void merge_symattr(struct SymAttr *sa, struct SymAttr *sa1)
     sa->packed |= sa1->packed;
     sa->weak |= sa1->weak;
     sa->nodebug |= sa1->nodebug;
+    sa->tls |= sa1->tls;
     if (sa1->visibility != STV_DEFAULT) {
 	int vis = sa->visibility;
 	if (vis == STV_DEFAULT
@@ -1179,6 +1222,8 @@ static void merge_funcattr(struct FuncAttr *fa, struct FuncAttr *fa1)
       fa->func_ctor = 1;
     if (fa1->func_dtor)
       fa->func_dtor = 1;
+    if (fa1->func_noinstr)
+      fa->func_noinstr = 1;
 }
 
 /* Merge attributes.  */
@@ -1265,8 +1310,12 @@ static void patch_type(Sym *sym, CType *type)
 /* Merge some storage attributes.  */
 static void patch_storage(Sym *sym, AttributeDef *ad, CType *type)
 {
-    if (type)
+    if (type) {
         patch_type(sym, type);
+        if (sym->a.tls != ad->a.tls)
+            tcc_error("thread-local storage mismatch for redefinition of '%s'",
+                get_tok_str(sym->v, NULL));
+    }
 
 #ifdef TCC_TARGET_PE
     if (sym->a.dllimport != ad->a.dllimport)
@@ -1874,6 +1923,8 @@ ST_FUNC int gv(int rc)
            - lvalue (need to dereference pointer)
            - already a register, but not in the right class */
         r = vtop->r & VT_VALMASK;
+        if (r == VT_LOCAL && !(vtop->r & VT_LVAL))
+            func_frame_escapes = 1;
         r_ok = !(vtop->r & VT_LVAL) && (r < VT_CONST) && (reg_classes[r] & rc);
         r2_ok = !rc2 || ((vtop->r2 < VT_CONST) && (reg_classes[vtop->r2] & rc2));
 
@@ -2825,6 +2876,10 @@ static int compare_types(CType *type1, CType *type2, int unqualified)
         type2 = pointed_type(type2);
         return is_compatible_types(type1, type2);
     } else if (bt1 == VT_STRUCT) {
+        if (is_vector_type(type1) && is_vector_type(type2))
+            return type1->ref->c == type2->ref->c
+                && (vector_elem_type(type1)->t & VT_BTYPE)
+                   == (vector_elem_type(type2)->t & VT_BTYPE);
         return (type1->ref == type2->ref);
     } else if (bt1 == VT_FUNC) {
         return is_compatible_func(type1, type2);
@@ -2969,6 +3024,138 @@ static int combine_types(CType *dest, SValue *op1, SValue *op2, int op)
     return ret;
 }
 
+/* replace the scalar on top of the stack by a temporary vector of
+   'type' with all elements set to it */
+static void vector_splat(CType *type)
+{
+    CType *et = vector_elem_type(type);
+    int size, align, esize, i, t;
+
+    size = type_size(type, &align);
+    t = get_temp_local_var(size, align);
+    esize = type_size(et, &align);
+    gen_cast(et);
+    if ((vtop->r & (VT_VALMASK | VT_LVAL)) != VT_CONST)
+        gv(is_float(et->t) ? RC_FLOAT : RC_INT);
+    for (i = 0; i < size; i += esize) {
+        vset(et, VT_LOCAL | VT_LVAL, t + i);
+        vpushv(vtop - 1);
+        vstore();
+        vpop();
+    }
+    vpop();
+    vset(type, VT_LOCAL | VT_LVAL, t);
+    vtop->type.t = VT_STRUCT;
+}
+
+/* pop the vector on top of the stack into 'sv'.  Vectors not at a
+   constant address get their address spilled to the stack. */
+static void vector_operand(SValue *sv)
+{
+    int r = vtop->r & (VT_VALMASK | VT_LVAL);
+
+    if (r == (VT_LOCAL | VT_LVAL) || r == (VT_CONST | VT_LVAL)) {
+        *sv = *vtop;
+    } else {
+        gaddrof();
+        vtop->type = char_pointer_type;
+        loc = (loc - PTR_SIZE) & -PTR_SIZE;
+        vset(&char_pointer_type, VT_LOCAL | VT_LVAL, loc);
+        vswap();
+        vstore();
+        vpop();
+        vset(&char_pointer_type, VT_LOCAL | VT_LVAL, loc);
+        *sv = *vtop;
+    }
+    vpop();
+}
+
+/* push the element at 'offset' of the vector described by 'sv' */
+static void vpush_vector_elem(SValue *sv, CType *et, int offset)
+{
+    vpushv(sv);
+    if ((sv->type.t & VT_BTYPE) == VT_STRUCT) {
+        vtop->c.i += offset;
+    } else {
+        vpushs(offset);
+        gen_op('+');
+        vtop->r |= VT_LVAL;
+    }
+    vtop->type = *et;
+}
+
+/* element-wise operation on GNU C vectors. A scalar operand is
+   broadcast to all elements first, comparisons yield 0 or -1 in a
+   vector of signed integers of the same element size. */
+static void gen_op_vector(int op)
+{
+    CType vtype, rtype, *et;
+    SValue sa, sb;
+    int size, align, esize, i, t;
+
+    if (!is_vector_type(&vtop->type))
+        vtype = vtop[-1].type, t = vtop->type.t;
+    else if (!is_vector_type(&vtop[-1].type))
+        vtype = vtop->type, t = vtop[-1].type.t;
+    else
+        vtype = vtop[-1].type, t = 0;
+    vtype.t = VT_STRUCT;
+    if (t ? !is_integer_btype(t & VT_BTYPE) && !is_float(t)
+          : !is_compatible_unqualified_types(&vtype, &vtop->type))
+        tcc_error("invalid operands for vector operation");
+    et = vector_elem_type(&vtype);
+    size = type_size(&vtype, &align);
+    esize = type_size(et, &align);
+    rtype = vtype;
+    if (TOK_ISCOND(op)) {
+        rtype.t = esize == 8 ? VT_LLONG : esize == 4 ? VT_INT
+                : esize == 2 ? VT_SHORT : VT_BYTE;
+        make_vector_type(&rtype, size);
+    }
+
+    if (nocode_wanted) {
+        /* only the type of the result matters */
+        if (CONST_WANTED && !NOEVAL_WANTED)
+            expect("constant");
+        vpop();
+        vpop();
+        vset(&rtype, VT_LOCAL | VT_LVAL, 0);
+        return;
+    }
+
+    if (!is_vector_type(&vtop->type)) {
+        vector_splat(&vtype);
+    } else if (!is_vector_type(&vtop[-1].type)) {
+        vswap();
+        vector_splat(&vtype);
+        vswap();
+    }
+    size = type_size(&rtype, &align);
+    t = get_temp_local_var(size, align);
+#ifdef TCC_TARGET_NATIVE_VECTOR_OP
+    if (!tcc_state->do_bounds_check && gen_opv(op, et->t, size, t))
+        goto done;
+#endif
+    /* generic case: one element after the other */
+    vector_operand(&sb);
+    vector_operand(&sa);
+    for (i = 0; i < size; i += esize) {
+        vset(vector_elem_type(&rtype), VT_LOCAL | VT_LVAL, t + i);
+        vpush_vector_elem(&sa, et, i);
+        vpush_vector_elem(&sb, et, i);
+        gen_op(op);
+        if (TOK_ISCOND(op)) {
+            vpushi(0);
+            vswap();
+            gen_op('-');
+        }
+        vstore();
+        vpop();
+    }
+done:
+    vset(&rtype, VT_LOCAL | VT_LVAL, t);
+}
+
 /* generic gen_op: handles types problems */
 ST_FUNC void gen_op(int op)
 {
@@ -2999,6 +3186,10 @@ redo:
 	    vswap();
 	}
 	goto redo;
+    } else if (is_vector_type(&vtop[-1].type) || is_vector_type(&vtop->type)) {
+        /* result is an lvalue on the stack */
+        gen_op_vector(op);
+        return;
     } else if (!combine_types(&combtype, vtop - 1, vtop, op_class)) {
 op_err:
         tcc_error("invalid operand types for binary operation");
@@ -3200,6 +3391,13 @@ static void gen_cast(CType *type)
     if (sbt == VT_FUNC)
         sbt = VT_PTR;
 
+    /* vectors can only be reinterpreted as vectors of the same size */
+    if ((is_vector_type(type) || is_vector_type(&vtop->type))
+        && (dbt & VT_BTYPE) != VT_VOID
+        && !(is_vector_type(type) && is_vector_type(&vtop->type)
+             && type->ref->c == vtop->type.ref->c))
+        cast_error(&vtop->type, type);
+
 again:
     if (sbt != dbt) {
         sf = is_float(sbt);
@@ -3883,6 +4081,19 @@ redo:
         case TOK_ALWAYS_INLINE2:
             ad->f.func_alwinl = 1;
             break;
+        case TOK_NO_INSTRUMENT1:
+        case TOK_NO_INSTRUMENT2:
+            ad->f.func_noinstr = 1;
+            break;
+        case TOK_VECTOR_SIZE1:
+        case TOK_VECTOR_SIZE2:
+            skip('(');
+            n = expr_const();
+            if (n <= 0 || (n & (n - 1)) != 0)
+                tcc_error("vector size must be a positive power of two");
+            ad->vector_size = n;
+            skip(')');
+            break;
         case TOK_SECTION1:
         case TOK_SECTION2:
             skip('(');
@@ -4338,6 +4549,35 @@ static void struct_layout(CType *type, AttributeDef *ad)
     }
 }
 
+/* turn the arithmetic 'type' into 'type __attribute__((vector_size(size)))' */
+static void make_vector_type(CType *type, int size)
+{
+    int bt, esize, align;
+    CType t;
+    Sym *s, *f;
+
+    bt = type->t & VT_BTYPE;
+    if (bt == VT_BOOL || !(is_integer_btype(bt) || bt == VT_FLOAT || bt == VT_DOUBLE))
+        tcc_error("invalid vector element type");
+    esize = type_size(type, &align);
+    if (size < esize || size % esize)
+        tcc_error("vector size must be a multiple of the element size");
+    t.t = type->t & (VT_BTYPE | VT_UNSIGNED | VT_DEFSIGN | VT_LONG);
+    t.ref = NULL;
+    f = sym_push(SYM_FIELD, &t, 0, size / esize);
+    t.t = VT_PTR | VT_ARRAY;
+    t.ref = f;
+    f = sym_push(anon_sym++ | SYM_FIELD, &t, 0, 0);
+    t.t = VT_STRUCT;
+    t.ref = NULL;
+    s = sym_push(anon_sym++ | SYM_STRUCT, &t, 0, size);
+    s->r = size < MAX_ALIGN ? size : MAX_ALIGN;
+    s->a.vector = 1;
+    s->next = f;
+    type->t = VT_STRUCT | (type->t & (VT_CONSTANT | VT_VOLATILE));
+    type->ref = s;
+}
+
 static void do_Static_assert(void);
 
 /* enum/struct/union declaration. u is VT_ENUM/VT_STRUCT/VT_UNION */
@@ -4805,7 +5045,10 @@ static int parse_btype(CType *type, AttributeDef *ad, int ignore_label)
                 sym_to_attr(ad, type1.ref);
             goto basic_type2;
         case TOK_THREAD_LOCAL:
-            tcc_error("_Thread_local is not implemented");
+        case TOK_THREAD_LOCAL2:
+            ad->a.tls = 1;
+            next();
+            break;
         default:
             if (typespec_found)
                 goto the_end;
@@ -5173,6 +5416,10 @@ static CType *type_decl(CType *type, AttributeDef *ad, int *v, int td)
     post_type(post, ad, post != ret ? 0 : storage,
               td & ~(TYPE_DIRECT|TYPE_ABSTRACT));
     parse_attribute(ad);
+    if (ad->vector_size) {
+        make_vector_type(ret, ad->vector_size);
+        ad->vector_size = 0;
+    }
     type->t |= storage;
     return ret;
 }
@@ -5228,6 +5475,125 @@ static void gfunc_param_typed(Sym *func, Sym *arg)
     }
 }
 
+#ifdef TCC_TARGET_NATIVE_STRUCT_COPY
+/* expand a call to memcpy() or memset() with a small constant size in
+   place.  The function and its arguments are on the value stack. */
+static int gen_inline_mem(int nb_args)
+{
+    SValue *f = vtop - nb_args;
+    int v, r;
+    uint64_t size;
+
+    if (nb_args != 3
+        || (f->r & (VT_VALMASK | VT_SYM)) != (VT_CONST | VT_SYM)
+        || (f->sym->type.t & VT_STATIC)
+        || f->sym->type.ref->f.func_type != FUNC_NEW
+        || (vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) != VT_CONST
+#ifdef CONFIG_TCC_BCHECK
+        || tcc_state->do_bounds_check
+#endif
+        )
+        return 0;
+    v = f->sym->v;
+    size = vtop->c.i;
+    if (!(v == TOK_memcpy && size > 0 && size <= STRUCT_MOVE_MAX)
+        && !(v == TOK_memset && size >= STRUCT_MOVE_MIN
+             && size <= STRUCT_MOVE_MAX))
+        return 0;
+    vpop();
+    if (v == TOK_memset) {
+        /* replicate the byte value */
+        gen_cast_s(VT_BYTE | VT_UNSIGNED);
+        gen_cast_s(VT_LLONG | VT_UNSIGNED);
+        vpush64(VT_LLONG | VT_UNSIGNED, 0x0101010101010101ULL);
+        gen_op('*');
+    }
+    /* the destination is also the value of the call */
+    vswap();
+    r = vtop->r & (VT_VALMASK | VT_LVAL);
+    if (r == VT_CONST || r == VT_LOCAL)
+        vdup();
+    else
+        gv_dup();
+    vrotb(3);
+    if (v == TOK_memset)
+        gen_struct_set(size);
+    else
+        gen_struct_copy(size);
+    vswap();
+    vpop();
+    return 1;
+}
+#endif
+
+#ifdef TCC_TARGET_NATIVE_TAIL_CALL
+/* generate 'return f(args);' as a jump to 'f' if possible.  Whether
+   addresses into the frame can still be used by 'f' is only known at
+   the end of the function, which may turn it back into a call. */
+static int gen_tail_call(Sym *s, int nb_args)
+{
+    int addr;
+
+    if (nocode_wanted
+        || func_var
+        || (func_vt.t & (VT_BTYPE | VT_UNSIGNED))
+           != (s->type.t & (VT_BTYPE | VT_UNSIGNED))
+        || (func_vt.t & VT_BTYPE) == VT_STRUCT
+        || cur_scope->cl.s != root_scope->cl.s
+        || tcc_state->do_backtrace
+        || tcc_state->test_coverage
+#ifdef CONFIG_TCC_BCHECK
+        || tcc_state->do_bounds_check
+#endif
+        )
+        return 0;
+    addr = gfunc_tail_call(nb_args);
+    if (addr < 0)
+        return 0;
+    func_tail_calls = tcc_realloc(func_tail_calls,
+        (nb_func_tail_calls + 1) * sizeof *func_tail_calls);
+    func_tail_calls[nb_func_tail_calls++] = addr;
+    return 1;
+}
+#endif
+
+/* replace the thread local variable on top of the stack by its
+   address in the current thread, as lvalue */
+static void gen_tls_addr(void)
+{
+    CType type = vtop->type;
+    int lval = vtop->r & VT_LVAL;
+
+    if (NOEVAL_WANTED)
+        return;
+    if (nocode_wanted & (DATA_ONLY_WANTED | CONST_WANTED_MASK))
+        tcc_error("address of thread-local '%s' is not constant",
+            get_tok_str(vtop->sym->v, NULL));
+    if (nocode_wanted)
+        return;
+    vtop->r &= ~VT_LVAL;
+    vtop->type = char_pointer_type;
+    if (tcc_state->output_type == TCC_OUTPUT_MEMORY) {
+        /* per thread copies of the TLS sections are managed by
+           rt_tls_addr() in tccrun.c */
+        vpush_helper_func(TOK___tcc_tls_addr);
+        vswap();
+        vpushsym(&char_pointer_type, external_helper_sym(TOK___tcc_tls_module));
+        vswap();
+        gfunc_call(2);
+        vpushi(0);
+        vtop->r = REG_IRET;
+#ifdef TCC_TARGET_NATIVE_TLS
+    } else if (tcc_state->output_type != TCC_OUTPUT_DLL) {
+        gen_tls_le();
+#endif
+    } else {
+        tcc_error("thread-local variables are not supported for this output");
+    }
+    vtop->type = type;
+    vtop->r |= lval;
+}
+
 /* parse an expression and return its type without any side effect. */
 static void expr_type(CType *type, void (*expr_fn)(void))
 {
@@ -5450,12 +5816,51 @@ static void parse_atomic(int atok)
     }
 }
 
+/* __builtin_frame_address(level), or __builtin_return_address(level)
+   if 'ret' */
+static void vpush_frame_address(int ret, int level)
+{
+    CType type;
+
+    type.t = VT_VOID;
+    mk_pointer(&type);
+    vset(&type, VT_LOCAL, 0);       /* local frame */
+    while (level--) {
+#ifdef TCC_TARGET_RISCV64
+        vpushi(2*PTR_SIZE);
+        gen_op('-');
+#endif
+        mk_pointer(&vtop->type);
+        indir();                    /* -> parent frame */
+    }
+    if (ret) {
+        // assume return address is just above frame pointer on stack
+#ifdef TCC_TARGET_ARM
+        vpushi(2*PTR_SIZE);
+        gen_op('+');
+#elif defined TCC_TARGET_RISCV64
+        vpushi(PTR_SIZE);
+        gen_op('-');
+#else
+        vpushi(PTR_SIZE);
+        gen_op('+');
+#endif
+        mk_pointer(&vtop->type);
+        indir();
+    }
+}
+
 ST_FUNC void unary(void)
 {
     int n, t, align, size, r;
     CType type;
     Sym *s;
     AttributeDef ad;
+#ifdef TCC_TARGET_NATIVE_TAIL_CALL
+    int tail = tail_call_pos;
+#endif
+
+    tail_call_pos = 0;
 
     /* generate line number info */
     if (debug_modes)
@@ -5724,32 +6129,7 @@ ST_FUNC void unary(void)
             if (level < 0)
                 tcc_error("%s only takes positive integers", get_tok_str(tok1, 0));
             skip(')');
-            type.t = VT_VOID;
-            mk_pointer(&type);
-            vset(&type, VT_LOCAL, 0);       /* local frame */
-            while (level--) {
-#ifdef TCC_TARGET_RISCV64
-                vpushi(2*PTR_SIZE);
-                gen_op('-');
-#endif
-                mk_pointer(&vtop->type);
-                indir();                    /* -> parent frame */
-            }
-            if (tok1 == TOK_builtin_return_address) {
-                // assume return address is just above frame pointer on stack
-#ifdef TCC_TARGET_ARM
-                vpushi(2*PTR_SIZE);
-                gen_op('+');
-#elif defined TCC_TARGET_RISCV64
-                vpushi(PTR_SIZE);
-                gen_op('-');
-#else
-                vpushi(PTR_SIZE);
-                gen_op('+');
-#endif
-                mk_pointer(&vtop->type);
-                indir();
-            }
+            vpush_frame_address(tok1 == TOK_builtin_return_address, level);
         }
         break;
 #ifdef TCC_TARGET_RISCV64
@@ -5991,6 +6371,8 @@ special_math_val:
 
         if (r & VT_SYM) {
             vtop->c.i = 0;
+            if (s->a.tls)
+                gen_tls_addr();
         } else if (r == VT_CONST && IS_ENUM_VAL(s->type.t)) {
             vtop->c.i = s->enum_val;
         }
@@ -6032,6 +6414,14 @@ special_math_val:
             next();
         } else if (tok == '[') {
             next();
+            if (is_vector_type(&vtop->type)) {
+                /* v[i] designates the i-th element of vector v */
+                type = *vector_elem_type(&vtop->type);
+                type.t |= vtop->type.t & (VT_CONSTANT | VT_VOLATILE);
+                mk_pointer(&type);
+                gaddrof();
+                vtop->type = type;
+            }
             gexpr();
             gen_op('+');
             indir();
@@ -6055,6 +6445,8 @@ special_math_val:
             } else {
                 vtop->r &= ~VT_LVAL; /* no lvalue */
             }
+            if (tcc_state->inline_functions && gen_inline_call())
+                continue;
             /* get return type */
             s = vtop->type.ref;
             next();
@@ -6119,6 +6511,16 @@ special_math_val:
             if (sa)
                 tcc_error("too few arguments to function");
             skip(')');
+#ifdef TCC_TARGET_NATIVE_STRUCT_COPY
+            if (gen_inline_mem(nb_args))
+                continue;
+#endif
+#ifdef TCC_TARGET_NATIVE_TAIL_CALL
+            if ((vtop[-nb_args].r & (VT_VALMASK | VT_SYM)) == (VT_CONST | VT_SYM)
+                && vtop[-nb_args].sym->v == TOK_alloca)
+                func_frame_escapes = 1;
+            if (!(tail && tok == ';' && gen_tail_call(s, nb_args)))
+#endif
             gfunc_call(nb_args);
 
             if (ret_nregs < 0) {
@@ -6326,7 +6728,7 @@ static int precedence(int tok)
 	    return 0;
     }
 }
-static unsigned char prec[256];
+static ST_TLS unsigned char prec[256];
 static void init_prec(void)
 {
     int i;
@@ -6944,6 +7346,221 @@ static void lblock(int *bsym, int *csym)
     }
 }
 
+/* ------------------------------------------------------------------------- */
+/* expansion of small inline functions at their call sites */
+
+/* return the recorded body of inline function 'sym' if a call can be
+   replaced by it: no static variables, labels or frame builtins, and
+   not larger than -finline-limit tokens (unless always_inline) */
+static InlineFunc *inline_candidate(Sym *sym)
+{
+    InlineFunc *fn = NULL;
+    struct inline_call *ic;
+    TokenString ts;
+    int i, n, colons, t;
+
+    for (i = tcc_state->nb_inline_fns; i-- > 0;)
+        if (tcc_state->inline_fns[i]->sym == sym) {
+            fn = tcc_state->inline_fns[i];
+            break;
+        }
+    if (!fn)
+        return NULL;
+
+    if (fn->tokens == 0) {
+        t = tok;
+        ts = *fn->func_str;
+        begin_macro(&ts, 0);
+        n = colons = 0;
+        for (next(); tok != TOK_EOF && n >= 0; next(), n++) {
+            switch (tok) {
+            case TOK_STATIC: case TOK_GOTO: case TOK_LABEL:
+            case TOK___FUNCTION__: case TOK___FUNC__:
+            case TOK_builtin_frame_address: case TOK_builtin_return_address:
+#if defined TCC_TARGET_I386 || defined TCC_TARGET_X86_64
+            case TOK_alloca:
+#endif
+                n = -2;
+                break;
+            case ':':
+                colons++;
+                break;
+            case '?': case TOK_CASE: case TOK_DEFAULT:
+                colons--;
+                break;
+            }
+        }
+        end_macro();
+        tok = t;
+        /* a ':' without '?', 'case' or 'default' is a label or bitfield */
+        fn->tokens = n < 0 || colons > 0 ? -1 : n;
+    }
+
+    if (fn->tokens < 0 || (fn->tokens > tcc_state->inline_limit
+                           && !sym->type.ref->f.func_alwinl))
+        return NULL;
+    for (n = 0, ic = cur_inline; ic; ic = ic->prev, n++)
+        if (ic->fn == fn)
+            return NULL; /* recursion */
+    return n < INLINE_DEPTH_MAX ? fn : NULL;
+}
+
+/* unlink the locals of the caller from the identifier table so that
+   the inlined body resolves its names at file scope, where it was
+   defined.  The hidden symbols are put in 'hidden' for show_locals() */
+static void hide_locals(Sym ***hidden, int *nb_hidden)
+{
+    Sym *s, **ps;
+    TokenSym *ts;
+    int v;
+
+    for (s = local_stack; s; s = s->prev) {
+        v = s->v;
+        if ((v & SYM_FIELD) || (v & ~SYM_STRUCT) >= SYM_FIRST_ANOM)
+            continue;
+        ts = table_ident[(v & ~SYM_STRUCT) - TOK_IDENT];
+        ps = v & SYM_STRUCT ? &ts->sym_struct : &ts->sym_identifier;
+        if (*ps == s) {
+            *ps = s->prev_tok;
+            dynarray_add(hidden, nb_hidden, s);
+        }
+    }
+}
+
+static void show_locals(Sym **hidden, int nb_hidden)
+{
+    Sym *s;
+    TokenSym *ts;
+
+    while (nb_hidden-- > 0) {
+        s = hidden[nb_hidden];
+        ts = table_ident[(s->v & ~SYM_STRUCT) - TOK_IDENT];
+        if (s->v & SYM_STRUCT)
+            ts->sym_struct = s;
+        else
+            ts->sym_identifier = s;
+    }
+}
+
+/* replace the call to the function on top of the value stack by its
+   body.  The arguments are stored to new locals named after the
+   parameters and 'return' stores to a temporary which becomes the
+   value of the call.  Return 0 if the call can't be expanded. */
+static int gen_inline_call(void)
+{
+    struct inline_call ic;
+    struct scope o, *saved_root, *saved_loop;
+    struct switch_t *saved_switch;
+    TokenString ts;
+    CType saved_vt, type;
+    Sym *sym, *s, *sa, **hidden;
+    int saved_rsym, saved_var, saved_nocode, n, size, align, nb_hidden;
+
+    sym = vtop->sym;
+    if ((vtop->type.t & VT_BTYPE) != VT_FUNC
+        || (vtop->r & (VT_VALMASK | VT_SYM)) != (VT_CONST | VT_SYM)
+        || vtop->c.i != 0
+        || !(sym->type.t & VT_INLINE)
+        || nocode_wanted || debug_modes
+#ifdef CONFIG_TCC_BCHECK
+        || tcc_state->do_bounds_check
+#endif
+        )
+        return 0;
+    s = sym->type.ref;
+    if (s->f.func_type != FUNC_NEW)
+        return 0;
+    ic.fn = inline_candidate(sym);
+    if (!ic.fn)
+        return 0;
+
+    vpop();
+    next();
+    n = 0;
+    sa = s->next;
+    if (tok != ')') {
+        for (;;) {
+            expr_eq();
+            gfunc_param_typed(s, sa);
+            n++;
+            if (sa)
+                sa = sa->next;
+            if (tok == ')')
+                break;
+            skip(',');
+        }
+    }
+    if (sa)
+        tcc_error("too few arguments to function");
+
+    /* parameters, then store the arguments from the last one */
+    hidden = NULL, nb_hidden = 0;
+    hide_locals(&hidden, &nb_hidden);
+    new_scope(&o);
+    o.bsym = o.csym = NULL;
+    for (sa = s->next; sa; sa = sa->next) {
+        size = type_size(&sa->type, &align);
+        loc = (loc - size) & -align;
+        sym_push(sa->v & ~SYM_FIELD, &sa->type, VT_LOCAL | VT_LVAL, loc);
+    }
+    for (sa = local_stack; n--; sa = sa->prev) {
+        type = sa->type;
+        type.t &= ~VT_CONSTANT;
+        vset(&type, VT_LOCAL | VT_LVAL, sa->c);
+        vswap();
+        vstore();
+        vpop();
+    }
+    save_regs(0);
+
+    if ((s->type.t & VT_BTYPE) != VT_VOID) {
+        size = type_size(&s->type, &align);
+        loc = (loc - size) & -align;
+        ic.ret = loc;
+    }
+    ic.level = local_scope + 1;
+    ic.prev = cur_inline;
+    cur_inline = &ic;
+    saved_root = root_scope, root_scope = &o;
+    saved_loop = loop_scope, loop_scope = NULL;
+    saved_switch = cur_switch, cur_switch = NULL;
+    saved_vt = func_vt, func_vt = s->type;
+    saved_var = func_var, func_var = 0;
+    saved_rsym = rsym, rsym = 0;
+    saved_nocode = nocode_wanted;
+
+    ts = *ic.fn->func_str;
+    begin_macro(&ts, 0);
+    next();
+    block(0);
+    gsym(rsym);
+    end_macro();
+    prev_scope(&o, 0);
+    show_locals(hidden, nb_hidden);
+    tcc_free(hidden);
+
+    cur_inline = ic.prev;
+    root_scope = saved_root;
+    loop_scope = saved_loop;
+    cur_switch = saved_switch;
+    func_vt = saved_vt;
+    func_var = saved_var;
+    rsym = saved_rsym;
+    nocode_wanted = saved_nocode;
+
+    if ((s->type.t & VT_BTYPE) == VT_VOID) {
+        vpushi(0);
+        vtop->type.t = VT_VOID;
+    } else {
+        vset(&s->type, VT_LOCAL | VT_LVAL, ic.ret);
+        if ((s->type.t & VT_BTYPE) != VT_STRUCT)
+            gv(RC_TYPE(s->type.t));
+    }
+    tok = ')';
+    next();
+    return 1;
+}
+
 static void block(int flags)
 {
     int a, b, c, d, e, t;
@@ -7036,6 +7653,8 @@ again:
     } else if (t == TOK_RETURN) {
         b = (func_vt.t & VT_BTYPE) != VT_VOID;
         if (tok != ';') {
+            tail_call_pos = tcc_state->sibling_calls && !cur_inline
+                && !func_instrument;
             gexpr();
             if (b) {
                 gen_assign_cast(&func_vt);
@@ -7049,11 +7668,21 @@ again:
             b = 0;
         }
         leave_scope(root_scope);
-        if (b)
+        if (func_instrument && !cur_inline)
+            gen_instrument(TOK___cyg_profile_func_exit);
+        if (b && cur_inline) {
+            vset(&func_vt, VT_LOCAL | VT_LVAL, cur_inline->ret);
+            vswap();
+            vstore();
+            vpop();
+        } else if (b) {
             gfunc_return(&func_vt);
+        }
         skip(';');
-        /* jump unless last stmt in top-level block */
-        if (tok != '}' || local_scope != 1)
+        /* jump unless last stmt in top-level block (and always with
+           the exit hook, not to call it again at the end) */
+        if (tok != '}' || local_scope != (cur_inline ? cur_inline->level : 1)
+            || (func_instrument && !cur_inline))
             rsym = gjmp(rsym);
         if (debug_modes)
 	    tcc_tcov_block_end (tcc_state, -1);
@@ -7245,6 +7874,7 @@ again:
 
     } else if (t == TOK_ASM1 || t == TOK_ASM2 || t == TOK_ASM3) {
         asm_instr();
+        func_frame_escapes = 1;
 
     } else {
         if (tok == ':' && t >= TOK_UIDENT) {
@@ -7397,13 +8027,20 @@ static void init_putz(init_params *p, unsigned long c, int size)
     if (p->sec) {
         /* nothing to do because globals are already set to zero */
     } else {
-        vpush_helper_func(TOK_memset);
         vseti(VT_LOCAL, c);
         vpushi(0);
+#ifdef TCC_TARGET_NATIVE_STRUCT_COPY
+        if (size >= STRUCT_MOVE_MIN && size <= STRUCT_MOVE_MAX) {
+            gen_struct_set(size);
+            return;
+        }
+#endif
         vpushs(size);
 #if defined TCC_TARGET_ARM && defined TCC_ARM_EABI
         vswap();  /* using __aeabi_memset(void*, size_t, int) */
 #endif
+        vpush_helper_func(TOK_memset);
+        vrott(4);
         gfunc_call(3);
     }
 }
@@ -8007,6 +8644,15 @@ static void decl_initializer_alloc(CType *type, AttributeDef *ad, int r,
 #endif
     init_params p = {0};
 
+    if (ad->a.tls) {
+        if ((r & VT_VALMASK) != VT_CONST)
+            tcc_error("thread-local variable '%s' must be static or extern",
+                get_tok_str(v, NULL));
+#ifdef CONFIG_TCC_BCHECK
+        bcheck = 0;
+#endif
+    }
+
     /* Always allocate static or global variables */
     if (v && (r & VT_VALMASK) == VT_CONST)
         nocode_wanted |= DATA_ONLY_WANTED;
@@ -8155,7 +8801,9 @@ static void decl_initializer_alloc(CType *type, AttributeDef *ad, int r,
 
         /* allocate symbol in corresponding section */
         sec = ad->section;
-        if (!sec) {
+        if (ad->a.tls) {
+            sec = tls_section(tcc_state, !has_init);
+        } else if (!sec) {
             CType *tp = type;
             while ((tp->t & (VT_BTYPE|VT_ARRAY)) == (VT_PTR|VT_ARRAY))
                 tp = &tp->ref->type;
@@ -8167,6 +8815,8 @@ static void decl_initializer_alloc(CType *type, AttributeDef *ad, int r,
                     tcc_warning("rw data: %s", get_tok_str(v, 0));*/
             } else if (tcc_state->nocommon)
                 sec = bss_section;
+            if (sec && v)
+                sec = sym_section(sec, v, tcc_state->data_sections);
         }
 
         if (sec) {
@@ -8228,6 +8878,7 @@ static void decl_initializer_alloc(CType *type, AttributeDef *ad, int r,
 
         vpush_type_size(type, &a);
         gen_vla_alloc(type, a);
+        func_frame_escapes = 1;
 #if defined TCC_TARGET_PE && defined TCC_TARGET_X86_64
         /* on _WIN64, because of the function args scratch area, the
            result of alloca differs from RSP and is returned in RAX.  */
@@ -8295,6 +8946,58 @@ static void func_vla_arg(Sym *sym)
             func_vla_arg_code(arg->type.ref);
 }
 
+/* -ffunction-sections, -fdata-sections (implied by -Wl,--gc-sections):
+   the section of its own for the symbol 'v' which would go to 'sec'.
+   Line numbers in debug info are for text_section only. */
+static Section *sym_section(Section *sec, int v, int split)
+{
+    TCCState *s1 = tcc_state;
+    char buf[256];
+    Section *s;
+
+#if defined TCC_TARGET_PE || defined TCC_TARGET_MACHO
+    return sec; /* no gc_sections() */
+#endif
+    if (!(split || s1->gc_sections) || s1->do_debug || NODATA_WANTED
+        || s1->nb_sections >= SHN_LORESERVE / 4 * 3)
+        return sec;
+    snprintf(buf, sizeof buf, "%s.%s", sec->name, get_tok_str(v, NULL));
+    s = new_section(s1, buf, sec->sh_type, sec->sh_flags);
+    s->sh_addralign = 1;
+    s->parent = sec;
+    if (sec == text_section && s1->nb_profile)
+        s->hot = tcc_tcov_profile(s1, file->true_filename,
+                                  get_tok_str(v, NULL));
+    return s;
+}
+
+/* -finstrument-functions: call __cyg_profile_func_enter/exit(this_fn,
+   call_site) after the prolog and before each return */
+static void gen_instrument(int v)
+{
+    vpush_helper_func(v);
+    vpushsym(&char_pointer_type, func_instrument);
+    vpush_frame_address(1, 0);
+    gfunc_call(2);
+}
+
+/* and the name of the function for the runtime (lib/instrument.c): in
+   section __tcc_funcs, its address and its name, aligned to PTR_SIZE */
+static void gen_instrument_name(Sym *sym)
+{
+    Section *s = find_section(tcc_state, "__tcc_funcs");
+    int len = strlen(funcname) + 1;
+
+    /* writable: the addresses may need dynamic relocations */
+    s->sh_flags |= SHF_WRITE;
+    s->sh_addralign = PTR_SIZE;
+    section_ptr_add(s, -s->data_offset & (PTR_SIZE - 1));
+    put_elf_reloc(symtab_section, s, s->data_offset, R_DATA_PTR, sym->c);
+    section_ptr_add(s, PTR_SIZE);
+    memcpy(section_ptr_add(s, len), funcname, len);
+    section_ptr_add(s, -s->data_offset & (PTR_SIZE - 1));
+}
+
 /* parse a function defined by symbol 'sym' and generate its code in
    'cur_text_section' */
 static void gen_function(Sym *sym)
@@ -8335,10 +9038,26 @@ static void gen_function(Sym *sym)
 
     local_scope = 0;
     rsym = 0;
+    func_frame_escapes = 0;
     clear_temp_local_var_list();
     func_vla_arg(sym);
+    if (tcc_state->instrument_functions && !sym->type.ref->f.func_noinstr) {
+        func_instrument = sym;
+        gen_instrument_name(sym);
+        gen_instrument(TOK___cyg_profile_func_enter);
+    }
     block(0);
+    if (func_instrument && !nocode_wanted)
+        gen_instrument(TOK___cyg_profile_func_exit);
+    func_instrument = NULL;
     gsym(rsym);
+#ifdef TCC_TARGET_NATIVE_TAIL_CALL
+    while (nb_func_tail_calls) {
+        --nb_func_tail_calls;
+        if (func_frame_escapes)
+            gfunc_tail_call_undo(func_tail_calls[nb_func_tail_calls]);
+    }
+#endif
 
     nocode_wanted = 0;
     /* reset local stack */
@@ -8391,7 +9110,9 @@ static void gen_inline_functions(TCCState *s)
                 tccpp_putfile(fn->filename);
                 begin_macro(fn->func_str, 1);
                 next();
-                cur_text_section = text_section;
+                cur_text_section = sym_section(text_section, sym->v,
+                                               s->function_sections
+                                               || s->nb_profile);
                 gen_function(sym);
                 end_macro();
 
@@ -8591,6 +9312,7 @@ static int decl(int l)
                     fn = tcc_malloc(sizeof *fn + strlen(file->filename));
                     strcpy(fn->filename, file->filename);
                     fn->sym = sym;
+                    fn->tokens = 0;
                     dynarray_add(&tcc_state->inline_fns,
 				 &tcc_state->nb_inline_fns, fn);
                     skip_or_save_block(&fn->func_str);
@@ -8598,7 +9320,9 @@ static int decl(int l)
                     /* compute text section */
                     cur_text_section = ad.section;
                     if (!cur_text_section)
-                        cur_text_section = text_section;
+                        cur_text_section = sym_section(text_section, v,
+                            tcc_state->function_sections
+                            || tcc_state->nb_profile);
                     gen_function(sym);
                 }
                 break;
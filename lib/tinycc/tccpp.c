@@ -21,6 +21,11 @@
 #define USING_GLOBALS
 #include "tcc.h"
 
+#ifndef _WIN32
+# include <dirent.h>
+#endif
+#include <sys/stat.h>
+
 /* #define to 1 to enable (see parse_pp_string()) */
 #define ACCEPT_LF_IN_STRINGS 0
 
@@ -43,23 +48,55 @@ ST_DATA int pp_expr;
 
 /* ------------------------------------------------------------------------- */
 
-static TokenSym *hash_ident[TOK_HASH_SIZE];
-static char token_buf[STRING_MAX_SIZE + 1];
-static CString cstr_buf;
-static TokenString tokstr_buf;
-static TokenString unget_buf;
-static unsigned char isidnum_table[256 - CH_EOF];
-static int pp_debug_tok, pp_debug_symv;
-static int pp_counter;
+static ST_TLS TokenSym **hash_ident;
+static ST_TLS char token_buf[STRING_MAX_SIZE + 1];
+static ST_TLS CString cstr_buf;
+static ST_TLS TokenString tokstr_buf;
+static ST_TLS TokenString unget_buf;
+static ST_TLS unsigned char isidnum_table[256 - CH_EOF];
+static ST_TLS int pp_debug_tok, pp_debug_symv;
+static ST_TLS int pp_counter;
 static void tok_print(const int *str, const char *msg, ...);
 static void next_nomacro(void);
 static void parse_number(const char *p);
 static void parse_string(const char *p, int len);
 
-static struct TinyAlloc *toksym_alloc;
-static struct TinyAlloc *tokstr_alloc;
-
-static TokenString *macro_stack;
+static ST_TLS struct TinyAlloc *toksym_alloc;
+static ST_TLS struct TinyAlloc *tokstr_alloc;
+
+static ST_TLS TokenString *macro_stack;
+
+/* header prefix cache, see pch_start() */
+typedef struct PCHDep {
+    int64_t size, mtime; /* size -1: a place searched for a header */
+    int sys; /* found in a system include path, -1: not for -MD */
+    char path[1];
+} PCHDep;
+
+typedef struct PCHState {
+    TokenString str; /* what the parser got so far */
+    BufferedFile *main, *bf; /* main file, file of the last token */
+    uint8_t *text; /* main file contents */
+    int off, line; /* end of its last directive there */
+    uint64_t key;
+    int failed;
+    int nb_warnings; /* when recording started */
+    char **names; /* file names for messages, main file first */
+    int nb_names;
+    PCHDep **deps; /* headers read */
+    int nb_deps;
+} PCHState;
+
+static ST_TLS PCHState *pch; /* recording */
+static ST_TLS char **pch_names; /* replaying */
+static ST_TLS int nb_pch_names;
+static void pch_add_tok(void);
+static void pch_add_mark(int n);
+static void pch_replay_mark(int n);
+static void pch_cut(void);
+static void pch_stop(TCCState *s1);
+static void pch_add_dep(const char *path, int sys);
+static void pch_add_missing(const char *path);
 
 static const char tcc_keywords[] = 
 #define DEF(id, str) str "\0"
@@ -646,7 +683,7 @@ static int handle_eob(void)
 
     /* only tries to read if really end of buffer */
     if (bf->buf_ptr >= bf->buf_end) {
-        if (bf->fd >= 0) {
+        if (bf->fd >= 0 && !bf->map) {
 #if defined(PARSE_DEBUG)
             len = 1;
 #else
@@ -747,11 +784,57 @@ static int skip_spaces(void)
     return ch;
 }
 
+/* Return the first byte at or after 'p' that is one of the 'n' chars in
+   'set', looking at 16 bytes at a time while they are all before 'end'.
+   Stops at 'end' or earlier otherwise, the caller's scalar loop finishes
+   the job.  Every 'set' includes '\\', so CH_EOB is never skipped. */
+#if defined __GNUC__ && defined __SSE2__ && !defined __TINYC__
+static inline uint8_t *scan_chars(uint8_t *p, uint8_t *end, const char *set, int n)
+{
+    __m128i v, m;
+    int i, mask;
+    while (p + 16 <= end) {
+        v = _mm_loadu_si128((const __m128i *)p);
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8(set[0]));
+        for (i = 1; i < n; i++)
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(set[i])));
+        mask = _mm_movemask_epi8(m);
+        if (mask)
+            return p + __builtin_ctz(mask);
+        p += 16;
+    }
+    return p;
+}
+#elif defined __GNUC__ && defined __aarch64__ && defined __ARM_NEON && !defined __TINYC__
+static inline uint8_t *scan_chars(uint8_t *p, uint8_t *end, const char *set, int n)
+{
+    uint8x16_t v, m;
+    uint64_t mask;
+    int i;
+    while (p + 16 <= end) {
+        v = vld1q_u8(p);
+        m = vceqq_u8(v, vdupq_n_u8(set[0]));
+        for (i = 1; i < n; i++)
+            m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8(set[i])));
+        /* 4 bits per byte */
+        mask = vget_lane_u64(vreinterpret_u64_u8(
+            vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+        if (mask)
+            return p + (__builtin_ctzll(mask) >> 2);
+        p += 16;
+    }
+    return p;
+}
+#else
+#define scan_chars(p, end, set, n) (p)
+#endif
+
 /* single line C++ comments */
 static uint8_t *parse_line_comment(uint8_t *p)
 {
     int c;
     for(;;) {
+        p = scan_chars(p + 1, file->buf_end + 1, "\n\\", 2) - 1;
         for (;;) {
             c = *++p;
     redo:
@@ -778,6 +861,7 @@ static uint8_t *parse_comment(uint8_t *p)
     int c;
     for(;;) {
         /* fast skip loop */
+        p = scan_chars(p + 1, file->buf_end + 1, "\n*\\", 3) - 1;
         for(;;) {
             c = *++p;
         redo:
@@ -955,7 +1039,8 @@ redo_start:
             break;
 _default:
         default:
-            p++;
+            /* only these matter until the next line */
+            p = scan_chars(p + 1, file->buf_end + 1, "\n\\\"'/#", 6);
             break;
         }
         start_of_line = 0;
@@ -1345,6 +1430,84 @@ ST_FUNC void skip_to_eol(int warn)
 static CachedInclude *
 search_cached_include(TCCState *s1, const char *filename, int add);
 
+#ifndef _WIN32
+/* file systems on macOS are usually case insensitive */
+# ifdef __APPLE__
+#  define NAMECMP strcasecmp
+# else
+#  define NAMECMP strcmp
+# endif
+
+static int include_name_cmp(const void *a, const void *b)
+{
+    return NAMECMP(*(const char **)a, *(const char **)b);
+}
+
+/* return 0 if the include directory 'path' surely has no entry for the
+   first component of 'name' */
+static int include_dir_has(TCCState *s1, const char *path, const char *name)
+{
+    IncludeDir *d;
+    DIR *dir;
+    struct dirent *de;
+    char first[256], *key = first;
+    int i;
+
+    for (i = 0; i < s1->nb_include_dirs; i++) {
+        d = s1->include_dirs[i];
+        if (0 == strcmp(d->path, path))
+            goto found;
+    }
+    d = tcc_mallocz(sizeof *d + strlen(path));
+    strcpy(d->path, path);
+    dir = opendir(path);
+    if (dir || errno == ENOENT || errno == ENOTDIR) {
+        /* a directory that does not exist has no entries */
+        d->names = tcc_malloc(sizeof *d->names);
+        while (dir && (de = readdir(dir)) != NULL)
+            dynarray_add(&d->names, &d->nb_names, tcc_strdup(de->d_name));
+        if (dir)
+            closedir(dir);
+        qsort(d->names, d->nb_names, sizeof *d->names, include_name_cmp);
+    }
+    dynarray_add(&s1->include_dirs, &s1->nb_include_dirs, d);
+found:
+    if (!d->names)
+        return 1;
+    for (i = 0; name[i] && !IS_DIRSEP(name[i]); i++)
+        if (i == sizeof first - 1)
+            return 1;
+    memcpy(first, name, i), first[i] = 0;
+    return NULL != bsearch(&key, d->names, d->nb_names,
+                           sizeof *d->names, include_name_cmp);
+}
+#else
+# define include_dir_has(s1, path, name) 1
+#endif
+
+/* 'dir/name' was searched for a header and not found: a dependency for
+   the header cache and tcc_list_deps() */
+static void add_missing_dep(TCCState *s1, const char *dir, const char *name)
+{
+    char buf[1024];
+    int i;
+
+    if (!pch && !s1->gen_deps)
+        return;
+    if (*dir)
+        snprintf(buf, sizeof buf, "%s/%s", dir, name);
+    else
+        pstrcpy(buf, sizeof buf, name);
+    if (pch)
+        pch_add_missing(buf);
+    if (s1->gen_deps) {
+        for (i = s1->nb_missing_deps; i-- > 0;)
+            if (0 == strcmp(s1->missing_deps[i], buf))
+                return;
+        dynarray_add(&s1->missing_deps, &s1->nb_missing_deps, tcc_strdup(buf));
+    }
+}
+
 static int parse_include(TCCState *s1, int do_next, int test)
 {
     int c, i;
@@ -1408,6 +1571,10 @@ static int parse_include(TCCState *s1, int do_next, int test)
                 return 0;
             else
                 tcc_error("include file '%s' not found", name);
+            if (!include_dir_has(s1, p, name)) {
+                add_missing_dep(s1, p, name);
+                continue;
+            }
             pstrcpy(buf, sizeof buf, p);
             pstrcat(buf, sizeof buf, "/");
         }
@@ -1421,11 +1588,24 @@ static int parse_include(TCCState *s1, int do_next, int test)
 #endif
             return 1;
         }
+        if (e && e->missing) {
+            add_missing_dep(s1, "", buf);
+            continue;
+        }
         if (tcc_open(s1, buf) >= 0)
             break;
+        search_cached_include(s1, buf, 1)->missing = 1;
+        add_missing_dep(s1, "", buf);
     }
 
     if (test) {
+        /* a __has_include() answer depends on the file as well */
+        c = i - 2 >= s1->nb_include_paths;
+        if (s1->gen_deps && (s1->include_sys_deps || !c))
+            dynarray_add(&s1->target_deps, &s1->nb_target_deps,
+                tcc_strdup(buf));
+        if (pch)
+            pch_add_dep(buf, c);
         tcc_close();
     } else {
         if (s1->include_stack_ptr >= s1->include_stack + INCLUDE_STACK_SIZE)
@@ -1437,14 +1617,17 @@ static int parse_include(TCCState *s1, int do_next, int test)
         printf("%s: including %s\n", file->prev->filename, file->filename);
 #endif
         /* update target deps */
-        if (s1->gen_deps) {
+        if (s1->gen_deps || pch) {
             BufferedFile *bf = file;
             while (i == 1 && (bf = bf->prev))
                 i = bf->include_next_index;
             /* skip system include files */
-            if (s1->include_sys_deps || i - 2 < s1->nb_include_paths)
+            if (s1->gen_deps
+                && (s1->include_sys_deps || i - 2 < s1->nb_include_paths))
                 dynarray_add(&s1->target_deps, &s1->nb_target_deps,
                     tcc_strdup(buf));
+            if (pch)
+                pch_add_dep(buf, i - 2 >= s1->nb_include_paths);
         }
         /* add include file debug info */
         tcc_debug_bincl(s1);
@@ -1661,7 +1844,7 @@ static CachedInclude *search_cached_include(TCCState *s1, const char *filename,
 
     e = tcc_malloc(sizeof(CachedInclude) + (len = strlen(filename)));
     memcpy(e->filename, filename, len + 1);
-    e->ifndef_macro = e->once = 0;
+    e->ifndef_macro = e->once = e->missing = 0;
     dynarray_add(&s1->cached_includes, &s1->nb_cached_includes, e);
     /* add in hash table */
     e->hash_next = s1->cached_includes_hash[h];
@@ -1679,6 +1862,9 @@ static int pragma_parse(TCCState *s1)
         int t = tok, v;
         Sym *s;
 
+        if (pch)
+            pch->failed = 1; /* macro stacks are not saved */
+
         if (next(), tok != '(')
             goto pragma_err;
         if (next(), tok != TOK_STR)
@@ -1754,6 +1940,8 @@ static int pragma_parse(TCCState *s1)
         }
         if (tok != ')')
             goto pragma_err;
+        if (pch)
+            pch_add_mark(2 * *s1->pack_stack_ptr + 1);
 
     } else if (tok == TOK_comment) {
         char *p; int t;
@@ -1768,6 +1956,8 @@ static int pragma_parse(TCCState *s1)
         next();
         if (tok != ')')
             goto pragma_err;
+        if (pch)
+            pch->failed = 1; /* neither are libraries and options */
         if (t == TOK_lib) {
             dynarray_add(&s1->pragma_libs, &s1->nb_pragma_libs, p);
         } else {
@@ -1806,6 +1996,8 @@ ST_FUNC void tccpp_putfile(const char *filename)
     if (file->true_filename == file->filename)
         file->true_filename = tcc_strdup(file->filename);
     pstrcpy(file->filename, sizeof file->filename, buf);
+    if (pch)
+        pch->bf = NULL;
     tcc_debug_newfile(tcc_state);
 }
 
@@ -2607,6 +2799,8 @@ static void next_nomacro(void)
                 /* pop include stack */
                 tcc_close();
                 s1->include_stack_ptr--;
+                if (pch)
+                    pch_cut();
                 p = file->buf_ptr;
                 goto maybe_newline;
             }
@@ -2633,6 +2827,8 @@ maybe_newline:
             tok_flags &= ~TOK_FLAG_BOL;
             file->buf_ptr = p;
             preprocess(tok_flags & TOK_FLAG_BOF);
+            if (pch)
+                pch_cut();
             p = file->buf_ptr;
             goto maybe_newline;
         } else {
@@ -3375,6 +3571,8 @@ static int macro_subst_tok(
         } else if (v == TOK___DATE__ || v == TOK___TIME__) {
             time_t ti;
             struct tm *tm;
+            if (pch)
+                pch->failed = 1; /* not to be frozen in the cache */
             time(&ti);
             tm = localtime(&ti);
             if (v == TOK___DATE__) {
@@ -3473,7 +3671,10 @@ redo:
         if (TOK_HAS_VALUE(t)) {
             tok_get(&tok, &macro_ptr, &tokc);
             if (t == TOK_LINENUM) {
-                file->line_num = tokc.i;
+                if ((int)tokc.i < 0)
+                    pch_replay_mark(tokc.i);
+                else
+                    file->line_num = tokc.i;
                 goto redo;
             }
             goto convert;
@@ -3492,11 +3693,14 @@ redo:
             }
         }
         tok = t;
-        return;
+        goto done;
     }
 
     next_nomacro();
     t = tok;
+    if (pch && file == pch->main
+        && !(parse_flags & (PARSE_FLAG_LINEFEED | PARSE_FLAG_ASM_FILE)))
+        pch_stop(tcc_state);
     if (t >= TOK_IDENT && (parse_flags & PARSE_FLAG_PREPROCESS)) {
         /* if reading from file, try to substitute macros */
         Sym *s = define_find(t);
@@ -3507,7 +3711,7 @@ redo:
             begin_macro(&tokstr_buf, 0);
             goto redo;
         }
-        return;
+        goto done;
     }
 
 convert:
@@ -3519,6 +3723,12 @@ convert:
         if (parse_flags & PARSE_FLAG_TOK_STR)
             parse_string(tokc.str.data, tokc.str.size - 1);
     }
+done:
+    /* record what the parser gets from the file, directly or through
+       macro expansion, but not tokens that it saved and replays */
+    if (pch && (!macro_stack || macro_stack == &tokstr_buf)
+        && !(parse_flags & (PARSE_FLAG_LINEFEED | PARSE_FLAG_ASM_FILE)))
+        pch_add_tok();
 }
 
 /* push back current token and set current token to 'last_tok'. Only
@@ -3536,6 +3746,626 @@ ST_INLN void unget_tok(int last_tok)
     tok = last_tok;
 }
 
+/* ------------------------------------------------------------------------- */
+/* header prefix cache (tcc_set_pch_dir(), -pch-dir)
+
+   Compiling a C file records the tokens that the directives above its
+   first line of code feed to the parser, that is mostly its headers
+   after macro expansion, and saves them together with the macros,
+   include guards and '#pragma pack' state those directives leave
+   behind.  The next time the same file is compiled with the same
+   predefined macros and include paths, and neither these directives
+   nor any header they read changed, that state is restored and the
+   parser reads the saved tokens instead of the headers. */
+
+#define PCH_MAGIC 0x31484350 /* "PCH1" */
+#define PCH_HASH_INIT 0xcbf29ce484222325ULL
+
+typedef struct PCHBuf {
+    uint8_t *p, *end;
+} PCHBuf;
+
+static uint64_t pch_hash(uint64_t h, const void *p, size_t n)
+{
+    const uint8_t *q = p;
+    while (n--)
+        h = (h ^ *q++) * 0x100000001b3ULL;
+    return h;
+}
+
+static uint64_t pch_hash_str(uint64_t h, const char *s)
+{
+    return pch_hash(h, s, strlen(s) + 1);
+}
+
+/* everything but the main file's contents that the prefix depends on */
+static uint64_t pch_key(TCCState *s1, CString *predefs)
+{
+    char cwd[1024];
+    uint64_t h = PCH_HASH_INIT;
+    int i;
+
+    /* another build of the same version may encode the saved tokens
+       otherwise */
+    static const int build[] = {
+        TOK_TWOSHARPS, TOK_PLCHLDR, TOK_CCHAR, TOK_LINENUM, TOK_IDENT,
+        SYM_FIELD, LDOUBLE_SIZE, sizeof(CValue)
+    };
+
+    h = pch_hash_str(h, TCC_VERSION);
+#ifdef TCC_GITHASH
+    h = pch_hash_str(h, TCC_GITHASH);
+#endif
+    h = pch_hash(h, build, sizeof build);
+    h = pch_hash(h, &tok_ident, sizeof tok_ident);
+    h = pch_hash(h, predefs->data, predefs->size);
+    for (i = 0; i < s1->nb_include_paths; i++)
+        h = pch_hash_str(h, s1->include_paths[i]);
+    h = pch_hash_str(h, "");
+    for (i = 0; i < s1->nb_sysinclude_paths; i++)
+        h = pch_hash_str(h, s1->sysinclude_paths[i]);
+    i = s1->dollars_in_identifiers | gnu_ext << 1;
+    h = pch_hash(h, &i, sizeof i);
+    if (getcwd(cwd, sizeof cwd))
+        h = pch_hash_str(h, cwd);
+    h = pch_hash_str(h, file->true_filename);
+    return pch_hash_str(h, file->filename);
+}
+
+/* modification time, in ns where the system has it */
+static int64_t pch_mtime(struct stat *st)
+{
+#if defined _WIN32
+    return st->st_mtime;
+#elif defined __APPLE__
+    return st->st_mtimespec.tv_sec * (int64_t)1000000000
+        + st->st_mtimespec.tv_nsec;
+#else
+    return st->st_mtim.tv_sec * (int64_t)1000000000 + st->st_mtim.tv_nsec;
+#endif
+}
+
+static void pch_path(TCCState *s1, char *buf, int size, uint64_t key)
+{
+    snprintf(buf, size, "%s/%08x%08x.pch", s1->pch_dir,
+             (unsigned)(key >> 32), (unsigned)key);
+}
+
+/* the main file must be in memory as a whole */
+static int pch_text(uint8_t **text)
+{
+    BufferedFile *bf = file;
+    if (!bf->map) {
+        if (bf->buf_ptr >= bf->buf_end)
+            handle_eob();
+        if (bf->buf_end - bf->buffer >= IO_BUF_SIZE)
+            return -1;
+    }
+    *text = bf->buf_ptr;
+    return bf->buf_end - bf->buf_ptr;
+}
+
+static int pch_name(const char *name)
+{
+    int i;
+    for (i = 0; i < pch->nb_names; i++)
+        if (0 == strcmp(pch->names[i], name))
+            return i;
+    dynarray_add(&pch->names, &pch->nb_names, tcc_strdup(name));
+    return i;
+}
+
+/* marks are TOK_LINENUM with a negative value: a file name for messages
+   (n even) or a '#pragma pack' value (n odd) */
+static void pch_add_mark(int n)
+{
+    CValue cval;
+    cval.i = -1 - n;
+    tok_str_add2(&pch->str, TOK_LINENUM, &cval);
+}
+
+static void pch_replay_mark(int n)
+{
+    n = -1 - n;
+    if (n & 1)
+        *tcc_state->pack_stack_ptr = n >> 1;
+    else if ((n >>= 1) < nb_pch_names)
+        pstrcpy(file->filename, sizeof file->filename, pch_names[n]);
+}
+
+static void pch_add_tok(void)
+{
+    if (file != pch->bf) {
+        pch->bf = file;
+        pch_add_mark(2 * pch_name(file->filename));
+        pch->str.last_line_num = -1;
+    }
+    tok_str_add_tok(&pch->str);
+}
+
+static void pch_add_dep(const char *path, int sys)
+{
+    struct stat st;
+    PCHDep *d;
+
+    pch->bf = NULL;
+    if (fstat(file->fd, &st) < 0) {
+        pch->failed = 1;
+        return;
+    }
+    d = tcc_malloc(sizeof *d + strlen(path));
+    d->size = st.st_size;
+    d->mtime = pch_mtime(&st);
+    d->sys = sys;
+    strcpy(d->path, path);
+    dynarray_add(&pch->deps, &pch->nb_deps, d);
+}
+
+/* 'path' was not there when looking for a header: the cache holds as
+   long as it still isn't */
+static void pch_add_missing(const char *path)
+{
+    PCHDep *d;
+    int i;
+
+    for (i = pch->nb_deps; i-- > 0;)
+        if (pch->deps[i]->size < 0 && 0 == strcmp(pch->deps[i]->path, path))
+            return;
+    d = tcc_malloc(sizeof *d + strlen(path));
+    d->size = -1;
+    d->mtime = 0;
+    d->sys = -1;
+    strcpy(d->path, path);
+    dynarray_add(&pch->deps, &pch->nb_deps, d);
+}
+
+/* a directive in the main file ended here */
+static void pch_cut(void)
+{
+    pch->bf = NULL;
+    if (file == pch->main) {
+        pch->off = file->buf_ptr - pch->text;
+        pch->line = file->line_num;
+    }
+}
+
+static void pch_put_int(FILE *f, int v)
+{
+    fwrite(&v, sizeof v, 1, f);
+}
+
+static void pch_put_str(FILE *f, const char *s)
+{
+    int n = strlen(s) + 1;
+    pch_put_int(f, n);
+    fwrite(s, 1, n, f);
+}
+
+/* number of ints in a token string, with the final 0 */
+static int pch_len(const int *str)
+{
+    const int *p = str;
+    CValue cval;
+    int t;
+    while (*p)
+        TOK_GET(&t, &p, &cval);
+    return p - str + 1;
+}
+
+static void pch_write(TCCState *s1, PCHState *p)
+{
+    char path[1024], tmp[1040];
+    uint64_t h;
+    CachedInclude *e;
+    Sym *s, *a;
+    FILE *f;
+    int i, n;
+
+    pch_add_mark(0); /* back to the main file name */
+    tok_str_add(&p->str, 0);
+    pch_path(s1, path, sizeof path, p->key);
+    snprintf(tmp, sizeof tmp, "%s.%d", path, (int)getpid());
+    f = fopen(tmp, "wb");
+    if (!f)
+        return;
+
+    pch_put_int(f, PCH_MAGIC);
+    fwrite(&p->key, sizeof p->key, 1, f);
+    h = pch_hash(PCH_HASH_INIT, p->text, p->off);
+    pch_put_int(f, p->off);
+    fwrite(&h, sizeof h, 1, f);
+    pch_put_int(f, p->line);
+    pch_put_int(f, pp_counter);
+
+    pch_put_int(f, p->nb_deps);
+    for (i = 0; i < p->nb_deps; i++) {
+        pch_put_str(f, p->deps[i]->path);
+        fwrite(&p->deps[i]->size, sizeof(int64_t), 2, f);
+        pch_put_int(f, p->deps[i]->sys);
+    }
+
+    n = tok_ident - TOK_IDENT;
+    pch_put_int(f, n);
+    for (i = 0; i < n; i++)
+        pch_put_str(f, table_ident[i]->str);
+    pch_put_int(f, p->nb_names);
+    for (i = 0; i < p->nb_names; i++)
+        pch_put_str(f, p->names[i]);
+
+    for (i = n = 0; i < tok_ident - TOK_IDENT; i++)
+        if ((s = table_ident[i]->sym_define) && s->d)
+            n++;
+    pch_put_int(f, n);
+    for (i = 0; i < tok_ident - TOK_IDENT; i++) {
+        if (!(s = table_ident[i]->sym_define) || !s->d)
+            continue;
+        pch_put_int(f, s->v);
+        pch_put_int(f, s->type.t);
+        for (n = 0, a = s->next; a; a = a->next)
+            n++;
+        pch_put_int(f, n);
+        for (a = s->next; a; a = a->next) {
+            pch_put_int(f, a->v & ~SYM_FIELD);
+            pch_put_int(f, a->type.t);
+        }
+        n = pch_len(s->d);
+        pch_put_int(f, n);
+        fwrite(s->d, sizeof(int), n, f);
+    }
+
+    for (i = n = 0; i < s1->nb_cached_includes; i++)
+        if (s1->cached_includes[i]->ifndef_macro || s1->cached_includes[i]->once)
+            n++;
+    pch_put_int(f, n);
+    for (i = 0; i < s1->nb_cached_includes; i++) {
+        e = s1->cached_includes[i];
+        if (!e->ifndef_macro && !e->once)
+            continue;
+        pch_put_str(f, e->filename);
+        pch_put_int(f, e->ifndef_macro);
+        pch_put_int(f, e->once);
+    }
+
+    n = s1->pack_stack_ptr - s1->pack_stack;
+    pch_put_int(f, n);
+    fwrite(s1->pack_stack, sizeof(int), n + 1, f);
+
+    pch_put_int(f, p->str.len);
+    fwrite(p->str.str, sizeof(int), p->str.len, f);
+
+    n = ferror(f);
+    if (fclose(f) || n) {
+        remove(tmp);
+        return;
+    }
+#ifdef _WIN32
+    remove(path);
+#endif
+    if (rename(tmp, path))
+        remove(tmp);
+}
+
+static void pch_free(PCHState *p)
+{
+    tok_str_free_str(p->str.str);
+    dynarray_reset(&p->names, &p->nb_names);
+    dynarray_reset(&p->deps, &p->nb_deps);
+    tcc_free(p);
+}
+
+/* the parser is about to get the first token of the main file */
+static void pch_stop(TCCState *s1)
+{
+    PCHState *p = pch;
+
+    /* the warnings, #warning included, would not be seen again */
+    if (!p->failed && p->off > 0 && s1->nb_errors == 0
+        && s1->nb_warnings == p->nb_warnings
+        && s1->ifdef_stack_ptr == p->main->ifdef_stack_ptr)
+        pch_write(s1, p);
+    pch = NULL;
+    pch_free(p);
+}
+
+static void *pch_get(PCHBuf *b, int size)
+{
+    uint8_t *p = b->p;
+    if (size < 0 || size > b->end - p) {
+        b->p = b->end;
+        return NULL;
+    }
+    b->p = p + size;
+    return p;
+}
+
+static int pch_int(PCHBuf *b, int *v)
+{
+    int *p = pch_get(b, sizeof *v);
+    if (!p)
+        return 0;
+    memcpy(v, p, sizeof *v);
+    return 1;
+}
+
+static const char *pch_str(PCHBuf *b, int *len)
+{
+    const char *s;
+    if (!pch_int(b, len) || *len < 1 || !(s = pch_get(b, *len))
+        || s[*len - 1])
+        return NULL;
+    return s;
+}
+
+static int *pch_ints(PCHBuf *b, int *len)
+{
+    int *p;
+    if (!pch_int(b, len) || *len < 1 || *len > (b->end - b->p) / 4
+        || !(p = pch_get(b, *len * sizeof(int))) || p[*len - 1])
+        return NULL;
+    return p;
+}
+
+/* replace identifiers as numbered when the cache was written, only
+   check the 'len' tokens when 'map' is NULL */
+static int pch_remap(int *p, int len, const int *map, int n)
+{
+    int *end = p + len;
+    CValue cval;
+    int t, v;
+    while (p < end && (t = *p) != 0) {
+        if (TOK_HAS_VALUE(t)) {
+            tok_get(&t, (const int **)&p, &cval);
+            continue;
+        }
+        v = (t & ~SYM_FIELD) - TOK_IDENT;
+        if (v >= 0) {
+            if (v >= n)
+                return 0;
+            if (map)
+                *p = map[v] | (t & SYM_FIELD);
+        }
+        p++;
+    }
+    return p < end;
+}
+
+/* the state after the dependencies: checked as a whole first, then
+   restored with 'apply', so that a damaged cache changes nothing */
+static int pch_body(TCCState *s1, PCHBuf *b, int apply, TokenString **pts)
+{
+    int i, j, n, v, t, nb, *map, *str;
+    const char *name;
+    TokenString *ts, body;
+    CachedInclude *e;
+    Sym *first, **ps;
+
+    /* identifiers */
+    map = NULL;
+    if (!pch_int(b, &n) || n < 0 || n > b->end - b->p)
+        goto bad;
+    if (apply)
+        map = tcc_malloc(n * sizeof *map + 1);
+#define PCH_TOK(v) ((v) < TOK_IDENT ? (v) : (v) - TOK_IDENT >= n ? -1 \
+                    : map ? map[(v) - TOK_IDENT] : (v))
+    for (i = 0; i < n; i++) {
+        if (!(name = pch_str(b, &j)))
+            goto bad;
+        if (apply)
+            map[i] = tok_alloc(name, j - 1)->tok;
+    }
+
+    /* file names, the main file first */
+    if (!pch_int(b, &nb))
+        goto bad;
+    for (i = 0; i < nb; i++) {
+        if (!(name = pch_str(b, &j)))
+            goto bad;
+        if (apply)
+            dynarray_add(&pch_names, &nb_pch_names,
+                         tcc_strdup(i ? name : file->filename));
+    }
+
+    /* macros */
+    if (!pch_int(b, &nb))
+        goto bad;
+    while (nb--) {
+        if (!pch_int(b, &v) || (v = PCH_TOK(v)) < TOK_IDENT
+            || !pch_int(b, &t) || !pch_int(b, &j) || j < 0)
+            goto bad;
+        first = NULL, ps = &first;
+        while (j--) {
+            int a, va;
+            if (!pch_int(b, &a) || (a = PCH_TOK(a)) < TOK_IDENT
+                || !pch_int(b, &va))
+                goto bad;
+            if (apply) {
+                *ps = sym_push2(&define_stack, a | SYM_FIELD, va, 0);
+                ps = &(*ps)->next;
+            }
+        }
+        if (!(str = pch_ints(b, &j)))
+            goto bad;
+        if (!apply) {
+            if (!pch_remap(str, j, NULL, n))
+                goto bad;
+            continue;
+        }
+        tok_str_new(&body);
+        tok_str_realloc(&body, j);
+        memcpy(body.str, str, j * sizeof(int));
+        pch_remap(body.str, j, map, n);
+        define_push(v, t, body.str, first);
+    }
+
+    /* include guards and '#pragma once' */
+    if (!pch_int(b, &nb))
+        goto bad;
+    while (nb--) {
+        if (!(name = pch_str(b, &j)) || !pch_int(b, &v) || !pch_int(b, &t))
+            goto bad;
+        if (apply) {
+            e = search_cached_include(s1, name, 1);
+            e->ifndef_macro = PCH_TOK(v);
+            e->once = t;
+        }
+    }
+
+    /* '#pragma pack' stack, its top is set again by the tokens */
+    if (!pch_int(b, &j) || j < 0 || j >= PACK_STACK_SIZE
+        || !(str = pch_get(b, (j + 1) * sizeof(int))))
+        goto bad;
+    if (apply) {
+        memcpy(s1->pack_stack, str, (j + 1) * sizeof(int));
+        s1->pack_stack_ptr = s1->pack_stack + j;
+        *s1->pack_stack_ptr = 0;
+    }
+
+    /* the tokens */
+    if (!(str = pch_ints(b, &j)))
+        goto bad;
+    if (!apply) {
+        if (!pch_remap(str, j, NULL, n))
+            goto bad;
+        return 1;
+    }
+#undef PCH_TOK
+    ts = tok_str_alloc();
+    tok_str_realloc(ts, j);
+    memcpy(ts->str, str, j * sizeof(int));
+    ts->len = j;
+    pch_remap(ts->str, j, map, n);
+    tcc_free(map);
+    *pts = ts;
+    return 1;
+bad:
+    tcc_free(map);
+    return 0;
+}
+
+/* 1 if restored, 0 if out of date, -1 if damaged */
+static int pch_restore(TCCState *s1, PCHBuf *b, uint64_t key,
+                       uint8_t *text, int len)
+{
+    struct stat st;
+    uint64_t h;
+    uint8_t *deps, *body;
+    int64_t *m;
+    int i, j, n, v, nb, off, line, counter;
+    const char *name;
+    TokenString *ts;
+
+    /* still valid? */
+    if (!pch_int(b, &v) || v != PCH_MAGIC
+        || !(m = pch_get(b, sizeof key)) || memcmp(m, &key, sizeof key)
+        || !pch_int(b, &off) || off <= 0 || off > len
+        || !(m = pch_get(b, sizeof h)))
+        return 0;
+    memcpy(&h, m, sizeof h);
+    if (h != pch_hash(PCH_HASH_INIT, text, off)
+        || !pch_int(b, &line) || !pch_int(b, &counter))
+        return 0;
+    deps = b->p;
+    if (!pch_int(b, &nb))
+        return 0;
+    for (i = 0; i < nb; i++) {
+        if (!(name = pch_str(b, &n)) || !(m = pch_get(b, 2 * sizeof *m))
+            || !pch_int(b, &v))
+            return 0;
+        if (m[0] < 0 ? stat(name, &st) == 0
+            : stat(name, &st) < 0 || st.st_size != m[0]
+              || pch_mtime(&st) != m[1])
+            return 0;
+    }
+
+    body = b->p;
+    if (!pch_body(s1, b, 0, NULL))
+        return -1;
+    b->p = body;
+    pch_body(s1, b, 1, &ts);
+
+    /* headers for -MD */
+    if (s1->gen_deps) {
+        b->p = deps;
+        for (pch_int(b, &nb), i = 0; i < nb; i++) {
+            name = pch_str(b, &j);
+            pch_get(b, 2 * sizeof *m);
+            pch_int(b, &v);
+            if (v < 0)
+                dynarray_add(&s1->missing_deps, &s1->nb_missing_deps,
+                             tcc_strdup(name));
+            else if (s1->include_sys_deps || !v)
+                dynarray_add(&s1->target_deps, &s1->nb_target_deps,
+                             tcc_strdup(name));
+        }
+    }
+
+    /* continue after the prefix, with its tokens first */
+    file->buf_ptr = text + off;
+    file->line_num = line;
+    tok_flags = TOK_FLAG_BOL;
+    pp_counter = counter;
+    if (file->true_filename == file->filename)
+        file->true_filename = tcc_strdup(file->filename);
+    begin_macro(ts, 1);
+    return 1;
+}
+
+static int pch_load(TCCState *s1, uint64_t key, uint8_t *text, int len)
+{
+    char path[1024];
+    struct stat st;
+    PCHBuf b;
+    uint8_t *data;
+    int fd, n, ret;
+
+    pch_path(s1, path, sizeof path, key);
+    fd = open(path, O_RDONLY | O_BINARY);
+    if (fd < 0)
+        return 0;
+    ret = 0;
+    data = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size < 0x7fffffff) {
+        data = tcc_malloc(st.st_size + 1);
+        n = read(fd, data, st.st_size);
+        if (n == st.st_size) {
+            b.p = data, b.end = data + n;
+            ret = pch_restore(s1, &b, key, text, len);
+        }
+    }
+    close(fd);
+    tcc_free(data);
+    if (ret < 0) {
+        /* compile the headers instead, and write it again */
+        remove(path);
+        ret = 0;
+    }
+    return ret;
+}
+
+/* restore the prefix of the main file from the cache if possible,
+   otherwise start recording it */
+static int pch_start(TCCState *s1, CString *predefs)
+{
+    uint8_t *text;
+    uint64_t key;
+    int len;
+
+    if (s1->output_type == TCC_OUTPUT_PREPROCESS || s1->do_debug
+        || s1->test_coverage || s1->run_test || file->fd <= 0
+        || (len = pch_text(&text)) < 0)
+        return 0;
+    key = pch_key(s1, predefs);
+    if (pch_load(s1, key, text, len))
+        return 1;
+    pch = tcc_mallocz(sizeof *pch);
+    pch->main = file;
+    pch->text = text;
+    pch->key = key;
+    pch->nb_warnings = s1->nb_warnings;
+    pch_name(file->filename);
+    return 0;
+}
+
 /* ------------------------------------------------------------------------- */
 /* init preprocessor */
 
@@ -3655,9 +4485,11 @@ ST_FUNC void preprocess_start(TCCState *s1, int filetype)
         if (s1->cmdline_incl.size)
           cstr_cat(&cstr, s1->cmdline_incl.data, s1->cmdline_incl.size);
         //printf("%.*s\n", cstr.size, (char*)cstr.data);
-        *s1->include_stack_ptr++ = file;
-        tcc_open_bf(s1, "<command line>", cstr.size);
-        memcpy(file->buffer, cstr.data, cstr.size);
+        if (!s1->pch_dir || is_asm || !pch_start(s1, &cstr)) {
+            *s1->include_stack_ptr++ = file;
+            tcc_open_bf(s1, "<command line>", cstr.size);
+            memcpy(file->buffer, cstr.data, cstr.size);
+        }
         cstr_free(&cstr);
     }
     parse_flags = is_asm ? PARSE_FLAG_ASM_FILE : 0;
@@ -3669,6 +4501,9 @@ ST_FUNC void preprocess_end(TCCState *s1)
     while (macro_stack)
         end_macro();
     macro_ptr = NULL;
+    if (pch)
+        pch_free(pch), pch = NULL;
+    dynarray_reset(&pch_names, &nb_pch_names);
     while (file)
         tcc_close();
     tccpp_delete(s1);
@@ -3701,7 +4536,7 @@ ST_FUNC void tccpp_new(TCCState *s)
     tal_new(&toksym_alloc, TOKSYM_TAL_LIMIT, TOKSYM_TAL_SIZE);
     tal_new(&tokstr_alloc, TOKSTR_TAL_LIMIT, TOKSTR_TAL_SIZE);
 
-    memset(hash_ident, 0, TOK_HASH_SIZE * sizeof(TokenSym *));
+    hash_ident = tcc_mallocz(TOK_HASH_SIZE * sizeof(TokenSym *));
     memset(s->cached_includes_hash, 0, sizeof s->cached_includes_hash);
 
     cstr_new(&tokcstr);
@@ -3747,6 +4582,8 @@ ST_FUNC void tccpp_delete(TCCState *s)
         tal_free(toksym_alloc, table_ident[i]);
     tcc_free(table_ident);
     table_ident = NULL;
+    tcc_free(hash_ident);
+    hash_ident = NULL;
 
     /* free static buffers */
     cstr_free(&tokcstr);
@@ -51,12 +51,17 @@ typedef struct rt_context
     // 10 * PTR_SIZE
     int num_callers;
     int dwarf;
+    struct rt_lines *lines; /* pc -> line index, see rt_printline() */
 } rt_context;
 
 /* linked list of rt_contexts */
 static rt_context *g_rc;
 static int signal_set;
 static void set_exception_handler(void);
+static void rt_lines_free(rt_context *rc);
+#ifndef _WIN32
+# include <sys/mman.h>
+#endif
 #endif /* def CONFIG_TCC_BACKTRACE */
 
 typedef struct rt_frame {
@@ -77,6 +82,7 @@ static void rt_exit(rt_frame *f, int code);
 
 #ifndef _WIN32
 # include <sys/mman.h>
+# include <pthread.h>
 #endif
 
 static int protect_pages(void *ptr, unsigned long length, int mode);
@@ -90,6 +96,8 @@ static int _tcc_backtrace(rt_frame *f, const char *fmt, va_list ap);
 static void *win64_add_function_table(TCCState *s1);
 static void win64_del_function_table(void *);
 #endif
+static void rt_tls_init(TCCState *s1);
+static void rt_tls_free(TCCState *s1);
 
 #if !defined PAGESIZE
 # if defined _SC_PAGESIZE
@@ -108,6 +116,22 @@ static void win64_del_function_table(void *);
 //#define HAVE_SELINUX 1
 #endif
 
+#ifdef HAVE_SELINUX
+# include <sys/syscall.h>
+#elif defined MADV_HUGEPAGE
+/* -fhuge-pages: the code starts and ends on a huge page boundary */
+# define HUGEPAGESIZE (2 * 1024 * 1024)
+#endif
+
+#if defined TCC_TARGET_X86_64 && !defined TCC_TARGET_PE && !defined TCC_TARGET_MACHO
+/* -flazy-binding, with __tcc_lazy_entry from lib/lazy-bind.S */
+# define RUN_LAZY_BIND 1
+static void rt_lazy_init(TCCState *s1);
+static void rt_lazy_got(TCCState *s1);
+static void rt_lazy_free(TCCState *s1);
+static void *rt_lazy_bind(TCCState *s1, unsigned index);
+#endif
+
 static int rt_mem(TCCState *s1, int size)
 {
     void *ptr;
@@ -115,10 +139,21 @@ static int rt_mem(TCCState *s1, int size)
 #ifdef HAVE_SELINUX
     /* Using mmap instead of malloc */
     void *prw;
-    char tmpfname[] = "/tmp/.tccrunXXXXXX";
-    int fd = mkstemp(tmpfname);
-    unlink(tmpfname);
-    ftruncate(fd, size);
+    int fd = -1;
+# ifdef SYS_memfd_create
+    /* an anonymous file, works with a noexec or read-only /tmp */
+    fd = syscall(SYS_memfd_create, "tccrun", 1 /* MFD_CLOEXEC */);
+# endif
+    if (fd < 0) {
+        char tmpfname[] = "/tmp/.tccrunXXXXXX";
+        fd = mkstemp(tmpfname);
+        unlink(tmpfname);
+    }
+    if (fd < 0 || ftruncate(fd, size) < 0) {
+        if (fd >= 0)
+            close(fd);
+	return tcc_error_noabort("tccrun: could not map memory");
+    }
 
     ptr = mmap(NULL, size * 2, PROT_READ|PROT_EXEC, MAP_SHARED, fd, 0);
     /* mmap RW memory at fixed distance */
@@ -130,6 +165,23 @@ static int rt_mem(TCCState *s1, int size)
     //printf("map %p %p %p\n", ptr, prw, (void*)ptr_diff);
     size *= 2;
 #else
+# ifdef HUGEPAGESIZE
+    if (s1->run_huge_pages) {
+        /* map one huge page more, then unmap around an aligned block */
+        size_t pad;
+        size = (size + HUGEPAGESIZE - 1) & -HUGEPAGESIZE;
+        ptr = mmap(NULL, size + HUGEPAGESIZE, PROT_READ|PROT_WRITE,
+                   MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+	    return tcc_error_noabort("tccrun: could not map memory");
+        pad = -(addr_t)ptr & (HUGEPAGESIZE - 1);
+        if (pad)
+            munmap(ptr, pad);
+        munmap((char*)ptr + pad + size, HUGEPAGESIZE - pad);
+        ptr = (char*)ptr + pad;
+        s1->run_mapped = 1;
+    } else
+# endif
     ptr = tcc_malloc(size += PAGESIZE); /* one extra page to align malloc memory */
 #endif
     s1->run_ptr = ptr;
@@ -150,6 +202,16 @@ LIBTCCAPI int tcc_relocate(TCCState *s1)
 #ifdef CONFIG_TCC_BACKTRACE
     if (s1->do_backtrace)
         tcc_add_symbol(s1, "_tcc_backtrace", _tcc_backtrace); /* for bt-log.c */
+#endif
+    if (s1->test_coverage)
+        tcc_tcov_add_file(s1, NULL);
+    rt_tls_init(s1);
+#ifdef RUN_LAZY_BIND
+    if (s1->run_lazy_binding && !s1->nostdlib) {
+        tcc_add_symbol(s1, "__tcc_lazy_bind", rt_lazy_bind);
+        /* have lazy-bind.o from libtcc1.a */
+        set_global_sym(s1, "__tcc_lazy_entry", NULL, 0);
+    }
 #endif
     size = tcc_relocate_ex(s1, NULL, 0);
     if (size < 0)
@@ -184,10 +246,24 @@ ST_FUNC void tcc_run_free(TCCState *s1)
     if (NULL == ptr)
         return;
     st_unlink(s1);
+#ifdef CONFIG_TCC_BACKTRACE
+    if (s1->rc)
+        rt_lines_free(s1->rc);
+#endif
+    rt_tls_free(s1);
+#ifdef RUN_LAZY_BIND
+    rt_lazy_free(s1);
+#endif
     size = s1->run_size;
 #ifdef HAVE_SELINUX
     munmap(ptr, size);
 #else
+# ifdef HUGEPAGESIZE
+    if (s1->run_mapped) {
+        munmap(ptr, size);
+        return;
+    }
+# endif
     /* unprotect memory to make it usable for malloc again */
     protect_pages((void*)PAGEALIGN(ptr), size - PAGESIZE, 2 /*rw*/);
 # ifdef _WIN64
@@ -246,6 +322,239 @@ LIBTCCAPI int tcc_run(TCCState *s1, int argc, char **argv)
     return ret;
 }
 
+/* ------------------------------------------------------------- */
+/* thread local storage for -run: each thread gets its own copy of the
+   .tdata/.tbss image, created on first access by __tcc_tls_addr() */
+
+typedef struct rt_tls_block {
+    struct rt_tls_block *next;
+    struct rt_tls *t;
+#ifndef _WIN32
+    pthread_t thread;
+#endif
+} rt_tls_block;
+
+typedef struct rt_tls {
+    char *image;
+    addr_t end;
+    unsigned align;
+#ifdef _WIN32
+    DWORD key;
+#else
+    pthread_key_t key;
+#endif
+} rt_tls;
+
+/* the copies of all threads, freed by rt_tls_free() unless the thread
+   ends first.  Not per state: a thread may end while its state is
+   deleted. */
+static rt_tls_block *rt_tls_blocks;
+TCC_SEM(static rt_tls_sem);
+
+#ifndef _WIN32
+static void rt_tls_destroy(void *p)
+{
+    rt_tls_block **pb, *b;
+
+    WAIT_SEM(&rt_tls_sem);
+    /* unless rt_tls_free() was first, and maybe gave the memory to
+       the copy of another thread */
+    for (pb = &rt_tls_blocks; (b = *pb); pb = &b->next)
+        if (b == p && pthread_equal(b->thread, pthread_self())) {
+            *pb = b->next;
+            tcc_free(b);
+            break;
+        }
+    POST_SEM(&rt_tls_sem);
+}
+#endif
+
+static void *rt_tls_addr(rt_tls *t, char *p)
+{
+    rt_tls_block *b;
+    char *d;
+    unsigned size = t->end - (addr_t)t->image;
+
+#ifdef _WIN32
+    b = TlsGetValue(t->key);
+#else
+    b = pthread_getspecific(t->key);
+#endif
+    if (NULL == b) {
+        b = tcc_malloc(sizeof *b + size + t->align);
+        d = (char*)(b + 1);
+        /* keep the alignment of the original image */
+        memcpy(d + ((t->image - d) & (t->align - 1)), t->image, size);
+        b->t = t;
+#ifdef _WIN32
+        TlsSetValue(t->key, b);
+#else
+        b->thread = pthread_self();
+        pthread_setspecific(t->key, b);
+#endif
+        WAIT_SEM(&rt_tls_sem);
+        b->next = rt_tls_blocks;
+        rt_tls_blocks = b;
+        POST_SEM(&rt_tls_sem);
+    }
+    d = (char*)(b + 1);
+    return d + ((t->image - d) & (t->align - 1)) + (p - t->image);
+}
+
+static void rt_tls_init(TCCState *s1)
+{
+    rt_tls *t;
+    int i;
+
+    for (i = 1; i < s1->nb_sections; i++)
+        if (s1->sections[i]->sh_flags & SHF_TLS)
+            break;
+    if (i == s1->nb_sections)
+        return;
+    s1->run_tls = t = tcc_mallocz(sizeof *t);
+    t->align = 1;
+#ifdef _WIN32
+    t->key = TlsAlloc();
+#else
+    pthread_key_create(&t->key, rt_tls_destroy);
+#endif
+    tcc_add_symbol(s1, "__tcc_tls_module", t);
+    tcc_add_symbol(s1, "__tcc_tls_addr", rt_tls_addr);
+}
+
+static void rt_tls_free(TCCState *s1)
+{
+    rt_tls *t = s1->run_tls;
+    rt_tls_block **pb, *b;
+
+    if (NULL == t)
+        return;
+#ifdef _WIN32
+    TlsFree(t->key);
+#else
+    pthread_key_delete(t->key);
+#endif
+    /* also the copies of the threads still running, or which ended
+       without running the destructor of the key (Windows) */
+    WAIT_SEM(&rt_tls_sem);
+    for (pb = &rt_tls_blocks; (b = *pb); )
+        if (b->t == t)
+            *pb = b->next, tcc_free(b);
+        else
+            pb = &b->next;
+    POST_SEM(&rt_tls_sem);
+    tcc_free(t);
+    s1->run_tls = NULL;
+}
+
+/* ------------------------------------------------------------- */
+#ifdef RUN_LAZY_BIND
+/* lazy binding for -run: the functions from shared libraries which are
+   only called through the PLT are looked up by the first call, through
+   __tcc_lazy_entry from lib/lazy-bind.S */
+
+typedef struct rt_lazy {
+    addr_t got; /* run time address of the GOT */
+    unsigned nb_syms, nb_bound;
+    struct { unsigned got_offset; char *name; } syms[1];
+} rt_lazy;
+
+static void rt_lazy_init(TCCState *s1)
+{
+    Section *s, *symtab = s1->symtab;
+    ElfW_Rel *rel;
+    ElfW(Sym) *sym;
+    struct sym_attr *attr;
+    rt_lazy *l;
+    char *eager;
+    int i, sym_index;
+
+    if (!s1->plt || !s1->got->reloc)
+        return;
+    /* symbols with other relocations than the one of their PLT entry in
+       the GOT (address taken, data) are needed before main() */
+    eager = tcc_mallocz(symtab->data_offset / sizeof (ElfW(Sym)));
+    for (i = 1; i < s1->nb_sections; i++) {
+        s = s1->sections[i];
+        if (s->sh_type != SHT_RELX || s->link != symtab)
+            continue;
+        for_each_elem(s, 0, rel, ElfW_Rel)
+            if (s != s1->got->reloc
+                || ELFW(R_TYPE)(rel->r_info) != R_JMP_SLOT)
+                eager[ELFW(R_SYM)(rel->r_info)] = 1;
+    }
+    l = tcc_mallocz(sizeof *l + s1->got->reloc->data_offset
+                    / sizeof (ElfW_Rel) * sizeof l->syms[0]);
+    for_each_elem(s1->got->reloc, 0, rel, ElfW_Rel) {
+        sym_index = ELFW(R_SYM)(rel->r_info);
+        sym = &((ElfW(Sym) *)symtab->data)[sym_index];
+        if (ELFW(R_TYPE)(rel->r_info) != R_JMP_SLOT
+            || eager[sym_index]
+            || sym->st_shndx != SHN_UNDEF
+            || ELFW(ST_BIND)(sym->st_info) == STB_WEAK)
+            continue;
+        attr = get_sym_attr(s1, sym_index, 0);
+        /* the PLT entry pushes the index in the table, and the GOT entry
+           points to that push until the function is bound */
+        write32le(s1->plt->data + attr->plt_offset + 7, l->nb_syms);
+        sym->st_shndx = s1->plt->sh_num;
+        sym->st_value = attr->plt_offset + 6;
+        l->syms[l->nb_syms].got_offset = rel->r_offset;
+        l->syms[l->nb_syms].name = tcc_strdup((char *)symtab->link->data
+            + sym->st_name + s1->leading_underscore);
+        l->nb_syms++;
+    }
+    tcc_free(eager);
+    s1->run_lazy = l;
+}
+
+/* PLT0 pushes GOT[1] and jumps to GOT[2] */
+static void rt_lazy_got(TCCState *s1)
+{
+    rt_lazy *l = s1->run_lazy;
+
+    l->got = s1->got->sh_addr;
+    write64le(s1->got->data + PTR_SIZE, (addr_t)s1);
+    write64le(s1->got->data + 2 * PTR_SIZE,
+              get_sym_addr(s1, "__tcc_lazy_entry", 1, 0));
+}
+
+static void *rt_lazy_bind(TCCState *s1, unsigned index)
+{
+    rt_lazy *l = s1->run_lazy;
+    const char *name = l->syms[index].name;
+    void *addr;
+
+    addr = dlsym(RTLD_DEFAULT, name);
+    if (NULL == addr) {
+        fprintf(stderr, "tcc: error: undefined symbol '%s'\n", name);
+        if (s1->run_lj)
+            ((void(*)(void*,int))s1->run_lj)(s1->run_jb, 255);
+        exit(255);
+    }
+    /* calls from other threads meanwhile store the same address */
+    *(void **)(l->got + l->syms[index].got_offset) = addr;
+    l->nb_bound++;
+    return addr;
+}
+
+static void rt_lazy_free(TCCState *s1)
+{
+    rt_lazy *l = s1->run_lazy;
+    unsigned i;
+
+    if (NULL == l)
+        return;
+    if (s1->do_bench)
+        fprintf(stderr, "# lazy binding: %u of %u functions bound\n",
+                l->nb_bound, l->nb_syms);
+    for (i = 0; i < l->nb_syms; i++)
+        tcc_free(l->syms[i].name);
+    tcc_free(l);
+    s1->run_lazy = NULL;
+}
+#endif
+
 /* ------------------------------------------------------------- */
 /* remove all STB_LOCAL symbols */
 static void cleanup_symbols(TCCState *s1)
@@ -300,22 +609,117 @@ static void cleanup_sections(TCCState *s1)
 #  endif
 #endif
 
+/* ------------------------------------------------------------- */
+/* counters of -ftest-coverage, see lib/tcov.c for the layout */
+
+LIBTCCAPI void tcc_list_coverage(TCCState *s1, void *ctx,
+    void (*cov_cb)(void *ctx, const char *file, const char *func,
+                   int line, int last, unsigned long long count))
+{
+    unsigned char *start, *p;
+    const char *file, *func;
+    unsigned long long v;
+    int line, last;
+
+    if (NULL == s1->run_ptr)
+        return;
+    start = (void*)(uintptr_t)get_sym_addr(s1, "__tcov_data", 0, 1);
+    if ((addr_t)-1 == (addr_t)start)
+        return;
+    for (p = start + 4; *p; p++) {
+        file = (char *)p;
+        for (p += strlen(file) + 1; *p; p++) {
+            func = (char *)p;
+            p += strlen(func) + 1;
+            p += -(p - start) & 7;
+            for (p += 8; *p; p += 16) { /* after the function start line */
+                v = read64le(p);
+                line = (v >> 8) & 0xfffffff;
+                last = v >> 36;
+                /* a block ends before the line of the next one, as
+                   written by lib/tcov.c */
+                last = last > line ? last - 1 : line;
+                cov_cb(ctx, file, func, line, last, read64le(p + 8));
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------- */
+/* symbols from other relocated states, see tcc_import_symbols() */
+
+LIBTCCAPI int tcc_import_symbols(TCCState *s1, TCCState *from)
+{
+    if (NULL == from->run_ptr)
+        return tcc_error_noabort("tcc_import_symbols(): state not relocated");
+    dynarray_add(&s1->run_imports, &s1->nb_run_imports, from);
+    return 0;
+}
+
+/* give the undefined symbols the values they have in the first imported
+   state that defines them, what remains is looked up with dlsym() */
+static void rt_import_syms(TCCState *s1)
+{
+    ElfW(Sym) *sym, *esym;
+    TCCState *from;
+    const char *name;
+    int i, sym_index;
+
+    if (0 == s1->nb_run_imports)
+        return;
+    for_each_elem(symtab_section, 1, sym, ElfW(Sym)) {
+        if (sym->st_shndx != SHN_UNDEF)
+            continue;
+        name = (char *)symtab_section->link->data + sym->st_name;
+        for (i = 0; i < s1->nb_run_imports; i++) {
+            from = s1->run_imports[i];
+            sym_index = find_elf_sym(from->symtab, name);
+            esym = (ElfW(Sym) *)from->symtab->data + sym_index;
+            /* not the static ones, nor those dropped by gc_sections()
+               which are made local, nor thread locals which have a copy
+               per state */
+            if (0 == sym_index || esym->st_shndx == SHN_UNDEF
+                || ELFW(ST_BIND)(esym->st_info) == STB_LOCAL
+                || ELFW(ST_TYPE)(esym->st_info) == STT_TLS
+                || ELFW(ST_VISIBILITY)(esym->st_other) != STV_DEFAULT)
+                continue;
+#ifdef TCC_TARGET_PE
+            /* as from tcc_add_symbol() */
+            pe_putimport(s1, 0, name + s1->leading_underscore, esym->st_value);
+#else
+            /* SHN_ABS: on 64 bit platforms through .got, as from
+               tcc_add_symbol() */
+            sym->st_shndx = SHN_ABS;
+            sym->st_value = esym->st_value;
+#endif
+            break;
+        }
+    }
+}
+
 /* relocate code. Return -1 on error, required size if ptr is NULL,
    otherwise copy code into buffer passed by the caller */
 static int tcc_relocate_ex(TCCState *s1, void *ptr, unsigned ptr_diff)
 {
     Section *s;
     unsigned offset, length, align, i, k, f;
-    unsigned n, copy;
+    unsigned n, copy, huge_align;
     addr_t mem, addr;
 
     if (NULL == ptr) {
 #ifdef TCC_TARGET_PE
+        rt_import_syms(s1);
         pe_output_file(s1, NULL);
 #else
         tcc_add_runtime(s1);
+        gc_sections(s1);
+        rt_import_syms(s1);
 	resolve_common_syms(s1);
         build_got_entries(s1, 0);
+#ifdef RUN_LAZY_BIND
+        if (s1->run_lazy_binding && !s1->nostdlib)
+            rt_lazy_init(s1);
+#endif
 #endif
     }
 
@@ -329,6 +733,7 @@ redo:
     if (copy == 3)
         return 0;
 
+    huge_align = s1->run_huge_pages;
     for (k = 0; k < 3; ++k) { /* 0:rx, 1:ro, 2:rw sections */
         n = 0; addr = 0;
         for(i = 1; i < s1->nb_sections; i++) {
@@ -371,6 +776,11 @@ redo:
                 /* start new page for different permissions */
                 if (k <= CONFIG_RUNMEM_RO)
                     align = PAGESIZE;
+#ifdef HUGEPAGESIZE
+                /* the code, and what follows it, on huge page boundaries */
+                if (huge_align)
+                    align = HUGEPAGESIZE, huge_align = k == 0;
+#endif
             }
             s->sh_addralign = align;
             addr = k ? mem + ptr_diff : mem;
@@ -378,6 +788,12 @@ redo:
             s->sh_addr = mem ? addr + offset : 0;
             offset += length;
         }
+#ifdef HUGEPAGESIZE
+        /* advise the code pages before they are first written */
+        if (k == 0 && copy == 0 && mem && s1->run_huge_pages)
+            madvise((void*)mem, (offset + HUGEPAGESIZE - 1) & -HUGEPAGESIZE,
+                    MADV_HUGEPAGE);
+#endif
         if (copy == 2) { /* set permissions */
             if (n == 0) /* no data  */
                 continue;
@@ -392,6 +808,11 @@ redo:
                 f = 3; /* change only SHF_EXECINSTR to rwx */
             }
             n = PAGEALIGN(n);
+#ifdef HUGEPAGESIZE
+            /* a partial mprotect() would split the huge pages */
+            if (s1->run_huge_pages && k == 0)
+                n = (n + HUGEPAGESIZE - 1) & -HUGEPAGESIZE;
+#endif
             if (s1->verbose == 2) {
                 printf("protect         %3s %p  len %05x\n",
                     &"rx\0ro\0rw\0rwx"[f*3], (void*)addr, (unsigned)n);
@@ -412,6 +833,20 @@ redo:
 #ifdef _WIN64
         s1->run_function_table = win64_add_function_table(s1);
 #endif
+        if (s1->run_tls) {
+            rt_tls *t = s1->run_tls;
+            for (i = 1; i < s1->nb_sections; i++) {
+                s = s1->sections[i];
+                if (!(s->sh_flags & SHF_TLS))
+                    continue;
+                if (!t->image || (char*)s->sh_addr < t->image)
+                    t->image = (char*)s->sh_addr;
+                if (s->sh_addr + s->data_offset > t->end)
+                    t->end = s->sh_addr + s->data_offset;
+                if (s->sh_addralign > t->align)
+                    t->align = s->sh_addralign;
+            }
+        }
         /* remove local symbols and free sections except symtab */
         cleanup_symbols(s1);
         cleanup_sections(s1);
@@ -425,6 +860,10 @@ redo:
     s1->pe_imagebase = mem;
 #else
     relocate_plt(s1);
+# ifdef RUN_LAZY_BIND
+    if (s1->run_lazy)
+        rt_lazy_got(s1);
+# endif
 #endif
     relocate_sections(s1);
     goto redo;
@@ -652,18 +1091,59 @@ typedef struct bt_info
     addr_t func_pc;
 } bt_info;
 
-/* print the position in the source file of PC value 'pc' by reading
-   the stabs debug information */
-static addr_t rt_printline (rt_context *rc, addr_t wanted_pc, bt_info *bi)
+/* the positions in the source files, from 'start' to 'end' included
+   since a return address may follow the last instruction of a line */
+typedef struct rt_line {
+    addr_t start, end;
+    addr_t func_pc;
+    const char *file;
+    const char *func;
+    int line;
+} rt_line;
+
+typedef struct rt_lines {
+    size_t size;
+    int n, max;
+    rt_line line[1];
+} rt_lines;
+
+/* count the entries when 'max' is 0, else store them */
+static void rt_line_add(rt_lines *t, addr_t start, addr_t end,
+                        const char *file, int line,
+                        const char *func, addr_t func_pc)
 {
-    char func_name[128];
+    rt_line *l;
+
+    if (end < start)
+        return;
+    if (t->max) {
+        l = t->line + t->n - 1;
+        if (t->n && l->end == start && l->line == line && l->file == file
+            && l->func == func && l->func_pc == func_pc) {
+            l->end = end;
+            return;
+        }
+        if (t->n == t->max)
+            return;
+        l = t->line + t->n;
+        l->start = start, l->end = end;
+        l->file = file, l->line = line;
+        l->func = func, l->func_pc = func_pc;
+    }
+    t->n++;
+}
+
+/* read the stabs debug information */
+static void rt_lines_stab(rt_context *rc, rt_lines *t)
+{
+    const char *func_name;
     addr_t func_addr, last_pc, pc;
     const char *incl_files[INCLUDE_STACK_SIZE];
-    int incl_index, last_incl_index, len, last_line_num, i;
-    const char *str, *p;
+    int incl_index, last_incl_index, len, last_line_num;
+    const char *str;
     Stab_Sym *sym;
 
-    func_name[0] = '\0';
+    func_name = NULL;
     func_addr = 0;
     incl_index = 0;
     last_pc = (addr_t)-1;
@@ -693,8 +1173,11 @@ static addr_t rt_printline (rt_context *rc, addr_t wanted_pc, bt_info *bi)
         rel_pc:
             pc += func_addr;
         check_pc:
-            if (pc >= wanted_pc && wanted_pc >= last_pc)
-                goto found;
+            if (last_pc != (addr_t)-1)
+                rt_line_add(t, last_pc, pc,
+                            last_incl_index ? incl_files[last_incl_index - 1]
+                                            : NULL,
+                            last_line_num, func_name, func_addr);
             break;
         }
 
@@ -703,10 +1186,7 @@ static addr_t rt_printline (rt_context *rc, addr_t wanted_pc, bt_info *bi)
         case N_FUN:
             if (sym->n_strx == 0)
                 goto reset_func;
-            p = strchr(str, ':');
-            if (0 == p || (len = p - str + 1, len > sizeof func_name))
-                len = sizeof func_name;
-            pstrcpy(func_name, len, str);
+            func_name = str;
             func_addr = pc;
             break;
             /* line number info */
@@ -734,7 +1214,7 @@ static addr_t rt_printline (rt_context *rc, addr_t wanted_pc, bt_info *bi)
                     incl_files[incl_index++] = str;
             }
         reset_func:
-            func_name[0] = '\0';
+            func_name = NULL;
             func_addr = 0;
             last_pc = (addr_t)-1;
             break;
@@ -745,20 +1225,10 @@ static addr_t rt_printline (rt_context *rc, addr_t wanted_pc, bt_info *bi)
             break;
         }
     }
-    last_incl_index = 0, func_name[0] = 0, func_addr = 0;
-found:
-    i = last_incl_index;
-    if (i > 0) {
-        pstrcpy(bi->file, sizeof bi->file, incl_files[--i]);
-        bi->line = last_line_num;
-    }
-    pstrcpy(bi->func, sizeof bi->func, func_name);
-    bi->func_pc = func_addr;
-    return func_addr;
 }
 
 /* ------------------------------------------------------------- */
-/* rt_printline - dwarf version */
+/* rt_lines - dwarf version */
 
 #define MAX_128	((8 * sizeof (long long) + 6) / 7)
 
@@ -823,7 +1293,7 @@ dwarf_read_sleb128(unsigned char **ln, unsigned char *end)
     return retval;
 }
 
-static addr_t rt_printline_dwarf (rt_context *rc, addr_t wanted_pc, bt_info *bi)
+static void rt_lines_dwarf (rt_context *rc, rt_lines *t)
 {
     unsigned char *ln;
     unsigned char *cp;
@@ -1000,8 +1470,7 @@ static addr_t rt_printline_dwarf (rt_context *rc, addr_t wanted_pc, bt_info *bi)
 		}
 		i = (int)((i - opcode_base) % line_range) + line_base;
 check_pc:
-		if (pc >= wanted_pc && wanted_pc >= last_pc)
-		    goto found;
+		rt_line_add(t, last_pc, pc, filename, line, function, func_addr);
 		line += i;
 	    }
 	    else {
@@ -1097,14 +1566,109 @@ check_pc:
 next_line:
 	ln = end;
     }
-    filename = function = NULL, func_addr = 0;
-found:
-    if (filename)
-        pstrcpy(bi->file, sizeof bi->file, filename), bi->line = line;
-    if (function)
-        pstrcpy(bi->func, sizeof bi->func, function);
-    bi->func_pc = func_addr;
-    return (addr_t)func_addr;
+}
+
+/* ------------------------------------------------------------- */
+/* the pc -> line index of a rt_context, built on the first backtrace
+   instead of reading the debug information again for each frame.  From
+   mmap() rather than malloc(), for backtraces from signal handlers. */
+
+static rt_lines rt_no_lines;
+
+static void *rt_lines_alloc(size_t size)
+{
+#ifdef _WIN32
+    return VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+    void *p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p == MAP_FAILED ? NULL : p;
+#endif
+}
+
+static void rt_lines_free(rt_context *rc)
+{
+    rt_lines *t = rc->lines;
+
+    rc->lines = NULL;
+    if (!t || t == &rt_no_lines)
+        return;
+#ifdef _WIN32
+    VirtualFree(t, 0, MEM_RELEASE);
+#else
+    munmap(t, t->size);
+#endif
+}
+
+static int rt_line_cmp(const void *a, const void *b)
+{
+    const rt_line *l = a, *m = b;
+
+    if (l->end != m->end)
+        return l->end < m->end ? -1 : 1;
+    return l->start < m->start ? -1 : l->start > m->start;
+}
+
+static rt_lines *rt_lines_build(rt_context *rc)
+{
+    rt_lines count = {0}, *t;
+    size_t size;
+    int i;
+
+    if (rc->dwarf)
+        rt_lines_dwarf(rc, &count);
+    else
+        rt_lines_stab(rc, &count);
+    size = sizeof *t + count.n * sizeof t->line[0];
+    t = count.n ? rt_lines_alloc(size) : NULL;
+    if (!t)
+        return &rt_no_lines;
+    t->size = size, t->max = count.n;
+    if (rc->dwarf)
+        rt_lines_dwarf(rc, t);
+    else
+        rt_lines_stab(rc, t);
+    for (i = 1; i < t->n; i++)
+        if (rt_line_cmp(&t->line[i - 1], &t->line[i]) > 0) {
+            qsort(t->line, t->n, sizeof t->line[0], rt_line_cmp);
+            break;
+        }
+    return t;
+}
+
+/* the position in the source file of PC value 'wanted_pc' */
+static addr_t rt_printline (rt_context *rc, addr_t wanted_pc, bt_info *bi)
+{
+    rt_lines *t = rc->lines;
+    rt_line *l;
+    const char *p;
+    int lo, hi, m, len;
+
+    if (!t)
+        t = rc->lines = rt_lines_build(rc);
+    /* the first entry which ends at or after wanted_pc */
+    lo = 0, hi = t->n;
+    while (lo < hi) {
+        m = (lo + hi) / 2;
+        if (t->line[m].end < wanted_pc)
+            lo = m + 1;
+        else
+            hi = m;
+    }
+    if (lo == t->n || t->line[lo].start > wanted_pc)
+        return 0;
+    l = &t->line[lo];
+    if (l->file)
+        pstrcpy(bi->file, sizeof bi->file, l->file), bi->line = l->line;
+    if (l->func) {
+        /* stabs: "name:F1" */
+        len = sizeof bi->func;
+        if (!rc->dwarf && (p = strchr(l->func, ':')) && p - l->func < len)
+            len = p - l->func + 1;
+        pstrcpy(bi->func, len, l->func);
+    }
+    bi->func_pc = l->func_pc;
+    return l->func_pc;
 }
 /* ------------------------------------------------------------- */
 #ifndef CONFIG_TCC_BACKTRACE_ONLY
@@ -1118,7 +1682,6 @@ int _tcc_backtrace(rt_frame *f, const char *fmt, va_list ap)
     int i, level, ret, n, one;
     const char *a, *b;
     bt_info bi;
-    addr_t (*getinfo)(rt_context*, addr_t, bt_info*);
 
     skip[0] = 0;
     /* If fmt is like "^file.c^..." then skip calls from 'file.c' */
@@ -1134,13 +1697,9 @@ int _tcc_backtrace(rt_frame *f, const char *fmt, va_list ap)
 
     rt_wait_sem();
     rc = g_rc;
-    getinfo = rt_printline, n = 6;
-    if (rc) {
-        if (rc->dwarf)
-            getinfo = rt_printline_dwarf;
-        if (rc->num_callers)
-            n = rc->num_callers;
-    }
+    n = 6;
+    if (rc && rc->num_callers)
+        n = rc->num_callers;
 
     for (i = level = 0; level < n; i++) {
         ret = rt_get_caller_pc(&pc, f, i);
@@ -1148,7 +1707,7 @@ int _tcc_backtrace(rt_frame *f, const char *fmt, va_list ap)
             break;
         memset(&bi, 0, sizeof bi);
         for (rc2 = rc; rc2; rc2 = rc2->next) {
-            if (getinfo(rc2, pc, &bi))
+            if (rt_printline(rc2, pc, &bi))
                 break;
             /* we try symtab symbols (no line number info) */
             if (!!(a = rt_elfsym(rc2, pc, &bi.func_pc))) {
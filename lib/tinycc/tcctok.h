@@ -39,6 +39,7 @@
      DEF(TOK_RESTRICT3, "__restrict__")
      DEF(TOK_EXTENSION, "__extension__") /* gcc keyword */
      DEF(TOK_THREAD_LOCAL, "_Thread_local") /* C11 thread-local storage */
+     DEF(TOK_THREAD_LOCAL2, "__thread") /* gcc keyword */
 
      DEF(TOK_GENERIC, "_Generic")
      DEF(TOK_STATIC_ASSERT, "_Static_assert")
@@ -148,6 +149,10 @@
      DEF(TOK_DESTRUCTOR2, "__destructor__")
      DEF(TOK_ALWAYS_INLINE1, "always_inline")
      DEF(TOK_ALWAYS_INLINE2, "__always_inline__")
+     DEF(TOK_NO_INSTRUMENT1, "no_instrument_function")
+     DEF(TOK_NO_INSTRUMENT2, "__no_instrument_function__")
+     DEF(TOK_VECTOR_SIZE1, "vector_size")
+     DEF(TOK_VECTOR_SIZE2, "__vector_size__")
 
      DEF(TOK_MODE, "__mode__")
      DEF(TOK_MODE_QI, "__QI__")
@@ -219,6 +224,10 @@
      DEF(TOK_option, "option")
 
 /* builtin functions or variables */
+     DEF(TOK___tcc_tls_addr, "__tcc_tls_addr")
+     DEF(TOK___tcc_tls_module, "__tcc_tls_module")
+     DEF(TOK___cyg_profile_func_enter, "__cyg_profile_func_enter")
+     DEF(TOK___cyg_profile_func_exit, "__cyg_profile_func_exit")
 #ifndef TCC_ARM_EABI
      DEF(TOK_memcpy, "memcpy")
      DEF(TOK_memmove, "memmove")
@@ -45,20 +45,40 @@ char my_program[] =
 "    return 0;\n"
 "}\n";
 
-int main(int argc, char **argv)
-{
-    TCCState *s;
-    int i;
-    int (*func)(int);
+/* a module, compiled and relocated on its own, which uses fib() and
+   add() from the state of my_program */
+char my_module[] =
+"#include <tcclib.h>\n"
+"extern int fib(int n);\n"
+"extern int add(int a, int b);\n"
+"int counter;\n"
+"int bar(int n)\n"
+"{\n"
+"    counter += n;\n"
+"    printf(\"module: add(fib(%d), %d) = %d\\n\", n, counter, add(fib(n), counter));\n"
+"    return 0;\n"
+"}\n";
 
-    s = tcc_new();
-    if (!s) {
-        fprintf(stderr, "Could not create tcc state\n");
-        exit(1);
-    }
+/* a state linked with --gc-sections, where printf() is only used by
+   code which is dropped, and a module which uses both */
+char my_gc_program[] =
+"#include <tcclib.h>\n"
+"int twice(int n) { return 2 * n; }\n"
+"int unused(int n) { printf(\"unused %d\\n\", n); return n; }\n"
+"int main(void) { return twice(21); }\n";
+
+char my_gc_module[] =
+"#include <tcclib.h>\n"
+"extern int twice(int n);\n"
+"int baz(int n)\n"
+"{\n"
+"    printf(\"gc module: twice(%d) = %d\\n\", n, twice(n));\n"
+"    return 0;\n"
+"}\n";
 
-    /* set custom error/warning printer */
-    tcc_set_error_func(s, stderr, handle_error);
+void set_paths(TCCState *s, int argc, char **argv)
+{
+    int i;
 
     /* if tcclib.h and libtcc1.a are not installed, where can we find them */
     for (i = 1; i < argc; ++i) {
@@ -72,6 +92,79 @@ int main(int argc, char **argv)
                 tcc_add_library_path(s, a+2);
         }
     }
+}
+
+/* load the module, call it and unload it */
+int run_module(TCCState *s, int argc, char **argv, const char *module,
+               const char *name, int n)
+{
+    TCCState *m;
+    int (*func)(int);
+
+    m = tcc_new();
+    if (!m)
+        return 1;
+    tcc_set_error_func(m, stderr, handle_error);
+    set_paths(m, argc, argv);
+    tcc_set_output_type(m, TCC_OUTPUT_MEMORY);
+    if (tcc_compile_string(m, module) == -1)
+        return 1;
+    /* resolve fib() and add() with the symbols of 's' */
+    if (tcc_import_symbols(m, s) < 0)
+        return 1;
+    if (tcc_relocate(m) < 0)
+        return 1;
+    func = tcc_get_symbol(m, name);
+    if (!func)
+        return 1;
+    func(n);
+    func(n);
+    tcc_delete(m);
+    return 0;
+}
+
+/* the same with a state where unused functions were dropped */
+int run_gc_module(int argc, char **argv)
+{
+    TCCState *s;
+    int (*func)(void);
+
+    s = tcc_new();
+    if (!s)
+        return 1;
+    tcc_set_error_func(s, stderr, handle_error);
+    set_paths(s, argc, argv);
+    tcc_set_output_type(s, TCC_OUTPUT_MEMORY);
+    tcc_set_options(s, "-ffunction-sections -Wl,--gc-sections");
+    if (tcc_compile_string(s, my_gc_program) == -1)
+        return 1;
+    if (tcc_relocate(s) < 0)
+        return 1;
+    func = tcc_get_symbol(s, "main");
+    if (!func || func() != 42)
+        return 1;
+    if (run_module(s, argc, argv, my_gc_module, "baz", 5))
+        return 1;
+    tcc_delete(s);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    TCCState *s;
+    int i;
+    int (*func)(int);
+
+    s = tcc_new();
+    if (!s) {
+        fprintf(stderr, "Could not create tcc state\n");
+        exit(1);
+    }
+
+    /* set custom error/warning printer */
+    tcc_set_error_func(s, stderr, handle_error);
+
+    set_paths(s, argc, argv);
 
     /* MUST BE CALLED before any compilation */
     tcc_set_output_type(s, TCC_OUTPUT_MEMORY);
@@ -96,8 +189,16 @@ int main(int argc, char **argv)
     /* run the code */
     func(32);
 
+    /* load a module using the code above, twice */
+    for (i = 10; i <= 20; i += 10)
+        if (run_module(s, argc, argv, my_module, "bar", i))
+            return 1;
+
     /* delete the state */
     tcc_delete(s);
 
+    if (run_gc_module(argc, argv))
+        return 1;
+
     return 0;
 }
@@ -32,6 +32,12 @@ void sleep_ms(unsigned n)
 {
     Sleep(n);
 }
+int nb_cpus(void)
+{
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return si.dwNumberOfProcessors;
+}
 #else
 #include <sys/time.h>
 #include <unistd.h>
@@ -53,6 +59,10 @@ void sleep_ms(unsigned n)
 {
     usleep(n * 1000);
 }
+int nb_cpus(void)
+{
+    return sysconf(_SC_NPROCESSORS_ONLN);
+}
 #endif
 
 void handle_error(void *opaque, const char *msg)
@@ -272,6 +282,50 @@ void time_tcc(int n, const char *src)
     }
 }
 
+/* compile tcc.c R times, shared by several threads */
+#define R 8
+int nb_compile_threads;
+const char *compile_src;
+
+TF_TYPE(thread_compile, vn)
+{
+    TCCState *s;
+    int i;
+    for (i = (size_t)vn; i < R; i += nb_compile_threads) {
+        s = new_state(1);
+        if (tcc_add_file(s, compile_src) < 0)
+            exit(1);
+        tcc_delete(s);
+    }
+    return 0;
+}
+
+static unsigned getclock_ms(void);
+
+void scale_tcc(const char *src)
+{
+    int n, i, max = nb_cpus();
+    unsigned t, t1 = 1;
+
+    if (max < 4)
+        max = 4;
+    if (max > R)
+        max = R;
+    compile_src = src;
+    for (n = 1; n <= max; n *= 2) {
+        nb_compile_threads = n;
+        t = getclock_ms();
+        for (i = 0; i < n; ++i)
+            create_thread(thread_compile, i);
+        wait_threads(n);
+        t = getclock_ms() - t;
+        if (n == 1)
+            t1 = t ? t : 1;
+        printf(" %d: %u ms (%.2fx)", n, t, (double)t1 / (t ? t : 1));
+        fflush(stdout);
+    }
+}
+
 static unsigned getclock_ms(void)
 {
 #ifdef _WIN32
@@ -331,6 +385,12 @@ int main(int argc, char **argv)
     t = getclock_ms();
     time_tcc(10, argv[1]);
     printf("\n (%u ms)\n", getclock_ms() - t), fflush(stdout);
+#endif
+#if 1
+    printf("compiling tcc.c %d times with 1, 2, 4 ... threads (%d cpus)\n ",
+        R, nb_cpus()), fflush(stdout);
+    scale_tcc(argv[1]);
+    printf("\n"), fflush(stdout);
 #endif
     return 0;
 }
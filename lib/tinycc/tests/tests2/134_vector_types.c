@@ -0,0 +1,60 @@
+#include <stdio.h>
+
+/* GNU C vector extension: vector_size types, element-wise operators,
+   scalar splats, comparisons, subscripts and vector casts */
+
+typedef float v4sf __attribute__((vector_size(16)));
+typedef int v4si __attribute__((vector_size(16)));
+typedef unsigned char v16qu __attribute__((vector_size(16)));
+typedef double v4df __attribute__((vector_size(32)));
+typedef int v8si __attribute__((vector_size(32)));
+typedef short v8hi __attribute__((vector_size(16)));
+typedef long long v2di __attribute__((vector_size(16)));
+
+struct S { int x; v4sf v; };
+
+v4si g = { 7, 8, 9, 10 };
+
+v4sf add(v4sf a, v4sf b)
+{
+    return a + b;
+}
+
+int main(void)
+{
+    v4sf a = {1, 2, 3, 4}, b = {10, 20, 30, 40}, c;
+    v4si i = {1, -2, 3, -4}, j = {5, 6, 7, 8}, k;
+    v4df d = {1.5, 2.5, 3.5, 4.5};
+    v8si w = {1, 2, 3, 4, 5, 6, 7, 8}, x;
+    v8hi h = {1, 2, 3, 4, 5, 6, 7, 8};
+    v2di q = {1LL << 40, -1};
+    v16qu u = {250, 1, 2, 3};
+    struct S s, *ps = &s;
+    int n;
+
+    c = a + b; printf("%g %g %g %g\n", c[0], c[1], c[2], c[3]);
+    c = a * 2; printf("%g %g %g %g\n", c[0], c[1], c[2], c[3]);
+    c = 1 - a / b; printf("%g %g %g %g\n", c[0], c[1], c[2], c[3]);
+    k = i + j; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = i * j; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = i < j; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = a > 2.5f; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = i << 2; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = i >> 1; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = -i; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = ~i & 0xff; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    k = g - i; printf("%d %d %d %d\n", k[0], k[1], k[2], k[3]);
+    d = d * d + 1; printf("%g %g %g %g\n", d[0], d[1], d[2], d[3]);
+    x = w * w - w; printf("%d %d %d %d\n", x[0], x[3], x[4], x[7]);
+    x = w >= 4; printf("%d %d %d %d\n", x[0], x[3], x[4], x[7]);
+    h = h * h - 1; printf("%d %d %d\n", h[0], h[4], h[7]);
+    q += q; printf("%lld %lld\n", q[0], q[1]);
+    u += 10; printf("%d %d %d\n", u[0], u[1], u[15]);
+    ps->v = a; ps->v += ps->v; printf("%g %g\n", s.v[0], s.v[3]);
+    s.v[2] = 42; printf("%g\n", s.v[2]);
+    c = add(a, b); printf("%g %g\n", c[0], c[3]);
+    k = (v4si)a; printf("%x\n", k[0]);
+    printf("%d %d %d\n", (int)sizeof(v4sf), (int)sizeof(v4df), (int)_Alignof(v4sf));
+    n = 0; c = n ? a + b : a - b; printf("%g\n", c[0]);
+    return 0;
+}
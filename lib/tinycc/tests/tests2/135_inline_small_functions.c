@@ -0,0 +1,45 @@
+#include <stdio.h>
+
+/* compiled with -finline-small-functions: calls are expanded in place,
+   except for recursion, labels and calls through pointers */
+
+struct P { int x, y; };
+static inline int max(int a, int b) { return a > b ? a : b; }
+static inline int sq(int a) { return a * a; }
+static inline struct P padd(struct P a, struct P b) { struct P r = { a.x + b.x, a.y + b.y }; return r; }
+static inline double mix(double a, double b, float t) { return a + (b - a) * t; }
+static inline void inc(int *p) { ++*p; if (*p > 100) return; *p += 1; }
+static inline int sum(const int *a, int n) { int s = 0, i; for (i = 0; i < n; i++) { if (a[i] < 0) continue; s += a[i]; } return s; }
+static inline int sw(int v) { switch (v) { case 1: return 10; case 2: return 20; default: break; } return v ? -1 : 0; }
+static inline int rec(int n) { return n <= 1 ? 1 : n * rec(n - 1); }
+static inline int lab(int n) { again: if (n > 10) { n -= 10; goto again; } return n; }
+static inline char ch(int c) { return c + 1; }
+static inline int cst(const int a) { return a + 1; }
+static inline int nest(int a, int b) { return max(sq(a), sq(b)) + max(a, b); }
+static inline unsigned long long big(unsigned long long a) { return a << 33; }
+static int (*fp)(int, int) = max;
+/* the body sees the globals, not the locals of the caller */
+int counter = 100;
+struct T { int v; };
+static inline int get(void) { return counter + sizeof(struct T); }
+static int shadow(void) { int counter = 5; struct T { char c[32]; } t = { 0 }; return get() + counter + t.c[0]; }
+int main(void)
+{
+    int i = 3, j = 0, arr[5] = { 1, -2, 3, 4, -5 };
+    struct P p = { 1, 2 }, q = { 10, 20 }, r;
+    for (j = 0; j < 3; j++)
+        printf("%d %d\n", max(i, j + 2), sq(max(j, 1)) + sq(2));
+    r = padd(p, q); printf("%d %d\n", r.x, padd(r, q).y);
+    printf("%g\n", mix(1.0, 3.0, 0.25f));
+    j = 99; inc(&j); printf("%d\n", j); inc(&j); printf("%d\n", j);
+    printf("%d\n", sum(arr, 5));
+    printf("%d %d %d %d\n", sw(1), sw(2), sw(5), sw(0));
+    printf("%d %d\n", rec(5), lab(37));
+    printf("%d %d %d\n", ch(64), cst(4), nest(3, -5));
+    printf("%llx %d\n", big(3), fp(4, 9));
+    printf("%d\n", i > 2 ? max(i, 7) : sq(i));
+    while (j < 110) { inc(&j); if (max(j, 105) == j) break; }
+    printf("%d %d\n", j, 1 + sizeof(sq(2)));
+    printf("%d\n", shadow());
+    return 0;
+}
@@ -0,0 +1,17 @@
+/* struct copies and memcpy/memset with a constant size, expanded in place */
+#include <stdio.h>
+#include <string.h>
+static unsigned char a[400], b[400];
+static void fill(void){ for(int i=0;i<400;i++) a[i]=i*7+1, b[i]=0xee; }
+static unsigned sum(void){ unsigned s=0; for(int i=0;i<400;i++) s=s*31+b[i]; return s; }
+#define T(N) fill(); if (memcpy(b+1, a+3, N) != b+1) puts("bad ret"); printf("cpy %d %u\n", N, sum()); \
+  fill(); memset(b+2, N, N); printf("set %d %u\n", N, sum()); \
+  { struct { char c[N]; } x, y; memcpy(&x, a, N); y = x; memcpy(b, &y, N); printf("st %d %u\n", N, sum()); }
+int main(void){
+  int v = 0x1ab; char *p = (char*)b;
+  T(1) T(3) T(7) T(8) T(9) T(15) T(16) T(17) T(31) T(33) T(64) T(100) T(255) T(256) T(257) T(300)
+  fill(); memset(p + 5, v, 40); printf("var %u\n", sum());
+  fill(); memset(p, 0, 24); printf("zero %u\n", sum());
+  { long z[20] = {1}; long s=0; for(int i=0;i<20;i++) s+=z[i]+i; printf("init %ld\n", s); }
+  return 0;
+}
@@ -0,0 +1,83 @@
+/* 'return f(...);' compiled as a jump with -foptimize-sibling-calls */
+#include <stdio.h>
+
+/* deep enough to overflow the stack without the optimization */
+#define DEPTH 10000000
+
+long count(long n, long acc)
+{
+    if (n == 0)
+        return acc;
+    return count(n - 1, acc + n);
+}
+
+int even(unsigned n);
+int odd(unsigned n) { if (n == 0) return 0; return even(n - 1); }
+int even(unsigned n) { if (n == 0) return 1; return odd(n - 1); }
+
+double halves(double x, int n)
+{
+    if (n == 0)
+        return x;
+    return halves(x + 0.5, n - 1);
+}
+
+typedef int (*fn)(unsigned);
+int indirect(fn f, unsigned n) { fn g = f; return g(n); }
+
+/* the address of 'y' is used by the callee: must stay a call */
+static int *gp;
+static int peek(void) { return *gp; }
+int escape(int k)
+{
+    int y = k;
+    if (k == 0)
+        return 0;
+    gp = &y;
+    return peek();
+}
+int escape_later(int k)
+{
+    int y = 0, i;
+    for (i = 0; i < 2; i++) {
+        if (i == 1)
+            return peek();
+        y = k;
+        gp = &y;
+    }
+    return -1;
+}
+
+/* different return types: stays a call */
+char narrow(int x) { return x; }
+int widen(int x) { return narrow(x); }
+
+/* arguments on the stack: stays a call */
+int seven(int a, int b, int c, int d, int e, int f, int g)
+{
+    return a + b + c + d + e + f + g;
+}
+int call_seven(int n) { return seven(n, 1, 2, 3, 4, 5, 6); }
+
+/* variadic callee */
+int say(const char *s, int n) { return printf("%s %d\n", s, n); }
+
+struct pair { long a, b; };
+struct pair mkpair(long a, long b) { struct pair p = { a, b }; return p; }
+struct pair pass(long a) { return mkpair(a, a + 1); }
+
+int main(void)
+{
+    struct pair p = pass(7);
+
+    printf("%ld\n", count(DEPTH, 0));
+    printf("%d %d\n", even(DEPTH + 1), odd(DEPTH + 1));
+    printf("%g\n", halves(0, DEPTH));
+    printf("%d\n", indirect(even, DEPTH));
+    printf("%d %d\n", escape(42), escape_later(43));
+    printf("%d\n", widen(300));
+    printf("%d\n", call_seven(1));
+    printf("%d\n", say("len", 12));
+    printf("%ld %ld\n", p.a, p.b);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include <pthread.h>
+
+_Thread_local int counter = 10;
+static __thread long hist[4] = { 1, 2, 3, 4 };
+__thread char buf[64];
+extern __thread int counter;
+
+static int bump(void)
+{
+    static __thread int calls;
+    return ++calls;
+}
+
+static char result[3][128];
+
+static void *worker(void *arg)
+{
+    int i, n = (int)(long)arg;
+    int *p = &counter;
+
+    for (i = 0; i < n; i++) {
+        ++*p;
+        hist[i & 3] += i;
+        buf[i % sizeof buf] = 'a' + n / 10;
+        bump();
+    }
+    buf[n] = 0;
+    snprintf(result[n / 10 - 1], sizeof result[0],
+        "thread %d: counter %d hist %ld %ld %ld %ld calls %d buf %s",
+        n, counter, hist[0], hist[1], hist[2], hist[3], bump(), buf);
+    return NULL;
+}
+
+int main(void)
+{
+    pthread_t t[3];
+    int i;
+
+    for (i = 0; i < 3; i++)
+        pthread_create(&t[i], NULL, worker, (void *)(long)(10 * (i + 1)));
+    for (i = 0; i < 3; i++)
+        pthread_join(t[i], NULL);
+    for (i = 0; i < 3; i++)
+        printf("%s\n", result[i]);
+    counter += 5;
+    printf("main: counter %d hist %ld calls %d buf '%s' size %d\n",
+        counter, hist[3], bump(), buf, (int)sizeof buf);
+    return 0;
+}
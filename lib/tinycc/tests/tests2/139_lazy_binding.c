@@ -0,0 +1,40 @@
+/* -flazy-binding: functions from libc bound on their first call */
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+/* never called, so never looked up */
+void no_such_function(void);
+
+static size_t (*get_length)(const char *) = strlen;
+
+static void *work(void *arg)
+{
+    char buf[32];
+    int i;
+
+    for (i = 0; i < 1000; i++)
+        snprintf(buf, sizeof buf, "%d %.1f", i, (double)i / 2);
+    return (void *)strchr(buf, ' ');
+}
+
+int main(int argc, char **argv)
+{
+    pthread_t t[4];
+    void *r[4];
+    int i;
+
+    if (argc > 1000)
+        no_such_function();
+    for (i = 0; i < 4; i++)
+        pthread_create(&t[i], NULL, work, NULL);
+    for (i = 0; i < 4; i++)
+        pthread_join(t[i], &r[i]);
+    for (i = 0; i < 4; i++)
+        printf("%s\n", (char *)r[i] ? "joined" : "?");
+    printf("%s %d %.2f %.2f %ld\n", "varargs", 42, 1.25, 2.5e3,
+           (long)get_length("seven"));
+    printf("%.3f\n", sqrt(2.0));
+    return 0;
+}
@@ -0,0 +1,43 @@
+/* -Wl,--gc-sections: unreferenced functions and data are dropped */
+#include <stdio.h>
+#include <string.h>
+
+/* only referenced by code which is dropped */
+void no_such_function(void);
+extern int no_such_variable;
+
+int big_table[4096] = { 1 };
+static char message[] = "kept through a pointer";
+
+static void unused_static(void)
+{
+    no_such_function();
+}
+
+void unused(void)
+{
+    unused_static();
+    printf("%d %d\n", big_table[1], no_such_variable);
+}
+
+static int square(int x)
+{
+    return x * x;
+}
+
+/* kept since referenced by kept data */
+static int (*const ops[])(int) = { square };
+char *pointer = message;
+int counter;
+
+int used(int x)
+{
+    return ops[0](x) + (int)strlen(pointer);
+}
+
+int main(void)
+{
+    counter += used(3);
+    printf("%d %s\n", counter, pointer);
+    return 0;
+}
@@ -0,0 +1,32 @@
+/* -fprofile-use: the functions run most often come first, per the
+   counts in 141_profile_use.tcov of a -ftest-coverage run, where the
+   'never' of another file was run a lot */
+#include <stdio.h>
+
+static int never(int x)
+{
+    return x - 1;
+}
+
+int once(int x)
+{
+    return x + 1;
+}
+
+static int often(int x)
+{
+    return x * 2;
+}
+
+int main(void)
+{
+    int i, s = 0;
+
+    for (i = 0; i < 10; i++)
+        s += often(i);
+    printf("%d %d\n", s, once(s));
+    printf("main before often: %d\n", (char *)main < (char *)often);
+    printf("often before once: %d\n", (char *)often < (char *)once);
+    printf("once before never: %d\n", (char *)once < (char *)never);
+    return 0;
+}
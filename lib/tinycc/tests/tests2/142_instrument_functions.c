@@ -0,0 +1,66 @@
+/* -finstrument-functions: calls to __cyg_profile_func_enter/exit */
+#include <stdio.h>
+
+#define NOINSTR __attribute__((no_instrument_function))
+
+struct pair { long a, b, c; };
+
+static int depth;
+NOINSTR static const char *name(void *fn);
+
+NOINSTR void __cyg_profile_func_enter(void *fn, void *call_site)
+{
+    printf("%*s> %s%s\n", 2 * depth++, "", name(fn), call_site ? "" : " ?");
+}
+
+NOINSTR void __cyg_profile_func_exit(void *fn, void *call_site)
+{
+    printf("%*s< %s\n", 2 * --depth, "", name(fn));
+}
+
+NOINSTR int quiet(int x)
+{
+    return x + 1;
+}
+
+int fact(int n)
+{
+    if (n < 2)
+        return 1;
+    return n * fact(n - 1);
+}
+
+struct pair mk(long x)
+{
+    struct pair p = { x, x + 1, x + 2 };
+    return p;
+}
+
+double half(double d)
+{
+    return d / 2;
+}
+
+void early(int x)
+{
+    if (x)
+        return;
+    printf("early %d\n", x);
+}
+
+NOINSTR static const char *name(void *fn)
+{
+    return fn == fact ? "fact" : fn == mk ? "mk" : fn == half ? "half"
+        : fn == early ? "early" : fn == quiet ? "quiet" : "main";
+}
+
+int main(void)
+{
+    int f = fact(3);
+    struct pair p = mk(5);
+    double h = half(3.0);
+    early(0);
+    early(1);
+    printf("%d %ld %ld %g %d depth %d\n", f, p.a, p.c, h, quiet(1), depth);
+    return 0;
+}
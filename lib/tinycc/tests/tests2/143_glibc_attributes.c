@@ -0,0 +1,37 @@
+/* attributes written after the C library's headers: glibc's
+   <sys/cdefs.h> defines __attribute__ away for compilers other than gcc
+   and clang, include/sys/cdefs.h of tcc undefines it again */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct packed { char c; int i; } __attribute__((packed));
+struct aligned { char c; } __attribute__((aligned(32)));
+typedef int v4si __attribute__((vector_size(16)));
+
+static int __attribute__((const)) twice(int x)
+{
+    return 2 * x;
+}
+
+static void __attribute__((noreturn)) leave(int code)
+{
+    exit(code);
+}
+
+int main(void)
+{
+    v4si v = { 1, 2, 3, 4 };
+    char buf[8];
+#ifdef __attribute__
+    printf("__attribute__ is a macro\n");
+#endif
+    v = v + v;
+    /* declared with nonnull, pure, ... by glibc */
+    memcpy(buf, "abc", 4);
+    printf("%d %d %d %d %d %d\n", (int)sizeof(struct packed),
+           (int)sizeof(struct aligned), (int)__alignof__(struct aligned),
+           v[3], twice(21), (int)strlen(buf));
+    fflush(stdout);
+    leave(0);
+}
@@ -0,0 +1,29 @@
+/* module relative TLS offsets: DTPOFF in code after the local dynamic
+   sequence is relaxed, and in data as debug information has them.
+   Compiled by the host compiler, linked by tcc. */
+#include <stdio.h>
+
+static __thread int first = 1;
+static __thread int second = 2;
+
+extern const long off_second;
+#ifdef __x86_64__
+__asm__(".section .rodata\n.p2align 3\noff_second: .quad second@dtpoff\n.previous");
+#else
+__asm__(".section .rodata\n.p2align 2\noff_second: .long second@dtpoff\n.previous");
+#endif
+
+static void set(int a, int b)
+{
+    first = a, second = b;
+}
+
+int main(void)
+{
+    long off = (char *)&second - (char *)&first;
+
+    set(3, 4);
+    printf("offset %ld, %ld in data\n", off, off_second);
+    printf("values %d %d\n", first, second);
+    return off_second != off || first != 3 || second != 4;
+}
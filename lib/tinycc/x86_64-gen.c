@@ -110,6 +110,24 @@ enum {
 
 #define TCC_TARGET_NATIVE_STRUCT_COPY
 ST_FUNC void gen_struct_copy(int size);
+ST_FUNC void gen_struct_set(int size);
+/* sizes copied with unrolled moves, and supported by gen_struct_set() */
+#define STRUCT_MOVE_MIN 8
+#define STRUCT_MOVE_MAX 256
+
+#ifndef TCC_TARGET_PE
+#define TCC_TARGET_NATIVE_TAIL_CALL
+ST_FUNC int gfunc_tail_call(int nb_args);
+ST_FUNC void gfunc_tail_call_undo(int addr);
+#endif
+
+#define TCC_TARGET_NATIVE_VECTOR_OP
+ST_FUNC int gen_opv(int op, int t, int size, int dst);
+
+#if !defined TCC_TARGET_PE && !defined TCC_TARGET_MACHO
+#define TCC_TARGET_NATIVE_TLS
+ST_FUNC void gen_tls_le(void);
+#endif
 
 /******************************************************/
 #else /* ! TARGET_DEFS_ONLY */
@@ -118,12 +136,12 @@ ST_FUNC void gen_struct_copy(int size);
 #include "tcc.h"
 #include <assert.h>
 
-ST_DATA const char * const target_machine_defs =
+ST_SHARED const char * const target_machine_defs =
     "__x86_64__\0"
     "__amd64__\0"
     ;
 
-ST_DATA const int reg_classes[NB_REGS] = {
+ST_SHARED const int reg_classes[NB_REGS] = {
     /* eax */ RC_INT | RC_RAX,
     /* ecx */ RC_INT | RC_RCX,
     /* edx */ RC_INT | RC_RDX,
@@ -154,17 +172,17 @@ ST_DATA const int reg_classes[NB_REGS] = {
     /* st0 */ RC_ST0
 };
 
-static unsigned long func_sub_sp_offset;
-static int func_ret_sub;
+static ST_TLS unsigned long func_sub_sp_offset;
+static ST_TLS int func_ret_sub;
 
 #if defined(CONFIG_TCC_BCHECK)
-static addr_t func_bound_offset;
-static unsigned long func_bound_ind;
+static ST_TLS addr_t func_bound_offset;
+static ST_TLS unsigned long func_bound_ind;
 ST_DATA int func_bound_add_epilog;
 #endif
 
 #ifdef TCC_TARGET_PE
-static int func_scratch, func_alloca;
+static ST_TLS int func_scratch, func_alloca;
 #endif
 
 /* XXX: make it faster ? */
@@ -1237,8 +1255,11 @@ static int arg_prepare_reg(int idx) {
 
 /* Generate function call. The function address is pushed first, then
    all the parameters in call order. This functions pops all the
-   parameters and the function address. */
-void gfunc_call(int nb_args)
+   parameters and the function address.  With 'tail', the frame is
+   left and the function jumped to instead, which is only possible if
+   no parameters are passed on the stack: returns -1 without generating
+   any code otherwise, and else the address of the 'leave' opcode. */
+static int gen_call(int nb_args, int tail)
 {
     X86_64_Mode mode;
     CType type;
@@ -1279,6 +1300,11 @@ void gfunc_call(int nb_args)
 	}
     }
 
+    if (tail && stack_adjust) {
+        tcc_free(onstack);
+        return -1;
+    }
+
     if (nb_sse_args && tcc_state->nosse)
       tcc_error("SSE disabled but floating point arguments passed");
 
@@ -1440,10 +1466,47 @@ void gfunc_call(int nb_args)
 
     if (vtop->type.ref->f.func_type != FUNC_NEW) /* implies FUNC_OLD or FUNC_ELLIPSIS */
         oad(0xb8, nb_sse_args < 8 ? nb_sse_args : 8); /* mov nb_sse_args, %eax */
+    if (tail) {
+        /* an indirect call address may be relative to %rbp */
+        if ((vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) != (VT_CONST | VT_SYM)
+            || (vtop->c.i-4) != (int)(vtop->c.i-4)) {
+            load(TREG_R11, vtop);
+            vtop->r = TREG_R11;
+        }
+        r = ind;
+        o(0xc9); /* leave */
+        gcall_or_jmp(1);
+        vtop--;
+        return r;
+    }
     gcall_or_jmp(0);
     if (args_size)
         gadd_sp(args_size);
     vtop--;
+    return 0;
+}
+
+void gfunc_call(int nb_args)
+{
+    gen_call(nb_args, 0);
+}
+
+ST_FUNC int gfunc_tail_call(int nb_args)
+{
+    return gen_call(nb_args, 1);
+}
+
+/* turn the tail call at 'addr' back into a call, which returns to the
+   code generated after it */
+ST_FUNC void gfunc_tail_call_undo(int addr)
+{
+    unsigned char *p = cur_text_section->data + addr;
+
+    p[0] = 0x90; /* nop instead of leave */
+    if (p[1] == 0xe9)
+        p[1] = 0xe8; /* call rel32 */
+    else
+        p[3] = 0xd3; /* call *%r11 */
 }
 
 #define FUNC_PROLOG_SIZE 11
@@ -2284,13 +2347,45 @@ ST_FUNC void gen_vla_alloc(CType *type, int align) {
     }
 }
 
+/* move 'n' (16 or 8) bytes between %xmm0 and 'c'('r') */
+static void gen_xmm_move(int opc, int r, int n, int c)
+{
+    if (n == 16) {
+        orex(0, r, 0, opc); /* movups */
+    } else {
+        o(opc == 0x100f ? 0xf3 : 0x66);
+        orex(0, r, 0, opc == 0x100f ? 0x7e0f : 0xd60f); /* movq */
+    }
+    gen_modrm(TREG_XMM0, r | TREG_MEM, NULL, c);
+}
+
 /*
  * Assmuing the top part of the stack looks like below,
  *  src dest src
+ *
+ * Sizes up to STRUCT_MOVE_MAX are copied with unaligned SSE moves,
+ * the last one overlapping the previous one, which avoids the startup
+ * cost of 'rep movsq'.
  */
 ST_FUNC void gen_struct_copy(int size)
 {
-    int n = size / PTR_SIZE;
+    int i, n = size / PTR_SIZE;
+
+    if (size >= STRUCT_MOVE_MIN && size <= STRUCT_MOVE_MAX
+        && !tcc_state->nosse) {
+        save_reg(TREG_XMM0);
+        gv2(RC_INT, RC_INT);
+        n = size >= 16 ? 16 : 8;
+        for (i = 0; i < size; i += n) {
+            if (i + n > size)
+                i = size - n;
+            gen_xmm_move(0x100f, vtop->r, n, i);
+            gen_xmm_move(0x110f, vtop[-1].r, n, i);
+        }
+        vpop();
+        vpop();
+        return;
+    }
 #ifdef TCC_TARGET_PE
     o(0x5756); /* push rsi, rdi */
 #endif
@@ -2317,6 +2412,154 @@ ST_FUNC void gen_struct_copy(int size)
     vpop();
 }
 
+/* fill 'size' bytes (STRUCT_MOVE_MIN to STRUCT_MOVE_MAX) at the address
+   below the top of the stack with the 64 bit pattern on top of it */
+ST_FUNC void gen_struct_set(int size)
+{
+    int r, i, n;
+
+    if (tcc_state->nosse) {
+        gv2(RC_INT, RC_INT);
+        r = vtop->r;
+        for (i = 0; i < size; i += 8) {
+            if (i + 8 > size)
+                i = size - 8;
+            orex(1, vtop[-1].r, r, 0x89); /* mov %r,i(dst) */
+            gen_modrm(r, vtop[-1].r | TREG_MEM, NULL, i);
+        }
+        vpop();
+        vpop();
+        return;
+    }
+    save_reg(TREG_XMM0);
+    if ((vtop->r & (VT_VALMASK | VT_LVAL | VT_SYM)) == VT_CONST
+        && vtop->c.i == 0) {
+        o(0xc0ef0f66); /* pxor %xmm0,%xmm0 */
+    } else {
+        r = gv(RC_INT);
+        o(0x66);
+        orex(1, r, 0, 0x6e0f); /* movq %r,%xmm0 */
+        o(0xc0 + REG_VALUE(r));
+        o(0xc06c0f66); /* punpcklqdq %xmm0,%xmm0 */
+    }
+    vpop();
+    r = gv(RC_INT);
+    n = size >= 16 ? 16 : 8;
+    for (i = 0; i < size; i += n) {
+        if (i + n > size)
+            i = size - n;
+        gen_xmm_move(0x110f, r, n, i);
+    }
+    vpop();
+}
+
+/* generate 'op' on the two vectors on top of the stack, element type
+   't', and store the result to 'dst'(%rbp). Vectors wider than 16
+   bytes are done in 16 byte chunks so that only SSE2 is needed.
+   Return 0 if there is no instruction for 'op'. */
+ST_FUNC int gen_opv(int op, int t, int size, int dst)
+{
+    static const unsigned char padd[4] = { 0xfc, 0xfd, 0xfe, 0xd4 };
+    static const unsigned char psub[4] = { 0xf8, 0xf9, 0xfa, 0xfb };
+    static const unsigned char pcmpeq[4] = { 0x74, 0x75, 0x76, 0 };
+    static const unsigned char pcmpgt[4] = { 0x64, 0x65, 0x66, 0 };
+    int bt, esize, pfx, opc, imm, swap, i, r1, r2;
+
+    if (tcc_state->nosse || (size & 15))
+        return 0;
+    bt = t & VT_BTYPE;
+    esize = bt == VT_BYTE ? 1 : bt == VT_SHORT ? 2 : is64_type(t) ? 8
+          : bt == VT_DOUBLE ? 8 : 4;
+    pfx = 0x66, opc = 0, imm = -1, swap = 0;
+    if (bt == VT_FLOAT || bt == VT_DOUBLE) {
+        if (bt == VT_FLOAT)
+            pfx = 0;
+        switch (op) {
+        case '+': opc = 0x58; break; /* addps */
+        case '-': opc = 0x5c; break; /* subps */
+        case '*': opc = 0x59; break; /* mulps */
+        case '/': opc = 0x5e; break; /* divps */
+        case TOK_EQ: imm = 0; break; /* cmpeqps */
+        case TOK_GT: swap = 1; /* fall through */
+        case TOK_LT: imm = 1; break; /* cmpltps */
+        case TOK_GE: swap = 1; /* fall through */
+        case TOK_LE: imm = 2; break; /* cmpleps */
+        case TOK_NE: imm = 4; break; /* cmpneqps */
+        }
+        if (imm >= 0)
+            opc = 0xc2;
+    } else {
+        i = esize == 1 ? 0 : esize == 2 ? 1 : esize == 4 ? 2 : 3;
+        switch (op) {
+        case '+': opc = padd[i]; break;
+        case '-': opc = psub[i]; break;
+        case '*': opc = esize == 2 ? 0xd5 : 0; break; /* pmullw */
+        case '&': opc = 0xdb; break; /* pand */
+        case '|': opc = 0xeb; break; /* por */
+        case '^': opc = 0xef; break; /* pxor */
+        case TOK_EQ: opc = pcmpeq[i]; break;
+        case TOK_LT: swap = 1; /* fall through */
+        case TOK_GT:
+            if (!(t & VT_UNSIGNED))
+                opc = pcmpgt[i];
+            break;
+        }
+    }
+    if (!opc)
+        return 0;
+
+    save_reg(TREG_XMM0);
+    save_reg(TREG_XMM1);
+    for (i = 0; i < 2; i++) {
+        vswap();
+        gaddrof();
+        vtop->type = char_pointer_type;
+    }
+    gv2(RC_INT, RC_INT);
+    r1 = vtop[-1].r, r2 = vtop->r;
+    if (swap)
+        i = r1, r1 = r2, r2 = i;
+    for (i = 0; i < size; i += 16) {
+        orex(0, r1, 0, 0x100f); /* movups i(r1),%xmm0 */
+        gen_modrm(TREG_XMM0, r1 | TREG_MEM, NULL, i);
+        orex(0, r2, 0, 0x100f); /* movups i(r2),%xmm1 */
+        gen_modrm(TREG_XMM1, r2 | TREG_MEM, NULL, i);
+        if (pfx)
+            o(pfx);
+        o(0x0f);
+        o(opc);
+        o(0xc1); /* op %xmm1,%xmm0 */
+        if (imm >= 0)
+            g(imm);
+        o(0x110f); /* movups %xmm0,dst+i(%rbp) */
+        gen_modrm(TREG_XMM0, VT_LOCAL, NULL, dst + i);
+    }
+    vpop();
+    vpop();
+    return 1;
+}
+
+#ifdef TCC_TARGET_NATIVE_TLS
+/* load the address of the thread-local symbol on top of the stack
+   (local-exec model, for executables only) */
+ST_FUNC void gen_tls_le(void)
+{
+    int r = get_reg(RC_INT);
+
+    o(0x64);
+    orex(1, 0, r, 0x8b); /* mov %fs:0,%r */
+    o(0x04 | REG_VALUE(r) << 3);
+    o(0x25);
+    gen_le32(0);
+    orex(1, r, r, 0x8d); /* lea sym@tpoff(%r),%r */
+    o(0x80 | REG_VALUE(r) << 3 | REG_VALUE(r));
+    greloca(cur_text_section, vtop->sym, ind, R_X86_64_TPOFF32, vtop->c.i);
+    gen_le32(0);
+    vtop->r = r;
+    vtop->c.i = 0;
+}
+#endif
+
 /* end of x86-64 code generator */
 /*************************************************************/
 #endif /* ! TARGET_DEFS_ONLY */
@@ -192,6 +192,23 @@ ST_FUNC void relocate(TCCState *s1, ElfW_Rel *rel, int type, unsigned char *ptr,
 
     sym_index = ELFW(R_SYM)(rel->r_info);
 
+    if (s1->output_type == TCC_OUTPUT_MEMORY) {
+        /* -run gives each thread a copy of the TLS sections, addressed
+           by __tcc_tls_addr() and not from %fs like 'tcc -c' does */
+        switch (type) {
+        case R_X86_64_GOTTPOFF:
+        case R_X86_64_TLSGD:
+        case R_X86_64_TLSLD:
+        case R_X86_64_TPOFF32:
+        case R_X86_64_TPOFF64:
+            if (0 == s1->nb_errors)
+                tcc_error_noabort("thread-local '%s' of an object file is not supported with -run",
+                    (char *) symtab_section->link->data
+                    + ((ElfW(Sym) *)symtab_section->data)[sym_index].st_name);
+            return;
+        }
+    }
+
     switch (type) {
         case R_X86_64_64:
             if (s1->output_type & TCC_OUTPUT_DYN) {
@@ -325,14 +342,12 @@ ST_FUNC void relocate(TCCState *s1, ElfW_Rel *rel, int type, unsigned char *ptr,
 
                 if (memcmp (ptr-4, expect, sizeof(expect)) == 0) {
                     ElfW(Sym) *sym;
-                    Section *sec;
                     int32_t x;
 
                     memcpy(ptr-4, replace, sizeof(replace));
                     rel[1].r_info = ELFW(R_INFO)(0, R_X86_64_NONE);
                     sym = &((ElfW(Sym) *)symtab_section->data)[sym_index];
-                    sec = s1->sections[sym->st_shndx];
-                    x = sym->st_value - sec->sh_addr - sec->data_offset;
+                    x = tls_tpoff(s1, sym->st_value);
                     add32le(ptr + 8, x);
                 }
                 else
@@ -362,26 +377,20 @@ ST_FUNC void relocate(TCCState *s1, ElfW_Rel *rel, int type, unsigned char *ptr,
         case R_X86_64_DTPOFF32:
         case R_X86_64_TPOFF32:
             {
-                ElfW(Sym) *sym;
-                Section *sec;
-                int32_t x;
+                /* in code, DTPOFF is added to the thread pointer that
+                   the relaxed TLSLD sequence above loads */
+                int32_t x = type == R_X86_64_DTPOFF32 && !s1->reloc_code
+                    ? tls_dtpoff(s1, val) : tls_tpoff(s1, val);
 
-                sym = &((ElfW(Sym) *)symtab_section->data)[sym_index];
-                sec = s1->sections[sym->st_shndx];
-                x = val - sec->sh_addr - sec->data_offset;
                 add32le(ptr, x);
             }
             break;
         case R_X86_64_DTPOFF64:
         case R_X86_64_TPOFF64:
             {
-                ElfW(Sym) *sym;
-                Section *sec;
-                int32_t x;
+                int32_t x = type == R_X86_64_DTPOFF64 && !s1->reloc_code
+                    ? tls_dtpoff(s1, val) : tls_tpoff(s1, val);
 
-                sym = &((ElfW(Sym) *)symtab_section->data)[sym_index];
-                sec = s1->sections[sym->st_shndx];
-                x = val - sec->sh_addr - sec->data_offset;
                 add64le(ptr, x);
             }
             break;
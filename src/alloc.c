@@ -0,0 +1,750 @@
+/* CJIT https://dyne.org/cjit
+ *
+ * Copyright (C) 2025 Dyne.org foundation
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+// Memory allocation runtime for the programs run in memory, see
+// assets/alloc/cjit_alloc.h for the interface.
+//
+// The allocator takes its memory from a single range of address space,
+// reserved at the first call and cut in spans of 64 KiB. A span holds
+// blocks of one of the small size classes, up to 32 KiB, or is the
+// start of a large block. So a pointer in the range tells its size by
+// the span it falls in, and a pointer out of it was not allocated here
+// and goes to the C library.
+//
+// Each thread keeps a cache of free small blocks per class, which
+// serves malloc() and takes free() without locks. It moves blocks in
+// batches to and from the spans of the class, under a lock per class.
+// Free spans, of large blocks or of small ones all free, merge with
+// the free spans around them and give their pages back to the system,
+// under a lock of their own: they serve large blocks and new spans of
+// small ones.
+
+#include <cjit.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#if !defined(WINDOWS)
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+#include "../assets/alloc/cjit_alloc.h"
+
+#define SPAN_SHIFT 16
+#define SPAN       ((size_t)1<<SPAN_SHIFT)
+#define SMALL_MAX  32768
+#define NCLASS     45 // 0 is unused
+#define LARGE      0x80000000u // in span_info[], | number of spans
+#define EXTENT     0x40000000u // same, for free spans
+#define LARGE_BINS 64 // exact sizes in spans, then first fit
+#define DIRTY_MAX  256 // free spans whose pages are kept, 16 MiB
+
+// address space reserved, the largest the system gives
+static const size_t region_sizes[] = {
+	(size_t)1<<36, (size_t)1<<34, (size_t)1<<32, (size_t)1<<30, 0 };
+
+static char *region; // NULL: the C library does all the work
+static size_t region_spans;
+static size_t region_top; // spans used so far, under large_lock
+// per span: its class, or LARGE | spans at both ends of a large block,
+// or EXTENT | spans at both ends of free ones
+static uint32_t *span_info;
+static size_t page = 4096;
+static pthread_once_t region_once = PTHREAD_ONCE_INIT;
+
+typedef struct block { struct block *next; } block;
+
+// the free blocks of a span of small blocks, under the central lock
+typedef struct small_span {
+	block *free;
+	unsigned avail, blocks; // in 'free', in all
+	struct small_span *next, **pprev;
+} small_span;
+
+static small_span *small_spans; // per span
+
+static struct central {
+	pthread_mutex_t lock;
+	small_span *spans; // those with free blocks
+} central[NCLASS];
+
+// free spans, merged with the free ones around
+typedef struct extent {
+	struct extent *next, **pprev;
+	size_t spans;
+	bool dirty; // its pages are not yet given back
+} extent;
+
+static pthread_mutex_t large_lock = PTHREAD_MUTEX_INITIALIZER;
+static extent *large_free[LARGE_BINS + 1];
+static size_t dirty_spans; // in the dirty extents
+
+enum { CACHE_NEW, CACHE_ON, CACHE_GONE }; // tcache.state
+
+typedef struct tcache {
+	block *free[NCLASS];
+	unsigned count[NCLASS];
+	int state; // CACHE_GONE once flushed at thread exit
+} tcache;
+
+static __thread tcache cache;
+static pthread_key_t cache_key;
+
+// classes of 16 bytes up to 256, then four per power of two
+static inline int size_class(size_t size) {
+	int p;
+	if(size <= 256) return size ? (size + 15) >> 4 : 1;
+	p = 63 - __builtin_clzll(size - 1); // 2^p < size <= 2^(p+1)
+	return 13 + (p - 8) * 4 + (int)((size - 1) >> (p - 2));
+}
+
+static inline size_t class_size(int c) {
+	int k, p;
+	if(c <= 16) return (size_t)c << 4;
+	k = c - 17;
+	p = 8 + k / 4;
+	return (size_t)(k % 4 + 5) << (p - 2);
+}
+
+// blocks moved at once between a thread cache and the central list
+static inline unsigned class_batch(int c) {
+	size_t n = 8192 / class_size(c);
+	return n < 4 ? 4 : n > 64 ? 64 : n;
+}
+
+static void cache_flush(void *arg);
+
+static void region_init(void) {
+	int i;
+	for(i=0; i<NCLASS; i++)
+		pthread_mutex_init(&central[i].lock, NULL);
+	pthread_key_create(&cache_key, cache_flush);
+#if !defined(WINDOWS)
+	if(sysconf(_SC_PAGESIZE) > 0) page = sysconf(_SC_PAGESIZE);
+	for(i=0; region_sizes[i]; i++) {
+		size_t spans = region_sizes[i] >> SPAN_SHIFT;
+		size_t info = spans * (sizeof *small_spans + sizeof *span_info);
+		// one more span to align the start
+		void *p = mmap(NULL, region_sizes[i] + SPAN + info,
+			       PROT_READ | PROT_WRITE,
+			       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+			       -1, 0);
+		if(p == MAP_FAILED) continue;
+		small_spans = p;
+		span_info = (uint32_t*)(small_spans + spans);
+		region = (char*)(((uintptr_t)p + info + SPAN - 1) & ~(SPAN - 1));
+		__atomic_store_n(&region_spans, spans, __ATOMIC_RELEASE);
+		return;
+	}
+#endif
+}
+
+static inline bool is_ours(const void *ptr) {
+	return (uintptr_t)ptr - (uintptr_t)region
+		< (uintptr_t)region_spans << SPAN_SHIFT;
+}
+
+// extents are linked and unlinked under large_lock
+static void extent_link(char *p, size_t n, bool dirty) {
+	extent *e = (extent*)p;
+	extent **head = &large_free[n < LARGE_BINS ? n : LARGE_BINS];
+	size_t i = (p - region) >> SPAN_SHIFT;
+	e->spans = n;
+	e->dirty = dirty;
+	if(dirty) dirty_spans += n;
+	if((e->next = *head)) e->next->pprev = &e->next;
+	e->pprev = head;
+	*head = e;
+	span_info[i] = span_info[i + n - 1] = EXTENT | n;
+}
+
+static void extent_unlink(extent *e) {
+	if(e->dirty) dirty_spans -= e->spans;
+	if(e->next) e->next->pprev = e->pprev;
+	*e->pprev = e->next;
+}
+
+// the pages of the dirty extents, but the one holding the extent, go
+// back to the system, the addresses stay. Done once DIRTY_MAX spans are
+// free and dirty, so that reused blocks do not fault their pages in
+// again each time.
+static void extents_purge(void) {
+#if !defined(WINDOWS)
+	extent *e;
+	int bin;
+	for(bin=1; bin<=LARGE_BINS; bin++)
+		for(e = large_free[bin]; e; e = e->next) {
+			if(!e->dirty) continue;
+			if((e->spans << SPAN_SHIFT) > page)
+				madvise((char*)e + page,
+					(e->spans << SPAN_SHIFT) - page,
+					MADV_DONTNEED);
+			e->dirty = false;
+		}
+#endif
+	dirty_spans = 0;
+}
+
+// 'n' spans tagged at both ends: the start of the smallest free extent
+// that fits, or else new ones from the top of the region
+static char *spans_take(size_t n, uint32_t tag) {
+	size_t bin = n < LARGE_BINS ? n : LARGE_BINS, i;
+	extent *e;
+	char *p = NULL;
+	pthread_mutex_lock(&large_lock);
+	while(bin < LARGE_BINS && !large_free[bin]) bin++;
+	for(e = large_free[bin]; e && e->spans < n; e = e->next);
+	if(e) {
+		extent_unlink(e);
+		if(e->spans > n) // the rest stays free
+			extent_link((char*)e + (n << SPAN_SHIFT),
+				    e->spans - n, e->dirty);
+		p = (char*)e;
+	} else if(n <= region_spans - region_top) {
+		p = region + (region_top << SPAN_SHIFT);
+		region_top += n;
+	}
+	if(p) {
+		i = (p - region) >> SPAN_SHIFT;
+		span_info[i] = span_info[i + n - 1] = tag;
+	}
+	pthread_mutex_unlock(&large_lock);
+	if(!p) errno = ENOMEM;
+	return p;
+}
+
+// 'n' spans back to the free extents, merged with the free ones around
+static void spans_free(char *p, size_t n) {
+	size_t i = (p - region) >> SPAN_SHIFT, m;
+	pthread_mutex_lock(&large_lock);
+	if(i && (span_info[i - 1] & EXTENT)) {
+		m = span_info[i - 1] & ~EXTENT;
+		p -= m << SPAN_SHIFT;
+		extent_unlink((extent*)p);
+		i -= m;
+		n += m;
+	}
+	if(i + n < region_top && (span_info[i + n] & EXTENT)) {
+		m = span_info[i + n] & ~EXTENT;
+		extent_unlink((extent*)(p + (n << SPAN_SHIFT)));
+		n += m;
+	}
+	extent_link(p, n, true);
+	if(dirty_spans > DIRTY_MAX) extents_purge();
+	pthread_mutex_unlock(&large_lock);
+}
+
+static void *large_alloc(size_t size) {
+	size_t n = (size + SPAN - 1) >> SPAN_SHIFT;
+	if(n < size >> SPAN_SHIFT || n > region_spans) { // or too big
+		errno = ENOMEM;
+		return NULL;
+	}
+	return spans_take(n, LARGE | n);
+}
+
+// small spans with free blocks are linked and unlinked under the
+// central lock of their class
+static void span_link(struct central *k, small_span *m) {
+	if((m->next = k->spans)) m->next->pprev = &m->next;
+	m->pprev = &k->spans;
+	k->spans = m;
+}
+
+static void span_unlink(small_span *m) {
+	if(m->next) m->next->pprev = m->pprev;
+	*m->pprev = m->next;
+}
+
+// cut a new span in blocks of class 'c'
+static bool span_cut(int c) {
+	size_t size = class_size(c);
+	char *s = spans_take(1, c), *p;
+	small_span *m;
+	if(!s) return false;
+	m = &small_spans[(s - region) >> SPAN_SHIFT];
+	m->free = NULL;
+	m->avail = m->blocks = SPAN / size;
+	for(p = s + (m->blocks - 1) * size; p >= s; p -= size) {
+		((block*)p)->next = m->free;
+		m->free = (block*)p;
+	}
+	span_link(&central[c], m);
+	return true;
+}
+
+// a free block back to its span. A span whose blocks are all free goes
+// back to the free extents, unless it is the last of its class with
+// some.
+static void span_put(struct central *k, block *b) {
+	size_t i = ((char*)b - region) >> SPAN_SHIFT;
+	small_span *m = &small_spans[i];
+	b->next = m->free;
+	m->free = b;
+	if(!m->avail++) span_link(k, m);
+	if(m->avail == m->blocks && (k->spans != m || m->next)) {
+		span_unlink(m);
+		spans_free(region + (i << SPAN_SHIFT), 1);
+	}
+}
+
+// a batch of free blocks of class 'c' into the cache of this thread
+static bool cache_refill(tcache *t, int c) {
+	struct central *k = &central[c];
+	unsigned want = class_batch(c), got = 0;
+	small_span *m;
+	block *b;
+	pthread_mutex_lock(&k->lock);
+	if(!k->spans && !span_cut(c)) {
+		pthread_mutex_unlock(&k->lock);
+		return false;
+	}
+	while(got < want && (m = k->spans)) {
+		for(; got < want && (b = m->free); got++, m->avail--) {
+			m->free = b->next;
+			b->next = t->free[c];
+			t->free[c] = b;
+		}
+		if(!m->free) span_unlink(m);
+	}
+	pthread_mutex_unlock(&k->lock);
+	t->count[c] += got;
+	return true;
+}
+
+// give 'n' blocks of class 'c' of the cache back to their spans
+static void cache_release(tcache *t, int c, unsigned n) {
+	struct central *k = &central[c];
+	block *b = t->free[c], *next;
+	unsigned i;
+	if(!b || !n) return;
+	pthread_mutex_lock(&k->lock);
+	for(i=0; i<n && b; i++, b = next) {
+		next = b->next;
+		span_put(k, b);
+	}
+	pthread_mutex_unlock(&k->lock);
+	t->free[c] = b;
+	t->count[c] -= i;
+}
+
+static void cache_flush(void *arg) {
+	tcache *t = arg;
+	int c;
+	for(c=1; c<NCLASS; c++)
+		cache_release(t, c, t->count[c]);
+	t->state = CACHE_GONE;
+}
+
+// after a malloc() or free() of class 'c': the first one registers the
+// cache, to give its blocks back at thread exit, also when the thread
+// only frees. Those of later destructors, once it is flushed, leave
+// nothing in it.
+static inline void cache_keep(tcache *t, int c) {
+	if(t->state == CACHE_ON) return;
+	if(t->state == CACHE_NEW) {
+		pthread_setspecific(cache_key, t);
+		t->state = CACHE_ON;
+	} else cache_release(t, c, t->count[c]);
+}
+
+void *cjit_mem_alloc(size_t size) {
+	tcache *t = &cache;
+	block *b;
+	int c;
+	// not yet reserved, or failed
+	if(!__atomic_load_n(&region_spans, __ATOMIC_ACQUIRE)) {
+		pthread_once(&region_once, region_init);
+		if(!region) return malloc(size);
+	}
+	if(size > SMALL_MAX) {
+		b = large_alloc(size);
+		return b ? b : malloc(size); // out of the region
+	}
+	c = size_class(size);
+	if(!(b = t->free[c])) {
+		if(!cache_refill(t, c)) return malloc(size);
+		b = t->free[c];
+	}
+	t->free[c] = b->next;
+	t->count[c]--;
+	cache_keep(t, c);
+	return b;
+}
+
+void cjit_mem_free(void *ptr) {
+	tcache *t = &cache;
+	uint32_t info;
+	int c;
+	if(!ptr) return;
+	if(!is_ours(ptr)) {
+		free(ptr);
+		return;
+	}
+	info = span_info[((char*)ptr - region) >> SPAN_SHIFT];
+	if(info & LARGE) {
+		spans_free(ptr, info & ~LARGE);
+		return;
+	}
+	c = info;
+	((block*)ptr)->next = t->free[c];
+	t->free[c] = ptr;
+	if(++t->count[c] > 2 * class_batch(c))
+		cache_release(t, c, class_batch(c));
+	cache_keep(t, c);
+}
+
+size_t cjit_mem_size(void *ptr) {
+	uint32_t info;
+	if(!ptr) return 0;
+	if(!is_ours(ptr)) {
+#if defined(__APPLE__)
+		return malloc_size(ptr);
+#elif defined(WINDOWS)
+		return _msize(ptr);
+#else
+		return malloc_usable_size(ptr);
+#endif
+	}
+	info = span_info[((char*)ptr - region) >> SPAN_SHIFT];
+	if(info & LARGE) return (size_t)(info & ~LARGE) << SPAN_SHIFT;
+	return class_size(info);
+}
+
+void *cjit_mem_calloc(size_t nmemb, size_t size) {
+	void *p;
+	if(size && nmemb > SIZE_MAX / size) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	p = cjit_mem_alloc(nmemb * size);
+	if(p) memset(p, 0, nmemb * size);
+	return p;
+}
+
+void *cjit_mem_realloc(void *ptr, size_t size) {
+	size_t old;
+	void *p;
+	if(!ptr) return cjit_mem_alloc(size);
+	if(!is_ours(ptr)) return realloc(ptr, size);
+	if(!size) {
+		cjit_mem_free(ptr);
+		return NULL;
+	}
+	old = cjit_mem_size(ptr);
+	// keep the block unless it shrinks to less than half
+	if(size <= old && (size > old / 2 || old <= 16)) return ptr;
+	p = cjit_mem_alloc(size);
+	if(!p) return NULL;
+	memcpy(p, ptr, size < old ? size : old);
+	cjit_mem_free(ptr);
+	return p;
+}
+
+// small blocks of a power of two size are aligned to it, large blocks
+// to a span
+void *cjit_mem_aligned(size_t alignment, size_t size) {
+	size_t s = size > alignment ? size : alignment;
+	if(alignment & (alignment - 1)) {
+		errno = EINVAL;
+		return NULL;
+	}
+	pthread_once(&region_once, region_init);
+	if(alignment <= 16) return cjit_mem_alloc(size);
+	if(!region || alignment > SPAN) {
+#if defined(WINDOWS)
+		errno = EINVAL;
+		return NULL;
+#else
+		void *p;
+		int err = posix_memalign(&p, alignment, size);
+		if(err) errno = err;
+		return err ? NULL : p;
+#endif
+	}
+	if(s <= SMALL_MAX) // a power of two
+		s = (size_t)1 << (64 - __builtin_clzll(s - 1));
+	return cjit_mem_alloc(s);
+}
+
+static int cjit_posix_memalign(void **memptr, size_t alignment, size_t size) {
+	void *p;
+	if(alignment < sizeof(void*) || (alignment & (alignment - 1)))
+		return EINVAL;
+	p = cjit_mem_aligned(alignment, size);
+	if(!p) return ENOMEM;
+	*memptr = p;
+	return 0;
+}
+
+static void *cjit_memalign(size_t alignment, size_t size) {
+	return cjit_mem_aligned(alignment, size);
+}
+
+static void *cjit_reallocarray(void *ptr, size_t nmemb, size_t size) {
+	if(size && nmemb > SIZE_MAX / size) {
+		errno = ENOMEM;
+		return NULL;
+	}
+	return cjit_mem_realloc(ptr, nmemb * size);
+}
+
+static char *cjit_strdup(const char *s) {
+	size_t len = strlen(s) + 1;
+	char *p = cjit_mem_alloc(len);
+	if(p) memcpy(p, s, len);
+	return p;
+}
+
+static char *cjit_strndup(const char *s, size_t n) {
+	size_t len = strnlen(s, n);
+	char *p = cjit_mem_alloc(len + 1);
+	if(p) {
+		memcpy(p, s, len);
+		p[len] = 0;
+	}
+	return p;
+}
+
+#if !defined(WINDOWS)
+// the C library's getline() would realloc() a buffer allocated here
+static ssize_t cjit_getdelim(char **lineptr, size_t *n, int delim, FILE *f) {
+	size_t len = 0;
+	int ch;
+	if(!lineptr || !n || !f) {
+		errno = EINVAL;
+		return -1;
+	}
+	flockfile(f);
+	while((ch = getc_unlocked(f)) != EOF) {
+		if(len + 2 > *n || !*lineptr) {
+			size_t size = *n < 120 ? 120 : *n * 2;
+			char *p = cjit_mem_realloc(*lineptr, size);
+			if(!p) {
+				funlockfile(f);
+				errno = ENOMEM;
+				return -1;
+			}
+			*lineptr = p;
+			*n = size;
+		}
+		(*lineptr)[len++] = ch;
+		if(ch == delim) break;
+	}
+	funlockfile(f);
+	if(!len) return -1;
+	(*lineptr)[len] = 0;
+	return len;
+}
+
+static ssize_t cjit_getline(char **lineptr, size_t *n, FILE *f) {
+	return cjit_getdelim(lineptr, n, '\n', f);
+}
+#endif
+
+/////////////
+// arenas
+
+#define ARENA_CHUNK 65536
+
+typedef struct arena_chunk {
+	struct arena_chunk *next;
+	size_t size; // usable after the header
+} arena_chunk;
+
+struct cjit_arena {
+	arena_chunk *chunks; // the current one first
+	char *ptr, *end;
+	size_t chunk;
+};
+
+#define ARENA_HEADER ((sizeof(arena_chunk) + 15) & ~(size_t)15)
+
+cjit_arena *cjit_arena_new(size_t chunk) {
+	cjit_arena *a = calloc(1, sizeof *a);
+	if(!a) return NULL;
+	a->chunk = chunk ? chunk : ARENA_CHUNK;
+	return a;
+}
+
+void *cjit_arena_alloc(cjit_arena *a, size_t size) {
+	arena_chunk *c;
+	char *p;
+	size = (size + 15) & ~(size_t)15;
+	if(!size) size = 16;
+	if((size_t)(a->end - a->ptr) >= size) {
+		p = a->ptr;
+		a->ptr += size;
+		return p;
+	}
+	c = malloc(ARENA_HEADER + (size > a->chunk ? size : a->chunk));
+	if(!c) return NULL;
+	c->size = size > a->chunk ? size : a->chunk;
+	if(size > a->chunk && a->chunks) {
+		// a big block alone, after the current chunk
+		c->next = a->chunks->next;
+		a->chunks->next = c;
+		return (char*)c + ARENA_HEADER;
+	}
+	c->next = a->chunks;
+	a->chunks = c;
+	p = (char*)c + ARENA_HEADER;
+	a->ptr = p + size;
+	a->end = p + c->size;
+	return p;
+}
+
+void cjit_arena_reset(cjit_arena *a) {
+	arena_chunk *c, *next, *keep = NULL;
+	for(c = a->chunks; c; c = next) {
+		next = c->next;
+		if(!keep && c->size == a->chunk) keep = c;
+		else free(c);
+	}
+	a->chunks = keep;
+	if(keep) {
+		keep->next = NULL;
+		a->ptr = (char*)keep + ARENA_HEADER;
+		a->end = a->ptr + keep->size;
+	} else a->ptr = a->end = NULL;
+}
+
+void cjit_arena_delete(cjit_arena *a) {
+	arena_chunk *c, *next;
+	if(!a) return;
+	for(c = a->chunks; c; c = next) {
+		next = c->next;
+		free(c);
+	}
+	free(a);
+}
+
+/////////////
+// pools
+
+#define POOL_CHUNK 65536
+
+typedef struct pool_chunk { struct pool_chunk *next; } pool_chunk;
+
+struct cjit_pool {
+	block *free;
+	pool_chunk *chunks;
+	char *ptr, *end; // not yet used in the last chunk
+	size_t size;
+};
+
+#define POOL_HEADER ((sizeof(pool_chunk) + 15) & ~(size_t)15)
+
+cjit_pool *cjit_pool_new(size_t size) {
+	cjit_pool *p = calloc(1, sizeof *p);
+	if(!p) return NULL;
+	size = size < sizeof(block) ? sizeof(block) : size;
+	p->size = (size + 15) & ~(size_t)15;
+	return p;
+}
+
+void *cjit_pool_alloc(cjit_pool *p) {
+	block *b = p->free;
+	pool_chunk *c;
+	size_t n;
+	if(b) {
+		p->free = b->next;
+		return b;
+	}
+	if(p->ptr == p->end) {
+		n = POOL_CHUNK / p->size;
+		if(n < 16) n = 16;
+		if(!(c = malloc(POOL_HEADER + n * p->size))) return NULL;
+		c->next = p->chunks;
+		p->chunks = c;
+		p->ptr = (char*)c + POOL_HEADER;
+		p->end = p->ptr + n * p->size;
+	}
+	b = (block*)p->ptr;
+	p->ptr += p->size;
+	return b;
+}
+
+void cjit_pool_free(cjit_pool *p, void *ptr) {
+	if(!ptr) return;
+	((block*)ptr)->next = p->free;
+	p->free = ptr;
+}
+
+void cjit_pool_delete(cjit_pool *p) {
+	pool_chunk *c, *next;
+	if(!p) return;
+	for(c = p->chunks; c; c = next) {
+		next = c->next;
+		free(c);
+	}
+	free(p);
+}
+
+// arenas and pools always, the allocator in place of malloc() & co.
+// with 'interpose'
+void cjit_alloc_symbols(TCCState *TCC, bool interpose) {
+	static const struct { const char *name; void *fn; } api[] = {
+		{ "cjit_mem_alloc", cjit_mem_alloc },
+		{ "cjit_mem_calloc", cjit_mem_calloc },
+		{ "cjit_mem_realloc", cjit_mem_realloc },
+		{ "cjit_mem_free", cjit_mem_free },
+		{ "cjit_mem_aligned", cjit_mem_aligned },
+		{ "cjit_mem_size", cjit_mem_size },
+		{ "cjit_arena_new", cjit_arena_new },
+		{ "cjit_arena_alloc", cjit_arena_alloc },
+		{ "cjit_arena_reset", cjit_arena_reset },
+		{ "cjit_arena_delete", cjit_arena_delete },
+		{ "cjit_pool_new", cjit_pool_new },
+		{ "cjit_pool_alloc", cjit_pool_alloc },
+		{ "cjit_pool_free", cjit_pool_free },
+		{ "cjit_pool_delete", cjit_pool_delete },
+	}, libc[] = {
+		{ "malloc", cjit_mem_alloc },
+		{ "calloc", cjit_mem_calloc },
+		{ "realloc", cjit_mem_realloc },
+		{ "free", cjit_mem_free },
+		{ "aligned_alloc", cjit_mem_aligned },
+		{ "posix_memalign", cjit_posix_memalign },
+		{ "memalign", cjit_memalign },
+		{ "malloc_usable_size", cjit_mem_size },
+		{ "reallocarray", cjit_reallocarray },
+		{ "strdup", cjit_strdup },
+		{ "strndup", cjit_strndup },
+#if !defined(WINDOWS)
+		{ "getline", cjit_getline },
+		{ "getdelim", cjit_getdelim },
+#endif
+	};
+	size_t i;
+	for(i=0; i<sizeof api/sizeof api[0]; i++)
+		tcc_add_symbol(TCC, api[i].name, api[i].fn);
+	if(!interpose) return;
+	for(i=0; i<sizeof libc/sizeof libc[0]; i++)
+		tcc_add_symbol(TCC, libc[i].name, libc[i].fn);
+}
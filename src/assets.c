@@ -0,0 +1,52 @@
+// Generated by cjit/build/init-assets.sh
+// Sat Oct 17 04:50:04 UTC 2026
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <assets.h>
+#include <cjit.h>
+
+// from muntar.c
+extern int muntargz_to_path(const char *path, const uint8_t *buf, const unsigned int len);
+
+// main function
+bool extract_assets(CJITState *CJIT) {
+  if(!CJIT->tmpdir) return(false);
+  bool res = 0;
+  char incpath[512];
+
+// vv libtcc1.a vv
+snprintf(incpath,511,"%s/%s",CJIT->tmpdir,"libtcc1.a");
+if(CJIT->fresh) res = muntargz_to_path(CJIT->tmpdir,(const uint8_t*)&libtcc1_a,libtcc1_a_len);
+if(res!=0) { _err("Error extracting %s",incpath); return(false); }
+cjit_add_include_path(CJIT, incpath);
+// ^^ libtcc1.a ^^
+
+
+// vv include vv
+snprintf(incpath,511,"%s/%s",CJIT->tmpdir,"include");
+if(CJIT->fresh) res = muntargz_to_path(CJIT->tmpdir,(const uint8_t*)&include,include_len);
+if(res!=0) { _err("Error extracting %s",incpath); return(false); }
+cjit_add_include_path(CJIT, incpath);
+// ^^ include ^^
+
+
+// vv intrin vv
+snprintf(incpath,511,"%s/%s",CJIT->tmpdir,"intrin");
+if(CJIT->fresh) res = muntargz_to_path(CJIT->tmpdir,(const uint8_t*)&intrin,intrin_len);
+if(res!=0) { _err("Error extracting %s",incpath); return(false); }
+cjit_add_include_path(CJIT, incpath);
+// ^^ intrin ^^
+
+
+// vv alloc vv
+snprintf(incpath,511,"%s/%s",CJIT->tmpdir,"alloc");
+if(CJIT->fresh) res = muntargz_to_path(CJIT->tmpdir,(const uint8_t*)&alloc,alloc_len);
+if(res!=0) { _err("Error extracting %s",incpath); return(false); }
+cjit_add_include_path(CJIT, incpath);
+// ^^ alloc ^^
+
+
+return(true);
+}
@@ -0,0 +1,24 @@
+// Generated by cjit/build/init-assets.sh
+// Sat Oct 17 04:50:04 UTC 2026
+
+#ifndef __ASSETS_H__
+#define __ASSETS_H__
+
+
+extern const char *libtcc1_a;
+extern const unsigned int libtcc1_a_len;
+
+
+extern const char *include;
+extern const unsigned int include_len;
+
+
+extern const char *intrin;
+extern const unsigned int intrin_len;
+
+
+extern const char *alloc;
+extern const unsigned int alloc_len;
+
+
+#endif
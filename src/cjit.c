@@ -31,9 +31,16 @@
 #include <fcntl.h> // open(2)
 #include <inttypes.h>
 #include <sys/stat.h> // fstat(2)
+#if !defined(WINDOWS)
+#include <pthread.h> // parallel jobs
+#include <dirent.h> // cjit_prune_build
+#include <utime.h>
+#include <time.h>
+#endif
 
 #define MAX_PATH 260 // rather short paths
 #define MAX_STRING 20480 // max 20KiB strings
+#define BUILD_DAYS 14 // objects of projects unused that long are removed
 
 // declared at bottom
 void _out(const char *fmt, ...);
@@ -136,65 +143,87 @@ CJITState* cjit_new() {
 	return(cjit);
 }
 
-bool cjit_setup(CJITState *cjit) {
-	// set output in memory for just in time execution
-	if(cjit->done_setup) {
-		_err("Warning: cjit_setup called twice or more times");
-		return(true);
-	}
-	tcc_set_output_type(cjit->TCC, cjit->tcc_output);
-#if defined(LIBC_MUSL)
-	tcc_add_libc_symbols(cjit->TCC);
-#endif
+// settings shared by the main TCC state and the TCC states of jobs
+static void cjit_setup_state(CJITState *cjit, TCCState *TCC) {
 	if(getenv("CFLAGS")) {
 		char *extra_cflags = NULL;
 		extra_cflags = getenv("CFLAGS");
-		_err("CFLAGS: %s",extra_cflags);
-		tcc_set_options(cjit->TCC, extra_cflags);
+		if(TCC==cjit->TCC) _err("CFLAGS: %s",extra_cflags);
+		tcc_set_options(TCC, extra_cflags);
 	}
-#if defined(_WIN32)
-	// add symbols for windows compatibility
-	tcc_add_symbol(cjit->TCC, "usleep", &win_compat_usleep);
-	tcc_add_symbol(cjit->TCC, "getline", &win_compat_getline);
-#endif
-	// When using SDL2 these defines are needed
-	tcc_define_symbol(cjit->TCC,"SDL_DISABLE_IMMINTRIN_H",NULL);
-	tcc_define_symbol(cjit->TCC,"SDL_MAIN_HANDLED",NULL);
+	// When using SDL2 this define is needed
+	tcc_define_symbol(TCC,"SDL_MAIN_HANDLED",NULL);
 
 	// where is libtcc1.a found
-	tcc_add_library_path(cjit->TCC, cjit->tmpdir);
+	tcc_add_library_path(TCC, cjit->tmpdir);
 
 	// tcc_set_lib_path(TCC,tmpdir); // this overrides all?
 
-	tcc_add_sysinclude_path(cjit->TCC, cjit->tmpdir);
-	tcc_add_sysinclude_path(cjit->TCC, ".");
-	tcc_add_sysinclude_path(cjit->TCC, "include");
-	tcc_add_library_path(cjit->TCC, ".");
+	tcc_add_sysinclude_path(TCC, cjit->tmpdir);
+	tcc_add_sysinclude_path(TCC, ".");
+	tcc_add_sysinclude_path(TCC, "include");
+	tcc_add_library_path(TCC, ".");
+
+	{
+		// cache what the #include lines on top of sources produce
+		char *pchdir = malloc(strlen(cjit->tmpdir)+8);
+		strcpy(pchdir,cjit->tmpdir);
+		strcat(pchdir,"/pch");
+#if defined(WINDOWS)
+		CreateDirectory(pchdir, NULL);
+#else
+		mkdir(pchdir,0755);
+#endif
+		tcc_set_pch_dir(TCC, pchdir);
+		free(pchdir);
+	}
 
 #if defined(_WIN32)
 	{
 		// windows system32 libraries
 		//tcc_add_library_path(TCC, "C:\\Windows\\System32")
 		// 64bit
-		tcc_add_library_path(cjit->TCC, "C:\\Windows\\SysWOW64");
+		tcc_add_library_path(TCC, "C:\\Windows\\SysWOW64");
 		// tinycc win32 headers
 		char *tpath = malloc(strlen(cjit->tmpdir)+32);
 		strcpy(tpath,cjit->tmpdir);
 		strcat(tpath,"/tinycc_win32/winapi");
-		tcc_add_sysinclude_path(cjit->TCC, tpath);
+		tcc_add_sysinclude_path(TCC, tpath);
 		free(tpath);
 		// windows SDK headers
 		char *sdkpath = malloc(512);
 		if( get_winsdkpath(sdkpath,511) ) {
 			int pathend = strlen(sdkpath);
 			strcpy(&sdkpath[pathend],"\\um"); // um/GL
-			tcc_add_sysinclude_path(cjit->TCC, sdkpath);
+			tcc_add_sysinclude_path(TCC, sdkpath);
 			strcpy(&sdkpath[pathend],"\\shared"); // winapifamili.h etc.
-			tcc_add_sysinclude_path(cjit->TCC, sdkpath);
+			tcc_add_sysinclude_path(TCC, sdkpath);
 		}
 		free(sdkpath);
 	}
 #endif
+}
+
+bool cjit_setup(CJITState *cjit) {
+	// set output in memory for just in time execution
+	if(cjit->done_setup) {
+		_err("Warning: cjit_setup called twice or more times");
+		return(true);
+	}
+	tcc_set_output_type(cjit->TCC, cjit->tcc_output);
+#if defined(LIBC_MUSL)
+	tcc_add_libc_symbols(cjit->TCC);
+#endif
+	// arenas and pools of <cjit_alloc.h>, and with --fast-malloc the
+	// thread-caching allocator in place of malloc()
+	if(cjit->tcc_output == TCC_OUTPUT_MEMORY)
+		cjit_alloc_symbols(cjit->TCC, cjit->fast_malloc);
+#if defined(_WIN32)
+	// add symbols for windows compatibility
+	tcc_add_symbol(cjit->TCC, "usleep", &win_compat_usleep);
+	tcc_add_symbol(cjit->TCC, "getline", &win_compat_getline);
+#endif
+	cjit_setup_state(cjit, cjit->TCC);
 	cjit->done_setup = true;
 	return(true);
 }
@@ -254,26 +283,29 @@ static int has_source_extension(const char *path) {
 	return (is_source? 1 : -1);
 }
 
-static int detect_bom(const char *filename,size_t *filesize) {
+static int detect_bom(const char *filename,size_t *filesize,bool quiet) {
 	uint8_t bom[3];
 	int res;
 	int fd = open(filename, O_RDONLY | O_BINARY);
 	if(fd<0) {
+		if(quiet) return -1;
 		_err("%s: error opening file: %s",__func__,filename);
 		_err("%s",strerror(errno));
 		return -1;
 	}
 	struct stat st;
 	if (fstat(fd, &st) == -1) {
+		close(fd);
+		if(quiet) return -1;
 		_err("%s: error analyzing file: %s",__func__,filename);
 		_err("%s",strerror(errno));
-		close(fd);
 		return -1;
 	}
 	*filesize = st.st_size;
 	res = read(fd,bom,3);
 	close(fd);
 	if (res!=3) {
+		if(quiet) return -1;
 		_err("%s: error reading file: %s",__func__,filename);
 		_err("%s",strerror(errno));
 		return -1;
@@ -290,9 +322,23 @@ static int detect_bom(const char *filename,size_t *filesize) {
 	}
 }
 
+// headers next to a source are found when compiling it and the
+// sources that follow
+static void add_source_dir(TCCState *TCC, const char *path) {
+	size_t dirname;
+	cwk_path_get_dirname(path,&dirname);
+	if(dirname) {
+		char *tmp = malloc(dirname+1);
+		strncpy(tmp,path,dirname);
+		tmp[dirname] = 0x0;
+		tcc_add_include_path(TCC,tmp);
+		free(tmp);
+	}
+}
+
 static bool cjit_add_source(CJITState *cjit, const char *path) {
 	size_t length;
-	int res = detect_bom(path,&length);
+	int res = detect_bom(path,&length,false);
 	if(res<0) {
 		_err("Cannot open file: %s",path);
 		_err("Execution aborted.");
@@ -302,50 +348,532 @@ static bool cjit_add_source(CJITState *cjit, const char *path) {
 		_err("Encoding is not yet supported, execution aborted.");
 		return false;
 	}
-	FILE *file = fopen(path, "rb");
-	if (!file) {
-		_err("%s: fopen error: ", __func__, strerror(errno));
-		return false;
+	add_source_dir(cjit->TCC,path);
+	// compile by path: large files are mapped, not copied
+	tcc_compile_file(cjit->TCC,path,NULL,0);
+	return true;
+}
+
+/////////////
+// parallel compilation (-j): each source file is compiled by a job with
+// its own TCC state into an object in the tmpdir, then the objects are
+// loaded into the main state in the order of the command line
+
+typedef struct CJITJob {
+	const char *path; // source file
+	char *obj; // object file written by the job
+	char *deps; // files the object was made from (projects)
+	char *deplist; // as listed by the compiler
+	char *missing; // where headers were searched for and not found
+	char *tmp; // where the job writes the object before it is stored
+	char *log; // errors and warnings, printed when loaded
+	bool stale; // needs to be compiled
+	bool ok;
+} CJITJob;
+
+typedef struct CJITWorker {
+	struct CJITJobs *jobs;
+	int first; // runs the jobs first, first + nb_workers ...
+	bool started;
+#if defined(WINDOWS)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
+} CJITWorker;
+
+struct CJITJobs {
+	CJITState *cjit;
+	char *root; // project directory, objects are kept in the cache
+	CJITJob *job;
+	int nb_job;
+	CJITWorker *worker;
+	int nb_workers;
+	bool joined;
+	struct CJITHash *hashes;
+	int nb_hashes;
+};
+
+static void cjit_record_opt(CJITState *cjit, char kind,
+			    const char *a, const char *b) {
+	size_t la = strlen(a);
+	size_t lb = b? strlen(b) : 0;
+	char *opt = malloc(la+lb+3);
+	opt[0] = kind;
+	memcpy(opt+1,a,la+1);
+	if(b) memcpy(opt+la+2,b,lb+1);
+	cjit->opts = realloc(cjit->opts,(cjit->nb_opts+1)*sizeof(char*));
+	cjit->opts[cjit->nb_opts++] = opt;
+}
+
+void cjit_define_symbol(CJITState *cjit, const char *sym, const char *value) {
+	tcc_define_symbol(cjit->TCC, sym, value);
+	cjit_record_opt(cjit, value?'V':'D', sym, value);
+}
+
+void cjit_add_include_path(CJITState *cjit, const char *path) {
+	tcc_add_include_path(cjit->TCC, path);
+	cjit_record_opt(cjit, 'I', path, NULL);
+}
+
+void cjit_set_options(CJITState *cjit, const char *opts) {
+	tcc_set_options(cjit->TCC, opts);
+	cjit_record_opt(cjit, 'C', opts, NULL);
+}
+
+static void cjit_job_error(void *n, const char *m) {
+	CJITJob *job = (CJITJob*)n;
+	size_t len = job->log? strlen(job->log) : 0;
+	job->log = realloc(job->log, len+strlen(m)+2);
+	strcpy(job->log+len, m);
+	strcat(job->log+len, "\n");
+}
+
+/////////////
+// directory projects: each source in the tree is compiled by a job into
+// an object kept in <tmpdir>/build, next to the list of files it was
+// made from and their hashes, and the places where headers were not
+// found; the next runs only compile the sources for which any of those
+// files changed or appeared
+
+typedef struct CJITHash {
+	char *name; // as read by the compiler or from the deps
+	char *path; // absolute, as written in the deps
+	uint64_t hash;
+	bool ok;
+} CJITHash;
+
+static uint64_t fnv1a(uint64_t h, const void *data, size_t len) {
+	const uint8_t *p = (const uint8_t*)data;
+	while(len--) h = (h ^ *p++) * 0x100000001b3ULL;
+	return h;
+}
+
+static bool file_hash(const char *path, uint64_t *hash) {
+	uint8_t buf[65536];
+	uint64_t h = 0xcbf29ce484222325ULL, w;
+	ssize_t rd, i;
+	int fd = open(path, O_RDONLY | O_BINARY);
+	if(fd<0) return false;
+	while((rd = read(fd,buf,sizeof(buf))) > 0) {
+		// a word at a time, headers add up to megabytes
+		for(i=0; i+8<=rd; i+=8) {
+			memcpy(&w,buf+i,8);
+			h = (h ^ w) * 0x100000001b3ULL;
+			h ^= h >> 29;
+		}
+		h = fnv1a(h, buf+i, rd-i);
+	}
+	close(fd);
+	*hash = h;
+	return(rd==0);
+}
+
+static char *abs_path(const char *path) {
+#if defined(WINDOWS)
+	return _fullpath(NULL, path, 0);
+#else
+	return realpath(path, NULL);
+#endif
+}
+
+// the same headers are found in the deps of most sources, each is
+// hashed once per run
+static CJITHash *cjit_hash_of(struct CJITJobs *jobs, const char *name) {
+	CJITHash *h;
+	int i;
+	for(i=0; i<jobs->nb_hashes; i++)
+		if(!strcmp(jobs->hashes[i].name,name)) return &jobs->hashes[i];
+	jobs->hashes = realloc(jobs->hashes,
+			       (jobs->nb_hashes+1)*sizeof(CJITHash));
+	h = &jobs->hashes[jobs->nb_hashes++];
+	h->name = strdup(name);
+	h->path = abs_path(name);
+	h->ok = h->path && file_hash(h->path,&h->hash);
+	return h;
+}
+
+static void cjit_job_dep(void *ctx, const char *filename, int missing) {
+	CJITJob *job = (CJITJob*)ctx;
+	char **list = missing? &job->missing : &job->deplist;
+	size_t len = *list? strlen(*list) : 0;
+	*list = realloc(*list, len+strlen(filename)+2);
+	strcpy(*list+len, filename);
+	strcat(*list+len, "\n");
+}
+
+// move the object compiled by the job in the cache and write its
+// deps, under a temporary name first: other runs of cjit may be using
+// the same cache
+static bool cjit_cache_store(struct CJITJobs *jobs, CJITJob *job) {
+	size_t len = strlen(job->deps)+16;
+	char *tmp = malloc(len);
+	char *p = job->deplist, *nl;
+	bool ok = true;
+	FILE *fd;
+	snprintf(tmp,len,"%s.%d",job->deps,(int)getpid());
+	fd = fopen(tmp,"w");
+	if(!fd) ok = false;
+	while(ok && p && (nl = strchr(p,'\n'))) {
+		CJITHash *h;
+		*nl = 0x0;
+		h = cjit_hash_of(jobs, p);
+		// a dependency that cannot be read makes the deps unusable
+		fprintf(fd,"%016" PRIx64 " %s\n",h->ok? h->hash : 0,
+			h->path? h->path : p);
+		p = nl+1;
+	}
+	// no hash: the file must still be missing
+	p = job->missing;
+	while(ok && p && (nl = strchr(p,'\n'))) {
+		char cwd[MAX_PATH*4];
+		*nl = 0x0;
+		if(p[0]=='/') fprintf(fd,"---------------- %s\n",p);
+		else if(getcwd(cwd,sizeof(cwd)))
+			fprintf(fd,"---------------- %s/%s\n",cwd,p);
+		p = nl+1;
+	}
+	if(fd && fclose(fd)!=0) ok = false;
+	ok = ok && rename(job->tmp, job->obj) == 0
+		&& rename(tmp, job->deps) == 0;
+	if(!ok) {
+		remove(job->tmp);
+		remove(tmp);
+	}
+	free(tmp);
+	return ok;
+}
+
+// the object is there, none of the files in its deps changed and none
+// of the missing ones appeared
+static bool cjit_cache_fresh(struct CJITJobs *jobs, CJITJob *job) {
+	char line[MAX_PATH*4+32];
+	int nb = 0;
+	FILE *fd;
+	if(access(job->obj, F_OK) != 0) return false;
+	fd = fopen(job->deps,"r");
+	if(!fd) return false;
+	while(fgets(line,sizeof(line),fd)) {
+		size_t len = strlen(line);
+		CJITHash *h;
+		if(len<18 || line[16]!=' ' || line[len-1]!='\n') break;
+		line[len-1] = 0x0;
+		h = cjit_hash_of(jobs, line+17);
+		if(line[0]=='-') {
+			if(h->path) break;
+			continue;
+		}
+		if(!h->ok || h->hash!=strtoull(line,NULL,16)) break;
+		nb++;
+	}
+	// stopped before the end: some file changed
+	if(!feof(fd)) nb = 0;
+	fclose(fd);
+#if !defined(WINDOWS)
+	// still in use, see cjit_prune_build
+	if(nb>0) {
+		utime(job->obj, NULL);
+		utime(job->deps, NULL);
+	}
+#endif
+	return(nb>0);
+}
+
+// remove the objects and deps that no run used for BUILD_DAYS, and
+// what interrupted runs left
+static void cjit_prune_build(const char *build) {
+#if !defined(WINDOWS)
+	char path[MAX_PATH*4];
+	struct dirent *e;
+	struct stat st;
+	time_t old = time(NULL) - BUILD_DAYS*24*3600;
+	DIR *dir = opendir(build);
+	if(!dir) return;
+	while((e = readdir(dir))) {
+		if(e->d_name[0]=='.') continue;
+		snprintf(path,sizeof(path),"%s/%s",build,e->d_name);
+		if(stat(path,&st)==0 && S_ISREG(st.st_mode)
+		   && st.st_mtime < old)
+			remove(path);
+	}
+	closedir(dir);
+#endif
+}
+
+// same source and same options give the same object
+static void cjit_cache_paths(CJITState *cjit, CJITJob *job,
+			     const char *root, const char *build) {
+	const char *cflags = getenv("CFLAGS");
+	uint64_t h = 0xcbf29ce484222325ULL;
+	char *path = abs_path(job->path);
+	size_t len = strlen(build)+32;
+	int i;
+	// objects of a rebuilt cjit are not reused
+	h = fnv1a(h, VERSION " " __DATE__ " " __TIME__,
+		  strlen(VERSION " " __DATE__ " " __TIME__)+1);
+	h = fnv1a(h, &cjit->tcc_output, sizeof(cjit->tcc_output));
+	if(cflags) h = fnv1a(h, cflags, strlen(cflags)+1);
+	for(i=0; i<cjit->nb_opts; i++) {
+		const char *opt = cjit->opts[i];
+		h = fnv1a(h, opt, strlen(opt)+1);
+		if(opt[0]=='V') h = fnv1a(h, opt+strlen(opt)+1,
+					  strlen(opt+strlen(opt)+1)+1);
+	}
+	h = fnv1a(h, root, strlen(root)+1);
+	if(path) h = fnv1a(h, path, strlen(path)+1);
+	else h = fnv1a(h, job->path, strlen(job->path)+1);
+	job->obj = malloc(len);
+	snprintf(job->obj,len,"%s/%016" PRIx64 ".o",build,h);
+	job->deps = malloc(len);
+	snprintf(job->deps,len,"%s/%016" PRIx64 ".d",build,h);
+	job->tmp = malloc(len+16);
+	snprintf(job->tmp,len+16,"%s.%d",job->obj,(int)getpid());
+	if(path) free(path);
+}
+
+static void cjit_run_job(struct CJITJobs *jobs, int n) {
+	CJITState *cjit = jobs->cjit;
+	CJITJob *job = &jobs->job[n];
+	TCCState *TCC;
+	int i;
+	TCC = tcc_new();
+	if(!TCC) return;
+	tcc_set_error_func(TCC, job, cjit_job_error);
+	for(i=0; i<cjit->nb_opts; i++) {
+		const char *opt = cjit->opts[i];
+		if(opt[0]=='D') tcc_define_symbol(TCC, opt+1, NULL);
+		else if(opt[0]=='V') tcc_define_symbol(TCC, opt+1, opt+strlen(opt)+1);
+		else if(opt[0]=='I') tcc_add_include_path(TCC, opt+1);
+		else if(opt[0]=='C') tcc_set_options(TCC, opt+1);
+	}
+	// code for the memory keeps what is specific to it (__TCC_RUN__)
+	tcc_set_output_type(TCC, cjit->tcc_output==TCC_OUTPUT_MEMORY?
+			    TCC_OUTPUT_MEMORY : TCC_OUTPUT_OBJ);
+	cjit_setup_state(cjit, TCC);
+	if(jobs->root) {
+		// the same for any subset of the project being compiled
+		tcc_set_options(TCC, "-MD");
+		tcc_add_include_path(TCC, jobs->root);
+		add_source_dir(TCC, job->path);
+		job->ok = tcc_compile_file(TCC, job->path, NULL, 0) == 0
+			&& tcc_output_object(TCC, job->tmp) == 0;
+		if(job->ok) tcc_list_deps(TCC, job, cjit_job_dep);
+	} else {
+		// as in the main state: dirs of this and all previous sources
+		for(i=0; i<=n; i++) add_source_dir(TCC, jobs->job[i].path);
+		job->ok = tcc_compile_file(TCC, job->path, NULL, 0) == 0
+			&& tcc_output_object(TCC, job->obj) == 0;
+	}
+	tcc_delete(TCC);
+}
+
+#if defined(WINDOWS)
+static DWORD WINAPI cjit_worker(void *arg) {
+#else
+static void *cjit_worker(void *arg) {
+#endif
+	CJITWorker *w = (CJITWorker*)arg;
+	int n;
+	for(n=w->first; n<w->jobs->nb_job; n+=w->jobs->nb_workers)
+		if(w->jobs->job[n].stale) cjit_run_job(w->jobs, n);
+	return 0;
+}
+
+static void cjit_join_jobs(struct CJITJobs *jobs) {
+	int i;
+	if(jobs->joined) return;
+	for(i=0; i<jobs->nb_workers; i++) {
+		CJITWorker *w = &jobs->worker[i];
+		if(!w->started) continue;
+#if defined(WINDOWS)
+		WaitForSingleObject(w->thread, INFINITE);
+		CloseHandle(w->thread);
+#else
+		pthread_join(w->thread, NULL);
+#endif
+	}
+	jobs->joined = true;
+}
+
+static void cjit_free_jobs(struct CJITJobs *jobs) {
+	int i;
+	cjit_join_jobs(jobs);
+	for(i=0; i<jobs->nb_job; i++) {
+		if(!jobs->root) remove(jobs->job[i].obj);
+		free(jobs->job[i].obj);
+		if(jobs->job[i].deps) free(jobs->job[i].deps);
+		if(jobs->job[i].deplist) free(jobs->job[i].deplist);
+		if(jobs->job[i].missing) free(jobs->job[i].missing);
+		if(jobs->job[i].tmp) {
+			remove(jobs->job[i].tmp); // left by a failed job
+			free(jobs->job[i].tmp);
+		}
+		if(jobs->job[i].log) free(jobs->job[i].log);
+	}
+	for(i=0; i<jobs->nb_hashes; i++) {
+		free(jobs->hashes[i].name);
+		if(jobs->hashes[i].path) free(jobs->hashes[i].path);
+	}
+	if(jobs->hashes) free(jobs->hashes);
+	if(jobs->root) free(jobs->root);
+	free(jobs->job);
+	if(jobs->worker) free(jobs->worker);
+	free(jobs);
+}
+
+static void cjit_spawn_workers(struct CJITJobs *jobs, int nb_workers) {
+	int i;
+	jobs->nb_workers = nb_workers;
+	jobs->worker = calloc(nb_workers,sizeof(CJITWorker));
+	for(i=0; i<nb_workers; i++) {
+		CJITWorker *w = &jobs->worker[i];
+		w->jobs = jobs;
+		w->first = i;
+		if(nb_workers==1) { // nothing to run aside
+			cjit_worker(w);
+			break;
+		}
+#if defined(WINDOWS)
+		w->thread = CreateThread(NULL, 0, cjit_worker, w, 0, NULL);
+		w->started = (w->thread != NULL);
+#else
+		w->started = (pthread_create(&w->thread, NULL, cjit_worker, w) == 0);
+#endif
+		if(!w->started) cjit_worker(w);
+	}
+}
+
+bool cjit_start_jobs(CJITState *cjit, char **paths, int count) {
+	struct CJITJobs *jobs;
+	size_t length;
+	int i;
+	if(cjit->jobs<2 || cjit->pending) return false;
+	if(!cjit->done_setup) cjit_setup(cjit);
+	jobs = calloc(1,sizeof(struct CJITJobs));
+	jobs->cjit = cjit;
+	jobs->job = calloc(count,sizeof(CJITJob));
+	for(i=0; i<count; i++) {
+		// the others are left to cjit_add_file
+		if(has_source_extension(paths[i])<=0) continue;
+		if(detect_bom(paths[i],&length,true)!=0) continue;
+		CJITJob *job = &jobs->job[jobs->nb_job];
+		job->path = paths[i];
+		job->obj = malloc(strlen(cjit->tmpdir)+32);
+		snprintf(job->obj,strlen(cjit->tmpdir)+32,"%s/job-%d-%d.o",
+			 cjit->tmpdir,(int)getpid(),jobs->nb_job);
+		job->stale = true;
+		jobs->nb_job++;
 	}
-	char *spath = (char*)malloc((strlen(path)+16)*sizeof(char));
-	if (!spath) {
-		_err("%s: malloc error: %s",__func__, strerror(errno));
-		fclose(file);
+	if(jobs->nb_job<2) {
+		cjit_free_jobs(jobs);
 		return false;
 	}
-	sprintf(spath,"#line 1 \"%s\"\n",path);
-	size_t spath_len = strlen(spath);
-	char *contents =
-		(char*)malloc
-		((spath_len + length + 1)
-		 * sizeof(char));
-	if (!contents) {
-		_err("%s: malloc error: %s",__func__, strerror(errno));
-		free(spath);
-		fclose(file);
+	cjit->pending = jobs;
+	cjit_spawn_workers(jobs,
+			   cjit->jobs<jobs->nb_job? cjit->jobs : jobs->nb_job);
+	return true;
+}
+
+// load the object compiled by a job
+static bool cjit_load_object(CJITState *cjit, struct CJITJobs *jobs,
+			     CJITJob *job) {
+	const char *path = job->path;
+	int res;
+	cjit_join_jobs(jobs);
+	if(job->ok && job->stale && jobs->root)
+		job->ok = cjit_cache_store(jobs, job);
+	if(!job->ok) // compile again to report errors as usual
+		return(cjit_add_source(cjit, path));
+	if(!jobs->root) add_source_dir(cjit->TCC, path);
+	if(job->log) {
+		char *p = job->log, *nl;
+		while((nl = strchr(p,'\n'))) {
+			_err("%.*s",(int)(nl-p),p);
+			p = nl+1;
+		}
+	}
+	res = tcc_add_file(cjit->TCC, job->obj);
+	if(res<0) _err("%s: tcc_add_file error: %s",__func__,job->obj);
+	if(!jobs->root) remove(job->obj);
+	return(res>=0);
+}
+
+// load the object compiled for 'path', returns -1 if there is none
+static int cjit_load_job(CJITState *cjit, const char *path) {
+	struct CJITJobs *jobs = cjit->pending;
+	int i;
+	for(i=0; i<jobs->nb_job; i++)
+		if(jobs->job[i].path == path)
+			return(cjit_load_object(cjit, jobs, &jobs->job[i])? 1 : 0);
+	return -1;
+}
+
+// compile all sources found in the directory 'path' as a project
+static bool cjit_add_dir(CJITState *cjit, const char *path) {
+	struct CJITJobs *jobs;
+	char **files, *build;
+	size_t length;
+	int i, count, nb_stale = 0;
+	bool ok = true;
+	// the objects kept in build have no counters of their lines
+	if(cjit->hotlines || cjit->annotate) {
+		_err("--hotlines and --annotate cannot run a folder: %s",path);
+		_err("pass its source files instead");
 		return false;
 	}
-	strcpy(contents,spath);
-	free(spath);
-	fread(contents+spath_len, 1, length, file);
-	contents[length+spath_len] = 0x0;
-	fclose(file);
-	size_t dirname;
-	cwk_path_get_dirname(path,&dirname);
-	if(dirname) {
-		char *tmp = malloc(dirname+1);
-		strncpy(tmp,path,dirname);
-		tmp[dirname] = 0x0;
-		tcc_add_include_path(cjit->TCC,tmp);
-		free(tmp);
+	files = dir_list(path, &count);
+	if(!files) return false;
+	build = malloc(strlen(cjit->tmpdir)+8);
+	strcpy(build,cjit->tmpdir);
+	strcat(build,"/build");
+#if defined(WINDOWS)
+	CreateDirectory(build, NULL);
+#else
+	mkdir(build,0755);
+#endif
+	cjit_prune_build(build);
+	jobs = calloc(1,sizeof(struct CJITJobs));
+	jobs->cjit = cjit;
+	jobs->root = abs_path(path);
+	if(!jobs->root) jobs->root = strdup(path);
+	jobs->job = calloc(count? count : 1,sizeof(CJITJob));
+	for(i=0; i<count; i++) {
+		if(has_source_extension(files[i])<=0) continue;
+		CJITJob *job = &jobs->job[jobs->nb_job++];
+		job->path = files[i];
+		// sources with a BOM fail as usual when loaded
+		if(detect_bom(files[i],&length,true)!=0) continue;
+		cjit_cache_paths(cjit, job, jobs->root, build);
+		job->ok = cjit_cache_fresh(jobs, job);
+		job->stale = !job->ok;
+		if(job->stale) nb_stale++;
 	}
-	tcc_compile_string(cjit->TCC,contents);
-	free(contents);
-	return true;
+	if(!cjit->quiet)
+		_err("  %d sources, %d to compile",jobs->nb_job,nb_stale);
+	if(nb_stale)
+		cjit_spawn_workers(jobs, cjit->jobs<2? 1 :
+				   cjit->jobs<nb_stale? cjit->jobs : nb_stale);
+	tcc_add_include_path(cjit->TCC, jobs->root);
+	for(i=0; i<jobs->nb_job; i++)
+		if(!cjit_load_object(cjit, jobs, &jobs->job[i])) ok = false;
+	cjit_free_jobs(jobs);
+	for(i=0; i<count; i++) free(files[i]);
+	free(files);
+	free(build);
+	return ok;
 }
 
 bool cjit_add_file(CJITState *cjit, const char *path) {
 	// _err("%s",__func__);
+	struct stat st;
+	if(cjit->pending) {
+		int res = cjit_load_job(cjit, path);
+		if(res>=0) return(res>0);
+	}
+	if(stat(path,&st)==0 && S_ISDIR(st.st_mode)) {
+		if(!cjit->done_setup) cjit_setup(cjit);
+		return cjit_add_dir(cjit, path);
+	}
 	int is_source = has_source_extension(path);
 	if(is_source == 0) { // no extension, we still add
 		cjit_setup(cjit);
@@ -385,7 +913,7 @@ bool cjit_compile_file(CJITState *cjit, const char *path) {
 		return false;
 	}
 	cjit_setup(cjit);
-	tcc_add_file(cjit->TCC, path);
+	tcc_compile_file(cjit->TCC, path, NULL, 0);
 	if(cjit->output_filename) {
 		if(!cjit->quiet)
 			_err("Compiling: %s -> %s",path,
@@ -411,6 +939,202 @@ bool cjit_compile_file(CJITState *cjit, const char *path) {
 	return true;
 }
 
+/////////////
+// --hotlines and --annotate: execution counts of the source lines, from
+// the -ftest-coverage counters of the program, printed when it exits
+
+typedef struct CJITLine {
+	const char *file;
+	const char *func;
+	int line;
+	unsigned long long count; // of the line, or of the function lines
+	unsigned long long calls; // of the function
+} CJITLine;
+
+typedef struct CJITHot {
+	CJITLine *line;
+	int nb, max;
+	bool failed; // out of memory, the entries are incomplete
+} CJITHot;
+
+static bool hot_add(CJITHot *h, const char *file, const char *func,
+		    int line, unsigned long long count) {
+	CJITLine *l;
+	if(h->failed) return false;
+	if(h->nb==h->max) {
+		int max = h->max? h->max*2 : 1024;
+		l = realloc(h->line,max*sizeof(CJITLine));
+		if(!l) {
+			_err("Memory allocation error");
+			h->failed = true;
+			return false;
+		}
+		h->line = l;
+		h->max = max;
+	}
+	l = &h->line[h->nb++];
+	l->file = file;
+	l->func = func;
+	l->line = line;
+	l->count = count;
+	l->calls = 0;
+	return true;
+}
+
+// one entry for each line of a block
+static void hot_block(void *ctx, const char *file, const char *func,
+		      int line, int last, unsigned long long count) {
+	for(; line<=last; line++)
+		if(!hot_add((CJITHot*)ctx,file,func,line,count)) return;
+}
+
+// one entry for each function: its first block counts the calls
+static void hot_entry(void *ctx, const char *file, const char *func,
+		      int line, int last, unsigned long long count) {
+	CJITHot *h = (CJITHot*)ctx;
+	CJITLine *l = h->nb? &h->line[h->nb-1] : NULL;
+	if(l && l->func==func && l->file==file) return;
+	if(hot_add(h,file,func,line,0))
+		h->line[h->nb-1].calls = count;
+}
+
+static int hot_by_place(const void *a, const void *b) {
+	const CJITLine *p = a, *q = b;
+	int c = strcmp(p->file,q->file);
+	if(c) return c;
+	if(p->line!=q->line) return p->line<q->line? -1 : 1;
+	return p->count<q->count? 1 : p->count>q->count? -1 : 0;
+}
+
+static int hot_by_func(const void *a, const void *b) {
+	const CJITLine *p = a, *q = b;
+	int c = strcmp(p->file,q->file);
+	return c? c : strcmp(p->func,q->func);
+}
+
+static int hot_by_count(const void *a, const void *b) {
+	const CJITLine *p = a, *q = b;
+	return p->count<q->count? 1 : p->count>q->count? -1 : 0;
+}
+
+// the path relative to the current directory, when under it
+static const char *hot_path(const char *file) {
+	static char cwd[MAX_PATH*4];
+	size_t len;
+	if(!cwd[0] && !getcwd(cwd,sizeof(cwd))) return file;
+	len = strlen(cwd);
+	if(!strncmp(file,cwd,len) && file[len]=='/') return file+len+1;
+	return file;
+}
+
+// line 'line' of 'file', without indentation and newline
+static const char *hot_source(const char *file, int line, char *buf, int size) {
+	FILE *fp = fopen(file,"r");
+	int i;
+	buf[0] = 0x0;
+	if(!fp) return buf;
+	for(i=1; i<=line; i++)
+		if(!fgets(buf,size,fp)) { buf[0] = 0x0; break; }
+	fclose(fp);
+	buf[strcspn(buf,"\r\n")] = 0x0;
+	return buf + strspn(buf," \t");
+}
+
+// the sources with the count of each line, as in a .tcov file
+static void hot_annotate(CJITHot *h) {
+	char str[1024];
+	const char *file;
+	FILE *fp;
+	int i = 0, n;
+	while(i<h->nb) {
+		file = h->line[i].file;
+		fp = fopen(file,"r");
+		if(fp) _err("        -:    0:Source:%s",hot_path(file));
+		for(n=1; fp && fgets(str,sizeof(str),fp); n++) {
+			str[strcspn(str,"\r\n")] = 0x0;
+			while(i<h->nb && h->line[i].file==file
+			      && h->line[i].line<n) i++;
+			if(i==h->nb || h->line[i].file!=file
+			   || h->line[i].line!=n)
+				_err("        -:%5u:%s",n,str);
+			else if(h->line[i].count)
+				_err("%9llu:%5u:%s",h->line[i].count,n,str);
+			else
+				_err("    #####:%5u:%s",n,str);
+		}
+		if(fp) fclose(fp);
+		while(i<h->nb && h->line[i].file==file) i++;
+	}
+}
+
+static void cjit_hotlines(CJITState *cjit) {
+	CJITHot h = {0}, f = {0};
+	unsigned long long total = 0;
+	char str[256];
+	int i, j;
+
+	fflush(stdout);
+	tcc_list_coverage(cjit->TCC,&h,hot_block);
+	if(h.failed) goto done;
+	if(!h.nb) {
+		_err("No execution counts found");
+		return;
+	}
+	// the count of a line is the one of its block run most
+	qsort(h.line,h.nb,sizeof(CJITLine),hot_by_place);
+	for(i=j=0; i<h.nb; i++)
+		if(!j || h.line[i].line!=h.line[j-1].line
+		   || strcmp(h.line[i].file,h.line[j-1].file))
+			h.line[j++] = h.line[i];
+	h.nb = j;
+	for(i=0; i<h.nb; i++) total += h.line[i].count;
+	if(cjit->annotate) hot_annotate(&h);
+	if(!cjit->hotlines) goto done;
+
+	// the functions, with the sum of the counts of their lines
+	tcc_list_coverage(cjit->TCC,&f,hot_entry);
+	if(f.failed) goto done;
+	qsort(f.line,f.nb,sizeof(CJITLine),hot_by_func);
+	for(i=j=0; i<f.nb; i++) // same function in several blocks runs
+		if(j && !hot_by_func(&f.line[i],&f.line[j-1]))
+			f.line[j-1].calls += f.line[i].calls;
+		else
+			f.line[j++] = f.line[i];
+	f.nb = j;
+	qsort(h.line,h.nb,sizeof(CJITLine),hot_by_func);
+	for(i=j=0; i<h.nb; i++) {
+		while(j<f.nb && hot_by_func(&f.line[j],&h.line[i])<0) j++;
+		if(j<f.nb && !hot_by_func(&f.line[j],&h.line[i]))
+			f.line[j].count += h.line[i].count;
+	}
+
+	qsort(h.line,h.nb,sizeof(CJITLine),hot_by_count);
+	_err("Hot lines (%llu line executions):",total);
+	_err("%14s %6s  %s","count","%","line");
+	for(i=0; i<h.nb && i<cjit->hotlines && h.line[i].count; i++)
+		_err("%14llu %5.1f%%  %s:%d %s: %s",h.line[i].count,
+		     100.0*h.line[i].count/total,hot_path(h.line[i].file),
+		     h.line[i].line,h.line[i].func,
+		     hot_source(h.line[i].file,h.line[i].line,str,sizeof(str)));
+	qsort(f.line,f.nb,sizeof(CJITLine),hot_by_count);
+	_err("Hot functions:");
+	_err("%14s %6s %14s  %s","count","%","calls","function");
+	for(i=0; i<f.nb && i<cjit->hotlines && f.line[i].count; i++)
+		_err("%14llu %5.1f%% %14llu  %s (%s:%d)",f.line[i].count,
+		     100.0*f.line[i].count/total,f.line[i].calls,
+		     f.line[i].func,hot_path(f.line[i].file),f.line[i].line);
+done:
+	free(h.line);
+	free(f.line);
+}
+
+#if !defined(WINDOWS)
+static CJITState *hot_cjit; // for atexit() in the forked program
+static void cjit_hotlines_atexit(void) {
+	cjit_hotlines(hot_cjit);
+}
+#endif
+
 int cjit_exec(CJITState *cjit, int argc, char **argv) {
 	if(cjit->done_exec) {
 		_err("%s: CJIT already executed once",__func__);
@@ -418,6 +1142,7 @@ int cjit_exec(CJITState *cjit, int argc, char **argv) {
 	}
 	int res = 1;
 	int (*_ep)(int, char**);
+	void (*trace_write)(void);
 	// relocate the code (link symbols)
 	if (tcc_relocate(cjit->TCC) < 0) {
 		_err("%s: TCC linker error",__func__);
@@ -429,6 +1154,9 @@ int cjit_exec(CJITState *cjit, int argc, char **argv) {
 		_err("Symbol not found in source: %s",cjit->entry?cjit->entry:"main");
 		return -1;
 	}
+	// -finstrument-functions: lib/instrument.c writes the trace from a
+	// destructor, and destructors are not run here
+	trace_write = tcc_get_symbol(cjit->TCC, "__tcc_trace_write");
 #if defined(WINDOWS)
 	if(cjit->write_pid) {
 		pid_t pid = getpid();
@@ -443,12 +1171,18 @@ int cjit_exec(CJITState *cjit, int argc, char **argv) {
 	}
 	cjit->done_exec = true;
 	res = _ep(argc, argv);
+	if(cjit->hotlines || cjit->annotate) cjit_hotlines(cjit);
 	return(res);
 #else // we assume anything else but WINDOWS has fork()
 	pid_t pid;
 	cjit->done_exec = true;
 	pid = fork();
 	if (pid == 0) {
+		// also when the program calls exit()
+		hot_cjit = cjit;
+		if(cjit->hotlines || cjit->annotate)
+			atexit(cjit_hotlines_atexit);
+		if(trace_write) atexit(trace_write);
 		res = _ep(argc, argv);
 		exit(res);
 	} else {
@@ -490,6 +1224,10 @@ int cjit_exec(CJITState *cjit, int argc, char **argv) {
 }
 
 void cjit_free(CJITState *cjit) {
+	int i;
+	if(cjit->pending) cjit_free_jobs(cjit->pending);
+	for(i=0; i<cjit->nb_opts; i++) free(cjit->opts[i]);
+	if(cjit->opts) free(cjit->opts);
 	if(cjit->tmpdir) free(cjit->tmpdir);
 	if(cjit->write_pid) free(cjit->write_pid);
 	if(cjit->entry) free(cjit->entry);
@@ -42,6 +42,13 @@ struct CJITState {
 	char *output_filename; // output in case of compilation mode
 	bool done_setup;
 	bool done_exec;
+	int jobs; // number of parallel compilation jobs (-j)
+	struct CJITJobs *pending; // sources being compiled in parallel
+	char **opts; // compile options, replayed on the jobs' TCC states
+	int nb_opts;
+	int hotlines; // print the most executed lines after the run
+	bool annotate; // print the sources with the execution counts
+	bool fast_malloc; // malloc() & co. from the bundled allocator
 };
 typedef struct CJITState CJITState;
 
@@ -50,6 +57,12 @@ extern bool cjit_setup(CJITState *cjit);
 extern bool cjit_status(CJITState *cjit);
 extern bool cjit_compile_file(CJITState *cjit, const char *_path);
 extern bool cjit_add_file(CJITState *cjit, const char *path);
+extern bool cjit_start_jobs(CJITState *cjit, char **paths, int count);
+
+// compile options also given to the TCC states of parallel jobs
+extern void cjit_define_symbol(CJITState *cjit, const char *sym, const char *value);
+extern void cjit_add_include_path(CJITState *cjit, const char *path);
+extern void cjit_set_options(CJITState *cjit, const char *opts);
 
 extern int cjit_exec(CJITState *cjit, int argc, char **argv);
 
@@ -62,8 +75,7 @@ extern bool extract_assets(CJITState *CJIT);
 /////////////
 // from file.c
 extern char* file_load(const char *filename, unsigned int *len);
-extern char *load_stdin();
-extern char* dir_load(const char *path);
+extern char **dir_list(const char *path, int *count);
 extern bool write_to_file(const char *path, const char *filename,
 			  const char *buf, unsigned int len);
 
@@ -71,6 +83,10 @@ extern bool write_to_file(const char *path, const char *filename,
 extern void _out(const char *fmt, ...);
 extern void _err(const char *fmt, ...);
 
+/////////////
+// from alloc.c
+extern void cjit_alloc_symbols(TCCState *TCC, bool interpose);
+
 /////////////
 // from repl.c
 extern int cjit_cli_tty(CJITState *cjit);
@@ -0,0 +1,117 @@
+// Embedded: assets/alloc
+// source generated by cjit/build/embed-path.sh
+// Sat Oct 17 04:50:04 UTC 2026
+// alloc
+const char alloc[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xed, 0x56,
+  0x6d, 0x6f, 0xe2, 0x38, 0x10, 0xee, 0x67, 0x7e, 0xc5, 0x48, 0xfd, 0x52,
+  0x2a, 0x0a, 0x7d, 0x01, 0x2a, 0xd1, 0xd5, 0x4a, 0x2c, 0xb7, 0xdd, 0x72,
+  0xc7, 0xb6, 0x15, 0xa5, 0x5a, 0xf5, 0x13, 0x32, 0xc9, 0x84, 0xf8, 0x9a,
+  0xd8, 0xc8, 0x76, 0xca, 0x71, 0xbf, 0xfe, 0x66, 0x9c, 0x04, 0x52, 0xba,
+  0x2f, 0x5f, 0x6e, 0xef, 0x74, 0xba, 0x8c, 0x56, 0x1b, 0x27, 0x1e, 0x3f,
+  0xf3, 0xcc, 0x33, 0x33, 0xa6, 0x22, 0x49, 0x74, 0xd0, 0x39, 0xf8, 0xa9,
+  0x76, 0x4a, 0x76, 0xd9, 0xeb, 0xf9, 0x27, 0xd9, 0xfe, 0xd3, 0xaf, 0xcf,
+  0x7a, 0xe7, 0xfd, 0x6e, 0xaf, 0xdf, 0x3f, 0xeb, 0x75, 0x0f, 0x4e, 0xcf,
+  0xce, 0xcf, 0xfa, 0xdd, 0x03, 0xe8, 0xfd, 0x5c, 0x5a, 0xb9, 0x65, 0xd6,
+  0x09, 0x43, 0x54, 0x8c, 0xd6, 0xee, 0x7b, 0x7e, 0x3f, 0xda, 0xdf, 0x4f,
+  0xee, 0x3f, 0x62, 0xc2, 0xd7, 0x3f, 0xf8, 0x5d, 0xba, 0xb9, 0x5f, 0xb6,
+  0xe3, 0xbf, 0x3f, 0x06, 0xeb, 0xd1, 0xef, 0x76, 0xbf, 0x55, 0xff, 0xee,
+  0x65, 0xef, 0x72, 0x5b, 0xff, 0x8b, 0x33, 0xae, 0x7f, 0xb7, 0xdb, 0xbb,
+  0x38, 0x80, 0x7f, 0x44, 0xc4, 0xff, 0x79, 0xfd, 0x3b, 0xc7, 0x30, 0xfa,
+  0x75, 0x3c, 0x83, 0xd8, 0xb9, 0x95, 0x1d, 0x74, 0x3a, 0xe1, 0x46, 0x61,
+  0x5b, 0x9b, 0xa5, 0x6f, 0x89, 0x06, 0x1c, 0xd3, 0x3f, 0x18, 0xe9, 0xd5,
+  0xc6, 0xc8, 0x65, 0xec, 0xe0, 0x68, 0xd4, 0x84, 0xf3, 0xd3, 0xf3, 0x1e,
+  0xfc, 0x52, 0xb8, 0x41, 0xa4, 0x33, 0x15, 0x0a, 0x27, 0xb5, 0x2a, 0x9c,
+  0x67, 0xb1, 0xb4, 0xb0, 0x32, 0x7a, 0x69, 0x44, 0x0a, 0xb4, 0x8c, 0x0c,
+  0x22, 0x58, 0x1d, 0xb9, 0xb5, 0x30, 0x38, 0x80, 0x8d, 0xce, 0x20, 0x10,
+  0x0a, 0x0c, 0x86, 0xd2, 0x3a, 0x23, 0x17, 0x99, 0x43, 0x90, 0x0e, 0x84,
+  0x0a, 0x3b, 0xda, 0x40, 0xaa, 0x43, 0x19, 0x6d, 0x18, 0x87, 0xbe, 0x11,
+  0x32, 0x1a, 0x70, 0x31, 0x82, 0x43, 0x93, 0x5a, 0xd0, 0x91, 0x7f, 0xf9,
+  0x74, 0xfb, 0x08, 0x9f, 0x50, 0xa1, 0x11, 0x09, 0xdc, 0x67, 0x8b, 0x44,
+  0x06, 0x30, 0x91, 0x01, 0x2a, 0x8b, 0x20, 0x28, 0x34, 0x7f, 0xb1, 0x31,
+  0x86, 0xb0, 0xf0, 0x38, 0x7c, 0xe2, 0x9a, 0x39, 0x3c, 0x14, 0x1c, 0xe0,
+  0x7a, 0x4b, 0xb9, 0x05, 0x28, 0x69, 0xdf, 0xc0, 0x0b, 0x1a, 0x4b, 0xef,
+  0x70, 0x51, 0xc6, 0x28, 0x00, 0x5b, 0xa0, 0x0d, 0x83, 0x1c, 0x09, 0xc7,
+  0xcc, 0x0d, 0xe8, 0x15, 0x9f, 0x6b, 0x12, 0xdd, 0x0d, 0x24, 0xc2, 0xed,
+  0x8e, 0xb6, 0xbf, 0x91, 0xfe, 0x2e, 0xcb, 0x10, 0xa4, 0xf2, 0xd8, 0xb1,
+  0x5e, 0x51, 0x46, 0x31, 0x41, 0x52, 0x8e, 0x6b, 0x99, 0x24, 0xb0, 0x40,
+  0xc8, 0x2c, 0x46, 0x59, 0xd2, 0x62, 0x08, 0x72, 0x86, 0x2f, 0xe3, 0xd9,
+  0xcd, 0xdd, 0xe3, 0x0c, 0x86, 0xb7, 0x4f, 0xf0, 0x65, 0x38, 0x9d, 0x0e,
+  0x6f, 0x67, 0x4f, 0x57, 0xe4, 0xec, 0x62, 0x4d, 0xbb, 0xf8, 0x82, 0x39,
+  0x94, 0x4c, 0x57, 0x89, 0x24, 0x64, 0xca, 0xcb, 0x08, 0xe5, 0x36, 0x44,
+  0x9f, 0x11, 0x3e, 0x7f, 0x9c, 0x8e, 0x6e, 0xe8, 0xc8, 0xf0, 0xc3, 0x78,
+  0x32, 0x9e, 0x3d, 0x51, 0x12, 0x70, 0x3d, 0x9e, 0xdd, 0x7e, 0x7c, 0x78,
+  0x80, 0xeb, 0xbb, 0x29, 0x0c, 0xe1, 0x7e, 0x38, 0x9d, 0x8d, 0x47, 0x8f,
+  0x93, 0xe1, 0x14, 0xee, 0x1f, 0xa7, 0xf7, 0x77, 0x0f, 0x1f, 0xdb, 0x00,
+  0x0f, 0xc8, 0xb4, 0x90, 0x01, 0xbe, 0x23, 0x71, 0xe4, 0xab, 0x44, 0x32,
+  0x86, 0xe8, 0x84, 0x4c, 0x6c, 0x99, 0xf8, 0x13, 0x15, 0xd6, 0x12, 0xbb,
+  0x24, 0x84, 0x58, 0xbc, 0x20, 0x15, 0x38, 0x40, 0xf9, 0x42, 0xdc, 0x04,
+  0x04, 0xd4, 0x3f, 0x3f, 0x2e, 0x1e, 0x83, 0x88, 0x44, 0xab, 0xa5, 0x4f,
+  0x93, 0x9c, 0x77, 0x42, 0x12, 0xb9, 0x71, 0x04, 0x4a, 0xbb, 0x16, 0x58,
+  0x22, 0xf9, 0xae, 0x6c, 0xd6, 0xf5, 0x7a, 0xdd, 0x5e, 0xaa, 0xcc, 0xf7,
+  0x6b, 0x92, 0xa3, 0xd8, 0xce, 0xfb, 0x82, 0x51, 0xa7, 0xd1, 0xe8, 0x74,
+  0xe0, 0x33, 0x12, 0xd9, 0x0d, 0xf8, 0xbb, 0xcd, 0xd7, 0x1c, 0x4c, 0xa6,
+  0x9c, 0x4c, 0x91, 0x64, 0x56, 0x61, 0xc2, 0xda, 0x71, 0x34, 0x9e, 0x81,
+  0x96, 0xcf, 0x8d, 0x49, 0x16, 0x61, 0x2d, 0x15, 0x88, 0x31, 0xe8, 0x84,
+  0xe5, 0xe2, 0xa5, 0x39, 0xd6, 0x11, 0x11, 0xc9, 0x4f, 0x9d, 0x68, 0x96,
+  0xf6, 0x24, 0x68, 0xb6, 0xc9, 0x8d, 0x3d, 0x79, 0x68, 0xe0, 0xe4, 0x24,
+  0x12, 0xd6, 0x9d, 0xa4, 0x3e, 0x26, 0xa4, 0xe2, 0x19, 0x2d, 0xe4, 0x2f,
+  0x47, 0xcd, 0x96, 0x9f, 0x87, 0x23, 0x6e, 0xa0, 0xd0, 0x87, 0x32, 0x68,
+  0x5d, 0xa9, 0x4d, 0x24, 0x52, 0x99, 0x6c, 0x18, 0x87, 0xba, 0xc1, 0x63,
+  0xcd, 0x29, 0xe4, 0xbc, 0x38, 0xea, 0x8f, 0x44, 0x46, 0xa2, 0x0a, 0xed,
+  0x80, 0x54, 0x75, 0xb1, 0x41, 0x11, 0x9e, 0x04, 0x22, 0x88, 0x25, 0x89,
+  0x56, 0x64, 0xa8, 0x4d, 0x0b, 0xd6, 0xb1, 0x26, 0x39, 0x09, 0xc6, 0x72,
+  0x58, 0x58, 0xd0, 0xc6, 0xb3, 0x05, 0x6e, 0x7d, 0x47, 0x64, 0x94, 0x07,
+  0x5a, 0x4a, 0xee, 0xa1, 0x85, 0x08, 0x9e, 0xb7, 0x5d, 0xe5, 0xdd, 0xda,
+  0xa5, 0x62, 0xeb, 0x58, 0x06, 0xb1, 0xcf, 0x49, 0xa7, 0xc8, 0x63, 0xac,
+  0x53, 0x4f, 0x72, 0x04, 0x89, 0x5c, 0x18, 0xc1, 0x3a, 0x60, 0x7b, 0xd9,
+  0x06, 0x6a, 0xef, 0x30, 0x5b, 0x11, 0x3d, 0xa9, 0xac, 0x0c, 0x69, 0x04,
+  0xcb, 0xfd, 0xa6, 0x9f, 0x73, 0xeb, 0xa8, 0xc1, 0x19, 0x86, 0x7a, 0x3c,
+  0x8f, 0xe9, 0x74, 0x55, 0x03, 0xca, 0x21, 0x4f, 0xaf, 0x4d, 0xa3, 0x83,
+  0xa0, 0xfd, 0x38, 0xae, 0xc5, 0x06, 0x0c, 0x4f, 0x29, 0x4f, 0x10, 0xa9,
+  0xcd, 0xe7, 0x57, 0xda, 0x5a, 0xb9, 0x48, 0x90, 0x53, 0xb7, 0x31, 0x25,
+  0x13, 0x6e, 0x89, 0xa4, 0x74, 0x87, 0xb3, 0x5b, 0x89, 0x4b, 0x35, 0xd9,
+  0xc2, 0x96, 0x45, 0xe3, 0xc6, 0x66, 0x94, 0x62, 0x32, 0x0b, 0xb5, 0x30,
+  0x2c, 0x2b, 0x37, 0x34, 0xa8, 0xe8, 0xf6, 0x60, 0x4a, 0x2b, 0xad, 0x93,
+  0x5c, 0x2e, 0x91, 0x10, 0x13, 0x5a, 0xbe, 0x50, 0xa3, 0x0b, 0x8a, 0xed,
+  0x39, 0x6e, 0xfc, 0x16, 0x87, 0x2b, 0x2a, 0x60, 0x45, 0x84, 0x83, 0xb2,
+  0x6a, 0x5a, 0x51, 0xfb, 0xf8, 0x5b, 0x8b, 0xf7, 0xf8, 0xfe, 0xf0, 0xba,
+  0xd2, 0x19, 0x9f, 0x0f, 0xd1, 0x48, 0xdb, 0x8d, 0xc6, 0xa1, 0x8c, 0xe8,
+  0x6e, 0x8b, 0x60, 0xce, 0x7d, 0x37, 0x1f, 0x4e, 0x26, 0x77, 0xa3, 0xf9,
+  0xcd, 0xbc, 0x71, 0x48, 0xdf, 0x24, 0x01, 0xec, 0x7d, 0x26, 0x77, 0x15,
+  0x24, 0x19, 0x89, 0xfb, 0xce, 0xba, 0x90, 0x7c, 0xda, 0xf1, 0x7b, 0xdf,
+  0xdc, 0x5c, 0x8f, 0x6d, 0xdd, 0xb9, 0x8b, 0x5e, 0xb5, 0x5e, 0x8b, 0xf6,
+  0xac, 0xa6, 0x2a, 0x24, 0x9e, 0x3c, 0x5d, 0x45, 0x34, 0x93, 0x8e, 0x1a,
+  0xec, 0x45, 0xcb, 0x10, 0x8e, 0xf7, 0xfa, 0xcb, 0xca, 0x3f, 0x71, 0xee,
+  0x80, 0x1f, 0xcd, 0xab, 0x7d, 0x97, 0xe0, 0x95, 0x8f, 0xa2, 0x4f, 0x8b,
+  0x16, 0x7c, 0xf7, 0x44, 0x59, 0x80, 0xfc, 0xf3, 0xca, 0x99, 0xaf, 0xfa,
+  0x6f, 0xdd, 0x7d, 0xe5, 0xb6, 0xbe, 0x6f, 0xe1, 0x44, 0x22, 0x97, 0x0a,
+  0xc3, 0x92, 0x81, 0x7f, 0x4d, 0x51, 0xb9, 0x7d, 0xd4, 0xe2, 0x6d, 0x7b,
+  0x8e, 0xdf, 0x5f, 0xe1, 0xb2, 0x6c, 0x82, 0x6b, 0x3d, 0xa0, 0x99, 0x54,
+  0xd5, 0x8b, 0x21, 0xff, 0xa9, 0x0a, 0xf9, 0x0b, 0xd0, 0xdd, 0xac, 0x55,
+  0x80, 0x0d, 0xb7, 0x59, 0x21, 0xd7, 0x89, 0x9a, 0x3c, 0x0b, 0x0a, 0x58,
+  0x7f, 0xba, 0xb2, 0xbc, 0xf2, 0x43, 0x12, 0x67, 0xea, 0x79, 0xe0, 0x59,
+  0x94, 0xd3, 0x5c, 0x8c, 0x5d, 0x3e, 0x72, 0x7e, 0x7c, 0x76, 0x97, 0xc0,
+  0xe9, 0xf6, 0xaa, 0x21, 0x74, 0x91, 0x25, 0xf4, 0xcb, 0xda, 0xef, 0xc2,
+  0x6f, 0xf2, 0x43, 0xb3, 0x51, 0x89, 0x71, 0xbc, 0x5b, 0xcf, 0x15, 0xae,
+  0xcb, 0xe4, 0x7d, 0xac, 0xa6, 0x0f, 0x7b, 0xd6, 0xa7, 0x5f, 0x39, 0x47,
+  0xe3, 0x59, 0xe8, 0xd3, 0x82, 0xdb, 0xc7, 0xc9, 0x84, 0x66, 0x97, 0x42,
+  0xf2, 0x48, 0x13, 0x95, 0xbc, 0xff, 0xab, 0x7a, 0xe6, 0x80, 0x39, 0x97,
+  0x6a, 0x34, 0xff, 0xd8, 0x17, 0x94, 0x82, 0x10, 0xd5, 0x25, 0xba, 0x5c,
+  0x97, 0x8a, 0x5a, 0x3c, 0x2a, 0xcf, 0x88, 0xab, 0xfc, 0xea, 0x92, 0xc6,
+  0x16, 0xcc, 0xb6, 0xa9, 0x29, 0xfc, 0x83, 0x65, 0x44, 0x5b, 0xa9, 0x75,
+  0x1e, 0x9b, 0x2e, 0x3d, 0x74, 0x6f, 0x63, 0xbf, 0xea, 0x8a, 0xdc, 0x33,
+  0xc4, 0x04, 0x1d, 0x7e, 0xd5, 0x35, 0xbf, 0x14, 0x74, 0x32, 0x28, 0x95,
+  0xa6, 0x64, 0x79, 0xfa, 0x98, 0x78, 0x6b, 0x37, 0xe0, 0xc5, 0xb5, 0xc9,
+  0x95, 0xe5, 0xdd, 0xc5, 0x86, 0x1f, 0x5f, 0x2d, 0x2c, 0x83, 0xed, 0x56,
+  0x57, 0x8d, 0xdd, 0xc7, 0xe3, 0xed, 0xb2, 0x5a, 0x87, 0xb7, 0x8d, 0xef,
+  0x3d, 0x2a, 0xc2, 0xe6, 0x87, 0xf9, 0xff, 0x57, 0xa9, 0x79, 0x37, 0xdf,
+  0xf1, 0x7b, 0x5e, 0x2d, 0xa8, 0xb6, 0x2a, 0x4b, 0x4f, 0x4e, 0xd6, 0x2b,
+  0x5f, 0xe9, 0xa8, 0xa2, 0xbf, 0xf8, 0xc0, 0x3e, 0x68, 0x55, 0xae, 0x57,
+  0xc1, 0x1b, 0x87, 0xf4, 0xb3, 0x21, 0xa3, 0xc6, 0xbf, 0xfd, 0xe7, 0x66,
+  0x6d, 0xb5, 0xd5, 0x56, 0x5b, 0x6d, 0xb5, 0xd5, 0x56, 0x5b, 0x6d, 0xb5,
+  0xd5, 0x56, 0x5b, 0x6d, 0xb5, 0xd5, 0x56, 0x5b, 0x6d, 0xb5, 0xd5, 0x56,
+  0x5b, 0x6d, 0xb5, 0xd5, 0x56, 0x5b, 0x6d, 0x3f, 0xd9, 0xfe, 0x02, 0xcd,
+  0xe6, 0x64, 0xdb, 0x00, 0x28, 0x00, 0x00
+};
+const unsigned int alloc_len = 1315;
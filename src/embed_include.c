@@ -0,0 +1,629 @@
+// Embedded: lib/tinycc/include
+// source generated by cjit/build/embed-path.sh
+// Sat Oct 17 04:50:04 UTC 2026
+// include
+const char include[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0x3d,
+  0x6b, 0x73, 0xe3, 0x36, 0x92, 0xf9, 0x1a, 0xff, 0x0a, 0xdc, 0x4c, 0xd5,
+  0x44, 0x74, 0x64, 0xd9, 0x92, 0x6c, 0xcd, 0x64, 0x1c, 0xfb, 0x4a, 0x96,
+  0xe9, 0x19, 0xdd, 0xca, 0x92, 0x57, 0x92, 0xe7, 0x71, 0x7b, 0x5b, 0x2c,
+  0x9a, 0x82, 0x64, 0x66, 0x28, 0x52, 0x4b, 0x82, 0x7e, 0x24, 0x3b, 0xfb,
+  0xdb, 0xaf, 0x1b, 0x00, 0x49, 0xf0, 0x29, 0xd9, 0x89, 0xbd, 0x95, 0xbb,
+  0x61, 0xed, 0x8e, 0x45, 0xa0, 0xbb, 0xd1, 0x68, 0x34, 0x1a, 0xdd, 0x60,
+  0x03, 0xb1, 0x5d, 0xcb, 0x09, 0x67, 0x74, 0xf7, 0xbb, 0x27, 0x7c, 0xf6,
+  0xe0, 0x79, 0xfd, 0xfa, 0x80, 0xff, 0x85, 0x27, 0xfb, 0x97, 0xff, 0x6e,
+  0x1e, 0xb4, 0x3a, 0xfb, 0x07, 0xaf, 0x0f, 0x3a, 0x58, 0xde, 0x6c, 0x1d,
+  0x34, 0xdb, 0xdf, 0x91, 0x83, 0xa7, 0x64, 0x2a, 0x7a, 0xc2, 0x80, 0x99,
+  0x3e, 0xb0, 0xe2, 0x7b, 0x1e, 0xab, 0x82, 0x5b, 0x57, 0x9f, 0xed, 0xdc,
+  0x9f, 0xe4, 0xb1, 0xe5, 0xf8, 0x07, 0x6c, 0x76, 0xe5, 0x79, 0x4e, 0xe3,
+  0xfa, 0x09, 0xda, 0x40, 0x79, 0x74, 0x3a, 0xfb, 0xa5, 0xe3, 0xdf, 0xea,
+  0xc0, 0xf8, 0xef, 0xbf, 0x6e, 0xef, 0xef, 0x37, 0x0f, 0x3a, 0x9d, 0x36,
+  0x8c, 0xff, 0x7e, 0xbb, 0x0d, 0xe3, 0xff, 0x2c, 0x42, 0xfc, 0x7f, 0x3e,
+  0xfe, 0x2f, 0xed, 0xb9, 0x3b, 0xa3, 0x73, 0x62, 0x4c, 0xa6, 0xa7, 0x27,
+  0xa3, 0xd1, 0xc0, 0x78, 0xbf, 0xf5, 0x12, 0xde, 0x6d, 0x97, 0xaa, 0x45,
+  0x5b, 0xbb, 0xdb, 0xa4, 0x3f, 0x19, 0xf5, 0x7e, 0xfa, 0x89, 0xa0, 0x96,
+  0x50, 0xd3, 0x25, 0xdb, 0xbb, 0x5b, 0x31, 0x24, 0x96, 0x7d, 0x6f, 0x9c,
+  0xc0, 0xbf, 0x71, 0x11, 0xf3, 0x43, 0xfa, 0x7d, 0x33, 0x7e, 0x9d, 0x9b,
+  0x4e, 0x40, 0xbf, 0xdf, 0x4b, 0x68, 0x1b, 0x88, 0x63, 0x20, 0x94, 0xc1,
+  0xeb, 0x0c, 0xd3, 0xa7, 0x86, 0xa8, 0x9c, 0x91, 0x26, 0x90, 0xa6, 0xee,
+  0xcc, 0x9e, 0x13, 0x68, 0x37, 0x61, 0x03, 0xdb, 0xfc, 0x77, 0xcb, 0xeb,
+  0xff, 0xda, 0xa3, 0xcc, 0x7f, 0x90, 0xfe, 0x93, 0x4c, 0xff, 0x75, 0xf3,
+  0xbf, 0xd5, 0xdc, 0xcf, 0xcd, 0xff, 0x66, 0xfb, 0xe0, 0xdb, 0xfc, 0x7f,
+  0x8e, 0x47, 0x9d, 0xff, 0xa7, 0xfa, 0x59, 0x66, 0xfa, 0x8b, 0x92, 0x2d,
+  0x76, 0xbf, 0xa2, 0x1c, 0xc8, 0x98, 0xf4, 0xff, 0x5b, 0x37, 0xa6, 0x9f,
+  0x2f, 0x74, 0xc3, 0x20, 0x81, 0xfd, 0x2b, 0x35, 0xd8, 0xa1, 0x52, 0x7b,
+  0x31, 0x1d, 0x9f, 0xf6, 0xcf, 0xce, 0x62, 0x80, 0x3c, 0xc4, 0xc7, 0xde,
+  0xfb, 0xee, 0x38, 0xaa, 0xbf, 0xb5, 0xae, 0x4d, 0xbf, 0x92, 0xc2, 0x8a,
+  0xf9, 0x60, 0x05, 0xe6, 0x95, 0x30, 0xb6, 0xcb, 0x00, 0x2c, 0x0d, 0xa2,
+  0xb2, 0x19, 0x26, 0x00, 0x5b, 0xd0, 0x5b, 0xac, 0x9d, 0x9e, 0xf6, 0x8c,
+  0x0f, 0xfa, 0x78, 0xd2, 0x1f, 0x0d, 0x01, 0xe0, 0xf8, 0x88, 0xb4, 0xf6,
+  0x9a, 0xcd, 0x66, 0x6b, 0x10, 0x53, 0x08, 0x5d, 0xdb, 0x73, 0xc9, 0x6f,
+  0xc4, 0xf1, 0xdc, 0x85, 0xf8, 0xc7, 0x30, 0x1c, 0xe7, 0x50, 0xfc, 0x9c,
+  0x79, 0xe1, 0x95, 0x83, 0x26, 0xcc, 0x99, 0x1d, 0x92, 0xaf, 0x64, 0x69,
+  0xde, 0x19, 0xa6, 0x63, 0x2f, 0x5c, 0x6c, 0x41, 0x98, 0x2d, 0xde, 0x10,
+  0x17, 0xeb, 0xf0, 0x72, 0x30, 0x88, 0x25, 0x8a, 0x2f, 0xa4, 0x56, 0xbb,
+  0xf1, 0xec, 0xd9, 0xb6, 0xb6, 0xa7, 0x25, 0xc0, 0x21, 0x87, 0xf5, 0xe6,
+  0xf3, 0x80, 0x32, 0x6f, 0x1e, 0xc3, 0x47, 0x05, 0x35, 0x64, 0xab, 0x4e,
+  0xe6, 0x36, 0x75, 0x66, 0x1a, 0x10, 0x10, 0x62, 0xd5, 0x5e, 0xd5, 0x78,
+  0x05, 0x41, 0x5a, 0x3b, 0xc7, 0xa2, 0x56, 0x74, 0x31, 0xb2, 0xa3, 0x86,
+  0x61, 0xb7, 0xdf, 0x74, 0xa0, 0x8b, 0xff, 0xfc, 0xa7, 0x52, 0x76, 0x07,
+  0x45, 0x9d, 0x7d, 0xc3, 0xd8, 0x42, 0x46, 0xc8, 0xb6, 0xe9, 0x38, 0x9e,
+  0x65, 0x4a, 0xa2, 0x7c, 0x50, 0x35, 0xa5, 0x1f, 0xf2, 0x2f, 0xd8, 0xe1,
+  0x91, 0x33, 0xa3, 0x3e, 0x59, 0x38, 0xf6, 0x95, 0x45, 0x7c, 0xfa, 0x8f,
+  0xd0, 0xf6, 0x29, 0x31, 0xc9, 0x2d, 0x48, 0x17, 0xd0, 0xe6, 0xbe, 0xb7,
+  0x24, 0x3f, 0x47, 0x46, 0xe4, 0x98, 0xd4, 0x6e, 0xaf, 0xa9, 0xcb, 0xc1,
+  0x68, 0xc0, 0xe8, 0x6c, 0x8b, 0x10, 0x72, 0x75, 0x0f, 0x6d, 0xbb, 0x94,
+  0xce, 0x0c, 0x81, 0x53, 0x27, 0x66, 0x40, 0x3c, 0x76, 0x4d, 0xfd, 0x5b,
+  0x3b, 0xa0, 0x24, 0xc2, 0x25, 0x76, 0xe0, 0xfe, 0xc0, 0x08, 0x72, 0x75,
+  0x0b, 0xec, 0x32, 0x0f, 0x71, 0xa3, 0x45, 0xe5, 0xda, 0x0e, 0x08, 0xf6,
+  0x59, 0x6b, 0x40, 0xe1, 0xd0, 0x63, 0x58, 0x64, 0x32, 0x51, 0xbe, 0x84,
+  0x99, 0x4c, 0xae, 0x40, 0x6a, 0x21, 0x0b, 0xec, 0x19, 0xd6, 0x50, 0xe2,
+  0x7a, 0xfe, 0xd2, 0x74, 0x90, 0x42, 0xac, 0xcd, 0x64, 0x11, 0x9a, 0xfe,
+  0xac, 0x4e, 0x02, 0x4f, 0xe0, 0xda, 0x8c, 0xdc, 0x7a, 0xfe, 0x97, 0x80,
+  0xd0, 0x1b, 0xe0, 0x98, 0xb3, 0x7d, 0x4b, 0x7f, 0xb8, 0xa1, 0x44, 0x5a,
+  0xc6, 0x19, 0x27, 0x34, 0xb7, 0x1d, 0x8a, 0x64, 0x4c, 0xc7, 0xa7, 0xe6,
+  0xec, 0x1e, 0xfa, 0x67, 0xb3, 0x6b, 0x68, 0x49, 0x4a, 0xc2, 0x06, 0xb5,
+  0x10, 0xbd, 0x42, 0xce, 0x26, 0xde, 0x92, 0x8a, 0x9e, 0x11, 0x90, 0x56,
+  0x10, 0x71, 0x6f, 0x7c, 0xec, 0x0f, 0xa7, 0xc6, 0x14, 0xc9, 0xc0, 0x18,
+  0x41, 0xf5, 0x3d, 0x36, 0x13, 0x51, 0x5c, 0xf9, 0xde, 0x8d, 0x2d, 0x9a,
+  0xc3, 0x1e, 0xf1, 0x11, 0x07, 0x1e, 0x6f, 0x29, 0xb1, 0x60, 0xb5, 0x0d,
+  0x03, 0xd9, 0x55, 0x90, 0x19, 0xef, 0x40, 0x03, 0xc9, 0x4c, 0x7b, 0x3d,
+  0x49, 0x3c, 0xc0, 0xb9, 0xc5, 0xc9, 0x0b, 0xa5, 0x9f, 0x7b, 0x3e, 0xe0,
+  0x00, 0x2f, 0xb0, 0x64, 0xaa, 0x1a, 0x51, 0x4b, 0x0d, 0x81, 0x16, 0xeb,
+  0x69, 0xc4, 0xdb, 0xcb, 0x0c, 0xaf, 0xca, 0xcc, 0x55, 0xa8, 0x0b, 0xec,
+  0x58, 0x4b, 0xa4, 0xfe, 0xa6, 0x48, 0x47, 0x75, 0xff, 0x6e, 0xfb, 0xf6,
+  0xed, 0xa9, 0x7e, 0x94, 0xf5, 0xdf, 0x64, 0xde, 0xd2, 0xb6, 0x9e, 0xc0,
+  0x05, 0xa8, 0x5e, 0xff, 0x9b, 0x1d, 0x78, 0xb2, 0xeb, 0x7f, 0xe7, 0xf5,
+  0xb7, 0xf5, 0xff, 0x59, 0x1e, 0x30, 0xec, 0x53, 0xb4, 0x9e, 0x68, 0xe0,
+  0xc0, 0xf4, 0x82, 0xa1, 0xf0, 0xed, 0x1b, 0x30, 0x14, 0xdc, 0xa0, 0x5b,
+  0x8e, 0xe9, 0x2e, 0x7e, 0x08, 0x88, 0xa2, 0x1c, 0xdc, 0xef, 0xdf, 0xdd,
+  0x3e, 0x3a, 0x3a, 0xda, 0x81, 0x27, 0x55, 0xb3, 0x43, 0x26, 0xcc, 0x74,
+  0x67, 0x60, 0x9c, 0xc8, 0x35, 0x98, 0x34, 0xb0, 0x7e, 0x68, 0x85, 0x44,
+  0x35, 0x37, 0x68, 0x01, 0x81, 0x6a, 0xe2, 0xad, 0xa8, 0x6f, 0x32, 0x58,
+  0x5f, 0x03, 0x82, 0x24, 0x76, 0x80, 0xd4, 0x16, 0xd9, 0x86, 0xff, 0x91,
+  0x0b, 0xd3, 0x67, 0xb0, 0xe8, 0x71, 0x83, 0x3b, 0x18, 0x7c, 0x38, 0x27,
+  0x17, 0xbe, 0xf7, 0x0b, 0xb5, 0x60, 0xa5, 0x40, 0x03, 0xe3, 0xf3, 0xf2,
+  0xee, 0xca, 0xb4, 0xb0, 0xda, 0xb6, 0xa8, 0x0b, 0x36, 0xf1, 0xa6, 0xd5,
+  0xd8, 0x23, 0x68, 0x8b, 0x05, 0x82, 0x7e, 0x67, 0xd1, 0x15, 0xa7, 0xdd,
+  0x40, 0x82, 0x13, 0x4a, 0xc9, 0x35, 0x63, 0xab, 0xe0, 0xed, 0xee, 0xae,
+  0xe3, 0xdc, 0x2c, 0x1b, 0x9e, 0xbf, 0xd8, 0x1d, 0xf4, 0x7b, 0xfa, 0x70,
+  0xa2, 0x37, 0xd8, 0x1d, 0xe3, 0x0c, 0x3a, 0x92, 0x94, 0xed, 0xce, 0x71,
+  0xb5, 0x40, 0x6c, 0x81, 0x7c, 0x71, 0xfa, 0x69, 0x47, 0xb6, 0xb3, 0xd3,
+  0x9f, 0x51, 0x97, 0xd9, 0xb0, 0xc6, 0xfa, 0x6f, 0x25, 0x0b, 0x3b, 0xd8,
+  0xf2, 0xc7, 0xfe, 0xf4, 0x3d, 0x6f, 0x79, 0x87, 0x46, 0x2d, 0x8b, 0xbe,
+  0x48, 0xf9, 0xfc, 0x01, 0x8f, 0x10, 0xcf, 0x6e, 0xe2, 0x52, 0xe0, 0x4a,
+  0xd6, 0x9d, 0x8e, 0xce, 0xfb, 0xbd, 0x8c, 0xb3, 0x16, 0x17, 0x02, 0xa8,
+  0x98, 0xd5, 0xca, 0x8a, 0x9c, 0x2e, 0x03, 0x13, 0x9d, 0x2b, 0x13, 0xe1,
+  0xff, 0xf1, 0x96, 0x12, 0xa3, 0x49, 0x8a, 0x63, 0x7d, 0xd0, 0xfd, 0xa4,
+  0x9f, 0x92, 0xbd, 0x7c, 0x55, 0x6f, 0x34, 0x9c, 0x5c, 0x9e, 0xeb, 0xa4,
+  0x99, 0xaf, 0xea, 0xf6, 0xfe, 0x7a, 0xd9, 0x1f, 0xeb, 0xa4, 0x55, 0x48,
+  0x50, 0xef, 0x4e, 0x74, 0xd2, 0x2e, 0xc4, 0xc2, 0x6a, 0xb2, 0x9f, 0xaf,
+  0x9a, 0xe8, 0x7f, 0x35, 0x7a, 0x93, 0x29, 0x39, 0xe0, 0xee, 0xc8, 0x39,
+  0x5d, 0x7a, 0xfe, 0x3d, 0xf1, 0x7c, 0xd4, 0x58, 0x58, 0x7e, 0x41, 0x44,
+  0xd1, 0x62, 0x45, 0xdd, 0x70, 0x49, 0x7e, 0xc3, 0x05, 0x92, 0x2c, 0x39,
+  0x94, 0xc1, 0xa1, 0x0c, 0x9f, 0x3a, 0xe6, 0x1d, 0xe8, 0xf6, 0x51, 0xae,
+  0x6b, 0xf5, 0x3c, 0xb0, 0x05, 0x4a, 0x14, 0xc2, 0x3a, 0x7e, 0x94, 0xeb,
+  0x6c, 0x01, 0xb0, 0x69, 0x09, 0x7f, 0xe8, 0x28, 0xd7, 0xfd, 0x02, 0x60,
+  0x60, 0x83, 0x9a, 0x01, 0xcd, 0xb0, 0x81, 0x02, 0x29, 0xa6, 0x8c, 0x08,
+  0x19, 0xca, 0x88, 0x50, 0x00, 0x1c, 0xd0, 0x7f, 0x18, 0x16, 0x78, 0x41,
+  0x47, 0x39, 0xa1, 0xd5, 0xb7, 0xbe, 0xa6, 0x40, 0x0f, 0xb9, 0x0c, 0xbb,
+  0xc9, 0xdc, 0x04, 0xb9, 0x05, 0xaa, 0x0c, 0x0d, 0x51, 0x57, 0xe3, 0x51,
+  0xbd, 0x26, 0x67, 0x31, 0x0f, 0xda, 0x0f, 0x73, 0x30, 0xe8, 0xc6, 0xc7,
+  0x20, 0xf8, 0x92, 0x07, 0x09, 0xc0, 0x3f, 0x06, 0xc9, 0xa7, 0x20, 0x83,
+  0x62, 0xd0, 0xd0, 0x2d, 0x02, 0x0e, 0x4b, 0xe8, 0x5e, 0x7b, 0x3e, 0x4b,
+  0x28, 0xe2, 0x5b, 0x05, 0xc5, 0x34, 0x74, 0x58, 0x02, 0x0e, 0x93, 0x23,
+  0x86, 0x81, 0xdf, 0x15, 0xf4, 0x54, 0xc8, 0xb0, 0x10, 0x14, 0x03, 0x86,
+  0x18, 0x04, 0x5f, 0x2a, 0xa8, 0xa5, 0x60, 0xc3, 0x62, 0xe0, 0x38, 0x20,
+  0x49, 0x88, 0x6e, 0x40, 0x35, 0x4b, 0xba, 0x04, 0x05, 0x1d, 0x37, 0x54,
+  0x4d, 0xd6, 0xec, 0x18, 0x2c, 0x35, 0xa0, 0x58, 0x50, 0x85, 0xd0, 0x6e,
+  0x65, 0x10, 0xb0, 0x20, 0x8f, 0x20, 0x03, 0xbe, 0x18, 0x32, 0x1f, 0x00,
+  0x26, 0x43, 0x20, 0x08, 0xbf, 0x31, 0x52, 0x63, 0x11, 0x17, 0x56, 0x31,
+  0xa3, 0xe2, 0x84, 0xd5, 0x48, 0xc5, 0x3d, 0x4e, 0x95, 0x6e, 0x2c, 0xa7,
+  0x70, 0x0d, 0x5a, 0xb1, 0xb0, 0x52, 0xa5, 0x1b, 0x8b, 0x38, 0x5c, 0x83,
+  0x16, 0x57, 0x43, 0x9c, 0x57, 0xd0, 0x16, 0x96, 0x56, 0xb5, 0x95, 0xc2,
+  0x0a, 0xd7, 0xa0, 0x61, 0xf5, 0xbc, 0x60, 0xa8, 0xe6, 0x95, 0x23, 0x95,
+  0xc5, 0x08, 0x2b, 0x51, 0xa2, 0xca, 0xdc, 0x30, 0xcd, 0xab, 0x47, 0x29,
+  0x87, 0x13, 0x56, 0x23, 0x45, 0xb5, 0xb9, 0x21, 0x9a, 0x57, 0x8f, 0x50,
+  0x0e, 0x27, 0xac, 0x46, 0x8a, 0x6a, 0x73, 0xc3, 0x33, 0xaf, 0x1e, 0x9d,
+  0x1c, 0x4e, 0x58, 0x8d, 0x14, 0x6d, 0x7d, 0xa8, 0x6d, 0x64, 0x37, 0x4b,
+  0x14, 0xfa, 0x69, 0xd8, 0xb0, 0x1c, 0x58, 0xee, 0x40, 0xc4, 0x76, 0x37,
+  0xbb, 0xcf, 0x23, 0xc1, 0xe2, 0xed, 0x9b, 0x18, 0xb2, 0x68, 0x43, 0x27,
+  0xe1, 0x15, 0xb7, 0x52, 0x52, 0xbc, 0xf2, 0x82, 0x62, 0x5e, 0xd3, 0xb0,
+  0x61, 0x02, 0xac, 0x2c, 0x6c, 0x73, 0xc7, 0x4c, 0x39, 0x06, 0x01, 0xf3,
+  0x43, 0x8b, 0x49, 0xd7, 0x40, 0x59, 0xd2, 0xc8, 0x8d, 0xe9, 0x84, 0xf4,
+  0x10, 0xd6, 0x48, 0x59, 0x88, 0x88, 0x87, 0x89, 0x27, 0x24, 0xd7, 0xd2,
+  0xb3, 0x41, 0xf7, 0x9d, 0xd1, 0x1f, 0xf6, 0xa7, 0xe4, 0xb7, 0xbd, 0xaf,
+  0xd9, 0xca, 0x0f, 0xdd, 0x31, 0xaf, 0xab, 0x71, 0x5a, 0x1a, 0x91, 0x7f,
+  0x13, 0x22, 0x0a, 0x69, 0x83, 0xd1, 0x80, 0x19, 0xe0, 0x0c, 0xc3, 0x8a,
+  0xcd, 0x0c, 0x7a, 0xb7, 0x02, 0x1f, 0xd4, 0x66, 0x35, 0xef, 0x4a, 0x78,
+  0xbb, 0x7c, 0x85, 0xd6, 0x48, 0xee, 0xf9, 0x1f, 0xce, 0xb7, 0x61, 0x48,
+  0x4a, 0x2a, 0x11, 0xb1, 0xab, 0x44, 0xb6, 0xb5, 0xda, 0xab, 0x9a, 0xa4,
+  0xa3, 0xed, 0x1c, 0x0b, 0x16, 0xb4, 0x88, 0xe2, 0x5a, 0x56, 0x22, 0xcc,
+  0x7c, 0xd3, 0xc5, 0xac, 0x6c, 0xde, 0xa5, 0xac, 0x3f, 0x52, 0x22, 0x17,
+  0x0b, 0xec, 0x8c, 0xbf, 0xb9, 0x40, 0x8a, 0xe5, 0xc2, 0x89, 0xd4, 0x6a,
+  0x7c, 0x60, 0x1f, 0x21, 0x10, 0x81, 0x1e, 0x49, 0x22, 0xdf, 0xd1, 0x12,
+  0x1e, 0x0b, 0x7a, 0x08, 0x8a, 0xf8, 0x8e, 0xba, 0xe0, 0x9e, 0x5a, 0xc4,
+  0xf7, 0x42, 0xc6, 0xb7, 0x69, 0x70, 0x3f, 0x26, 0xdd, 0xa8, 0xed, 0x2a,
+  0x54, 0x66, 0x34, 0x00, 0x3f, 0x72, 0xb6, 0xc1, 0x08, 0xe4, 0x46, 0x21,
+  0x60, 0x9e, 0x4f, 0xf3, 0x7c, 0x49, 0x8a, 0xf5, 0x9c, 0xcf, 0x9b, 0x1f,
+  0x82, 0x75, 0x14, 0x2a, 0x86, 0x41, 0x70, 0x52, 0xfb, 0x0d, 0x5a, 0xc1,
+  0xc9, 0xe6, 0xcd, 0x0d, 0x83, 0xc4, 0x32, 0x84, 0x49, 0x0f, 0x2e, 0x69,
+  0xf4, 0x7a, 0xb8, 0x59, 0xaf, 0xf8, 0x88, 0x26, 0xb4, 0xb6, 0x81, 0x88,
+  0x46, 0xd8, 0x72, 0x85, 0x94, 0x22, 0x29, 0xad, 0x25, 0xa5, 0xd2, 0x52,
+  0x3b, 0x49, 0xd0, 0x34, 0xd5, 0xc9, 0x2b, 0xa0, 0x57, 0x07, 0xc6, 0x78,
+  0xbf, 0xd6, 0x52, 0x13, 0xb4, 0xbe, 0xe6, 0xb4, 0x86, 0x53, 0x7c, 0xdc,
+  0x08, 0x4a, 0xf6, 0x0a, 0xe5, 0x4f, 0x2a, 0x86, 0xb0, 0x74, 0x16, 0x39,
+  0x9e, 0x39, 0x7b, 0xf0, 0xfc, 0x51, 0x79, 0x79, 0x8e, 0x21, 0x5c, 0x3f,
+  0x6c, 0x25, 0xb4, 0x94, 0x4e, 0x3e, 0x6a, 0x04, 0x13, 0x5a, 0x0f, 0xe6,
+  0xa2, 0x8c, 0x56, 0x5e, 0x1d, 0x90, 0xbb, 0x58, 0x6e, 0x45, 0xc3, 0x42,
+  0x1e, 0x60, 0x15, 0xe9, 0x1d, 0xb8, 0xc8, 0xee, 0xe2, 0x31, 0xb3, 0xf2,
+  0x99, 0xc6, 0x13, 0x4c, 0xea, 0xa3, 0xa7, 0xe4, 0x13, 0xe8, 0x46, 0x24,
+  0xb0, 0x48, 0x3f, 0x80, 0xbd, 0x0d, 0xb5, 0xe4, 0x39, 0x74, 0x23, 0xe2,
+  0xee, 0x11, 0xd6, 0x02, 0x49, 0x96, 0x29, 0xc5, 0xa3, 0x4c, 0x85, 0xe5,
+  0x2d, 0x57, 0x26, 0xb7, 0x37, 0x92, 0x1a, 0x78, 0x47, 0x10, 0x17, 0xe6,
+  0x35, 0x0d, 0x0a, 0xe0, 0x2f, 0x12, 0x8d, 0xa9, 0x07, 0xa1, 0x65, 0xd1,
+  0x20, 0xa8, 0x93, 0xb9, 0x69, 0x3b, 0xa1, 0x4f, 0xb5, 0xe7, 0x5d, 0x00,
+  0x24, 0x1f, 0x9b, 0x8c, 0x52, 0x5e, 0x43, 0xb2, 0xfd, 0x16, 0x8a, 0x92,
+  0x74, 0x52, 0x28, 0xcb, 0x5e, 0x41, 0x27, 0x0f, 0x4b, 0xc7, 0xb5, 0x44,
+  0x96, 0xe5, 0x22, 0xd4, 0x32, 0x0c, 0x6e, 0x38, 0x26, 0xa4, 0x6a, 0x50,
+  0x94, 0xce, 0x6e, 0xf6, 0xe4, 0x36, 0x89, 0x1e, 0xa3, 0x35, 0xb7, 0xd4,
+  0xfc, 0xf2, 0x4d, 0x67, 0xb8, 0xce, 0x34, 0x7f, 0x9f, 0xce, 0xa0, 0x24,
+  0x37, 0xd1, 0x98, 0x75, 0x3a, 0x93, 0x1a, 0x91, 0x35, 0x1a, 0xf3, 0x40,
+  0x9d, 0x79, 0x8c, 0xc6, 0xcc, 0x29, 0xb3, 0xae, 0x0d, 0x73, 0x36, 0x4b,
+  0xdc, 0x11, 0xfc, 0x02, 0xe0, 0xce, 0xb4, 0xac, 0xe3, 0x5e, 0x0a, 0x59,
+  0xd4, 0x4c, 0x59, 0x2b, 0x49, 0xcf, 0xf3, 0x74, 0x4b, 0x78, 0x0b, 0xc2,
+  0xab, 0x0d, 0x79, 0x2b, 0x80, 0xdc, 0x98, 0x37, 0xc0, 0x2d, 0xe5, 0x0d,
+  0xea, 0x4a, 0x78, 0xf3, 0xfc, 0x0d, 0x59, 0xcb, 0x03, 0x6e, 0xcc, 0x99,
+  0xe7, 0x97, 0x32, 0xe6, 0xf9, 0x25, 0x7c, 0xdd, 0x6d, 0xcc, 0x58, 0x01,
+  0xe4, 0xc6, 0x9c, 0xdd, 0x55, 0xb0, 0x76, 0x57, 0xca, 0x1b, 0xb4, 0xb0,
+  0xa9, 0xae, 0xe5, 0x21, 0x37, 0xd7, 0x35, 0xb7, 0x42, 0xd7, 0x5c, 0xd0,
+  0x35, 0x7a, 0xc7, 0xa8, 0xef, 0x12, 0x1e, 0x98, 0x47, 0x21, 0xfb, 0x35,
+  0x7e, 0xec, 0x07, 0x20, 0xd7, 0x02, 0x0f, 0x45, 0xdd, 0x90, 0xd7, 0x0e,
+  0x53, 0xf0, 0x49, 0x90, 0x5f, 0x85, 0x91, 0xe1, 0x4b, 0x85, 0x95, 0xce,
+  0x4e, 0x19, 0x21, 0x19, 0xff, 0x16, 0xb0, 0x88, 0xdb, 0xc6, 0xa6, 0xf3,
+  0x10, 0x16, 0x2b, 0x31, 0xb2, 0xb1, 0x92, 0x02, 0x9b, 0x63, 0x31, 0x45,
+  0x28, 0xcb, 0x23, 0x0f, 0xe7, 0x63, 0x50, 0x3b, 0x00, 0x9f, 0xda, 0xfa,
+  0x62, 0xcc, 0x7d, 0x4a, 0xd5, 0xd4, 0x95, 0xba, 0xe0, 0x8d, 0x1b, 0xfe,
+  0x5c, 0xe3, 0x29, 0xa4, 0xd1, 0xc9, 0x7f, 0x69, 0xc5, 0xf4, 0x08, 0x27,
+  0xe8, 0xcd, 0x61, 0xfd, 0xe0, 0x50, 0x1a, 0xb8, 0x8e, 0xfc, 0xef, 0x56,
+  0x31, 0x2f, 0xea, 0xce, 0x07, 0x91, 0xfb, 0x30, 0x75, 0xb2, 0x89, 0xe4,
+  0xf8, 0x56, 0x02, 0x91, 0x3b, 0x15, 0x39, 0x94, 0x4c, 0x0e, 0x64, 0xf4,
+  0x79, 0xef, 0x8f, 0xcd, 0x82, 0x8c, 0xbf, 0xff, 0xdf, 0x07, 0x4f, 0x96,
+  0x03, 0xce, 0xf3, 0xbf, 0x0f, 0x36, 0xcc, 0xff, 0x6e, 0x76, 0xbe, 0xdb,
+  0x6b, 0xb6, 0xdb, 0xed, 0xce, 0xb7, 0xfc, 0xef, 0xe7, 0x78, 0xd4, 0xf1,
+  0xb7, 0xf0, 0x23, 0xe0, 0x53, 0xe5, 0x7f, 0xec, 0x97, 0xe7, 0x7f, 0xb7,
+  0x5b, 0xcd, 0x4c, 0xfe, 0xff, 0x3e, 0xfc, 0xfd, 0x96, 0xff, 0xf1, 0x1c,
+  0x0f, 0x18, 0x17, 0x9e, 0xd2, 0xf7, 0x43, 0x40, 0x7e, 0x56, 0x74, 0xe0,
+  0x58, 0xc9, 0x2b, 0x33, 0x19, 0xf3, 0xed, 0xab, 0x90, 0x51, 0x70, 0xa9,
+  0xcd, 0x5b, 0xf3, 0x9e, 0x67, 0x4d, 0xa0, 0xd7, 0x69, 0x3b, 0xd4, 0x97,
+  0x29, 0x7c, 0xb8, 0xb8, 0x32, 0x70, 0x3f, 0xc9, 0xc2, 0xb2, 0x78, 0x96,
+  0x07, 0x4f, 0x1d, 0xa9, 0x13, 0x06, 0xaf, 0x3c, 0x79, 0x23, 0xc0, 0xd4,
+  0x90, 0x80, 0xd8, 0xec, 0x2d, 0xf9, 0x42, 0xe9, 0x8a, 0xe7, 0x72, 0x7c,
+  0xa1, 0xf7, 0xb7, 0x60, 0xec, 0x1a, 0x22, 0x49, 0x4d, 0x28, 0xa2, 0xe1,
+  0x82, 0xa5, 0x4c, 0xb3, 0x82, 0x99, 0x0f, 0x22, 0xbf, 0xec, 0xdd, 0xa0,
+  0x7f, 0xd2, 0x33, 0x8c, 0x24, 0xe1, 0x4c, 0x61, 0xed, 0x5b, 0xc2, 0xd9,
+  0xa3, 0x9e, 0x68, 0xfe, 0xdf, 0x98, 0xbe, 0xe9, 0x2f, 0x9e, 0x62, 0xf6,
+  0xaf, 0x3f, 0xff, 0x71, 0xb0, 0xdf, 0xce, 0x9f, 0xff, 0xe8, 0x7c, 0x9b,
+  0xff, 0xcf, 0xf1, 0xec, 0x6e, 0xf3, 0xd4, 0xab, 0x24, 0x07, 0xec, 0xda,
+  0x0c, 0x88, 0xeb, 0xc1, 0xfc, 0x5e, 0xdd, 0xfb, 0xf6, 0xe2, 0x1a, 0x33,
+  0x4e, 0x65, 0x26, 0x01, 0x4e, 0x6b, 0x80, 0x5a, 0x39, 0xa6, 0xc5, 0x73,
+  0x1f, 0xf8, 0x1c, 0xbe, 0x08, 0xaf, 0xc0, 0x03, 0x26, 0xa7, 0xde, 0xd2,
+  0xb4, 0x45, 0xde, 0x54, 0x2a, 0x9d, 0x6c, 0xa5, 0xa4, 0x74, 0xdd, 0x76,
+  0xf6, 0xc9, 0xd2, 0x76, 0x17, 0xb7, 0x3b, 0x7e, 0xe8, 0x32, 0x7b, 0x49,
+  0xa1, 0xd6, 0xfa, 0x62, 0x2e, 0x28, 0x47, 0x1b, 0x7a, 0xe4, 0xd6, 0xf4,
+  0xc1, 0x03, 0x67, 0xf7, 0x88, 0xb8, 0xb0, 0x6f, 0xa8, 0x7b, 0x48, 0x7c,
+  0x3a, 0xc7, 0xc4, 0x2f, 0x2f, 0x4e, 0xc2, 0x25, 0xa7, 0xfd, 0x49, 0x6f,
+  0xd0, 0xed, 0x9f, 0xeb, 0x63, 0x9e, 0xf7, 0xc5, 0xd9, 0xe0, 0x0d, 0xc5,
+  0xa4, 0x76, 0x93, 0x54, 0xa9, 0x0f, 0xdd, 0x71, 0x77, 0xfc, 0x6e, 0xa2,
+  0x26, 0x4a, 0x25, 0x45, 0x60, 0x31, 0x7c, 0x1f, 0x4c, 0xd9, 0x8b, 0xa9,
+  0xed, 0xde, 0xf7, 0x7a, 0xd8, 0x6b, 0x4c, 0x8c, 0x80, 0xf6, 0xec, 0xe5,
+  0xca, 0xa1, 0x4b, 0xea, 0x32, 0x30, 0x8a, 0xf1, 0xc4, 0x38, 0x6e, 0xbc,
+  0x88, 0x31, 0xc6, 0xf4, 0x06, 0x73, 0x96, 0xef, 0xbd, 0x10, 0x2d, 0x21,
+  0x26, 0x1b, 0x7b, 0x3c, 0x45, 0x17, 0xf3, 0xa8, 0x00, 0x5a, 0x00, 0xff,
+  0x29, 0x2c, 0x92, 0x9a, 0xff, 0x89, 0x8c, 0x3f, 0x45, 0x1b, 0x6b, 0xe7,
+  0x7f, 0xf3, 0x75, 0xee, 0xfc, 0xc7, 0xc1, 0xb7, 0xf9, 0xff, 0x2c, 0x4f,
+  0x2a, 0xab, 0x70, 0xfc, 0x2e, 0x9b, 0x52, 0xc8, 0x4b, 0x94, 0x2c, 0xf0,
+  0xab, 0xd0, 0x76, 0x98, 0xed, 0x1a, 0x37, 0xa6, 0xe1, 0xd8, 0x01, 0x23,
+  0xf2, 0x6f, 0x12, 0x6a, 0x41, 0x01, 0x0a, 0x94, 0xa5, 0x61, 0x79, 0x91,
+  0x0a, 0x03, 0xba, 0x96, 0x86, 0x80, 0x02, 0xb5, 0x1e, 0xcd, 0x4f, 0x1a,
+  0x00, 0x4b, 0x54, 0x08, 0x98, 0x5b, 0x69, 0x00, 0x8a, 0x31, 0x37, 0xb8,
+  0x33, 0x73, 0xfb, 0x8e, 0x98, 0xe4, 0x2a, 0x5c, 0x2c, 0xee, 0xc1, 0x89,
+  0x59, 0x41, 0x31, 0xc4, 0x93, 0xf7, 0xc4, 0x73, 0xc9, 0x3b, 0x98, 0xe4,
+  0x60, 0x2f, 0xc0, 0xdd, 0xb1, 0x3d, 0x91, 0xc9, 0x1a, 0x75, 0x2c, 0xea,
+  0x8e, 0x61, 0x2c, 0xdc, 0xd0, 0x32, 0x72, 0xbd, 0x02, 0xab, 0x61, 0x0c,
+  0xfa, 0x93, 0xa9, 0x71, 0xaa, 0x9f, 0xf5, 0x87, 0xfa, 0x69, 0x2e, 0x36,
+  0x43, 0x39, 0xfd, 0x29, 0x8f, 0xa7, 0x45, 0xf3, 0x1f, 0x1c, 0xb5, 0x27,
+  0xf2, 0xfe, 0xd7, 0xcd, 0xff, 0x56, 0xa7, 0xd5, 0xca, 0xe5, 0x7f, 0xb7,
+  0x9b, 0xad, 0x6f, 0xf3, 0xff, 0x39, 0x1e, 0x50, 0x60, 0x12, 0x8f, 0xfd,
+  0x16, 0xdf, 0x23, 0x1b, 0x7a, 0xb8, 0xac, 0x2e, 0x44, 0x36, 0xb8, 0x38,
+  0x36, 0x72, 0x45, 0xe7, 0xf8, 0xd5, 0x9c, 0xc5, 0x4b, 0xbb, 0x48, 0x77,
+  0x26, 0x20, 0xba, 0x05, 0x65, 0x64, 0x69, 0x5a, 0x80, 0x41, 0xeb, 0xd1,
+  0xbb, 0x17, 0x88, 0x0d, 0x6a, 0x57, 0x1e, 0x9e, 0xa1, 0xb7, 0x84, 0x93,
+  0x0c, 0x08, 0xa6, 0xe0, 0x32, 0x7e, 0xac, 0x87, 0x78, 0x3c, 0x5d, 0x9a,
+  0x04, 0x94, 0x31, 0x5e, 0x85, 0x2b, 0xb9, 0x65, 0xad, 0x56, 0x0d, 0xeb,
+  0x2d, 0xfc, 0x35, 0x56, 0x3e, 0xcf, 0x49, 0xad, 0x69, 0x0d, 0xc1, 0x55,
+  0xca, 0xad, 0xa0, 0x36, 0x3f, 0x5d, 0x13, 0x1f, 0xd1, 0x31, 0x19, 0x89,
+  0x7c, 0x0a, 0x70, 0x5f, 0xec, 0x00, 0xbf, 0x8a, 0xc2, 0xc2, 0xec, 0xde,
+  0x50, 0x9f, 0x09, 0xcf, 0x85, 0xd3, 0x48, 0xe0, 0x03, 0xd2, 0xdb, 0x09,
+  0x98, 0xcf, 0x1b, 0x06, 0x64, 0x19, 0xcd, 0xec, 0x70, 0x0a, 0x35, 0x61,
+  0x35, 0x50, 0x04, 0xc0, 0x5f, 0x6f, 0x34, 0x3c, 0xeb, 0xbf, 0x33, 0xa6,
+  0xbd, 0x9e, 0x71, 0x31, 0xd6, 0x61, 0xfe, 0x4f, 0x22, 0x8e, 0x92, 0xf3,
+  0x47, 0x0e, 0xda, 0x08, 0x1b, 0x0d, 0x0d, 0xca, 0x82, 0x31, 0x08, 0x77,
+  0xde, 0x0a, 0x98, 0x1d, 0x61, 0x70, 0x30, 0x90, 0xe2, 0x36, 0x10, 0x89,
+  0xf2, 0xf6, 0x9c, 0x70, 0xe9, 0xe2, 0x07, 0x03, 0xf0, 0xa6, 0x18, 0xe6,
+  0x9d, 0xa3, 0x0c, 0x7d, 0x0f, 0x98, 0x01, 0x31, 0xfb, 0x54, 0xfa, 0x58,
+  0x57, 0xf7, 0x72, 0x73, 0xde, 0xf2, 0x7c, 0x9f, 0x06, 0x2b, 0x4f, 0x70,
+  0x85, 0xc7, 0x7e, 0xa4, 0xa4, 0x53, 0x8c, 0x0b, 0x12, 0x78, 0x00, 0x89,
+  0x52, 0xec, 0xfd, 0x1c, 0x77, 0xa6, 0x1a, 0x16, 0xc6, 0x6b, 0x92, 0x0e,
+  0x8e, 0x06, 0x37, 0x74, 0xe0, 0x92, 0x65, 0x5b, 0x0e, 0xc2, 0xd5, 0xca,
+  0xe3, 0xe2, 0xaa, 0x64, 0xb9, 0x11, 0x75, 0xcc, 0x73, 0x9d, 0x7b, 0x09,
+  0x27, 0xba, 0x0e, 0x98, 0xc7, 0x47, 0x64, 0x9f, 0x77, 0xc1, 0xb4, 0x58,
+  0x68, 0x3a, 0x00, 0x10, 0x8b, 0xdc, 0x76, 0xa5, 0x17, 0x47, 0xef, 0xa8,
+  0x15, 0x32, 0xf3, 0xca, 0xa1, 0xf5, 0xa8, 0x77, 0xd7, 0xd4, 0xfa, 0x12,
+  0x69, 0xa1, 0xd1, 0xb8, 0x6e, 0x6c, 0xc9, 0x7c, 0x77, 0x79, 0x92, 0x6f,
+  0x74, 0x66, 0x5c, 0x8c, 0xfa, 0xc3, 0xa9, 0x3e, 0x86, 0x08, 0xf4, 0x08,
+  0x9a, 0xe0, 0x78, 0xa0, 0xb9, 0xed, 0xd6, 0x95, 0xcd, 0x08, 0xc4, 0x8a,
+  0x8c, 0x2e, 0x83, 0x46, 0xf6, 0xac, 0x13, 0x60, 0x8f, 0x60, 0x20, 0x4f,
+  0x26, 0xa7, 0x10, 0x1d, 0x22, 0x46, 0x92, 0x51, 0x9e, 0x3a, 0x1f, 0xa8,
+  0x66, 0xca, 0x66, 0xe0, 0x32, 0x47, 0x0d, 0x39, 0xc4, 0x4b, 0xea, 0x04,
+  0x74, 0x13, 0x7a, 0xd0, 0xe3, 0x6a, 0x72, 0x08, 0x20, 0x7d, 0xc4, 0x34,
+  0x5c, 0x7f, 0x70, 0xd1, 0x6e, 0x01, 0x40, 0x33, 0x5b, 0x3e, 0x9c, 0x76,
+  0xf6, 0x55, 0x66, 0x62, 0x8e, 0x54, 0x59, 0x0d, 0x46, 0xc3, 0x77, 0x19,
+  0x41, 0x75, 0xf6, 0x51, 0x50, 0x1f, 0x61, 0x9c, 0xbc, 0x5b, 0x21, 0xa8,
+  0x0d, 0xe5, 0xb1, 0xa1, 0x50, 0x8a, 0xc0, 0x06, 0x83, 0x0b, 0x3c, 0x65,
+  0xf8, 0x80, 0x4e, 0x48, 0xb1, 0xe2, 0x59, 0x43, 0x3e, 0xbd, 0x05, 0xd7,
+  0xea, 0xf0, 0xfe, 0x71, 0xa3, 0x98, 0xe1, 0x35, 0x62, 0xf5, 0x25, 0x49,
+  0x1d, 0x9f, 0x04, 0xf5, 0x0e, 0xef, 0x72, 0xda, 0x93, 0xeb, 0x01, 0xa0,
+  0x21, 0xf7, 0xc8, 0x79, 0xf7, 0xe2, 0x62, 0xa0, 0xd7, 0x09, 0x28, 0x5d,
+  0x9e, 0xdf, 0xb2, 0x9e, 0x13, 0x79, 0x8c, 0xae, 0x48, 0x15, 0xe4, 0x98,
+  0xe2, 0xe1, 0x3b, 0x43, 0x8e, 0x67, 0x8a, 0xa0, 0x71, 0xde, 0xfd, 0x04,
+  0x35, 0x7b, 0x77, 0xaf, 0xe7, 0xe2, 0x49, 0xcf, 0x9b, 0xac, 0x2e, 0x28,
+  0x5d, 0xc6, 0x9a, 0x2c, 0xf2, 0xa0, 0x50, 0xbb, 0x0b, 0x41, 0xe7, 0x0a,
+  0x4a, 0x39, 0xdf, 0x1c, 0x55, 0x32, 0xf1, 0xa6, 0x88, 0x6c, 0x35, 0xed,
+  0x41, 0x06, 0x85, 0x9f, 0x1e, 0x3e, 0xe9, 0x4f, 0x0b, 0xa8, 0x8d, 0xc6,
+  0xa7, 0x60, 0x1f, 0x06, 0xfd, 0xe9, 0x74, 0xa0, 0x1b, 0xfa, 0xf0, 0xb4,
+  0xdf, 0xc5, 0xb3, 0xbd, 0xcd, 0x56, 0x3b, 0xdb, 0x71, 0x01, 0x78, 0x02,
+  0x36, 0x3d, 0x86, 0xda, 0x6f, 0xb7, 0xb2, 0x5a, 0x7a, 0xf2, 0x79, 0xaa,
+  0x4b, 0x50, 0xa3, 0x8c, 0x7a, 0xfa, 0xac, 0xed, 0xc7, 0xfe, 0xb0, 0xdd,
+  0xca, 0x50, 0x49, 0x1d, 0x77, 0x4e, 0x1f, 0x43, 0xc8, 0x42, 0x2a, 0xc7,
+  0x2b, 0x33, 0x80, 0x62, 0x7a, 0xaf, 0x53, 0xca, 0x54, 0x53, 0x79, 0xd3,
+  0x53, 0x48, 0x5f, 0x18, 0xa0, 0xfc, 0x80, 0x3f, 0x80, 0x96, 0x62, 0xc3,
+  0x04, 0xd4, 0x9a, 0x13, 0xd6, 0x1c, 0x86, 0x24, 0x6a, 0x82, 0x80, 0xc3,
+  0x91, 0xfc, 0xe2, 0x36, 0x49, 0xcc, 0x45, 0x1e, 0xa4, 0x37, 0x3a, 0x87,
+  0xa9, 0xf5, 0xa9, 0x0a, 0x64, 0xfa, 0x7e, 0xac, 0x77, 0x4f, 0x05, 0x15,
+  0x64, 0xe4, 0x3f, 0x8a, 0x06, 0x27, 0x83, 0x76, 0x39, 0x3d, 0x33, 0x9a,
+  0x9d, 0x52, 0xaa, 0x58, 0x2d, 0x6d, 0xb1, 0xaa, 0xe7, 0xc9, 0x31, 0xef,
+  0x6a, 0x05, 0x98, 0x51, 0xcb, 0x09, 0x56, 0xd4, 0xaa, 0xdd, 0x69, 0xe9,
+  0xed, 0xca, 0x1a, 0x94, 0x68, 0x19, 0x60, 0x0b, 0xa1, 0xb7, 0x72, 0xe3,
+  0x7d, 0xe6, 0x53, 0x5a, 0xb4, 0x88, 0xbd, 0x1b, 0x5e, 0xf6, 0x80, 0xb1,
+  0x9f, 0x8a, 0x8a, 0xcf, 0xfb, 0xc3, 0x11, 0x6a, 0x6e, 0xbb, 0xa8, 0xf2,
+  0xa2, 0x3b, 0xed, 0xbd, 0x1f, 0xe8, 0x1f, 0xf4, 0x01, 0xce, 0xba, 0x22,
+  0x08, 0xde, 0xf5, 0xfe, 0x70, 0x00, 0xb1, 0x4e, 0x81, 0x05, 0x47, 0x49,
+  0x0f, 0x26, 0xb9, 0xe2, 0xf1, 0xe5, 0x50, 0xe7, 0x5a, 0xc1, 0x97, 0xea,
+  0x61, 0x77, 0x10, 0xd9, 0xd3, 0xe2, 0x55, 0xfc, 0x4d, 0x64, 0xec, 0xcf,
+  0xfa, 0x9f, 0xce, 0x75, 0xfc, 0xec, 0x0a, 0xba, 0xd4, 0x6c, 0xbd, 0x31,
+  0x18, 0x7a, 0x78, 0x61, 0xc0, 0xfd, 0x1f, 0x74, 0x0f, 0x7f, 0x09, 0x97,
+  0xab, 0xbc, 0x31, 0x8d, 0x81, 0xa3, 0xa4, 0x6e, 0x92, 0x3a, 0x38, 0x44,
+  0x8c, 0x59, 0xb8, 0x5c, 0xde, 0xff, 0xad, 0xd9, 0xf9, 0xbb, 0x2a, 0xf8,
+  0x5a, 0x8d, 0x1f, 0xd5, 0xa7, 0xb3, 0x5a, 0xb3, 0xa3, 0x61, 0x2a, 0xd8,
+  0xd7, 0x62, 0xbb, 0x25, 0x96, 0x96, 0x02, 0x33, 0x13, 0xf5, 0x24, 0x5a,
+  0x52, 0x38, 0x48, 0x99, 0x4b, 0xa0, 0x12, 0xca, 0x9a, 0xa1, 0x02, 0x42,
+  0xfb, 0xf1, 0x52, 0x50, 0xaa, 0x03, 0x5f, 0xa8, 0xef, 0x52, 0x07, 0x54,
+  0x21, 0x07, 0x31, 0xa4, 0xac, 0x42, 0x49, 0xb2, 0xad, 0xa7, 0x94, 0x24,
+  0x3b, 0x90, 0x6b, 0x95, 0xe4, 0xc2, 0x37, 0x17, 0x4b, 0x13, 0x34, 0x38,
+  0x83, 0xa8, 0x0f, 0xce, 0xe2, 0xb9, 0x97, 0x70, 0x66, 0x9a, 0xbe, 0x75,
+  0xcd, 0x2f, 0x1c, 0x48, 0x41, 0x0f, 0x46, 0xbd, 0xd1, 0x58, 0x47, 0x05,
+  0x30, 0xf1, 0xab, 0x28, 0x0e, 0xb9, 0xb9, 0xc0, 0x4b, 0x0f, 0x10, 0x25,
+  0x58, 0x72, 0x6f, 0xae, 0x44, 0x1a, 0x65, 0x6e, 0x5d, 0x71, 0x67, 0xbb,
+  0xc3, 0x49, 0x1f, 0x4c, 0xf7, 0xc9, 0xb8, 0x3b, 0xfe, 0x2c, 0xae, 0x96,
+  0x49, 0x53, 0xe3, 0x4b, 0xb6, 0xa4, 0x05, 0xdc, 0xd0, 0x65, 0x88, 0x31,
+  0x8a, 0x58, 0xc9, 0x77, 0x70, 0xcf, 0x00, 0x1c, 0xd7, 0xa5, 0xf9, 0x05,
+  0x3d, 0x67, 0xfe, 0x9d, 0x44, 0x1c, 0x6e, 0xc5, 0x50, 0x24, 0x88, 0xfc,
+  0xef, 0xb7, 0x79, 0xfd, 0x8c, 0x78, 0x11, 0x44, 0x67, 0xa6, 0x7f, 0x0b,
+  0x6e, 0x35, 0x5d, 0xda, 0x2c, 0xc0, 0x7d, 0x4e, 0x57, 0x46, 0x17, 0x40,
+  0xfe, 0xe7, 0xfd, 0x3c, 0xb2, 0x60, 0xa9, 0x87, 0x04, 0x9a, 0x88, 0x8e,
+  0x5f, 0x5c, 0x7e, 0x9e, 0x72, 0x97, 0xbf, 0x87, 0x41, 0x00, 0x46, 0x4e,
+  0xa6, 0xc3, 0xbf, 0xd3, 0xe4, 0x70, 0x73, 0x4b, 0x60, 0xba, 0xfe, 0x74,
+  0x04, 0xc6, 0xfb, 0x72, 0x02, 0xd4, 0xe5, 0x5c, 0xe5, 0x93, 0x5c, 0x42,
+  0x15, 0x0c, 0x06, 0x70, 0xb8, 0xcb, 0x3f, 0xe6, 0x10, 0xb4, 0x63, 0xf6,
+  0xdc, 0xb6, 0x88, 0xdc, 0x74, 0x09, 0xe4, 0x66, 0x8a, 0xb5, 0xa3, 0x48,
+  0xa4, 0x40, 0x12, 0x67, 0x78, 0x2c, 0x42, 0x87, 0x45, 0x7e, 0xfa, 0xde,
+  0x18, 0x0d, 0x07, 0x9f, 0xf3, 0x3c, 0x9d, 0x8d, 0xc6, 0xd3, 0xfe, 0xd9,
+  0x67, 0x63, 0x32, 0xba, 0x1c, 0xf7, 0x74, 0xa9, 0x6d, 0xbb, 0xbb, 0x09,
+  0x89, 0x6b, 0x33, 0x88, 0xb6, 0x7a, 0xd0, 0x92, 0xee, 0x15, 0x0c, 0xe2,
+  0xf0, 0x74, 0x3c, 0xea, 0x67, 0x55, 0x82, 0x9c, 0xc0, 0x02, 0xd4, 0x07,
+  0x53, 0x36, 0xea, 0x4d, 0x07, 0x68, 0xb7, 0x26, 0xfd, 0x77, 0x43, 0xfd,
+  0x74, 0xa8, 0x4f, 0x26, 0xc6, 0x08, 0xd6, 0xa7, 0xc1, 0xa8, 0xcb, 0xf7,
+  0x72, 0x14, 0xd7, 0x73, 0x80, 0xab, 0xab, 0x38, 0x70, 0xab, 0x2c, 0x6b,
+  0x50, 0xc1, 0x6f, 0x75, 0x88, 0x8e, 0x47, 0x83, 0xf5, 0xa1, 0xb8, 0x53,
+  0x2c, 0x8e, 0x35, 0xe3, 0xbd, 0x07, 0x22, 0xa8, 0xc5, 0x98, 0x2c, 0x3a,
+  0x5f, 0x8b, 0xef, 0x52, 0x3f, 0x44, 0x00, 0x67, 0x31, 0x87, 0xef, 0x43,
+  0x05, 0x48, 0x29, 0x0a, 0xbf, 0x82, 0xd4, 0x86, 0x75, 0xd9, 0x34, 0xbe,
+  0x04, 0xc3, 0x09, 0xa6, 0x22, 0xb7, 0x82, 0x67, 0x9d, 0xdb, 0xbc, 0x83,
+  0xa8, 0x60, 0xe5, 0x80, 0x8b, 0x83, 0x8f, 0xe1, 0x14, 0x16, 0x3c, 0x65,
+  0x79, 0x2f, 0x5d, 0x4a, 0xa3, 0x6f, 0x87, 0xd1, 0xb7, 0xc2, 0x06, 0xf9,
+  0x08, 0x12, 0xf2, 0x88, 0xeb, 0xb1, 0x28, 0x9a, 0x44, 0xd6, 0x27, 0x60,
+  0xf1, 0x87, 0xdd, 0x73, 0x1d, 0xe3, 0x67, 0xb0, 0xf5, 0x40, 0x35, 0xa7,
+  0x22, 0x10, 0x58, 0xf7, 0xc7, 0x7a, 0x6f, 0x5a, 0x73, 0xcd, 0x25, 0xad,
+  0xe3, 0x5d, 0x18, 0xcc, 0xab, 0x13, 0x30, 0xd5, 0x66, 0xa0, 0x11, 0x2c,
+  0x13, 0x45, 0xc2, 0x32, 0x60, 0x66, 0xdf, 0x4b, 0x51, 0x57, 0x42, 0xc6,
+  0x18, 0x4e, 0xdf, 0x3f, 0x94, 0x14, 0x14, 0x80, 0xfb, 0x30, 0xfa, 0x58,
+  0x41, 0x72, 0x38, 0x78, 0x2c, 0xd1, 0xe1, 0x20, 0xab, 0x4d, 0x28, 0xa3,
+  0xf8, 0x33, 0x03, 0x88, 0x35, 0x23, 0x12, 0x1c, 0xab, 0xb1, 0x3e, 0x9d,
+  0x7e, 0x36, 0xce, 0x2e, 0x87, 0xbd, 0xa9, 0x70, 0xa3, 0x0c, 0xe5, 0x25,
+  0xc3, 0x66, 0x6e, 0x82, 0xe4, 0xab, 0xe7, 0xd4, 0x64, 0xa1, 0x4f, 0x93,
+  0x6a, 0xe0, 0xa2, 0xd7, 0x6a, 0x93, 0xbf, 0x88, 0xaf, 0xb0, 0x41, 0x6e,
+  0x54, 0x86, 0x9e, 0xeb, 0x86, 0x8e, 0x93, 0x29, 0x84, 0x12, 0x8c, 0xdd,
+  0x8b, 0x4b, 0x0d, 0x9f, 0x06, 0xa1, 0xc3, 0xf2, 0x95, 0x06, 0x68, 0xac,
+  0x30, 0x1f, 0x74, 0x16, 0xcb, 0x20, 0xf8, 0x62, 0xaf, 0x92, 0x3d, 0xdc,
+  0x46, 0xa3, 0x21, 0x4e, 0xf2, 0xef, 0xe8, 0x31, 0x2b, 0xf1, 0xb4, 0xe0,
+  0xdb, 0x2f, 0x17, 0xb8, 0xee, 0xa5, 0x3b, 0x16, 0xed, 0xff, 0x96, 0x5d,
+  0x95, 0x93, 0x0a, 0x12, 0xa3, 0x1b, 0x73, 0x52, 0x17, 0xe6, 0x14, 0xd3,
+  0xa3, 0x77, 0xcc, 0x37, 0x2d, 0x06, 0xfd, 0x01, 0x99, 0xb9, 0x98, 0x3b,
+  0xe8, 0xa3, 0xe0, 0xee, 0x32, 0x73, 0x21, 0xf2, 0xc5, 0xc9, 0xab, 0x57,
+  0x65, 0x33, 0x24, 0x72, 0x64, 0x96, 0x26, 0xbb, 0x16, 0x9b, 0xce, 0xc5,
+  0x2d, 0x5e, 0x87, 0x0b, 0x6a, 0xdc, 0x98, 0x4e, 0x4d, 0x23, 0x4d, 0x7a,
+  0xb0, 0x97, 0x1d, 0xc1, 0x2c, 0xd8, 0x5c, 0xc2, 0x65, 0x67, 0x6f, 0x16,
+  0x2e, 0xa6, 0xb7, 0x37, 0xc8, 0x06, 0xb7, 0xea, 0xba, 0x97, 0x27, 0xe0,
+  0x9a, 0xee, 0xbc, 0x06, 0x46, 0xc6, 0xf3, 0xe9, 0xcc, 0x10, 0x5b, 0x65,
+  0x20, 0xd0, 0xbd, 0xc6, 0xde, 0xd9, 0x2e, 0xfe, 0xa3, 0x65, 0xfb, 0x37,
+  0x77, 0x3c, 0x93, 0x05, 0xc2, 0xea, 0xc5, 0x8a, 0x4d, 0xce, 0x06, 0x53,
+  0x63, 0x3c, 0xba, 0x1c, 0x9e, 0x4e, 0x08, 0x5e, 0x1e, 0xc7, 0xb7, 0x9a,
+  0x1a, 0xb0, 0xa6, 0x81, 0xff, 0x07, 0x70, 0x2e, 0x35, 0x41, 0x61, 0x58,
+  0xb9, 0x50, 0xe6, 0x0e, 0x0c, 0x81, 0x17, 0xba, 0xb3, 0x00, 0xbb, 0x91,
+  0x6d, 0xd2, 0x98, 0xcf, 0xf0, 0xca, 0xb8, 0x2a, 0xa9, 0x5e, 0xfd, 0x4a,
+  0x7d, 0xaf, 0xb6, 0xaa, 0x93, 0xb8, 0x27, 0x78, 0xbf, 0x11, 0x89, 0x8b,
+  0x45, 0xa6, 0x57, 0x6d, 0xbb, 0xb6, 0x02, 0x6f, 0x50, 0x86, 0xf1, 0x8f,
+  0x15, 0x48, 0x26, 0x8e, 0x8f, 0xb8, 0xcd, 0x7f, 0x34, 0xc9, 0xec, 0x53,
+  0x29, 0x37, 0x32, 0x55, 0x58, 0x5a, 0x74, 0x44, 0x78, 0xaa, 0x2f, 0xb3,
+  0xf1, 0xf6, 0x29, 0x0e, 0xc4, 0xfd, 0x00, 0x5c, 0xa4, 0x25, 0xe5, 0x78,
+  0x8f, 0x24, 0xba, 0xd5, 0x03, 0x02, 0xc8, 0xd0, 0xc1, 0xed, 0x5b, 0x5c,
+  0xaa, 0x83, 0x7b, 0xd7, 0x12, 0x33, 0x0c, 0xb7, 0xe1, 0x30, 0xd6, 0x30,
+  0xc5, 0x45, 0x1c, 0x58, 0x89, 0x5f, 0x32, 0xc1, 0x96, 0xef, 0xc2, 0xff,
+  0x99, 0x65, 0x35, 0x1b, 0x56, 0x44, 0xaa, 0xf0, 0xec, 0x24, 0x3e, 0xf1,
+  0x1a, 0xb4, 0x58, 0xc9, 0xe9, 0x07, 0xf3, 0x2e, 0xfa, 0x79, 0xa8, 0x80,
+  0xf1, 0xab, 0xb4, 0xe2, 0xf7, 0x14, 0xaa, 0x77, 0x03, 0x6e, 0x83, 0xe3,
+  0xdd, 0xe6, 0xb0, 0xf0, 0xe1, 0x6e, 0xfc, 0x76, 0x0c, 0x02, 0xde, 0x0f,
+  0x5e, 0x12, 0x68, 0x26, 0x40, 0x5f, 0x93, 0x9f, 0x02, 0xd6, 0xa7, 0x0b,
+  0x23, 0x30, 0x6f, 0xa8, 0x02, 0xf7, 0x35, 0x2f, 0xff, 0xbf, 0x35, 0xff,
+  0x7e, 0x28, 0x46, 0x47, 0xe4, 0xea, 0x19, 0xf2, 0xfb, 0x53, 0x2d, 0x3f,
+  0x52, 0x26, 0x6a, 0x0e, 0xa8, 0x31, 0xb6, 0x2d, 0x2c, 0x0b, 0xbe, 0x89,
+  0x44, 0x43, 0x5e, 0x8e, 0xc1, 0x84, 0x76, 0x58, 0xa2, 0x31, 0xd1, 0x87,
+  0xaf, 0x1a, 0x92, 0x71, 0xcc, 0x20, 0x3e, 0x4e, 0x08, 0x0f, 0xa8, 0x9c,
+  0xb9, 0xd2, 0xc8, 0x11, 0xd9, 0xce, 0x37, 0xab, 0xd5, 0xf8, 0x95, 0x0a,
+  0xdb, 0x9a, 0x32, 0x11, 0x7c, 0x58, 0x64, 0xb8, 0x19, 0xa2, 0x41, 0x50,
+  0xdb, 0xd3, 0xc8, 0x0e, 0x69, 0xed, 0xe7, 0x02, 0xc8, 0xf4, 0xf7, 0x34,
+  0xde, 0x2c, 0x3f, 0xcc, 0xa9, 0xb6, 0xca, 0xf0, 0x4c, 0xa4, 0xa1, 0x82,
+  0x64, 0xf1, 0x78, 0x4f, 0x83, 0x1a, 0xd3, 0xe2, 0xe9, 0x81, 0x3f, 0x0d,
+  0x71, 0xc9, 0x19, 0x26, 0xd6, 0xc3, 0xbb, 0x56, 0xd5, 0x36, 0x7e, 0xaa,
+  0xc3, 0x03, 0x41, 0xa0, 0x10, 0x81, 0x6f, 0x69, 0xd8, 0x2a, 0xbe, 0x89,
+  0xde, 0x62, 0x89, 0x26, 0x7d, 0x2e, 0x3e, 0x3d, 0x40, 0xcb, 0x3b, 0xfb,
+  0x59, 0x6d, 0x13, 0xe3, 0x99, 0x93, 0x4c, 0x85, 0xa4, 0x95, 0x0e, 0xd7,
+  0x6a, 0x31, 0xdf, 0xe4, 0x98, 0xbc, 0xc1, 0xdb, 0xcf, 0x94, 0x92, 0x57,
+  0xea, 0xcb, 0x0e, 0x69, 0x42, 0x57, 0x94, 0x24, 0xf8, 0xff, 0x24, 0xdb,
+  0x5c, 0x46, 0x20, 0x24, 0x20, 0x47, 0x7e, 0x84, 0x38, 0x15, 0xa1, 0xe0,
+  0x1f, 0xf0, 0x6c, 0xa1, 0x82, 0xe4, 0x2a, 0xb4, 0xd2, 0x30, 0xc5, 0xf4,
+  0x97, 0xd2, 0xbc, 0x3e, 0xac, 0x5b, 0xf8, 0xf9, 0x43, 0x0a, 0x9b, 0xaf,
+  0x57, 0xd8, 0x23, 0xbc, 0x6a, 0x02, 0x96, 0xaf, 0x68, 0x16, 0x72, 0x42,
+  0xd6, 0x21, 0xbf, 0xff, 0xed, 0xee, 0xf0, 0xab, 0xbc, 0x03, 0x2e, 0x1b,
+  0x90, 0xc5, 0x84, 0x6a, 0xa8, 0x39, 0xf5, 0x88, 0x56, 0x7c, 0x39, 0x84,
+  0x86, 0xc5, 0xe4, 0xc7, 0xa2, 0x16, 0x51, 0x30, 0x1b, 0x9d, 0x0d, 0x78,
+  0x45, 0xfe, 0x55, 0x2b, 0xc1, 0xaf, 0x50, 0x91, 0x78, 0x5e, 0x88, 0x69,
+  0x81, 0x12, 0x3d, 0x22, 0x42, 0xed, 0xa1, 0x2f, 0xaf, 0x6a, 0xbc, 0x58,
+  0x03, 0xd6, 0xe2, 0xb1, 0xe4, 0x25, 0x3f, 0xb6, 0xb5, 0x57, 0xff, 0x6a,
+  0x6f, 0xa0, 0xf7, 0xb2, 0xab, 0x82, 0xac, 0x3c, 0x1a, 0x8d, 0xee, 0x80,
+  0x22, 0x11, 0x09, 0xf4, 0x63, 0xa4, 0x0c, 0xfc, 0xa5, 0xbd, 0xa6, 0xd3,
+  0xd8, 0x7a, 0x1d, 0x15, 0x41, 0x5c, 0xbc, 0x87, 0x0d, 0xec, 0x28, 0xfa,
+  0x26, 0x69, 0x70, 0x1e, 0xb5, 0x02, 0x85, 0x88, 0x23, 0xe1, 0x97, 0xa5,
+  0x2b, 0x71, 0xa9, 0xbd, 0x8d, 0x8c, 0x15, 0x88, 0xce, 0xfa, 0x52, 0x6a,
+  0xdc, 0x0e, 0xd5, 0x70, 0x66, 0x33, 0x5a, 0x75, 0xfc, 0xb5, 0xf0, 0x0d,
+  0xe6, 0xad, 0xf8, 0xcf, 0x1b, 0xfe, 0x33, 0xb1, 0xad, 0x68, 0xe8, 0xd0,
+  0x21, 0x05, 0x10, 0x34, 0xd3, 0x68, 0x0a, 0x6e, 0xc4, 0xcf, 0x6a, 0x2e,
+  0xe4, 0x62, 0x98, 0x16, 0x81, 0x6f, 0x07, 0xd6, 0xcd, 0x63, 0xa6, 0x3a,
+  0x14, 0x73, 0xf3, 0x0e, 0x92, 0xc6, 0x5b, 0xec, 0x38, 0x1d, 0xe3, 0xce,
+  0xa1, 0x2e, 0x39, 0x3e, 0x26, 0xed, 0x07, 0x2a, 0xbe, 0xb8, 0x10, 0x25,
+  0xd2, 0x7e, 0xd5, 0xb2, 0x3d, 0x54, 0xf9, 0x77, 0x6a, 0x39, 0xf4, 0xcd,
+  0xd5, 0x73, 0x3b, 0xa5, 0x38, 0x60, 0xab, 0x6a, 0xad, 0xed, 0x54, 0x4f,
+  0x35, 0xb4, 0x47, 0x52, 0xd9, 0x12, 0xc3, 0x93, 0x01, 0xd9, 0xc9, 0x16,
+  0xbc, 0x8d, 0x15, 0x3f, 0x5a, 0x4f, 0x0a, 0xf4, 0x1e, 0xe7, 0x56, 0x4a,
+  0x6d, 0xd3, 0x22, 0x46, 0x11, 0x40, 0xef, 0xd2, 0x94, 0xeb, 0xa4, 0x52,
+  0xf1, 0xc9, 0x06, 0x24, 0x34, 0x2d, 0x6d, 0xfd, 0xa3, 0x1b, 0x2a, 0x7f,
+  0xb7, 0xfd, 0x7f, 0x72, 0x8b, 0xc2, 0xc7, 0x8b, 0x89, 0x51, 0xf8, 0xf1,
+  0x28, 0x59, 0x43, 0x24, 0x85, 0x9d, 0x5a, 0xae, 0x48, 0xf4, 0xb4, 0x20,
+  0xc4, 0x4e, 0x67, 0xad, 0x70, 0x47, 0x80, 0x1b, 0x29, 0x14, 0xab, 0x96,
+  0x89, 0x7c, 0xb2, 0x29, 0x30, 0xbc, 0x96, 0x6c, 0xb4, 0xec, 0x46, 0x8b,
+  0x2e, 0x5f, 0x73, 0x53, 0xfb, 0xd6, 0xf8, 0x1b, 0x7d, 0x44, 0xf0, 0x29,
+  0x4f, 0x4e, 0x2e, 0xfb, 0x83, 0x69, 0x7f, 0x48, 0xba, 0xc3, 0x53, 0x72,
+  0x22, 0x5c, 0xf5, 0xee, 0xa0, 0xdf, 0x9d, 0xe8, 0x13, 0x25, 0x0c, 0x13,
+  0xbc, 0x38, 0xd4, 0xc4, 0x0f, 0xd0, 0x86, 0xc8, 0xe8, 0xb5, 0xc0, 0x13,
+  0xce, 0xb2, 0x33, 0xd6, 0x31, 0xd2, 0xaf, 0x7d, 0xd2, 0xa2, 0x50, 0xb8,
+  0xf6, 0xc2, 0x78, 0xf1, 0x29, 0x6a, 0x3c, 0x76, 0xae, 0xab, 0x10, 0x3e,
+  0xe5, 0x59, 0x8d, 0x19, 0xc0, 0x30, 0xf0, 0xa4, 0xf7, 0x5e, 0xef, 0xfd,
+  0x25, 0x8a, 0x5b, 0x12, 0x4a, 0xb2, 0x1f, 0x27, 0xbd, 0x1a, 0x04, 0x6d,
+  0x75, 0x1e, 0xa8, 0xaf, 0xc0, 0xc1, 0x5d, 0x42, 0x14, 0x0e, 0x05, 0x8a,
+  0xa8, 0x5e, 0xbe, 0x14, 0x11, 0x3b, 0xaf, 0x4c, 0x58, 0x78, 0x81, 0x77,
+  0x52, 0x43, 0xcf, 0x8c, 0x17, 0xbc, 0x3e, 0xf2, 0xea, 0x94, 0x06, 0x50,
+  0x38, 0xc5, 0xc4, 0x1f, 0x42, 0xb0, 0x48, 0x0a, 0xbf, 0x97, 0xf7, 0x07,
+  0x71, 0xac, 0x8a, 0x37, 0x92, 0x6c, 0xd1, 0xb7, 0x8b, 0x93, 0xd1, 0xf4,
+  0x7d, 0x44, 0x24, 0x5b, 0x25, 0xf8, 0xcd, 0x93, 0x2e, 0xda, 0x09, 0x47,
+  0x3a, 0xf9, 0x7e, 0x55, 0x75, 0xba, 0x9a, 0xf3, 0xb5, 0x5c, 0x3c, 0x4c,
+  0x66, 0xaa, 0xa2, 0x49, 0x66, 0xf9, 0x0d, 0xbd, 0xfc, 0x3c, 0x8e, 0xb5,
+  0xba, 0xaf, 0x27, 0x67, 0x7a, 0xf0, 0x4e, 0x38, 0x46, 0x64, 0x6d, 0x7a,
+  0x6b, 0x41, 0x2b, 0xc6, 0x5f, 0x42, 0xf8, 0xf2, 0xbb, 0x08, 0xf0, 0xb0,
+  0x2a, 0xc6, 0x87, 0xa5, 0xb8, 0x12, 0x8f, 0xd7, 0x23, 0xdb, 0xfc, 0xbc,
+  0x7b, 0xd2, 0xda, 0x43, 0xda, 0x4e, 0x55, 0xd5, 0xd1, 0x77, 0x80, 0x45,
+  0x36, 0xa6, 0x26, 0xed, 0x69, 0x0a, 0x83, 0x07, 0x2b, 0x1c, 0x52, 0x88,
+  0x4b, 0xc0, 0x44, 0x2d, 0x56, 0x63, 0xb8, 0x65, 0x28, 0xd5, 0x4c, 0xf2,
+  0x8e, 0x62, 0x83, 0x4a, 0x47, 0x25, 0x96, 0xf2, 0x52, 0x8c, 0xe3, 0x56,
+  0x23, 0x55, 0xb6, 0xab, 0x74, 0xd5, 0x64, 0x92, 0xef, 0xaa, 0x36, 0xd5,
+  0x8e, 0x96, 0x20, 0x6c, 0xda, 0xde, 0xb5, 0x9f, 0x65, 0x1a, 0x63, 0x82,
+  0x12, 0xe8, 0x07, 0x82, 0xcf, 0xc2, 0x8c, 0x44, 0x34, 0x2d, 0xeb, 0xa2,
+  0x8e, 0xcf, 0x0d, 0xbd, 0x7b, 0xd2, 0x97, 0x76, 0x37, 0x9a, 0xa1, 0x42,
+  0x9d, 0xc0, 0x74, 0x53, 0xf3, 0xca, 0x36, 0xe4, 0x84, 0x91, 0xa5, 0xaa,
+  0xc2, 0x95, 0x75, 0xb1, 0x90, 0x06, 0x9f, 0x34, 0x7f, 0x04, 0x91, 0xfd,
+  0x3f, 0x84, 0xca, 0x9b, 0xdf, 0x4d, 0x05, 0x27, 0xb1, 0x2c, 0x45, 0x25,
+  0xcc, 0xe2, 0x16, 0x7e, 0x4d, 0x8e, 0xb7, 0x16, 0x53, 0x77, 0x77, 0xcb,
+  0x48, 0x81, 0xec, 0xee, 0x92, 0xf7, 0xdd, 0x0f, 0x3a, 0x39, 0xef, 0x0e,
+  0x06, 0xa3, 0x9e, 0xd8, 0xa5, 0xce, 0x58, 0xc7, 0xf3, 0xee, 0xe7, 0x13,
+  0x5d, 0xd4, 0x24, 0xb6, 0xb2, 0xd0, 0x40, 0x67, 0x20, 0x41, 0x35, 0x54,
+  0xb7, 0x25, 0x55, 0x1f, 0x5b, 0x26, 0x7e, 0x6b, 0x78, 0x9d, 0xd4, 0x8a,
+  0xe5, 0x50, 0x80, 0xe1, 0xd3, 0x08, 0x25, 0x32, 0x48, 0x1b, 0xa3, 0x5a,
+  0x85, 0x8d, 0x3d, 0x80, 0x00, 0x0c, 0x01, 0x77, 0x7e, 0x1f, 0x4b, 0xa2,
+  0x4e, 0xf0, 0x5c, 0xa8, 0x64, 0x3d, 0x3f, 0x37, 0x2a, 0x2f, 0x59, 0xcf,
+  0x5b, 0x75, 0x71, 0xe1, 0x7a, 0x81, 0xec, 0x92, 0xb1, 0x49, 0xd6, 0xb6,
+  0xf5, 0x38, 0xca, 0x40, 0xa9, 0x48, 0x80, 0x73, 0xe5, 0xf9, 0xd1, 0xe2,
+  0x51, 0xa0, 0xa1, 0x75, 0x1e, 0x04, 0xfd, 0xc2, 0x6d, 0xa1, 0xec, 0x52,
+  0xd1, 0xd6, 0x63, 0x5a, 0xa9, 0xc9, 0x72, 0x69, 0x4a, 0x04, 0xb5, 0x52,
+  0xac, 0x3b, 0xa1, 0x1b, 0x57, 0xaa, 0x6e, 0x6f, 0x74, 0x58, 0x2b, 0x5e,
+  0xef, 0x0b, 0x8b, 0x33, 0x85, 0x89, 0xd3, 0x91, 0x14, 0x81, 0x5e, 0xa6,
+  0x4a, 0x94, 0x61, 0x4a, 0x57, 0x88, 0x15, 0x3e, 0xfb, 0xad, 0x40, 0x36,
+  0x64, 0xe8, 0x9f, 0x30, 0x3d, 0x41, 0x7c, 0xca, 0x09, 0x35, 0xf2, 0xfd,
+  0xf7, 0x49, 0xa4, 0x87, 0xa1, 0x6e, 0xd6, 0x71, 0xa8, 0x85, 0xdc, 0x72,
+  0x1e, 0xae, 0x83, 0x7b, 0xf9, 0xd2, 0x01, 0x50, 0x1e, 0x58, 0x1e, 0xae,
+  0x07, 0x8d, 0x60, 0x25, 0x42, 0x7a, 0x00, 0x23, 0x16, 0x31, 0xda, 0xd6,
+  0x8a, 0xab, 0x2c, 0xe7, 0xd7, 0x7a, 0xbc, 0x8f, 0x5a, 0x06, 0xc3, 0x36,
+  0x80, 0x71, 0xfc, 0xe0, 0xaa, 0xac, 0x91, 0x95, 0xb7, 0xb2, 0xc0, 0x83,
+  0x65, 0x6b, 0xa9, 0x80, 0x6f, 0x65, 0xb3, 0xfb, 0x2c, 0x58, 0x76, 0x88,
+  0x25, 0xf4, 0x96, 0xe2, 0x80, 0xf2, 0x4f, 0x61, 0xe9, 0x4f, 0x3c, 0x7f,
+  0xca, 0x34, 0xfa, 0x3f, 0xed, 0x13, 0xe5, 0xff, 0xf3, 0xcf, 0x37, 0x4f,
+  0x73, 0xfc, 0x67, 0xdd, 0xf9, 0x9f, 0x76, 0xa7, 0x99, 0xfd, 0xef, 0xbf,
+  0xb4, 0x5f, 0xbf, 0xde, 0xff, 0x96, 0xff, 0xff, 0x1c, 0x4f, 0xbc, 0xd1,
+  0x70, 0x36, 0x18, 0x75, 0xa7, 0xc6, 0x7b, 0x23, 0x39, 0xf3, 0x12, 0x97,
+  0xc4, 0x45, 0xfc, 0x6b, 0x5e, 0xf7, 0xb4, 0xff, 0x89, 0xb4, 0xc4, 0x7f,
+  0x12, 0x4a, 0xd7, 0x75, 0xf1, 0xe1, 0x4f, 0xbd, 0xd7, 0x10, 0xa1, 0xce,
+  0xbb, 0xff, 0xdb, 0xde, 0xd5, 0xf6, 0xb4, 0x91, 0x03, 0xe1, 0xef, 0xfc,
+  0x8a, 0x55, 0xfb, 0x25, 0x11, 0x09, 0xac, 0xed, 0xf5, 0xbe, 0x20, 0x74,
+  0x52, 0x8f, 0x42, 0x85, 0x94, 0x83, 0xaa, 0x50, 0xe9, 0xee, 0x53, 0x14,
+  0xc8, 0x26, 0xa4, 0x0a, 0x24, 0x4d, 0x42, 0x9b, 0xa0, 0xfb, 0xf1, 0x37,
+  0xe3, 0x7d, 0x1b, 0x7b, 0x5f, 0x8c, 0x4e, 0x94, 0x56, 0xea, 0x5a, 0xaa,
+  0x8a, 0xec, 0xe7, 0xf1, 0x78, 0xc7, 0x9e, 0x59, 0xc7, 0x6b, 0x8f, 0x2f,
+  0xae, 0x87, 0xef, 0xcf, 0x3f, 0x38, 0xdc, 0xd3, 0xf2, 0x31, 0xcb, 0xd7,
+  0xeb, 0x4b, 0x96, 0x1c, 0x98, 0x96, 0x79, 0xfa, 0xf1, 0xea, 0x7c, 0x70,
+  0x79, 0xe1, 0xb0, 0x03, 0x16, 0x71, 0x37, 0xe2, 0x91, 0x1b, 0xf7, 0xdd,
+  0xe0, 0x4c, 0x17, 0xa1, 0x1c, 0xca, 0x47, 0xa7, 0xd3, 0x67, 0x5c, 0x76,
+  0xcd, 0x22, 0xa4, 0x06, 0xd2, 0x8b, 0x3c, 0x21, 0xe3, 0xbe, 0x08, 0xcb,
+  0x54, 0xe6, 0xa6, 0x6c, 0x11, 0x18, 0xe4, 0x77, 0x7f, 0xab, 0x12, 0xc6,
+  0x43, 0x33, 0xdf, 0x11, 0x07, 0x9e, 0xcb, 0x43, 0x2e, 0xbc, 0x20, 0xde,
+  0x2f, 0x55, 0x0a, 0xbc, 0xb4, 0x52, 0x11, 0x16, 0xea, 0x49, 0x6f, 0x8b,
+  0x21, 0xfa, 0x79, 0xff, 0xe7, 0xa0, 0xd0, 0x8f, 0x14, 0x5a, 0x3e, 0x66,
+  0x31, 0xa9, 0x65, 0x65, 0xba, 0xe0, 0x07, 0x9c, 0xbb, 0x9e, 0xe7, 0xbb,
+  0x5e, 0xc4, 0xa5, 0x2b, 0x98, 0x60, 0x71, 0x9f, 0xf9, 0x7a, 0xad, 0x85,
+  0x4a, 0x5c, 0xce, 0xba, 0x66, 0x99, 0xaa, 0x42, 0xba, 0x81, 0x08, 0x65,
+  0x08, 0xff, 0x71, 0x97, 0x79, 0xa0, 0x1b, 0x37, 0x2c, 0xd5, 0x51, 0xe8,
+  0xc6, 0x0d, 0x8c, 0x5a, 0x32, 0xe5, 0xb8, 0xa4, 0x63, 0xd3, 0x02, 0x50,
+  0x79, 0x10, 0x05, 0x7e, 0x04, 0x4d, 0xf3, 0x42, 0x9f, 0x0b, 0x26, 0x51,
+  0x4b, 0x66, 0xf5, 0x44, 0x4b, 0x6e, 0xa2, 0xa6, 0xbb, 0xc5, 0x6a, 0xa5,
+  0xbe, 0x69, 0xe2, 0xa6, 0x9a, 0xb9, 0x76, 0xc7, 0x4e, 0xe9, 0x4b, 0x69,
+  0xe3, 0x54, 0x2b, 0x17, 0x34, 0xd0, 0x54, 0xec, 0x7b, 0x7a, 0x81, 0xd2,
+  0x71, 0xa8, 0xe7, 0x15, 0x03, 0xce, 0x0d, 0x3d, 0x0e, 0xca, 0x0b, 0xb8,
+  0x17, 0x4a, 0x09, 0xfa, 0x16, 0x9e, 0x8b, 0x8a, 0x8e, 0x06, 0x46, 0xed,
+  0x85, 0xaa, 0x7d, 0x11, 0x12, 0x5d, 0x67, 0xa5, 0x30, 0x56, 0x84, 0xcf,
+  0x19, 0x74, 0x94, 0x27, 0x18, 0x83, 0x41, 0x2c, 0xa4, 0xeb, 0x73, 0x3f,
+  0xee, 0x7b, 0x91, 0xe0, 0x15, 0x95, 0xe5, 0x3a, 0x87, 0xf2, 0x52, 0x75,
+  0x99, 0xd6, 0x41, 0x94, 0x57, 0x2a, 0xc2, 0xa1, 0x1e, 0x46, 0x01, 0x08,
+  0x8a, 0xa4, 0x90, 0x01, 0x28, 0x3e, 0xf0, 0xa5, 0xcb, 0xe3, 0xfd, 0x2a,
+  0x49, 0x85, 0xfa, 0xb1, 0xb4, 0xe8, 0x9a, 0xd3, 0x93, 0x73, 0xf8, 0x2d,
+  0x91, 0x98, 0x6c, 0xc5, 0x1e, 0xb9, 0xfc, 0xcb, 0x85, 0xae, 0xfa, 0x64,
+  0x35, 0xff, 0x50, 0x1d, 0x21, 0xfe, 0x8c, 0xd7, 0x31, 0x60, 0x7c, 0xd5,
+  0xb5, 0xba, 0x3c, 0xe2, 0x08, 0xf3, 0x30, 0x1a, 0x40, 0x7f, 0xfc, 0x17,
+  0x6e, 0xe9, 0xe8, 0x6f, 0x6f, 0x9d, 0xc3, 0x71, 0xfc, 0xed, 0x10, 0xf7,
+  0x94, 0x38, 0xff, 0x3a, 0xd3, 0x55, 0xbc, 0x54, 0x6d, 0x82, 0xbf, 0xf1,
+  0x7b, 0x7e, 0x3f, 0x76, 0xde, 0xac, 0x0f, 0x87, 0xc3, 0xc3, 0xc3, 0xe9,
+  0x9b, 0x3d, 0x6a, 0x2e, 0x7a, 0x67, 0x32, 0x26, 0xca, 0xbd, 0x29, 0x44,
+  0x5d, 0x6f, 0x82, 0xa9, 0x80, 0xf7, 0x88, 0xa0, 0x1b, 0x43, 0x50, 0x0c,
+  0x0c, 0x7b, 0xe1, 0x4a, 0x19, 0x05, 0x41, 0xe4, 0x71, 0x19, 0x82, 0x21,
+  0x05, 0x82, 0x83, 0x09, 0x78, 0x2f, 0xd4, 0xb9, 0xdc, 0x0f, 0x82, 0x90,
+  0x41, 0x9d, 0xe0, 0x7a, 0xb8, 0xef, 0xbe, 0x5a, 0x5f, 0x87, 0x32, 0x90,
+  0x20, 0xc9, 0xf7, 0x79, 0xe8, 0xba, 0x41, 0x43, 0xd7, 0x97, 0x2b, 0xa6,
+  0x1d, 0x2f, 0xfc, 0xec, 0xe3, 0x11, 0x9a, 0xe5, 0x7a, 0x94, 0x9c, 0xa6,
+  0xaa, 0xf1, 0x62, 0x83, 0x3a, 0x37, 0x36, 0xa8, 0xf0, 0x63, 0x03, 0xbb,
+  0x23, 0xab, 0xef, 0x02, 0xcd, 0x95, 0x0d, 0x2c, 0xbe, 0xac, 0x49, 0xdb,
+  0x9a, 0x37, 0x1b, 0xd4, 0xba, 0xb3, 0x81, 0xc5, 0x9f, 0xd5, 0x9b, 0x94,
+  0xe6, 0xec, 0x88, 0x62, 0x59, 0xb0, 0x47, 0x3e, 0x12, 0xe7, 0x07, 0x47,
+  0xb3, 0x17, 0xec, 0xcf, 0x9c, 0xf1, 0xe6, 0xe7, 0x3f, 0xa7, 0xc9, 0x06,
+  0xa5, 0x1f, 0x21, 0xc3, 0x32, 0xff, 0x0b, 0xa4, 0xcf, 0x4b, 0xe7, 0xbf,
+  0xfd, 0xf6, 0xfe, 0x9f, 0x57, 0x49, 0x89, 0xef, 0x3e, 0xbf, 0xba, 0x74,
+  0x4e, 0xf2, 0xeb, 0x7b, 0x8e, 0x1c, 0x27, 0x00, 0xeb, 0x72, 0x9c, 0xeb,
+  0xdd, 0x32, 0xee, 0x4f, 0xd3, 0x10, 0xd6, 0x38, 0x3e, 0x9c, 0xe3, 0x6c,
+  0x9c, 0xfc, 0x61, 0x5c, 0x4a, 0x73, 0xfd, 0x41, 0xed, 0xef, 0x25, 0xc7,
+  0xc7, 0xf3, 0x1c, 0x72, 0xcd, 0x4c, 0xc6, 0x25, 0x1b, 0x5e, 0x6f, 0x97,
+  0xf3, 0xc7, 0x35, 0xfe, 0x23, 0x17, 0xbe, 0x24, 0x42, 0x86, 0xb8, 0x64,
+  0xd4, 0xd9, 0xf6, 0x9c, 0xb3, 0xe4, 0x63, 0xec, 0x30, 0x0b, 0xa6, 0x8d,
+  0x67, 0x27, 0x7a, 0xc9, 0xbc, 0xf3, 0xc8, 0x39, 0x7b, 0xfb, 0x76, 0xd2,
+  0xa3, 0x93, 0x06, 0x95, 0x35, 0xc7, 0x28, 0x87, 0x93, 0xd1, 0xe3, 0x1c,
+  0x11, 0x5d, 0xdc, 0xa9, 0x5e, 0x59, 0xfb, 0x90, 0x0f, 0x19, 0x4a, 0xd8,
+  0xbd, 0x88, 0x10, 0xa8, 0xa7, 0x56, 0x4e, 0x83, 0x94, 0xfd, 0xce, 0xee,
+  0x05, 0x25, 0x89, 0x5c, 0xd6, 0xd3, 0x4b, 0x8a, 0x83, 0xea, 0x6a, 0x25,
+  0xda, 0xe5, 0xed, 0x77, 0x9e, 0xfe, 0xaf, 0x4c, 0x7c, 0x15, 0x9d, 0x3d,
+  0x3e, 0xdc, 0x26, 0x37, 0x46, 0x65, 0x53, 0x8f, 0x19, 0x06, 0x61, 0xc3,
+  0xf1, 0x98, 0x8e, 0x28, 0x75, 0xd6, 0xf8, 0x18, 0xf7, 0xc7, 0xcd, 0xe3,
+  0xad, 0xba, 0x80, 0x10, 0x47, 0xf0, 0xd2, 0xeb, 0x6a, 0x01, 0xd7, 0x6f,
+  0x17, 0x6b, 0x68, 0x88, 0x93, 0x27, 0x7d, 0xa4, 0x41, 0xfb, 0x11, 0x41,
+  0xc2, 0xfd, 0xad, 0x67, 0x0f, 0x16, 0x3c, 0x20, 0x68, 0x78, 0xc0, 0x91,
+  0x0d, 0x0f, 0x88, 0xae, 0xd6, 0x9e, 0x3b, 0x4a, 0xa8, 0x6c, 0xcf, 0x9d,
+  0xde, 0x20, 0x0b, 0x01, 0x11, 0x7a, 0x8b, 0x2c, 0x04, 0x44, 0x14, 0x04,
+  0x53, 0x43, 0x65, 0x82, 0xa6, 0x21, 0x53, 0x41, 0x65, 0xb8, 0xa6, 0x20,
+  0x53, 0x3f, 0x65, 0xb8, 0xa6, 0x1f, 0x53, 0x3d, 0x95, 0x8d, 0xb9, 0xd3,
+  0x5a, 0x63, 0xc1, 0xeb, 0xda, 0x31, 0x95, 0x53, 0xd9, 0x1c, 0x82, 0x8f,
+  0xb7, 0x4b, 0x4b, 0xf3, 0x01, 0x51, 0xc0, 0xe7, 0x8b, 0xa9, 0x05, 0x0e,
+  0x88, 0x02, 0xbe, 0x5c, 0x7c, 0xef, 0x3c, 0xb1, 0xde, 0x13, 0xef, 0x56,
+  0xc1, 0xc1, 0xaa, 0xa1, 0xd0, 0x79, 0xe2, 0x3d, 0x04, 0x92, 0x67, 0xfe,
+  0xba, 0xda, 0x58, 0x9e, 0x19, 0x10, 0x05, 0x7e, 0x32, 0xba, 0xb1, 0xd8,
+  0x00, 0x22, 0x1a, 0xcc, 0x2e, 0xb7, 0x38, 0x75, 0xfe, 0x3b, 0x31, 0x33,
+  0xa9, 0x9b, 0x19, 0x68, 0x0d, 0x7d, 0xd0, 0xae, 0xee, 0x41, 0x12, 0xdb,
+  0x56, 0x30, 0xd2, 0xd9, 0x37, 0xf0, 0x20, 0xdb, 0xda, 0x86, 0x01, 0x07,
+  0x11, 0x04, 0x1f, 0xcf, 0xe6, 0x16, 0x3c, 0x20, 0xe8, 0x60, 0x5a, 0xee,
+  0x70, 0x71, 0x32, 0x6f, 0x58, 0x75, 0xab, 0x32, 0x18, 0xe9, 0xf5, 0xd5,
+  0x44, 0x93, 0x53, 0x16, 0x04, 0x08, 0x0d, 0x7e, 0xdb, 0xdc, 0x2e, 0x44,
+  0x68, 0x83, 0x8a, 0x5b, 0xf0, 0x80, 0xd0, 0xf0, 0xf7, 0x8c, 0x12, 0xaa,
+  0xf0, 0xf7, 0x64, 0xc6, 0x3c, 0x19, 0xcf, 0xee, 0x69, 0x6f, 0xd4, 0x3c,
+  0x38, 0xc2, 0x08, 0x69, 0xbe, 0x58, 0xac, 0x1a, 0xa5, 0x28, 0x04, 0x21,
+  0xe0, 0x79, 0xb0, 0xde, 0xae, 0xf7, 0x54, 0xdd, 0xe9, 0xe4, 0x1d, 0x01,
+  0x48, 0x8d, 0xb6, 0x7d, 0x4e, 0xe3, 0x00, 0x46, 0x49, 0xb3, 0x87, 0x67,
+  0x91, 0xa8, 0xef, 0x99, 0xdc, 0x2f, 0xc6, 0xcf, 0x22, 0x2d, 0xc6, 0x84,
+  0xb4, 0x42, 0x9b, 0xaf, 0x1f, 0xca, 0xf9, 0xec, 0x41, 0x01, 0x0b, 0xde,
+  0xdd, 0x6e, 0xb9, 0xd8, 0xd8, 0x4d, 0x40, 0xc1, 0x0a, 0xd6, 0x0c, 0xfc,
+  0xc1, 0x4d, 0xa3, 0xd2, 0x15, 0x82, 0x78, 0x98, 0xf1, 0x33, 0x9b, 0xa7,
+  0x80, 0x84, 0x37, 0x1d, 0xdd, 0xab, 0xf3, 0x7b, 0xb5, 0x82, 0x12, 0x04,
+  0x61, 0xcc, 0x57, 0xb3, 0x87, 0x4d, 0x23, 0x43, 0x21, 0x34, 0x06, 0x6e,
+  0x7e, 0x29, 0x28, 0x55, 0x0c, 0x44, 0x68, 0x0e, 0x93, 0xb9, 0x8d, 0xcf,
+  0xaf, 0x10, 0x3a, 0x61, 0x69, 0x25, 0xe8, 0x2e, 0xd9, 0x62, 0x6c, 0x88,
+  0xd0, 0xf0, 0x37, 0x56, 0x3c, 0xed, 0x10, 0x43, 0x4b, 0x15, 0x78, 0x43,
+  0x4b, 0x86, 0x92, 0xaa, 0x08, 0xba, 0x92, 0xf0, 0xcc, 0xc4, 0xcd, 0x8e,
+  0x88, 0x29, 0x31, 0x72, 0x04, 0x25, 0x6d, 0x37, 0xa3, 0xc9, 0x26, 0x5e,
+  0x65, 0x83, 0xa5, 0x7a, 0x3c, 0xe6, 0x30, 0x9d, 0xb9, 0x59, 0x7c, 0x87,
+  0x5f, 0x05, 0x29, 0xb5, 0x9e, 0x99, 0xc0, 0x0a, 0xea, 0x2a, 0xc6, 0x98,
+  0x70, 0x63, 0x9b, 0xd0, 0x1c, 0xa6, 0x31, 0xbf, 0x3e, 0x2e, 0x88, 0x3f,
+  0x69, 0x98, 0xe2, 0x26, 0x58, 0xc2, 0x35, 0x7a, 0xa0, 0xac, 0x1f, 0xbd,
+  0x07, 0xcc, 0x0e, 0xa8, 0xc0, 0xeb, 0x1d, 0xb0, 0xbe, 0x1d, 0xcd, 0x6f,
+  0xe6, 0xc4, 0x01, 0xd5, 0x19, 0x5d, 0x0a, 0x34, 0x98, 0xd4, 0x73, 0x35,
+  0x32, 0xe9, 0xbc, 0xc9, 0x6a, 0xaf, 0x1b, 0xc3, 0x5e, 0x37, 0x2b, 0x78,
+  0x77, 0x37, 0x3e, 0x95, 0x42, 0x34, 0xbd, 0xe7, 0xc9, 0x64, 0x9a, 0xbc,
+  0xea, 0x7d, 0xf2, 0x46, 0xc5, 0x9d, 0x91, 0x95, 0x53, 0x09, 0xf8, 0x4d,
+  0xb7, 0x1d, 0x22, 0x49, 0xcd, 0xd1, 0x00, 0x46, 0x48, 0xb3, 0xfb, 0xd1,
+  0xb4, 0x72, 0x46, 0xaa, 0x93, 0x10, 0x46, 0x5f, 0xde, 0x0f, 0x5f, 0x9e,
+  0x23, 0x0a, 0x60, 0x84, 0xb4, 0x5c, 0x2d, 0xbe, 0x3c, 0x43, 0x14, 0xc2,
+  0x08, 0x2b, 0x99, 0x07, 0x59, 0x59, 0x08, 0xeb, 0xee, 0xe5, 0x87, 0x94,
+  0x93, 0xcd, 0xac, 0xf9, 0x8f, 0x59, 0x47, 0x2f, 0xc8, 0x7e, 0x0b, 0xff,
+  0x7a, 0xdf, 0x36, 0x49, 0xfc, 0x3f, 0x3c, 0xd9, 0x84, 0xa7, 0xdd, 0x5e,
+  0x7c, 0x11, 0xc8, 0x16, 0xff, 0x8f, 0x05, 0xd2, 0x58, 0xff, 0x91, 0xdc,
+  0x67, 0xed, 0xfa, 0xcf, 0x6b, 0x24, 0x1a, 0xff, 0xef, 0xe2, 0xf2, 0xd3,
+  0xe9, 0xf5, 0xe7, 0x4f, 0x17, 0x46, 0x10, 0x40, 0x92, 0xad, 0xbe, 0x6a,
+  0x5d, 0x5d, 0x9e, 0x30, 0xe6, 0x64, 0xa3, 0x85, 0xce, 0xfc, 0xf3, 0xbc,
+  0xe1, 0x45, 0xfa, 0x97, 0x19, 0x28, 0xaf, 0xa8, 0xeb, 0xd7, 0x33, 0x85,
+  0xdf, 0x32, 0xd1, 0xf8, 0x9f, 0xb8, 0x45, 0xea, 0x47, 0xac, 0x00, 0xdb,
+  0xec, 0x5f, 0x7a, 0xa5, 0xf5, 0x5f, 0xaf, 0xbd, 0xff, 0xfd, 0x75, 0x92,
+  0x16, 0xff, 0x73, 0x70, 0xfe, 0xc1, 0x34, 0xfe, 0x2c, 0x6f, 0xaf, 0x32,
+  0xb0, 0xcf, 0x71, 0x16, 0xd7, 0x07, 0x0f, 0x40, 0x77, 0xd2, 0xd9, 0x43,
+  0x27, 0x0b, 0x7e, 0xd1, 0x25, 0x1f, 0x0b, 0x21, 0xf3, 0xfa, 0xfc, 0xe2,
+  0x9f, 0x93, 0x64, 0xd3, 0x5a, 0xbe, 0x45, 0xfd, 0x1d, 0x8e, 0xb9, 0x11,
+  0x1e, 0x36, 0x74, 0x8c, 0xf0, 0x38, 0xe9, 0xb1, 0x9a, 0x78, 0x9c, 0x9e,
+  0x37, 0x34, 0x49, 0xc9, 0xf9, 0x3d, 0xfd, 0x54, 0x62, 0xf1, 0x91, 0x25,
+  0x5b, 0x8a, 0x48, 0xaa, 0xcf, 0xe5, 0xe8, 0x05, 0x18, 0x6a, 0x24, 0xad,
+  0x8b, 0xde, 0x7a, 0x9e, 0x92, 0xf0, 0x4e, 0x88, 0x6c, 0x3e, 0xc4, 0xcc,
+  0x62, 0x10, 0xa8, 0x15, 0x9b, 0xf1, 0x40, 0x13, 0xad, 0xa9, 0x25, 0xf2,
+  0x9f, 0xdd, 0xc3, 0x6d, 0x6a, 0x53, 0x9b, 0xda, 0xd4, 0xa6, 0x36, 0xb5,
+  0xa9, 0x4d, 0x6d, 0x6a, 0x53, 0x9b, 0xda, 0xd4, 0xa6, 0x36, 0xb5, 0xe9,
+  0x77, 0x4f, 0xff, 0x01, 0x2c, 0xa6, 0xe0, 0xcd, 0x00, 0xa0, 0x00, 0x00
+};
+const unsigned int include_len = 7464;
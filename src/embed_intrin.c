@@ -0,0 +1,1356 @@
+// Embedded: assets/intrin
+// source generated by cjit/build/embed-path.sh
+// Sat Oct 17 04:50:04 UTC 2026
+// intrin
+const char intrin[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xed, 0x7d,
+  0x7b, 0x77, 0xdb, 0xb6, 0xb2, 0x6f, 0xff, 0xce, 0xa7, 0x60, 0xd3, 0xd5,
+  0x1e, 0xc9, 0x91, 0x1b, 0x91, 0x92, 0x65, 0xed, 0xc4, 0x71, 0x57, 0x8e,
+  0xa3, 0xb4, 0x3e, 0x27, 0xb1, 0xb3, 0x6d, 0xa7, 0xbb, 0x77, 0xf7, 0xa1,
+  0x45, 0x8b, 0xb4, 0xc5, 0x55, 0xbd, 0x42, 0x52, 0x8e, 0xdc, 0xa6, 0xfd,
+  0xec, 0x17, 0x83, 0x17, 0x01, 0x10, 0x2f, 0xca, 0x69, 0x7a, 0xce, 0xbd,
+  0xd6, 0xee, 0x8e, 0x49, 0x62, 0xf0, 0x9b, 0xc1, 0xe0, 0x0d, 0x0c, 0x06,
+  0xd9, 0xa2, 0xcc, 0xb3, 0xc5, 0xe3, 0xcf, 0xfe, 0xca, 0x5f, 0x17, 0xfd,
+  0xf6, 0xf7, 0xf6, 0xf0, 0x5f, 0xf4, 0x53, 0xff, 0xe2, 0xe7, 0x70, 0x2f,
+  0x1a, 0xf4, 0xf7, 0xfa, 0x51, 0x0f, 0xe8, 0xc2, 0xa8, 0xb7, 0x1f, 0x7d,
+  0x16, 0xec, 0xfd, 0xa5, 0x52, 0xd1, 0xdf, 0xba, 0x28, 0xe3, 0x1c, 0x89,
+  0x92, 0x2f, 0x97, 0xa5, 0x8d, 0xce, 0x15, 0xae, 0x26, 0xee, 0x7f, 0xc9,
+  0x2f, 0x23, 0xf9, 0x9f, 0xce, 0xe7, 0xe4, 0xe9, 0xeb, 0xe9, 0xc7, 0xe7,
+  0x01, 0xfa, 0x18, 0xf4, 0xfb, 0x86, 0xfc, 0xdf, 0xeb, 0xed, 0x77, 0xf7,
+  0x58, 0xfe, 0x87, 0xfb, 0xfb, 0xe8, 0x7b, 0xd8, 0xdf, 0xdb, 0xdb, 0xff,
+  0x2c, 0xf8, 0x24, 0x4a, 0xfc, 0xff, 0x3c, 0xff, 0x1f, 0xef, 0x3c, 0x08,
+  0x76, 0x82, 0xa3, 0xff, 0x3a, 0xbe, 0x08, 0x36, 0xc3, 0x41, 0x40, 0x0a,
+  0x41, 0x91, 0x4d, 0x8a, 0x27, 0xc1, 0xf9, 0xf9, 0x28, 0x0a, 0x0e, 0x84,
+  0x92, 0x71, 0x88, 0x48, 0x1f, 0x3f, 0x78, 0xf0, 0x45, 0x76, 0xb5, 0x48,
+  0xd2, 0xab, 0x60, 0x3c, 0x7a, 0xfd, 0xfa, 0xf8, 0xe4, 0xe2, 0xec, 0xf8,
+  0x64, 0xfc, 0xdd, 0xf8, 0xf8, 0xe4, 0xe8, 0xd5, 0xdb, 0x17, 0xa3, 0x17,
+  0x0f, 0xbe, 0x40, 0x41, 0xd9, 0x22, 0x35, 0x84, 0xa2, 0xc8, 0x8b, 0xc9,
+  0x6c, 0x9d, 0xa4, 0xc1, 0xc1, 0x46, 0x04, 0x7e, 0x50, 0xde, 0xae, 0x52,
+  0x00, 0x4d, 0x96, 0xeb, 0xcb, 0x19, 0x8a, 0x3d, 0x9e, 0x87, 0xd1, 0x30,
+  0x41, 0x7f, 0x5f, 0xbf, 0x1e, 0x7f, 0x3f, 0x3a, 0xba, 0x38, 0x3d, 0x6b,
+  0x85, 0x83, 0xf6, 0x53, 0x4e, 0x37, 0x5b, 0x2e, 0xae, 0xc9, 0x3f, 0x84,
+  0x34, 0x33, 0x93, 0xca, 0x90, 0xe3, 0x75, 0x03, 0x50, 0x1d, 0x71, 0x1d,
+  0xf7, 0x26, 0x4a, 0xae, 0xfc, 0x40, 0x11, 0xa5, 0x45, 0xd0, 0x35, 0x52,
+  0xfc, 0xf5, 0x22, 0x4d, 0xd4, 0x28, 0x16, 0x89, 0x79, 0x14, 0xa4, 0x4a,
+  0x20, 0xee, 0x17, 0x16, 0xe2, 0x62, 0xba, 0xcc, 0x31, 0xd5, 0x70, 0xea,
+  0x23, 0x85, 0x40, 0x6e, 0x01, 0x9d, 0x4c, 0xe3, 0x1c, 0x88, 0xc2, 0xc1,
+  0x3b, 0x0b, 0x28, 0x85, 0x14, 0x88, 0x0b, 0x0f, 0x09, 0x04, 0x72, 0x5d,
+  0x46, 0xf0, 0xa2, 0x86, 0x02, 0xce, 0xbf, 0x7b, 0xfb, 0xf2, 0xe5, 0xab,
+  0x51, 0xd4, 0xda, 0x74, 0x82, 0xdb, 0x76, 0xd0, 0x6a, 0xb5, 0x36, 0xed,
+  0xe0, 0xe0, 0x20, 0x08, 0xdb, 0xc1, 0x87, 0xa0, 0x75, 0xdb, 0x6e, 0x3f,
+  0x78, 0x80, 0x01, 0x8e, 0x4f, 0x5e, 0x1d, 0x9f, 0x8c, 0x84, 0x32, 0x31,
+  0x1f, 0xa3, 0x22, 0x58, 0xb6, 0xe8, 0x87, 0xb8, 0xfd, 0xe0, 0xf7, 0x07,
+  0x01, 0xfa, 0xd1, 0xf7, 0x49, 0xf0, 0x2c, 0x88, 0x83, 0x83, 0xa0, 0x1b,
+  0x7c, 0x13, 0xec, 0xf6, 0xf7, 0xba, 0xbd, 0xbd, 0x7f, 0xfc, 0x63, 0x10,
+  0xed, 0xa3, 0x26, 0xab, 0xff, 0x8f, 0xc1, 0xd7, 0xdd, 0xe0, 0x49, 0x50,
+  0xff, 0xf8, 0x34, 0x78, 0xbc, 0x13, 0x44, 0xbf, 0xec, 0x45, 0x50, 0x5b,
+  0x00, 0x2b, 0xbb, 0x0a, 0x5a, 0x71, 0x70, 0xf8, 0x4c, 0x43, 0x1b, 0x7c,
+  0xf8, 0x00, 0xf8, 0xcf, 0xb4, 0xe0, 0x38, 0xec, 0xf3, 0x67, 0x20, 0x54,
+  0x40, 0x7f, 0x79, 0x5a, 0xae, 0xf3, 0x45, 0x10, 0x3f, 0x7d, 0x20, 0xbc,
+  0x21, 0xf0, 0x47, 0xc1, 0xa4, 0x1d, 0xec, 0x06, 0x93, 0xa7, 0x0f, 0xfe,
+  0x78, 0xf0, 0x00, 0xb1, 0x9f, 0xc4, 0x45, 0x59, 0xe0, 0xda, 0x2a, 0xa6,
+  0x9a, 0x94, 0xea, 0x00, 0x12, 0x0d, 0x04, 0xab, 0x64, 0xbc, 0x2a, 0x5a,
+  0xac, 0xaa, 0xc5, 0xed, 0xe0, 0x77, 0x8e, 0x48, 0x3e, 0xb6, 0xe3, 0xa7,
+  0xc1, 0x1f, 0x1a, 0x84, 0x4c, 0x84, 0x28, 0x32, 0xf4, 0xc5, 0x86, 0x92,
+  0x99, 0x60, 0x92, 0x0a, 0xa6, 0x18, 0xaf, 0x12, 0x4a, 0xae, 0x83, 0x48,
+  0x3c, 0x24, 0x29, 0x24, 0x49, 0x1a, 0x09, 0xc2, 0x41, 0x30, 0x42, 0xa5,
+  0x94, 0xac, 0x89, 0x52, 0x12, 0x15, 0x25, 0xb1, 0xa1, 0xd0, 0x14, 0x41,
+  0x5e, 0xd1, 0xa2, 0xb6, 0xca, 0xd3, 0x49, 0x56, 0x64, 0xcb, 0xc5, 0x93,
+  0xa0, 0x48, 0xcb, 0x0e, 0xaa, 0xff, 0x31, 0x52, 0xe7, 0x02, 0xd5, 0xc3,
+  0x72, 0x99, 0xa7, 0x86, 0xbc, 0x24, 0x4c, 0x11, 0xfd, 0x6f, 0x69, 0xbe,
+  0x04, 0x96, 0x37, 0xcb, 0x2c, 0x61, 0x65, 0x98, 0x91, 0xe4, 0xa8, 0x10,
+  0xff, 0x8e, 0x8a, 0xf0, 0x1f, 0x52, 0xa9, 0xc9, 0x71, 0x59, 0xb1, 0x40,
+  0x02, 0x1c, 0x95, 0x2d, 0x0d, 0x3b, 0x4c, 0xcc, 0xb4, 0xab, 0x87, 0x4f,
+  0xbb, 0x1d, 0x44, 0xd6, 0x94, 0x47, 0x2e, 0x32, 0xe9, 0x56, 0x4c, 0xc2,
+  0x8f, 0xc9, 0x24, 0x14, 0x98, 0xc4, 0x7a, 0xe0, 0xb8, 0x83, 0xaa, 0x5a,
+  0x53, 0xfd, 0x14, 0x1e, 0xa8, 0x7a, 0xad, 0xf3, 0x96, 0x8b, 0x6b, 0x3a,
+  0x14, 0x85, 0x35, 0xb3, 0x85, 0x42, 0x01, 0xa9, 0x99, 0x2c, 0x17, 0x45,
+  0xc9, 0xb4, 0xb5, 0xb3, 0x62, 0xec, 0x29, 0x93, 0x1d, 0x1a, 0xce, 0x62,
+  0xee, 0xb4, 0x57, 0x35, 0xb6, 0x80, 0xb4, 0x46, 0x50, 0x22, 0xac, 0x83,
+  0x6f, 0x51, 0xe7, 0x5b, 0x95, 0x6b, 0x41, 0x29, 0xe8, 0xbb, 0xad, 0x8a,
+  0x00, 0x56, 0xa8, 0x4b, 0x44, 0x0d, 0x0c, 0x53, 0x79, 0xa0, 0xe5, 0x5e,
+  0x68, 0x98, 0x6a, 0xf5, 0x63, 0xf8, 0x73, 0x27, 0x58, 0xfd, 0xd8, 0xfd,
+  0xd9, 0x89, 0x3a, 0xad, 0xaa, 0x70, 0x02, 0x59, 0xa9, 0x61, 0x10, 0x23,
+  0x34, 0x94, 0xd3, 0x3b, 0xab, 0xa7, 0x55, 0xcb, 0xec, 0x40, 0x9d, 0xf9,
+  0xa0, 0x76, 0x75, 0xa8, 0xb5, 0xec, 0xe3, 0xc5, 0x86, 0x69, 0x54, 0xce,
+  0x3f, 0x68, 0x0a, 0x48, 0xda, 0xa1, 0x01, 0x11, 0xea, 0xc0, 0xce, 0xaa,
+  0xc3, 0xc5, 0xe2, 0x25, 0x77, 0xa7, 0x25, 0x94, 0x16, 0xe8, 0xf5, 0xea,
+  0x05, 0x15, 0x60, 0x78, 0x91, 0x61, 0xa0, 0x0a, 0x49, 0x9e, 0xc6, 0xf3,
+  0x1a, 0x89, 0x4d, 0xac, 0xc2, 0x20, 0x16, 0xd2, 0xc3, 0x0e, 0x96, 0x03,
+  0x29, 0x43, 0xd5, 0xa9, 0x0c, 0x11, 0x1a, 0x93, 0x86, 0x30, 0x56, 0x44,
+  0x97, 0x2b, 0x92, 0x51, 0x6e, 0xb0, 0xdc, 0x03, 0x0c, 0x72, 0xfd, 0xa9,
+  0x3f, 0xe4, 0xd4, 0x06, 0x49, 0xd3, 0x18, 0x3a, 0x30, 0x66, 0x1e, 0x18,
+  0x44, 0x8e, 0x7a, 0x96, 0x55, 0xad, 0x0b, 0xd3, 0x96, 0x7e, 0x2c, 0x04,
+  0xbd, 0xd7, 0x4d, 0x59, 0x24, 0xe3, 0xab, 0x41, 0x5f, 0xdb, 0x9f, 0xeb,
+  0x92, 0x2a, 0x16, 0xef, 0xf9, 0xf2, 0x06, 0xe7, 0xa7, 0x50, 0xba, 0xd9,
+  0xe3, 0xa5, 0x50, 0xae, 0x2f, 0x31, 0x8c, 0x54, 0xb2, 0xb5, 0xbd, 0x60,
+  0x9c, 0x67, 0xe5, 0x74, 0x9e, 0x96, 0xd9, 0xc4, 0xda, 0xf9, 0xc5, 0x49,
+  0xa2, 0x54, 0x29, 0x89, 0x29, 0xe3, 0x83, 0x86, 0x48, 0x97, 0x36, 0xe1,
+  0x8b, 0xf5, 0xa5, 0x17, 0xcc, 0xae, 0x1d, 0x66, 0xbe, 0x56, 0x2b, 0xb8,
+  0x1e, 0x66, 0xc7, 0x0e, 0x93, 0x64, 0x37, 0x5e, 0x30, 0x8f, 0x09, 0x8c,
+  0x55, 0x39, 0xae, 0x1c, 0x79, 0xa4, 0xcb, 0x12, 0x9b, 0x9a, 0x5c, 0x80,
+  0xbb, 0x4d, 0x00, 0x41, 0x61, 0x2e, 0xc0, 0x9d, 0x26, 0x80, 0xa0, 0x3a,
+  0x17, 0xe0, 0x63, 0x6d, 0x29, 0x34, 0xa6, 0xf9, 0x5d, 0x5e, 0x4a, 0xb9,
+  0x51, 0xf5, 0xf6, 0x71, 0x31, 0x1f, 0x8f, 0x5b, 0x0f, 0x51, 0xc9, 0x5f,
+  0xaf, 0x8a, 0xa0, 0xf5, 0x65, 0xb7, 0xdd, 0xf9, 0xf2, 0x4b, 0x34, 0xb3,
+  0xed, 0xfe, 0xb4, 0xf8, 0xa9, 0x7c, 0xc8, 0x87, 0xed, 0xf0, 0x7b, 0xf8,
+  0xf5, 0xe5, 0x6d, 0x99, 0x06, 0xdd, 0xcd, 0x60, 0xd0, 0xe9, 0x6e, 0xba,
+  0x57, 0xe8, 0x9f, 0xbd, 0x10, 0xfd, 0x33, 0x21, 0xb4, 0x30, 0x69, 0x00,
+  0x46, 0xa8, 0xed, 0xc4, 0x00, 0x1d, 0xfc, 0x2f, 0x9b, 0x42, 0x70, 0x10,
+  0xca, 0x89, 0x30, 0xe9, 0x00, 0xc3, 0x87, 0x68, 0x12, 0xf2, 0x24, 0x78,
+  0x98, 0x3f, 0x6c, 0x7d, 0x85, 0x2a, 0x2b, 0x7a, 0x9a, 0xa7, 0xf3, 0x65,
+  0x7e, 0xfb, 0xb0, 0x2d, 0x8d, 0x3b, 0x62, 0xfb, 0x68, 0x06, 0x52, 0x68,
+  0x52, 0x9a, 0x3c, 0xb6, 0x10, 0x2b, 0x3a, 0x90, 0x09, 0xfa, 0xb9, 0x6c,
+  0xb7, 0xad, 0x5c, 0xd0, 0x7c, 0xdf, 0x58, 0xa8, 0x29, 0x93, 0x98, 0xb5,
+  0xb0, 0xe8, 0xcf, 0x01, 0xce, 0x23, 0x34, 0xf1, 0xc2, 0x6f, 0x4f, 0x48,
+  0x8e, 0x51, 0xaa, 0x90, 0xb5, 0xc3, 0x98, 0x2a, 0x24, 0x54, 0x21, 0xa1,
+  0x0a, 0x7f, 0x6e, 0x90, 0xf2, 0x79, 0xbc, 0x69, 0x22, 0xd3, 0xa1, 0x97,
+  0x4c, 0x87, 0x77, 0x94, 0x09, 0xe9, 0xc9, 0x91, 0x19, 0x7e, 0x7a, 0xf2,
+  0xd6, 0x40, 0x03, 0x6e, 0x66, 0x0d, 0x78, 0x71, 0x43, 0x13, 0x1a, 0x8f,
+  0x86, 0x8d, 0x4f, 0x92, 0x5a, 0xd5, 0xd4, 0x2d, 0xf8, 0xaa, 0x9a, 0xc7,
+  0x5d, 0x5a, 0x07, 0x6f, 0x88, 0xc7, 0x62, 0x59, 0x36, 0x62, 0xf3, 0xe7,
+  0x36, 0x7c, 0x96, 0xf9, 0xb6, 0x49, 0xf9, 0xe0, 0xcb, 0x62, 0xb3, 0x3d,
+  0x8f, 0x5f, 0x54, 0x1e, 0xfa, 0x5e, 0x76, 0xb2, 0x9c, 0xaf, 0x50, 0x4f,
+  0x5b, 0xa0, 0x61, 0xa8, 0xb5, 0x9b, 0x9d, 0xcc, 0x57, 0xe9, 0xbb, 0x46,
+  0xb2, 0xc4, 0xc1, 0x33, 0xd4, 0xcc, 0x5a, 0x93, 0x87, 0x40, 0x67, 0xcd,
+  0x32, 0x0a, 0x16, 0x63, 0xdc, 0x98, 0x69, 0x53, 0x4c, 0x0f, 0x41, 0xaf,
+  0x9b, 0x0a, 0x7a, 0xe8, 0x81, 0xd9, 0x54, 0xd0, 0x43, 0x0f, 0x41, 0x17,
+  0x8d, 0xf3, 0xe9, 0x73, 0x1f, 0xd4, 0x66, 0x19, 0x05, 0x15, 0x0a, 0x56,
+  0x3b, 0x3d, 0x73, 0x6c, 0xd1, 0x2c, 0xcb, 0x24, 0x74, 0x1f, 0xe1, 0x9b,
+  0x65, 0x9e, 0x08, 0xef, 0x91, 0x8b, 0x8b, 0x66, 0xd9, 0x28, 0xa1, 0x7b,
+  0x08, 0xbf, 0xcc, 0x1b, 0x36, 0x99, 0xb8, 0xe2, 0xa1, 0xb1, 0x00, 0x6a,
+  0xc8, 0x2e, 0x49, 0x1d, 0x74, 0xb1, 0x58, 0x2f, 0xb6, 0x60, 0x82, 0x57,
+  0x26, 0xa1, 0x29, 0xbb, 0x24, 0x05, 0xa8, 0x2d, 0x4f, 0x3f, 0x80, 0xdb,
+  0xd1, 0xeb, 0x37, 0xe3, 0xf3, 0x17, 0xad, 0x45, 0x3c, 0x4f, 0xdb, 0xc1,
+  0x4f, 0x5a, 0x09, 0x20, 0xec, 0x8b, 0x2f, 0xcc, 0x23, 0xb6, 0x9f, 0x1e,
+  0xfc, 0x8e, 0xfe, 0x6f, 0x1e, 0x80, 0xd0, 0xf8, 0x2b, 0xfc, 0x82, 0x85,
+  0xf8, 0xe9, 0x01, 0x4d, 0x2b, 0xe5, 0xce, 0x5b, 0xaf, 0xb6, 0xee, 0xf3,
+  0xac, 0xd4, 0x7f, 0x4e, 0xb5, 0x9f, 0xaf, 0xf5, 0xd4, 0xd7, 0x7a, 0xea,
+  0x85, 0x81, 0xe7, 0xc2, 0xc0, 0x74, 0x61, 0xe0, 0xba, 0x30, 0xb0, 0x5d,
+  0x18, 0xf8, 0xa2, 0xcc, 0xd4, 0x7e, 0xc7, 0xd9, 0xac, 0xac, 0x84, 0xe3,
+  0x8d, 0x03, 0x08, 0x5e, 0xce, 0x33, 0xd4, 0x70, 0x58, 0x46, 0xce, 0xc2,
+  0x2c, 0x10, 0x97, 0x2a, 0xcd, 0x6c, 0x50, 0x04, 0x9b, 0x99, 0x47, 0x94,
+  0x0a, 0xd8, 0x81, 0x1b, 0xcb, 0x3a, 0xaf, 0x94, 0xb0, 0xdc, 0x82, 0x5d,
+  0x7b, 0x0b, 0x76, 0xe8, 0xc6, 0xf2, 0x16, 0xec, 0xd0, 0x2d, 0xd8, 0xc2,
+  0x5f, 0xff, 0x9f, 0x57, 0x68, 0xd2, 0x84, 0x7f, 0xcd, 0xb3, 0x51, 0xce,
+  0xd4, 0x3a, 0x11, 0xce, 0x1e, 0x39, 0xb3, 0x34, 0x44, 0xa9, 0x44, 0x94,
+  0x6a, 0x89, 0xae, 0x25, 0xa4, 0x6b, 0x3d, 0xd2, 0xb5, 0x84, 0x74, 0xad,
+  0x47, 0x5a, 0xc8, 0x92, 0x93, 0x57, 0xd3, 0x1a, 0xf9, 0x74, 0x7d, 0x75,
+  0x35, 0x4b, 0xed, 0x83, 0x16, 0x4a, 0x64, 0x6a, 0xd9, 0x3a, 0x58, 0xfd,
+  0xd9, 0x7c, 0xae, 0x99, 0xe3, 0xb0, 0x05, 0xc3, 0xf8, 0x47, 0x14, 0x8e,
+  0x9a, 0x52, 0x58, 0x36, 0xbc, 0xfc, 0xb1, 0x05, 0x2f, 0x87, 0x87, 0xb0,
+  0xad, 0x04, 0x9f, 0xec, 0xf3, 0x9d, 0xf5, 0x62, 0x15, 0x4f, 0x7e, 0x9d,
+  0x2d, 0x3d, 0x1a, 0x56, 0x99, 0x63, 0x17, 0xf3, 0x72, 0x2c, 0x51, 0x12,
+  0xf4, 0x69, 0xd6, 0x18, 0x9d, 0xa4, 0x24, 0x24, 0xe8, 0xda, 0xc2, 0x08,
+  0xcd, 0xeb, 0x3c, 0x2e, 0x7e, 0x35, 0x4c, 0x7a, 0xf1, 0x2e, 0xe6, 0x0d,
+  0x9a, 0x10, 0xb0, 0x8e, 0x4c, 0xd9, 0x8e, 0xba, 0x21, 0x95, 0xba, 0x8b,
+  0x3b, 0x87, 0x1b, 0x32, 0x49, 0xeb, 0x92, 0xdd, 0x38, 0xbe, 0x3f, 0xb5,
+  0x5c, 0xdc, 0xa4, 0x39, 0xe4, 0xa4, 0x63, 0xd4, 0x79, 0x53, 0xa6, 0xab,
+  0xac, 0x17, 0xc9, 0xbb, 0x29, 0x95, 0x24, 0xfd, 0xa2, 0x92, 0x04, 0x3d,
+  0x2b, 0x92, 0x88, 0xe9, 0xbe, 0xc1, 0x5a, 0xbd, 0xf9, 0xd1, 0x9c, 0x69,
+  0x0a, 0xc3, 0xe2, 0x4e, 0x0c, 0x0b, 0x81, 0x21, 0xfc, 0x1b, 0xe1, 0x7f,
+  0x7b, 0x46, 0xe6, 0x19, 0xe3, 0xbe, 0x4a, 0xc6, 0x58, 0x00, 0xad, 0xe2,
+  0x81, 0x3b, 0xd9, 0x5a, 0x68, 0xa1, 0xbc, 0x6a, 0x8f, 0xf9, 0xf6, 0x25,
+  0x94, 0x99, 0x76, 0xa7, 0xfe, 0x35, 0x84, 0xaf, 0xdd, 0xfa, 0x36, 0x04,
+  0x9f, 0x1a, 0x98, 0x76, 0x39, 0xb8, 0x3c, 0x8d, 0x04, 0x22, 0x45, 0x97,
+  0x3e, 0x42, 0xc2, 0xef, 0xc4, 0x7a, 0x55, 0x48, 0x9c, 0xeb, 0x8c, 0x09,
+  0x2e, 0xae, 0xc3, 0xe4, 0xf1, 0x6a, 0x99, 0x23, 0xee, 0x48, 0x9e, 0xee,
+  0xd3, 0x20, 0x43, 0xa5, 0xae, 0x8f, 0xfe, 0x3c, 0x7a, 0x24, 0x6c, 0x9f,
+  0xfe, 0x98, 0xc1, 0x44, 0x56, 0x56, 0xd3, 0x15, 0xd4, 0xf1, 0x9f, 0xdb,
+  0x5b, 0xeb, 0xc7, 0x25, 0xa5, 0x45, 0x3d, 0xf4, 0x31, 0xaa, 0x1e, 0x7b,
+  0x3f, 0x37, 0x55, 0x97, 0x50, 0x70, 0x0c, 0xbb, 0xb9, 0x62, 0xa9, 0x24,
+  0x22, 0x54, 0x99, 0x63, 0x1f, 0x19, 0xde, 0x98, 0x77, 0x66, 0xeb, 0x2d,
+  0x56, 0xcc, 0xda, 0x14, 0x6d, 0xff, 0x86, 0x57, 0x96, 0x0b, 0xb9, 0x1c,
+  0x09, 0x03, 0x4b, 0x4d, 0x71, 0xb6, 0x40, 0xb9, 0xb1, 0x74, 0x6b, 0xd5,
+  0x82, 0x59, 0x85, 0x20, 0x91, 0x61, 0xb1, 0xbb, 0xc5, 0xa9, 0x5d, 0x72,
+  0xd5, 0x60, 0x7d, 0x71, 0xcd, 0xeb, 0xe9, 0xa2, 0x80, 0x05, 0xd7, 0xbe,
+  0xef, 0x72, 0xba, 0x25, 0x3b, 0x8b, 0x42, 0x3b, 0xc2, 0xb8, 0x03, 0x20,
+  0xb4, 0x95, 0x32, 0x24, 0xe4, 0x93, 0x84, 0xd7, 0x00, 0x6c, 0xd0, 0x57,
+  0xc0, 0x2a, 0xe5, 0x5a, 0x20, 0xa5, 0x91, 0x44, 0x95, 0xaf, 0x1b, 0xe5,
+  0x5d, 0x25, 0xab, 0xd1, 0x99, 0x08, 0x31, 0x11, 0x1f, 0x99, 0x70, 0x39,
+  0x71, 0x4f, 0x86, 0x52, 0x9b, 0x5e, 0xa7, 0x79, 0x93, 0x4d, 0xfb, 0x4c,
+  0xda, 0xb4, 0x27, 0x56, 0x0b, 0xf5, 0x7d, 0xfb, 0xac, 0xe1, 0xbe, 0x3d,
+  0x47, 0x85, 0xe6, 0x08, 0xc9, 0x5b, 0x15, 0x34, 0xbc, 0x7d, 0x2f, 0xbc,
+  0x75, 0xf5, 0x8c, 0x1a, 0x6d, 0xae, 0x4b, 0xdc, 0x50, 0x45, 0x84, 0x4c,
+  0x4f, 0x7b, 0x24, 0xf3, 0xd3, 0x88, 0xfe, 0x0d, 0xe9, 0xdf, 0xae, 0xb6,
+  0x49, 0x24, 0xfc, 0x3a, 0x98, 0x3c, 0xed, 0x6d, 0xd7, 0x4b, 0x50, 0x01,
+  0xc2, 0x41, 0x8b, 0x58, 0x2b, 0xa5, 0xfb, 0x1d, 0x6a, 0xb7, 0x94, 0x0e,
+  0xf8, 0xd3, 0x1e, 0x7f, 0xea, 0x77, 0xa4, 0xd5, 0x74, 0xfd, 0x8f, 0xd2,
+  0xf6, 0x78, 0xac, 0x88, 0x3f, 0x85, 0xfc, 0x49, 0x4c, 0x12, 0x98, 0x53,
+  0xe9, 0x92, 0xd4, 0x01, 0x86, 0x98, 0x3d, 0x08, 0x93, 0xee, 0xdf, 0x29,
+  0x89, 0xc3, 0x16, 0xb6, 0x86, 0x4a, 0x43, 0x04, 0x47, 0x9f, 0xfa, 0xfc,
+  0xa9, 0xc7, 0x9f, 0x22, 0x8f, 0x14, 0x52, 0xd2, 0x90, 0x47, 0xea, 0xb2,
+  0xa7, 0x7f, 0xb0, 0x87, 0xa1, 0x37, 0xcc, 0x3e, 0x8b, 0x32, 0x60, 0x0f,
+  0x5c, 0x40, 0x1f, 0x6d, 0x13, 0x4a, 0x2e, 0x7f, 0xc4, 0x65, 0x62, 0x0f,
+  0xa2, 0xa2, 0xb1, 0x8d, 0x99, 0x8f, 0xa6, 0x75, 0x8c, 0x51, 0x9a, 0x70,
+  0x02, 0x71, 0x72, 0x71, 0xea, 0x41, 0x5b, 0x44, 0x79, 0x58, 0x97, 0x48,
+  0xb5, 0x5b, 0xe7, 0x50, 0x2e, 0x56, 0x83, 0xae, 0x52, 0xfc, 0x59, 0x75,
+  0xe8, 0xe9, 0xa7, 0x19, 0x34, 0x2a, 0x4e, 0x45, 0x44, 0x53, 0xd5, 0xb5,
+  0x8f, 0x13, 0x19, 0xc7, 0xaa, 0xdc, 0x77, 0x35, 0x65, 0xb4, 0x2a, 0xb7,
+  0x3d, 0x9f, 0x72, 0x5f, 0x55, 0x92, 0x7a, 0xc5, 0xa9, 0x2a, 0xd3, 0xbe,
+  0x39, 0x11, 0x48, 0x1a, 0x28, 0x0e, 0x38, 0x0b, 0xf6, 0x68, 0x96, 0x6c,
+  0x91, 0x28, 0x56, 0xd2, 0xbb, 0xb5, 0xb2, 0xc0, 0x4b, 0x87, 0x57, 0x7a,
+  0x58, 0x21, 0x54, 0x8b, 0x25, 0x2f, 0xa8, 0xda, 0x62, 0xa2, 0x47, 0x19,
+  0xd6, 0x6a, 0x48, 0x55, 0x69, 0x50, 0x51, 0xf2, 0xc6, 0x09, 0x23, 0x4d,
+  0x9d, 0xad, 0xea, 0xf1, 0x9e, 0x59, 0xb9, 0xc3, 0x16, 0xae, 0xfa, 0xb4,
+  0xa4, 0xf6, 0x78, 0xe9, 0x0d, 0x59, 0x89, 0x86, 0xa2, 0x6d, 0xa9, 0xb6,
+  0x77, 0xcc, 0x99, 0xb0, 0xde, 0xab, 0x68, 0x46, 0x83, 0x8c, 0x08, 0xcc,
+  0xa9, 0x0c, 0x23, 0x4b, 0x19, 0x91, 0x56, 0x19, 0x03, 0x14, 0x0a, 0x05,
+  0x24, 0xf2, 0x9f, 0x17, 0x1e, 0xaf, 0x10, 0x06, 0x44, 0x14, 0x5e, 0x21,
+  0x8a, 0xff, 0xd5, 0x27, 0xc3, 0x3a, 0x78, 0x5a, 0x34, 0x63, 0x5b, 0x36,
+  0xe9, 0xf1, 0x4d, 0xff, 0xd9, 0x15, 0x4f, 0xcc, 0xae, 0xf0, 0x00, 0x41,
+  0xb4, 0xe8, 0xca, 0x34, 0x26, 0x5f, 0x26, 0x0b, 0x2f, 0x1c, 0x5b, 0x01,
+  0x93, 0xc9, 0x92, 0xe4, 0x9d, 0x81, 0xcc, 0x2a, 0xd7, 0x8c, 0x64, 0xb6,
+  0x4b, 0x30, 0xa5, 0x64, 0xa0, 0x92, 0xca, 0xac, 0xd3, 0xaa, 0x92, 0xb4,
+  0xd3, 0x5e, 0xb9, 0xf5, 0xb0, 0x26, 0x63, 0x6a, 0x12, 0x17, 0x5b, 0xc7,
+  0xfc, 0xb5, 0xbc, 0x50, 0xe1, 0xf3, 0xe4, 0x85, 0x28, 0xbb, 0x64, 0x36,
+  0x55, 0x31, 0x84, 0x52, 0xad, 0x65, 0xa5, 0x9a, 0x3f, 0x09, 0x36, 0xab,
+  0x99, 0x60, 0xda, 0x23, 0xac, 0x3a, 0xec, 0x58, 0xcd, 0xb1, 0xaa, 0x8c,
+  0x13, 0x00, 0x75, 0x46, 0x59, 0x7a, 0x42, 0xab, 0xcd, 0x11, 0xc9, 0x60,
+  0xbb, 0x70, 0x2d, 0x49, 0xb5, 0xcc, 0x10, 0xc9, 0x9e, 0x6a, 0x9a, 0x95,
+  0x54, 0xb1, 0x1f, 0x13, 0x15, 0x65, 0x85, 0x0d, 0x95, 0xe6, 0x0a, 0x2c,
+  0x01, 0xf0, 0x05, 0x9c, 0xb6, 0x03, 0x99, 0x2a, 0x8f, 0xb6, 0x54, 0x00,
+  0xcc, 0x5b, 0x2c, 0x9a, 0x33, 0x66, 0xcb, 0x2d, 0x1a, 0x17, 0xa5, 0x55,
+  0x48, 0xcf, 0x4a, 0x1c, 0x8c, 0x2b, 0x38, 0x7a, 0x20, 0x58, 0x8b, 0x83,
+  0x35, 0xb9, 0xb5, 0x52, 0x5c, 0xe2, 0x2a, 0x91, 0x40, 0x42, 0xbb, 0x91,
+  0xaa, 0xa8, 0xb2, 0x21, 0x13, 0x5b, 0xb0, 0x82, 0x97, 0x36, 0x8a, 0x34,
+  0x17, 0xdf, 0x21, 0xa6, 0x73, 0x21, 0x25, 0x1c, 0x28, 0x2b, 0x29, 0x60,
+  0xd3, 0x3e, 0x87, 0xd5, 0x14, 0x58, 0xda, 0x93, 0x3a, 0x9d, 0x15, 0x59,
+  0x63, 0xb9, 0x41, 0x7f, 0x5c, 0x6b, 0x27, 0x64, 0xf2, 0x88, 0x93, 0x64,
+  0xef, 0x05, 0x78, 0xf5, 0xb2, 0xf7, 0x02, 0x7c, 0x6a, 0x86, 0x21, 0xbd,
+  0x7a, 0x2a, 0x2d, 0xa6, 0xb8, 0x68, 0x81, 0x6d, 0xb9, 0x85, 0xb5, 0x06,
+  0xc5, 0x9a, 0x5b, 0x2e, 0x46, 0xce, 0x05, 0x07, 0x8a, 0x26, 0xd4, 0x2a,
+  0x3f, 0x03, 0xbb, 0xac, 0xda, 0xf6, 0x92, 0x2b, 0x65, 0x2c, 0x98, 0xa1,
+  0x76, 0x1d, 0xb3, 0x62, 0x32, 0x8b, 0xe5, 0xcd, 0x80, 0xa4, 0xad, 0x3a,
+  0x31, 0x93, 0x74, 0x53, 0xff, 0x24, 0x4f, 0x7c, 0x9d, 0x76, 0x7a, 0x44,
+  0x78, 0x30, 0x45, 0xc3, 0x1d, 0xa4, 0xa6, 0xf4, 0x6a, 0xf6, 0x18, 0x33,
+  0x6c, 0xcc, 0x40, 0x8b, 0x6c, 0xf0, 0xa8, 0x2a, 0xaf, 0xa6, 0xfd, 0x52,
+  0x89, 0x0b, 0xea, 0xe7, 0x1b, 0xb1, 0x41, 0x53, 0x38, 0xce, 0x05, 0x9e,
+  0xbd, 0x98, 0x88, 0x65, 0xc2, 0x87, 0x09, 0x2e, 0x27, 0x94, 0x09, 0x3c,
+  0x7b, 0x31, 0x11, 0xf3, 0x5a, 0xcf, 0xc4, 0x62, 0xda, 0x48, 0x47, 0x2f,
+  0xeb, 0xcb, 0xed, 0x35, 0xbf, 0xeb, 0xab, 0x79, 0xca, 0x65, 0x3b, 0xcd,
+  0xef, 0x7a, 0x6a, 0x9e, 0x32, 0xd9, 0x4e, 0xf3, 0xbb, 0x9e, 0x9a, 0xa7,
+  0x4c, 0x7c, 0x34, 0x6f, 0xb4, 0x06, 0xa5, 0x15, 0x76, 0x3d, 0x9b, 0x2d,
+  0xb7, 0xd7, 0xca, 0x8e, 0xa2, 0x15, 0x79, 0x73, 0xfd, 0xfc, 0xf9, 0xc5,
+  0xdb, 0xb3, 0xe7, 0x17, 0x23, 0xbc, 0xbd, 0xde, 0x09, 0x6e, 0xca, 0x4e,
+  0xb0, 0xe8, 0x04, 0xef, 0xf1, 0x2a, 0x54, 0x27, 0x98, 0x66, 0x9d, 0x60,
+  0xb9, 0xd2, 0xef, 0xba, 0x67, 0x78, 0xd7, 0xdc, 0x20, 0x51, 0xb5, 0xe1,
+  0x7e, 0x53, 0x06, 0x1b, 0xe8, 0x29, 0x6e, 0x4a, 0xe8, 0x34, 0x6e, 0xe9,
+  0xe3, 0xe5, 0x53, 0x1a, 0xfc, 0xbe, 0x0c, 0x4a, 0xf6, 0x4c, 0xba, 0x0e,
+  0xfa, 0xa2, 0x76, 0x1e, 0x0b, 0xd2, 0x77, 0x04, 0x0c, 0x17, 0x7e, 0x25,
+  0xa0, 0xbd, 0x2f, 0xdb, 0x1b, 0xe8, 0x2d, 0x96, 0x2b, 0xfc, 0x7c, 0x0b,
+  0x5d, 0x86, 0x40, 0xb3, 0x21, 0x3d, 0x49, 0x89, 0x20, 0x66, 0xcb, 0xe0,
+  0x1b, 0xf8, 0xe7, 0x09, 0x7a, 0x3b, 0x44, 0x69, 0x43, 0x6f, 0xe8, 0x9f,
+  0x27, 0x95, 0x00, 0x7f, 0xc8, 0x46, 0x02, 0x5c, 0x9b, 0x1b, 0xc1, 0x1e,
+  0x80, 0x2b, 0x8c, 0x56, 0x2f, 0xbc, 0x70, 0x3f, 0xec, 0xd0, 0x6e, 0xb2,
+  0xe8, 0xa0, 0x5e, 0x0e, 0x77, 0xee, 0x9d, 0x60, 0x17, 0xc5, 0x45, 0xaf,
+  0x11, 0x9a, 0x33, 0x3d, 0x6a, 0x5b, 0x22, 0x43, 0x04, 0x92, 0x43, 0x9d,
+  0x60, 0xc8, 0xe2, 0xf6, 0xa2, 0xfd, 0x01, 0x7a, 0x81, 0x3f, 0x8e, 0xf8,
+  0x6b, 0xce, 0x7c, 0x2d, 0x30, 0x47, 0x5d, 0x52, 0xb4, 0xb7, 0xe7, 0x88,
+  0xc9, 0x39, 0xaf, 0x2b, 0xce, 0x28, 0xe2, 0x60, 0x6f, 0xaf, 0x67, 0x8a,
+  0x8a, 0x8a, 0xb5, 0x57, 0x8a, 0x77, 0x6d, 0x91, 0x3d, 0x52, 0x6c, 0x8b,
+  0x6f, 0x4f, 0xb1, 0x35, 0xa6, 0x3d, 0xc5, 0x28, 0xaa, 0x5c, 0x3b, 0x46,
+  0xaf, 0x46, 0xaf, 0x47, 0x27, 0x17, 0xff, 0x3a, 0x3e, 0x57, 0x2a, 0x48,
+  0xba, 0x59, 0xe5, 0x7f, 0x65, 0xb5, 0xf0, 0xaa, 0x0a, 0xb5, 0x42, 0xde,
+  0xc2, 0x62, 0x3d, 0xf5, 0x28, 0xc5, 0x62, 0xc2, 0x68, 0x1b, 0x33, 0xcd,
+  0x34, 0x59, 0xd3, 0xc2, 0xfb, 0x20, 0x18, 0x7e, 0x27, 0x80, 0xaa, 0xd5,
+  0xc6, 0x1b, 0xd7, 0x83, 0xb6, 0x1d, 0x46, 0xd5, 0x73, 0xab, 0xc5, 0x8e,
+  0x63, 0xfa, 0x63, 0xc5, 0x37, 0xd7, 0xba, 0xbc, 0x6e, 0x61, 0x80, 0x47,
+  0x18, 0x00, 0xfd, 0x09, 0x09, 0x88, 0x1d, 0x43, 0x95, 0xa6, 0x09, 0x04,
+  0xd8, 0xd1, 0x6a, 0xc4, 0xd8, 0x90, 0x61, 0x2b, 0x86, 0xf8, 0x86, 0xbc,
+  0x3d, 0x21, 0x89, 0x32, 0xc0, 0xc4, 0x1b, 0x23, 0xcc, 0x61, 0x03, 0x18,
+  0x2c, 0x8d, 0x9a, 0x4b, 0xdb, 0x09, 0xa3, 0x45, 0xd1, 0xcb, 0x62, 0xeb,
+  0x9b, 0x20, 0x59, 0xa6, 0xae, 0x54, 0x5c, 0xb1, 0x5f, 0x93, 0x02, 0x4f,
+  0x9e, 0x79, 0xa1, 0xa7, 0xaf, 0x97, 0x4f, 0x2b, 0xb3, 0x80, 0x35, 0xdb,
+  0xed, 0xac, 0x1f, 0x65, 0x46, 0xa5, 0xa7, 0x4b, 0x4a, 0x4f, 0xf7, 0x67,
+  0xcd, 0x2a, 0x95, 0x3e, 0x46, 0x44, 0x62, 0x44, 0x8d, 0x37, 0x45, 0x69,
+  0x12, 0x1d, 0xa3, 0x41, 0x79, 0x09, 0x9f, 0xa5, 0x11, 0xf7, 0xbd, 0x55,
+  0x1a, 0x71, 0xf7, 0xfb, 0xb4, 0x52, 0xc6, 0x1d, 0xf6, 0x9d, 0x51, 0x82,
+  0x76, 0x68, 0x15, 0xc2, 0x0f, 0x8f, 0xc8, 0x97, 0x47, 0x21, 0xff, 0xf6,
+  0x48, 0x31, 0x14, 0xf7, 0x5d, 0x81, 0x8e, 0x13, 0x5c, 0x44, 0x5d, 0xc9,
+  0xc4, 0x07, 0xa9, 0x37, 0xd5, 0xec, 0x4f, 0xca, 0x4c, 0xfc, 0x2e, 0xe6,
+  0x66, 0x6d, 0x07, 0xaa, 0xc9, 0x04, 0x11, 0x25, 0x19, 0xea, 0x66, 0x0f,
+  0x9f, 0x2f, 0xd1, 0x94, 0xcf, 0x5d, 0xf2, 0x46, 0x8a, 0x29, 0x7a, 0xdb,
+  0xe0, 0xf9, 0xa2, 0x39, 0xe9, 0xe2, 0x8c, 0x63, 0xb6, 0xbc, 0x76, 0x4d,
+  0x36, 0x16, 0x89, 0x79, 0xae, 0x2c, 0x0f, 0xe1, 0xbe, 0xb2, 0x0f, 0xe1,
+  0xa8, 0x31, 0xb9, 0x17, 0xd8, 0x9f, 0x4e, 0xb4, 0x65, 0xee, 0x2b, 0xd6,
+  0x07, 0x3b, 0xd0, 0xc6, 0x1f, 0xe9, 0x17, 0x7a, 0x46, 0x48, 0xd4, 0xa0,
+  0xdb, 0xea, 0x3b, 0x63, 0xb6, 0xa1, 0xe9, 0xbb, 0xed, 0x26, 0x0f, 0x45,
+  0x1b, 0xdb, 0xa1, 0xf2, 0x37, 0xfb, 0x98, 0x9b, 0x33, 0xda, 0x6e, 0xa4,
+  0xfc, 0xec, 0x99, 0xe7, 0x04, 0x82, 0xf3, 0xd9, 0x6e, 0x0a, 0xf1, 0xec,
+  0x99, 0xe7, 0x1c, 0x82, 0x18, 0x8c, 0x6f, 0xad, 0xb8, 0xc3, 0x06, 0x7a,
+  0xbb, 0x2e, 0xb7, 0xd7, 0xdb, 0xa1, 0xbf, 0xda, 0xae, 0xcb, 0xed, 0xd5,
+  0x76, 0xe8, 0xaf, 0xb5, 0xd9, 0x1d, 0xb4, 0x76, 0xd0, 0x40, 0x6b, 0xb3,
+  0x3b, 0x68, 0xed, 0xc0, 0x5f, 0x6b, 0xb3, 0x3b, 0x68, 0xed, 0x40, 0xd1,
+  0x9a, 0x6c, 0x6e, 0x30, 0xcd, 0xae, 0xa8, 0x8b, 0x07, 0x79, 0x56, 0xf8,
+  0xdd, 0xf1, 0xcb, 0x0b, 0x79, 0xc4, 0x7b, 0x99, 0x95, 0x05, 0x4c, 0x06,
+  0x3b, 0xc1, 0x55, 0x36, 0x9b, 0xd9, 0xc6, 0xbe, 0x5f, 0x7c, 0x91, 0x8d,
+  0xbf, 0xf8, 0xe2, 0xa6, 0x14, 0xa5, 0x85, 0x46, 0x7f, 0xb2, 0x5c, 0xa3,
+  0xb1, 0xa4, 0x61, 0x0c, 0xac, 0x1d, 0xf8, 0xc2, 0xfa, 0x60, 0x35, 0x72,
+  0xc4, 0xf1, 0xb1, 0x09, 0x2c, 0x12, 0x45, 0x1c, 0xfd, 0xd6, 0x53, 0xbf,
+  0xc1, 0xb3, 0x41, 0xa0, 0x43, 0x9d, 0x42, 0xd8, 0x6e, 0xc3, 0x2b, 0x16,
+  0xdb, 0x34, 0x36, 0x26, 0x31, 0x88, 0x84, 0x78, 0x98, 0x6c, 0x4d, 0x5f,
+  0x2d, 0x79, 0xec, 0xb1, 0x96, 0x44, 0xca, 0x47, 0x52, 0x0b, 0xa2, 0xaf,
+  0x64, 0xd7, 0x0d, 0x59, 0x30, 0x0a, 0x35, 0x1d, 0x86, 0x24, 0x7c, 0x43,
+  0xfe, 0x3c, 0x21, 0x46, 0x49, 0x2c, 0x54, 0x34, 0x52, 0x27, 0xf9, 0x85,
+  0x3b, 0xf1, 0xd9, 0x4c, 0x1a, 0xeb, 0xc2, 0x18, 0xef, 0xe0, 0xa0, 0xc3,
+  0x87, 0xb7, 0x75, 0x4a, 0x34, 0xfc, 0xea, 0x04, 0x7d, 0x98, 0x78, 0xb9,
+  0x28, 0xd1, 0xd0, 0x0c, 0xcd, 0xb1, 0xd0, 0x6c, 0xa9, 0x6f, 0xa4, 0xcc,
+  0xeb, 0xdc, 0x0f, 0x0f, 0x6d, 0x94, 0x22, 0x77, 0x3b, 0xa5, 0xc8, 0xdd,
+  0x44, 0x19, 0x4b, 0x03, 0x5a, 0xc6, 0xbd, 0x6b, 0xa4, 0x44, 0xd5, 0x42,
+  0xe2, 0xde, 0x6d, 0x2b, 0xdb, 0x23, 0xb3, 0x19, 0x9d, 0x15, 0x55, 0xaf,
+  0x24, 0x79, 0x5a, 0xb2, 0x5e, 0x24, 0x91, 0xa1, 0xb4, 0x69, 0xc9, 0x06,
+  0x7d, 0x89, 0x0c, 0x25, 0x4c, 0x26, 0xcb, 0x65, 0xa6, 0xb9, 0x81, 0x69,
+  0x2e, 0x33, 0xcd, 0x0d, 0x4c, 0x73, 0x99, 0x69, 0x6e, 0x62, 0x1a, 0xcb,
+  0x4c, 0x63, 0xca, 0x34, 0xd3, 0x92, 0x71, 0xa6, 0x31, 0x65, 0x9a, 0xa9,
+  0x29, 0x95, 0xd5, 0x66, 0xd0, 0x9a, 0xac, 0x34, 0x83, 0xce, 0x64, 0x95,
+  0x19, 0x34, 0x26, 0x2b, 0xcc, 0xa0, 0x2f, 0x59, 0x5d, 0x06, 0x6d, 0xc9,
+  0xca, 0x32, 0xe8, 0x4a, 0x56, 0x95, 0x41, 0x53, 0xb2, 0xa2, 0x98, 0x9e,
+  0xcc, 0xe3, 0x6f, 0x28, 0x0f, 0xb5, 0xe1, 0x98, 0x62, 0x5c, 0x6e, 0x1a,
+  0x7f, 0x7b, 0x0c, 0xb2, 0x89, 0x09, 0x7a, 0x77, 0x73, 0x75, 0x65, 0x1e,
+  0x6d, 0x93, 0x09, 0x46, 0x86, 0x5a, 0x4d, 0x44, 0xbd, 0xdd, 0x2c, 0x22,
+  0xff, 0x6b, 0x53, 0x81, 0xa7, 0x0a, 0x8f, 0x82, 0x56, 0x95, 0x9a, 0xb6,
+  0x23, 0x2d, 0x8f, 0x9c, 0x69, 0x11, 0xf3, 0xed, 0xb2, 0xca, 0x06, 0x25,
+  0x57, 0x14, 0xb2, 0x5c, 0x26, 0xe3, 0xaf, 0x72, 0x0f, 0x0b, 0xe6, 0xf5,
+  0x9d, 0x80, 0x98, 0xd9, 0x13, 0x9b, 0x3e, 0x72, 0x9a, 0xa0, 0xde, 0xe7,
+  0xbe, 0x79, 0x7e, 0xf4, 0xdf, 0x72, 0x97, 0x9b, 0xf3, 0x55, 0xd8, 0xbf,
+  0x72, 0xa9, 0x29, 0x2f, 0xd1, 0x5c, 0x54, 0xec, 0x7d, 0x3b, 0xd5, 0x82,
+  0xa8, 0x3a, 0x41, 0x8b, 0xd0, 0x14, 0xd3, 0xb4, 0x10, 0x8b, 0x57, 0xa6,
+  0xa4, 0x85, 0x03, 0x54, 0x8a, 0x16, 0xd2, 0x5a, 0x6c, 0xfe, 0x11, 0xd6,
+  0x62, 0x73, 0xa1, 0xdb, 0xc3, 0x2a, 0x03, 0xed, 0x83, 0x76, 0x75, 0x2b,
+  0x8b, 0x7c, 0x89, 0x92, 0xaf, 0x4c, 0xb6, 0x35, 0x31, 0xd7, 0xe6, 0xa8,
+  0x6b, 0xb6, 0xae, 0xa8, 0x8b, 0x47, 0x6d, 0xb6, 0xa5, 0x9e, 0x84, 0x21,
+  0x48, 0xcb, 0x99, 0xea, 0xb2, 0xe2, 0xdb, 0x93, 0x7a, 0x66, 0x5f, 0xc6,
+  0x85, 0xe1, 0x78, 0xdb, 0xdd, 0xb2, 0xb9, 0xa3, 0xe4, 0xae, 0x71, 0x51,
+  0x31, 0x78, 0x1c, 0x44, 0x9a, 0xac, 0xcd, 0x7f, 0x84, 0x4c, 0xa7, 0x95,
+  0x09, 0x84, 0x84, 0xfa, 0xa4, 0xe4, 0x2a, 0xa6, 0x80, 0x95, 0x34, 0xa0,
+  0xba, 0xad, 0x53, 0xf9, 0xe4, 0x25, 0xd5, 0x09, 0xe8, 0x96, 0x1f, 0x79,
+  0x11, 0xd7, 0x99, 0x33, 0xd2, 0x9f, 0xb3, 0xbe, 0xbc, 0x46, 0x4e, 0x96,
+  0x2f, 0x55, 0xf2, 0xa1, 0x89, 0x9c, 0xed, 0xa8, 0x48, 0x79, 0xee, 0x00,
+  0x57, 0xa8, 0xfb, 0x76, 0x6c, 0xa5, 0x60, 0x38, 0xb0, 0x15, 0xea, 0xc8,
+  0x8e, 0x3d, 0xe8, 0xd3, 0x21, 0x51, 0x86, 0x87, 0x44, 0x0e, 0x6c, 0x85,
+  0x3a, 0xb4, 0xac, 0xe7, 0xb1, 0xb3, 0x4e, 0xb5, 0xe9, 0x46, 0xbd, 0x01,
+  0x87, 0x45, 0xac, 0x6a, 0x45, 0x0f, 0xaf, 0x76, 0xd1, 0x35, 0xad, 0x9c,
+  0xd8, 0x57, 0x6f, 0xe8, 0xa1, 0xa7, 0x1e, 0x6b, 0x7b, 0xc9, 0x06, 0xf3,
+  0x86, 0x9f, 0x7f, 0x8a, 0xda, 0x52, 0x68, 0x24, 0x87, 0xf6, 0xe5, 0xd0,
+  0x9e, 0x1c, 0x3a, 0x90, 0x42, 0x9b, 0xf5, 0x50, 0x24, 0x8d, 0xba, 0x3d,
+  0xb5, 0x7a, 0x2a, 0x35, 0x6b, 0x7a, 0xd0, 0x49, 0x6d, 0xfe, 0x37, 0xa5,
+  0x94, 0x95, 0xde, 0xbb, 0xa5, 0xb4, 0x4f, 0xc4, 0xea, 0x57, 0x9d, 0x6f,
+  0xaf, 0xcd, 0x65, 0xde, 0x13, 0x02, 0xe5, 0x44, 0x57, 0x34, 0x03, 0x0d,
+  0x4d, 0x5f, 0xa1, 0xd9, 0xd7, 0xd0, 0x0c, 0x64, 0x1a, 0xa7, 0x06, 0x98,
+  0xe1, 0x45, 0xba, 0x29, 0xf3, 0x78, 0xa2, 0x99, 0xa1, 0xeb, 0xcf, 0xeb,
+  0xd1, 0xa9, 0xf9, 0x1a, 0xac, 0x30, 0x48, 0xfa, 0xf6, 0xed, 0xb6, 0x27,
+  0xd9, 0xa2, 0x48, 0x73, 0x03, 0x7c, 0xfd, 0x54, 0xa0, 0x4e, 0xc3, 0x24,
+  0x45, 0x1b, 0xce, 0x0e, 0x1f, 0x4a, 0x30, 0xec, 0xdd, 0x98, 0x52, 0xc9,
+  0x8f, 0xd9, 0xc9, 0x0b, 0x1e, 0xf2, 0x48, 0xab, 0x10, 0x47, 0x5a, 0x05,
+  0x63, 0x4c, 0x7b, 0xfb, 0x1c, 0x77, 0x02, 0x9e, 0x0b, 0xb2, 0xc1, 0x87,
+  0x67, 0x74, 0xff, 0x84, 0x1d, 0xc7, 0xcb, 0x34, 0xa6, 0xfe, 0xd8, 0x79,
+  0xe4, 0x64, 0x9a, 0xe2, 0x11, 0x0f, 0x71, 0x25, 0x13, 0x2c, 0xf3, 0x24,
+  0xcd, 0x33, 0xb0, 0x5d, 0x7a, 0x6c, 0xb0, 0x50, 0x9a, 0xcc, 0xae, 0x66,
+  0xeb, 0x62, 0xaa, 0xb7, 0x98, 0xa3, 0x6e, 0x72, 0x20, 0x41, 0xcb, 0x59,
+  0x5c, 0xc2, 0x39, 0xd2, 0x71, 0xeb, 0x21, 0x8d, 0x12, 0x7c, 0xd9, 0xa5,
+  0x1e, 0x6c, 0xe6, 0x0f, 0x5b, 0xcc, 0x7a, 0x8e, 0xd8, 0x31, 0xb5, 0x57,
+  0x1a, 0x87, 0x32, 0x9c, 0xe5, 0xec, 0x2a, 0x5d, 0x4c, 0x52, 0xe5, 0xe0,
+  0x84, 0x8e, 0x11, 0x21, 0x24, 0x4c, 0x24, 0xf7, 0x38, 0x46, 0x73, 0x2b,
+  0x5f, 0xe4, 0x79, 0x53, 0xe4, 0x55, 0xbc, 0x2e, 0x7c, 0x80, 0x31, 0x1d,
+  0x05, 0xfa, 0x22, 0x5d, 0x24, 0xd9, 0x15, 0xb8, 0x07, 0xd2, 0xba, 0xd4,
+  0x85, 0x3c, 0xb9, 0x83, 0xff, 0x5f, 0xea, 0xff, 0x79, 0xf1, 0xf7, 0xf9,
+  0x7f, 0xee, 0x46, 0x7b, 0xfb, 0xfb, 0xdc, 0xff, 0x77, 0x77, 0x6f, 0x80,
+  0xfd, 0x3f, 0x0f, 0xee, 0xfd, 0x3f, 0x7f, 0x92, 0x9f, 0xdd, 0xff, 0x73,
+  0xff, 0xeb, 0x28, 0x38, 0x58, 0x98, 0x3d, 0x40, 0x9f, 0x58, 0x3d, 0x40,
+  0x6b, 0x43, 0x05, 0x0f, 0xd0, 0x85, 0xe4, 0x01, 0xda, 0xb9, 0xf4, 0x6c,
+  0xb2, 0xc7, 0x51, 0xfa, 0x02, 0xbe, 0x2e, 0x48, 0x7d, 0x77, 0xd0, 0x46,
+  0xed, 0xe8, 0xec, 0x08, 0x0d, 0xec, 0x8f, 0x82, 0xd6, 0x51, 0x8c, 0x72,
+  0xfc, 0x7a, 0xb1, 0x9c, 0x65, 0x6d, 0xbc, 0x34, 0x1a, 0x5c, 0xde, 0xe2,
+  0x3f, 0x28, 0x61, 0xa2, 0x08, 0x8a, 0x67, 0x65, 0x10, 0x24, 0x9f, 0xf4,
+  0xa2, 0x49, 0x4b, 0x0a, 0x40, 0xdf, 0x3a, 0x3a, 0xbf, 0xcd, 0x37, 0xb4,
+  0x2f, 0xb9, 0x2d, 0xd3, 0x82, 0x09, 0x68, 0xd9, 0x3d, 0xc3, 0x74, 0x28,
+  0x1f, 0x86, 0xb8, 0xcd, 0x46, 0x13, 0x0b, 0xd4, 0x79, 0x3e, 0x83, 0xd1,
+  0x1e, 0x6b, 0xbc, 0x11, 0x1f, 0xe8, 0x05, 0xe0, 0xcf, 0x2f, 0x81, 0x24,
+  0x42, 0xbb, 0x75, 0x03, 0x47, 0xd1, 0xdb, 0xf8, 0x40, 0xba, 0xb4, 0xaf,
+  0xfa, 0x0d, 0xa1, 0x27, 0xa7, 0xd5, 0x7f, 0x41, 0xf3, 0xed, 0x61, 0x74,
+  0x35, 0xe8, 0x5d, 0xee, 0x0f, 0x51, 0x5b, 0xc5, 0x02, 0xa4, 0x0e, 0x00,
+  0x7d, 0xac, 0x35, 0x5d, 0xb2, 0x1a, 0x98, 0x16, 0xc6, 0xeb, 0xa1, 0x4d,
+  0x0f, 0xb8, 0xf9, 0xbe, 0x51, 0x0d, 0xa6, 0x05, 0x1d, 0x62, 0xf2, 0x1b,
+  0x18, 0xcf, 0x7a, 0x33, 0x44, 0x1d, 0xb5, 0x85, 0x23, 0x31, 0xfa, 0xf7,
+  0x61, 0x19, 0xf9, 0xb3, 0x44, 0xc3, 0x68, 0x0b, 0x4b, 0xf8, 0xe2, 0xc3,
+  0xb0, 0x6f, 0x61, 0xa8, 0x18, 0x88, 0x12, 0xb6, 0xa8, 0x9c, 0x6b, 0x08,
+  0x8c, 0x25, 0xcd, 0x22, 0x82, 0x5c, 0x50, 0x98, 0x40, 0xc3, 0xba, 0x40,
+  0x2c, 0xe1, 0xab, 0xe5, 0x6a, 0xb2, 0x28, 0xeb, 0x29, 0xe7, 0x63, 0x92,
+  0x18, 0xfb, 0xc3, 0xde, 0x0d, 0xc0, 0xff, 0x0b, 0x73, 0x83, 0xd0, 0xdd,
+  0xec, 0xd1, 0x1f, 0x3d, 0x43, 0x0d, 0x44, 0xad, 0x18, 0x87, 0xf4, 0xe8,
+  0xaf, 0x8d, 0x47, 0x85, 0x31, 0x1f, 0x5b, 0x0a, 0x21, 0xf2, 0xa8, 0xa9,
+  0x85, 0x9d, 0x59, 0x13, 0xca, 0x7e, 0x9b, 0x90, 0x76, 0xaf, 0xc8, 0xff,
+  0xda, 0xa8, 0x86, 0xa0, 0xb7, 0x90, 0xfc, 0x0f, 0x9b, 0x7e, 0x44, 0xfd,
+  0x5a, 0x5a, 0x64, 0x9d, 0xb2, 0x14, 0xe9, 0x95, 0xaa, 0x3b, 0xc8, 0x21,
+  0xe8, 0x40, 0xd6, 0x5f, 0x0c, 0x89, 0xb0, 0x52, 0x10, 0xb1, 0x7b, 0x51,
+  0xbb, 0xd6, 0x73, 0xeb, 0x9a, 0xc2, 0x3b, 0xf6, 0xdc, 0x1f, 0xe7, 0x47,
+  0xfb, 0xff, 0xe2, 0xef, 0xeb, 0xff, 0xc3, 0xfd, 0x68, 0x6f, 0xaf, 0xea,
+  0xff, 0xe9, 0xfd, 0x0f, 0xf7, 0xfd, 0xff, 0xa7, 0xf9, 0xb9, 0xfa, 0xff,
+  0x50, 0xe9, 0xa6, 0xe5, 0xfe, 0xff, 0xdc, 0xda, 0xff, 0x6b, 0x43, 0x85,
+  0xfe, 0xbf, 0x94, 0xfa, 0x7f, 0xd1, 0x9b, 0xff, 0xcb, 0xb3, 0xd3, 0xb7,
+  0x27, 0x2f, 0xc6, 0x17, 0xa7, 0xe3, 0x93, 0xd1, 0xf3, 0xb3, 0xd1, 0xf9,
+  0x05, 0x8a, 0x7f, 0x01, 0x75, 0xbf, 0x6b, 0x24, 0xfb, 0x16, 0x91, 0xbc,
+  0xc4, 0xfd, 0x1e, 0x34, 0x11, 0x06, 0xb2, 0x37, 0xa7, 0xe7, 0x22, 0x59,
+  0x64, 0x20, 0xfb, 0xf7, 0xe8, 0xec, 0x94, 0xf5, 0xa2, 0x88, 0xac, 0xa7,
+  0x23, 0x3b, 0x7a, 0x7b, 0x36, 0x7e, 0x71, 0x7c, 0x36, 0x3a, 0xba, 0x38,
+  0x3e, 0x3d, 0xc1, 0x64, 0x7d, 0x1d, 0xd9, 0xd9, 0xf3, 0xe3, 0xf3, 0xd1,
+  0x78, 0xf4, 0xc3, 0x11, 0x47, 0xd3, 0x26, 0xe1, 0xe4, 0xb4, 0xa2, 0x21,
+  0x64, 0x43, 0x2d, 0x19, 0xa8, 0x01, 0xff, 0x5a, 0x66, 0x35, 0x7d, 0xd0,
+  0xf2, 0x6f, 0xeb, 0xf0, 0x5e, 0xbe, 0x3a, 0x3d, 0x3d, 0xd3, 0xe3, 0x11,
+  0x7d, 0x36, 0xc0, 0x3a, 0x1a, 0x1d, 0xbf, 0xd2, 0xca, 0xc6, 0x94, 0xde,
+  0x00, 0xeb, 0xe2, 0xec, 0xed, 0xc9, 0x91, 0x0e, 0x0b, 0xe7, 0x4c, 0x03,
+  0xa0, 0x33, 0xad, 0xc2, 0xe4, 0xbc, 0x6b, 0x00, 0x07, 0x6a, 0xfe, 0xcf,
+  0xff, 0x03, 0x98, 0x9e, 0x70, 0x24, 0x5f, 0xdb, 0x78, 0x04, 0x9a, 0x2f,
+  0xd7, 0xa8, 0x3f, 0xd0, 0xcc, 0xa2, 0xa5, 0xcb, 0x28, 0x80, 0x88, 0xbb,
+  0x95, 0x27, 0xa3, 0xc8, 0xf9, 0x32, 0x49, 0x59, 0x47, 0x05, 0x38, 0x41,
+  0x56, 0x04, 0xef, 0xb3, 0x72, 0x9a, 0x2d, 0x82, 0x30, 0x58, 0x5e, 0xa1,
+  0xfe, 0x16, 0x3d, 0xc5, 0x8b, 0xdb, 0x8a, 0x03, 0xc4, 0x60, 0xae, 0x63,
+  0x29, 0x16, 0x2c, 0x15, 0x10, 0x0e, 0xd8, 0x91, 0x05, 0xed, 0x76, 0x0b,
+  0x84, 0x33, 0x99, 0x06, 0x2d, 0x1c, 0xe1, 0xab, 0x60, 0xbf, 0x1d, 0x10,
+  0x36, 0x13, 0x58, 0x07, 0xd6, 0x16, 0x89, 0x27, 0xea, 0xde, 0x7d, 0x8e,
+  0x86, 0xd9, 0x31, 0x1a, 0x6c, 0xe6, 0xb0, 0x5f, 0x8f, 0x86, 0x96, 0x74,
+  0x25, 0x51, 0x83, 0x40, 0x0b, 0x82, 0x06, 0xe1, 0x80, 0x22, 0x3c, 0x72,
+  0x20, 0x40, 0xf6, 0x57, 0xd1, 0xc9, 0xbd, 0x1a, 0xb5, 0x03, 0x48, 0x76,
+  0x54, 0xb7, 0xe4, 0x28, 0xdb, 0xe3, 0xf5, 0xac, 0xac, 0x8b, 0x49, 0x82,
+  0xff, 0xb0, 0xb9, 0x7c, 0xc2, 0x39, 0xa0, 0x78, 0x64, 0x52, 0xb3, 0x50,
+  0xe3, 0x40, 0x45, 0xc8, 0x7a, 0xe2, 0x4b, 0x05, 0xd3, 0x77, 0x02, 0xe9,
+  0x7b, 0xc8, 0xbe, 0x5b, 0x1d, 0x18, 0x51, 0x09, 0x44, 0xaf, 0x21, 0xaa,
+  0x00, 0x0d, 0x0c, 0x17, 0x63, 0x6a, 0x9d, 0x7c, 0x35, 0x5b, 0xc6, 0xcc,
+  0x41, 0x0b, 0x15, 0x27, 0x63, 0xe2, 0x34, 0xf0, 0xfe, 0x4a, 0x84, 0x33,
+  0xf8, 0x38, 0xab, 0x0b, 0x4a, 0xbd, 0x7d, 0x08, 0x6c, 0x2f, 0x2b, 0xed,
+  0x78, 0xb1, 0x15, 0xb9, 0xd6, 0x1d, 0xa9, 0x58, 0x78, 0xd6, 0x53, 0x6c,
+  0x67, 0x2d, 0x1d, 0x9f, 0x4a, 0x33, 0xec, 0x04, 0x1c, 0x0d, 0x18, 0xa5,
+  0x32, 0x81, 0x3e, 0x74, 0xd4, 0x16, 0xb3, 0xad, 0x89, 0x59, 0x28, 0x31,
+  0x0b, 0xdf, 0x98, 0x05, 0x75, 0x82, 0x28, 0xeb, 0x1a, 0x47, 0x6e, 0x5d,
+  0xfa, 0x21, 0x14, 0x75, 0x84, 0xc2, 0x17, 0x01, 0xa9, 0x8c, 0xb8, 0xab,
+  0x75, 0x25, 0x1c, 0x77, 0x3b, 0xda, 0xb8, 0xee, 0xa4, 0x1b, 0xe3, 0x36,
+  0x48, 0xbc, 0x19, 0xc3, 0x3f, 0xf9, 0x14, 0x03, 0x1a, 0x76, 0xd4, 0xbc,
+  0x2e, 0x12, 0xdb, 0x65, 0x3b, 0x98, 0x40, 0xae, 0x93, 0x72, 0x01, 0x14,
+  0x16, 0x9b, 0x1b, 0x54, 0x4e, 0x68, 0xff, 0xc8, 0xfa, 0x73, 0x2b, 0xc4,
+  0xcb, 0xb9, 0x6d, 0xb9, 0x21, 0xa4, 0x95, 0xf7, 0x52, 0xb5, 0xac, 0xb5,
+  0xd7, 0x51, 0x2a, 0xac, 0xa7, 0xc7, 0xbc, 0x4a, 0x86, 0x50, 0x6c, 0x35,
+  0x2a, 0x47, 0x42, 0x0a, 0x55, 0x24, 0x52, 0x85, 0x84, 0xca, 0xd3, 0x39,
+  0x76, 0x26, 0x88, 0x67, 0x36, 0xdd, 0xf3, 0xdc, 0x1f, 0xd1, 0x58, 0x77,
+  0x5b, 0x34, 0x3f, 0x6c, 0xa8, 0x79, 0x7a, 0xa8, 0xe3, 0xd6, 0x68, 0xd3,
+  0x5c, 0xdf, 0x14, 0x50, 0x8b, 0xcb, 0x8d, 0xa9, 0xbc, 0xd0, 0x27, 0xd8,
+  0x38, 0x50, 0xb6, 0xf4, 0xd8, 0xb1, 0x5e, 0xd8, 0xd2, 0x83, 0x60, 0x3c,
+  0x19, 0x0d, 0x75, 0x02, 0xb4, 0x5b, 0x82, 0x99, 0xe1, 0x57, 0xc1, 0x9f,
+  0x73, 0xec, 0xaa, 0x8f, 0x5b, 0x1b, 0xa2, 0x4f, 0x73, 0x87, 0x2f, 0x77,
+  0x26, 0xa3, 0xa9, 0x98, 0xb0, 0x47, 0x45, 0x4c, 0x30, 0x2a, 0x67, 0x62,
+  0x82, 0xe7, 0x40, 0x26, 0xe6, 0xa0, 0xa7, 0x13, 0x33, 0xa1, 0x72, 0x62,
+  0x1f, 0x83, 0xb2, 0x9c, 0xf0, 0xc9, 0x2e, 0x67, 0x26, 0xca, 0x69, 0x34,
+  0x29, 0x95, 0x4f, 0x50, 0xab, 0x8e, 0x91, 0xa8, 0xa8, 0xaa, 0xa5, 0x29,
+  0x96, 0x1a, 0xc6, 0x1d, 0xb2, 0xd0, 0x82, 0x88, 0x44, 0x34, 0xb6, 0xf6,
+  0x98, 0x2c, 0xcb, 0x60, 0x95, 0x2f, 0x93, 0xf5, 0xa4, 0xb4, 0x35, 0x13,
+  0xc9, 0xca, 0xb3, 0x8d, 0xc0, 0x7d, 0x53, 0x50, 0x54, 0x9b, 0x3f, 0xdb,
+  0x35, 0x1a, 0xdd, 0x4d, 0xd8, 0xd5, 0x95, 0xde, 0x02, 0x4c, 0xf6, 0x63,
+  0x72, 0xd8, 0xa7, 0x6a, 0x3c, 0x3c, 0x87, 0x0a, 0x72, 0xb5, 0x40, 0xa3,
+  0x2b, 0xb0, 0x7e, 0xec, 0x36, 0x68, 0x7f, 0x40, 0x0b, 0x9e, 0x8d, 0x0f,
+  0x1d, 0xda, 0x8a, 0x8a, 0xb8, 0xaa, 0xcc, 0x8b, 0x42, 0x61, 0x5c, 0x48,
+  0x93, 0xd4, 0x25, 0x49, 0xaa, 0x37, 0x4b, 0xdd, 0x4d, 0x54, 0xa7, 0x0e,
+  0x09, 0x35, 0x6b, 0x9e, 0x68, 0xab, 0x46, 0x5b, 0x3b, 0x39, 0x65, 0xb4,
+  0x2d, 0xa3, 0x6d, 0x9c, 0x25, 0xd5, 0x95, 0x81, 0x51, 0x80, 0x26, 0xbf,
+  0x8f, 0xe7, 0xf1, 0x06, 0x8d, 0x29, 0xd0, 0x68, 0x33, 0x5b, 0xcd, 0x6e,
+  0x3b, 0xd4, 0x2c, 0x9f, 0xec, 0xbd, 0x61, 0xb3, 0x23, 0x5e, 0x5a, 0x0c,
+  0xa7, 0x89, 0xd4, 0xb3, 0x7c, 0x5b, 0x1e, 0x27, 0xd2, 0xc2, 0x34, 0x3e,
+  0xdb, 0xa4, 0x1e, 0xd6, 0xda, 0xf2, 0xa0, 0x95, 0x0e, 0xa5, 0xf9, 0x39,
+  0x2b, 0xc5, 0x2a, 0x63, 0x4b, 0xc5, 0xe8, 0x50, 0x9a, 0xeb, 0x85, 0xa3,
+  0xac, 0xef, 0x20, 0x8b, 0x16, 0xa5, 0xf9, 0x99, 0x2f, 0x66, 0xe1, 0xd2,
+  0x6c, 0x2f, 0xa5, 0xea, 0x2d, 0x76, 0x44, 0xa3, 0x74, 0xeb, 0xe1, 0xab,
+  0xf5, 0xcc, 0x83, 0x93, 0xde, 0x1a, 0xe5, 0x56, 0x78, 0x95, 0xb7, 0xd5,
+  0xe9, 0xac, 0x89, 0xb9, 0x6f, 0x68, 0x69, 0x4f, 0x8b, 0x75, 0x82, 0x96,
+  0xf6, 0xdc, 0x99, 0xc3, 0xf9, 0x2a, 0x3b, 0x1a, 0xd2, 0x7c, 0xa3, 0x89,
+  0x5c, 0x74, 0xc0, 0xc1, 0x35, 0x26, 0x6a, 0x3a, 0x5b, 0xb3, 0x75, 0x75,
+  0x80, 0xd5, 0x96, 0x67, 0xd9, 0x62, 0xb5, 0xa4, 0x27, 0x60, 0xb5, 0x46,
+  0x02, 0x70, 0x3d, 0x67, 0x35, 0xba, 0x71, 0x18, 0x63, 0x72, 0xb3, 0x97,
+  0xae, 0xda, 0xac, 0x87, 0xe6, 0xa1, 0x0e, 0x2d, 0xb0, 0x10, 0x57, 0x99,
+  0x6a, 0x73, 0x23, 0x1a, 0xa4, 0x73, 0x6a, 0x3a, 0x93, 0xe9, 0x47, 0x3c,
+  0xdc, 0xba, 0x00, 0xd6, 0xcb, 0x71, 0x03, 0x07, 0xde, 0x0f, 0x83, 0x74,
+  0x53, 0xa6, 0x0b, 0xf0, 0x03, 0x5c, 0xb7, 0xaa, 0x1c, 0xfd, 0x70, 0x31,
+  0x3a, 0x79, 0x41, 0x4d, 0xed, 0x8a, 0x92, 0x18, 0x55, 0x2e, 0xfc, 0x0c,
+  0xed, 0x44, 0xeb, 0xba, 0x82, 0x5a, 0xd7, 0x15, 0xc2, 0x59, 0x85, 0x9a,
+  0xe5, 0xa4, 0xff, 0x81, 0xdd, 0xca, 0x3c, 0xf5, 0x67, 0xd3, 0x91, 0x04,
+  0xd1, 0x38, 0x8e, 0xa6, 0x02, 0x17, 0x30, 0xec, 0x5b, 0x78, 0x28, 0xd8,
+  0xa3, 0x91, 0x16, 0x97, 0x1b, 0xa6, 0xb5, 0x6d, 0x51, 0x68, 0x09, 0xe2,
+  0x51, 0x48, 0x51, 0xb2, 0x46, 0xa1, 0xd6, 0x63, 0x3c, 0x0a, 0x31, 0x23,
+  0x33, 0x45, 0x09, 0x07, 0x02, 0x1b, 0x2c, 0x90, 0x93, 0x0b, 0x89, 0x32,
+  0xe8, 0x4b, 0x51, 0xec, 0x5c, 0x7a, 0x91, 0x10, 0x05, 0xa3, 0xbb, 0xa2,
+  0xac, 0x15, 0x8d, 0xad, 0xdd, 0x1a, 0x5b, 0x2b, 0x1a, 0x5b, 0xbb, 0xd3,
+  0xb2, 0x56, 0x34, 0xb6, 0xf6, 0x10, 0x4c, 0xd1, 0x98, 0x0f, 0x17, 0x45,
+  0x63, 0x3e, 0x5c, 0x14, 0x8d, 0xc9, 0x51, 0xc8, 0x80, 0x02, 0xac, 0x99,
+  0x70, 0x9d, 0xa2, 0x86, 0x53, 0xb5, 0x51, 0xa6, 0xc6, 0xb0, 0x4a, 0x6b,
+  0xe4, 0xad, 0x78, 0xb6, 0x21, 0xc6, 0xdd, 0xcc, 0xa8, 0x2a, 0xdc, 0x33,
+  0xba, 0xaf, 0x17, 0x70, 0xf5, 0xc6, 0x87, 0x7a, 0x97, 0x39, 0xdc, 0xf6,
+  0xce, 0xea, 0x38, 0x47, 0x00, 0x97, 0x9b, 0xe6, 0x3a, 0x78, 0xe5, 0xad,
+  0xdd, 0xe8, 0xdc, 0x9c, 0xa1, 0xd5, 0x96, 0xc8, 0x0c, 0x76, 0x65, 0xaa,
+  0xa8, 0x7e, 0x76, 0x65, 0x35, 0xed, 0x6a, 0x27, 0xa6, 0xd8, 0x3b, 0x93,
+  0x60, 0xdf, 0x55, 0x33, 0x2c, 0x0b, 0xf7, 0x1a, 0x59, 0x96, 0xe9, 0x65,
+  0xa9, 0xe7, 0x88, 0x56, 0x98, 0x5a, 0x3f, 0x2c, 0x8b, 0xd2, 0xfb, 0x08,
+  0x92, 0xc8, 0xd9, 0x27, 0xf8, 0xf6, 0xad, 0xc9, 0x53, 0x65, 0x64, 0x8d,
+  0xab, 0x75, 0xad, 0x8f, 0xf2, 0x6a, 0xbc, 0xd6, 0x12, 0xab, 0x26, 0x9d,
+  0x78, 0x65, 0x42, 0x6b, 0xc8, 0xf9, 0x91, 0x96, 0x65, 0x74, 0xb3, 0x03,
+  0x71, 0xcb, 0x01, 0xb5, 0x03, 0x67, 0xcf, 0x8f, 0x2e, 0x60, 0xa1, 0xe9,
+  0xf9, 0x45, 0x2b, 0x41, 0x03, 0xbe, 0x0e, 0x29, 0xec, 0xa4, 0xcf, 0x69,
+  0xb5, 0x92, 0x36, 0xf5, 0x63, 0x46, 0x66, 0xf4, 0x9b, 0x76, 0x1b, 0xcb,
+  0x4b, 0x44, 0x95, 0xb7, 0x2f, 0x5e, 0xff, 0x37, 0x52, 0xd5, 0xf9, 0xe8,
+  0xec, 0xe2, 0xcd, 0xf9, 0xf8, 0xe4, 0xc5, 0x0f, 0xad, 0x02, 0x4c, 0x01,
+  0x12, 0xe8, 0x53, 0x7f, 0xc3, 0xd3, 0x5e, 0x8e, 0x09, 0x21, 0xd8, 0x34,
+  0x70, 0x40, 0x66, 0xda, 0x88, 0x06, 0xbf, 0xf6, 0xf1, 0x2b, 0x21, 0x26,
+  0x8d, 0x4e, 0x99, 0xea, 0x6e, 0x98, 0x66, 0x95, 0x0c, 0x42, 0x7f, 0xb3,
+  0x1d, 0x50, 0x56, 0x26, 0xda, 0x25, 0xb6, 0x2b, 0xf8, 0x4a, 0xc9, 0xe9,
+  0xcf, 0x5b, 0xf8, 0x2c, 0xdd, 0x87, 0xa0, 0xd4, 0xba, 0xed, 0x17, 0x99,
+  0x4d, 0x1a, 0x32, 0xfb, 0xf3, 0x4e, 0xdc, 0x16, 0xbf, 0xf9, 0xf0, 0x63,
+  0xb8, 0xaa, 0x42, 0xc8, 0x12, 0xe3, 0x57, 0x5f, 0x55, 0x21, 0x13, 0x31,
+  0xa4, 0xb6, 0x9e, 0x0c, 0x14, 0xe3, 0x78, 0x36, 0x1b, 0xc3, 0x88, 0xa9,
+  0x68, 0xcd, 0x3b, 0xc1, 0x4d, 0xbb, 0xa6, 0xe5, 0xd6, 0x1c, 0x16, 0x29,
+  0x6f, 0xda, 0x6d, 0x7d, 0xd4, 0xe5, 0x22, 0x2d, 0x5a, 0x42, 0x34, 0xc6,
+  0x11, 0x7d, 0xeb, 0xb0, 0x41, 0x35, 0xf3, 0xc8, 0xb9, 0x1b, 0xea, 0x50,
+  0xe6, 0xd9, 0x06, 0xa3, 0x68, 0xa5, 0xa8, 0x14, 0x52, 0xc9, 0xa1, 0x73,
+  0x42, 0x58, 0x39, 0x97, 0x24, 0x36, 0x9c, 0x82, 0xaf, 0x49, 0xc1, 0x5a,
+  0x42, 0xb7, 0x71, 0xfc, 0x3f, 0xc2, 0x5a, 0xe2, 0xff, 0xbd, 0x1f, 0xb5,
+  0xff, 0xf8, 0x2b, 0xcd, 0x3f, 0x9c, 0xf6, 0x9f, 0xe1, 0x60, 0xc0, 0xec,
+  0x3f, 0xc2, 0xbd, 0xc1, 0x1e, 0xd8, 0x7f, 0xf4, 0xbb, 0xf7, 0xf6, 0x1f,
+  0x9f, 0xe4, 0x67, 0xb1, 0xff, 0x78, 0xfd, 0xfa, 0x87, 0xe0, 0x40, 0xb6,
+  0xfd, 0x00, 0xda, 0x63, 0x4e, 0x12, 0xc0, 0x52, 0xd5, 0x6a, 0x16, 0x67,
+  0x0b, 0x34, 0xc7, 0x8a, 0xc1, 0xff, 0x5f, 0xb6, 0x98, 0x41, 0x85, 0xbf,
+  0x5a, 0x2f, 0x26, 0x25, 0xbe, 0xdb, 0xe5, 0xfd, 0x32, 0xff, 0x15, 0x36,
+  0xa4, 0xd1, 0xfc, 0xee, 0xdb, 0x93, 0xb7, 0xc1, 0x11, 0x00, 0xdc, 0xa4,
+  0x93, 0x12, 0x75, 0xa1, 0xe5, 0xed, 0x2a, 0x45, 0xd3, 0x92, 0xf7, 0xd3,
+  0x6c, 0x32, 0x0d, 0xca, 0x6c, 0x71, 0x3b, 0x99, 0xa0, 0xc1, 0xc0, 0xfb,
+  0x34, 0x2f, 0x82, 0x72, 0x09, 0xc6, 0x27, 0x11, 0x0c, 0x6c, 0xcb, 0x7c,
+  0x4d, 0xa0, 0xbe, 0x0e, 0x4e, 0x57, 0x69, 0x1e, 0xe3, 0x67, 0x40, 0x81,
+  0x0d, 0xf0, 0xe5, 0x1a, 0x8d, 0x7a, 0x83, 0x24, 0xcb, 0x11, 0x22, 0x89,
+  0x0b, 0xbc, 0x40, 0xaa, 0xf7, 0x79, 0x56, 0xa2, 0x89, 0x65, 0x90, 0xce,
+  0xd2, 0x79, 0x8a, 0x0d, 0x31, 0xd9, 0xe3, 0xd7, 0x8a, 0x09, 0x8b, 0xd5,
+  0x82, 0xc5, 0x60, 0xc0, 0x72, 0x15, 0x7c, 0x4e, 0x28, 0x12, 0xd4, 0xe8,
+  0x23, 0xb5, 0x8d, 0x07, 0xfd, 0xf1, 0x18, 0x37, 0xe8, 0xd5, 0xe7, 0xac,
+  0x87, 0xbe, 0x8f, 0x51, 0xab, 0x96, 0xe7, 0x28, 0xb1, 0x0f, 0x65, 0xe5,
+  0x06, 0xd3, 0x34, 0x4e, 0x20, 0xa5, 0xeb, 0x02, 0x11, 0x2f, 0xc1, 0x4b,
+  0xc7, 0x62, 0xb9, 0xd8, 0x05, 0x22, 0x54, 0x1a, 0xaf, 0xd3, 0xf2, 0x21,
+  0x6d, 0x0e, 0x71, 0x57, 0xbb, 0x58, 0x96, 0xe9, 0x93, 0xa0, 0x58, 0xa5,
+  0xb3, 0x19, 0xa2, 0xfe, 0x8f, 0xf1, 0x38, 0x2e, 0x11, 0xd0, 0xe5, 0xba,
+  0x4c, 0xff, 0x23, 0xb8, 0x4c, 0x27, 0x60, 0x2b, 0x1e, 0xcc, 0xb2, 0xcb,
+  0x09, 0x47, 0x9d, 0xc7, 0xb7, 0x01, 0x74, 0x3d, 0xd0, 0x0b, 0x89, 0xe4,
+  0xe3, 0xf1, 0x7f, 0x80, 0x10, 0x4b, 0x40, 0x9c, 0x82, 0xaa, 0xde, 0x4f,
+  0x53, 0xb0, 0x18, 0x44, 0x59, 0x73, 0x84, 0x12, 0x90, 0x15, 0x10, 0x10,
+  0xb0, 0x34, 0x20, 0x35, 0x49, 0xf3, 0x71, 0xda, 0x0f, 0xd2, 0xac, 0x46,
+  0x29, 0xc4, 0x99, 0x2d, 0xd3, 0x7c, 0x3f, 0x3a, 0xba, 0x38, 0x3d, 0x6b,
+  0xa1, 0x59, 0xba, 0xc0, 0x16, 0x75, 0x32, 0x38, 0xcb, 0x51, 0x4b, 0xff,
+  0x5b, 0x8a, 0xc2, 0xa0, 0x6f, 0x80, 0xdc, 0x07, 0xfd, 0x0b, 0x23, 0xfd,
+  0xf1, 0x1c, 0xce, 0xee, 0x0a, 0x28, 0x60, 0xa8, 0xc8, 0xe8, 0x88, 0x15,
+  0xee, 0x4d, 0x84, 0xc6, 0xa8, 0x26, 0x12, 0x62, 0x03, 0x0a, 0x83, 0xd7,
+  0xa9, 0x85, 0x48, 0xb0, 0x50, 0x85, 0x19, 0xd8, 0xbb, 0x3a, 0xa9, 0xde,
+  0x74, 0x3f, 0x9d, 0xaf, 0xca, 0x5b, 0x0f, 0xd3, 0xfd, 0x74, 0x3e, 0x2f,
+  0x34, 0x47, 0x00, 0x68, 0xea, 0xe6, 0xe2, 0xbd, 0x0f, 0xd4, 0x05, 0xae,
+  0x30, 0x3c, 0x41, 0x24, 0x0d, 0x2e, 0x7d, 0xa0, 0x80, 0x95, 0x23, 0x55,
+  0x04, 0x28, 0x59, 0x6b, 0x52, 0x85, 0x11, 0xc8, 0x58, 0x7f, 0x15, 0xcf,
+  0xa0, 0x6f, 0x39, 0x87, 0x53, 0xb9, 0x08, 0x25, 0x73, 0x08, 0xc4, 0x51,
+  0x35, 0x99, 0x24, 0xbb, 0x31, 0x92, 0x23, 0x5d, 0xa1, 0x27, 0xbf, 0xef,
+  0xc8, 0xff, 0x87, 0xff, 0x78, 0xff, 0x3f, 0x9e, 0xa3, 0x61, 0xe2, 0x72,
+  0xf2, 0x37, 0x9c, 0xff, 0x08, 0xa3, 0x28, 0xe4, 0xfd, 0xff, 0xa0, 0x1f,
+  0xe1, 0xfe, 0x7f, 0x7f, 0xef, 0xbe, 0xff, 0xff, 0x14, 0x3f, 0x4b, 0xff,
+  0x1f, 0xcf, 0x48, 0x5b, 0x89, 0xcb, 0x05, 0xee, 0x78, 0x61, 0x38, 0xc0,
+  0xcb, 0x89, 0x6a, 0x0b, 0x0a, 0xd3, 0xcc, 0xe7, 0xaf, 0x5e, 0x9d, 0x1e,
+  0x19, 0x7a, 0x52, 0x4d, 0xa8, 0x78, 0x16, 0xa4, 0x4c, 0x50, 0x17, 0x46,
+  0x0c, 0x41, 0x51, 0xdb, 0xc1, 0xfb, 0xd1, 0x7f, 0x1d, 0x9f, 0xf4, 0x22,
+  0x81, 0xae, 0xe2, 0x2e, 0xce, 0x2e, 0xc8, 0xd7, 0x16, 0xf4, 0x2f, 0x1d,
+  0x22, 0x37, 0xea, 0x80, 0xa8, 0xfc, 0x2c, 0x10, 0x87, 0xc2, 0xdc, 0x84,
+  0x84, 0x2b, 0xe6, 0x1f, 0x79, 0x9a, 0xb6, 0x56, 0x42, 0x24, 0xfa, 0x01,
+  0xb5, 0x65, 0xb3, 0x22, 0x7d, 0x00, 0xed, 0xe1, 0x6a, 0x59, 0xa0, 0x19,
+  0xd0, 0x3c, 0x9d, 0x63, 0x12, 0xea, 0x66, 0x7c, 0xa7, 0x13, 0x00, 0xec,
+  0xb8, 0x64, 0x7f, 0xa1, 0xff, 0x50, 0x7a, 0x48, 0x7a, 0x1c, 0x4e, 0x91,
+  0x73, 0x5c, 0x06, 0x44, 0x5c, 0xfa, 0x42, 0xa4, 0xa2, 0x6d, 0x2b, 0x3d,
+  0x40, 0x57, 0xed, 0x52, 0xe2, 0xd0, 0xe0, 0x00, 0x13, 0x2f, 0xaf, 0x28,
+  0x73, 0x61, 0x5d, 0x81, 0x84, 0x3f, 0x53, 0xc2, 0xab, 0xf8, 0x8a, 0xf0,
+  0x5f, 0xad, 0xa8, 0x9a, 0x08, 0x7b, 0x01, 0x88, 0xb6, 0xea, 0x27, 0x6f,
+  0x5f, 0xbd, 0x92, 0xba, 0x0a, 0x72, 0xbd, 0x80, 0x36, 0x65, 0x5c, 0x7f,
+  0xca, 0xb1, 0x3f, 0xaa, 0x42, 0x88, 0xc8, 0x06, 0x33, 0x52, 0xcf, 0x50,
+  0x2f, 0x10, 0xf7, 0x5d, 0xc3, 0x27, 0xff, 0xd1, 0xf6, 0x7f, 0xf5, 0x77,
+  0x9e, 0xff, 0xeb, 0x75, 0xa3, 0xca, 0xfe, 0x3f, 0xec, 0x63, 0xfb, 0xff,
+  0xfe, 0x7d, 0xfb, 0xff, 0x49, 0x7e, 0x76, 0xfb, 0xff, 0x5e, 0x70, 0xb0,
+  0x32, 0x5b, 0xff, 0xbf, 0xb1, 0xce, 0x9d, 0xb4, 0xa1, 0x42, 0x4b, 0x9e,
+  0x3a, 0x4e, 0xff, 0xe1, 0x76, 0x05, 0xdc, 0x1d, 0xaf, 0x2f, 0xf5, 0xcb,
+  0xb9, 0x46, 0x7b, 0x5a, 0x72, 0xcb, 0x21, 0xf8, 0xe6, 0xe6, 0xf7, 0x12,
+  0x82, 0x8b, 0x74, 0x6c, 0x40, 0x0b, 0x97, 0x2d, 0xe2, 0x90, 0x08, 0xbf,
+  0xf4, 0x48, 0x88, 0xf9, 0x5e, 0xce, 0x44, 0x12, 0xc3, 0x70, 0xd3, 0xaa,
+  0xed, 0xf6, 0x58, 0xbd, 0x20, 0x56, 0x13, 0xde, 0x29, 0xb8, 0x2d, 0xdd,
+  0x2a, 0xc9, 0x8f, 0xe8, 0xcd, 0x8e, 0x38, 0x95, 0x8f, 0x70, 0xfa, 0xc8,
+  0x4d, 0xb2, 0x3c, 0xfd, 0x97, 0x24, 0xc4, 0x96, 0x64, 0x22, 0xc3, 0x1d,
+  0xd4, 0x1e, 0x8b, 0x9a, 0x16, 0x64, 0xd8, 0x15, 0x65, 0xd8, 0xf5, 0x50,
+  0x3b, 0x51, 0xc4, 0x76, 0x4a, 0x67, 0xaa, 0x10, 0x52, 0xef, 0x60, 0x76,
+  0xa7, 0x1c, 0x16, 0x98, 0xed, 0xba, 0x73, 0x18, 0x4e, 0xfe, 0x4f, 0x93,
+  0xb5, 0x64, 0xef, 0x65, 0xd5, 0x6b, 0xc8, 0x2f, 0xed, 0x24, 0xfa, 0x8c,
+  0x5d, 0xf9, 0x07, 0x1c, 0x66, 0x4d, 0x38, 0x90, 0x02, 0xda, 0xa5, 0x19,
+  0x47, 0xfe, 0xb5, 0x2b, 0x0c, 0x58, 0x60, 0x0e, 0x9a, 0x4b, 0x82, 0x2d,
+  0x97, 0x84, 0x32, 0x33, 0x0c, 0xf5, 0xaa, 0x22, 0x02, 0xc5, 0x5f, 0x43,
+  0xf4, 0x22, 0x0d, 0x18, 0x74, 0xed, 0xc9, 0xfd, 0x80, 0xe1, 0xae, 0x3f,
+  0xda, 0xff, 0x67, 0x7f, 0x5b, 0xff, 0x1f, 0x86, 0x83, 0x5e, 0xb7, 0x3a,
+  0xff, 0xdf, 0x0f, 0xf1, 0xfa, 0xef, 0xde, 0xde, 0xe0, 0xbe, 0xff, 0xff,
+  0x14, 0x3f, 0x4b, 0xff, 0xff, 0xfc, 0xfb, 0x1f, 0x3a, 0xf0, 0x4f, 0x84,
+  0x2d, 0x0b, 0x5e, 0xbe, 0x7e, 0x1e, 0x1c, 0x64, 0xf5, 0xe5, 0xe0, 0x68,
+  0x6f, 0x80, 0x8f, 0xcf, 0x93, 0x25, 0x3e, 0xb2, 0x26, 0x8c, 0x97, 0x62,
+  0x61, 0xe6, 0x58, 0x04, 0xab, 0x38, 0x43, 0x1f, 0x97, 0x57, 0x01, 0xee,
+  0x3b, 0x10, 0x1d, 0x5e, 0xd8, 0x5d, 0xf2, 0xa5, 0x5c, 0x34, 0x01, 0x59,
+  0x02, 0xcc, 0x04, 0x0e, 0x20, 0xad, 0x0b, 0x58, 0x94, 0x2c, 0xa7, 0x69,
+  0x91, 0x8a, 0x8b, 0xa5, 0xf9, 0x7a, 0x51, 0xe0, 0x45, 0xd2, 0xc5, 0x2d,
+  0x08, 0xb9, 0x3b, 0xe8, 0x07, 0x47, 0x6f, 0xde, 0x7e, 0x8d, 0x45, 0xaa,
+  0xc8, 0x00, 0x05, 0x9b, 0xec, 0x07, 0xe5, 0xfb, 0x6c, 0x82, 0x26, 0x56,
+  0xb3, 0xec, 0xd7, 0x34, 0x28, 0xd2, 0x55, 0x8c, 0x58, 0xa5, 0xdc, 0xc8,
+  0x12, 0x27, 0x06, 0xb5, 0x36, 0xf2, 0xe2, 0xb2, 0x32, 0xb2, 0x39, 0xb6,
+  0x8e, 0x6c, 0xb4, 0xa1, 0xc2, 0xc8, 0x46, 0x72, 0x98, 0xc0, 0x57, 0x1e,
+  0x89, 0xd1, 0x2e, 0x6a, 0x29, 0x41, 0x63, 0xe2, 0x9a, 0x63, 0x2f, 0x12,
+  0xd6, 0x27, 0xab, 0xb3, 0x60, 0x88, 0x2c, 0x31, 0xd3, 0x49, 0xeb, 0xa6,
+  0x88, 0x34, 0x33, 0x93, 0x8a, 0x8c, 0xc7, 0x6b, 0x5f, 0xd6, 0x36, 0xca,
+  0x1a, 0x73, 0x1d, 0x71, 0x8d, 0xff, 0xcd, 0xb0, 0xb8, 0xf2, 0xe0, 0x7e,
+  0xd3, 0x4f, 0x2c, 0x64, 0x22, 0x6b, 0x44, 0x69, 0x49, 0xb6, 0xee, 0x90,
+  0x3d, 0x44, 0xb1, 0xa4, 0x8b, 0x2e, 0x32, 0x0f, 0x0b, 0x1f, 0x58, 0x4e,
+  0x6c, 0x01, 0xe4, 0x4b, 0xd2, 0xe1, 0x60, 0xea, 0x83, 0x29, 0xd2, 0x5b,
+  0x60, 0xd9, 0xea, 0x75, 0x2f, 0x7a, 0x67, 0x41, 0x55, 0x96, 0xba, 0x11,
+  0x71, 0xe1, 0x21, 0x82, 0x40, 0xae, 0xcb, 0x54, 0xd4, 0x13, 0xb3, 0x9a,
+  0x3c, 0x8d, 0x67, 0x37, 0x69, 0x41, 0x0e, 0x20, 0xb2, 0x56, 0x60, 0x76,
+  0x13, 0xcf, 0xd6, 0xa9, 0xba, 0x75, 0x00, 0x05, 0xef, 0xbb, 0xe7, 0xaf,
+  0x5e, 0xb6, 0x4a, 0xec, 0x80, 0x20, 0x6b, 0x83, 0xa5, 0x01, 0xdc, 0xc4,
+  0xf6, 0x15, 0x6c, 0x14, 0x13, 0x93, 0x55, 0x95, 0xfe, 0x3f, 0x8f, 0x4f,
+  0x9e, 0x9f, 0xfd, 0x1f, 0x6a, 0xfd, 0x57, 0xa2, 0x2f, 0xe8, 0xdf, 0x10,
+  0x3c, 0x01, 0x5e, 0x81, 0xb5, 0x83, 0x62, 0x04, 0x08, 0xe1, 0xc4, 0x02,
+  0x10, 0x3f, 0xc5, 0x24, 0x86, 0xec, 0x64, 0x0f, 0x7f, 0xe1, 0x46, 0x7f,
+  0xb2, 0x58, 0x18, 0x38, 0x07, 0x6f, 0x6c, 0xc1, 0x33, 0xcc, 0xa0, 0xa5,
+  0x09, 0x87, 0x05, 0x74, 0x7c, 0x26, 0xaf, 0x16, 0x72, 0x09, 0x21, 0x6d,
+  0x3b, 0x74, 0xe8, 0x80, 0x0e, 0x8d, 0xd0, 0x61, 0x5b, 0xf5, 0x7d, 0x4c,
+  0xed, 0x0b, 0x6b, 0x3a, 0x7b, 0x7b, 0x07, 0x95, 0x7d, 0x7c, 0x55, 0xdd,
+  0x59, 0x21, 0xbe, 0xc9, 0x46, 0xed, 0xf1, 0xd6, 0xe5, 0x84, 0x9b, 0x90,
+  0x7d, 0xfc, 0x82, 0x02, 0xb0, 0x77, 0x2f, 0x13, 0x22, 0x8a, 0x43, 0x0f,
+  0xa4, 0xca, 0xdc, 0x49, 0x1d, 0xa4, 0xda, 0xfc, 0xa5, 0x6a, 0x31, 0xd5,
+  0x9f, 0x8f, 0xa5, 0x30, 0x53, 0x25, 0xb2, 0xaa, 0x12, 0xbc, 0x9e, 0xf1,
+  0x2b, 0x11, 0x82, 0x15, 0x1a, 0xbc, 0x64, 0x93, 0x18, 0xfb, 0xe4, 0x11,
+  0xad, 0x92, 0x8f, 0x5e, 0xbf, 0x19, 0x8f, 0xfe, 0x39, 0x3e, 0xfd, 0x27,
+  0x20, 0xc8, 0x47, 0xf9, 0x21, 0xe8, 0xd5, 0xc5, 0xf8, 0xf4, 0x9c, 0x06,
+  0x85, 0x4a, 0xd0, 0xa8, 0x0a, 0x8a, 0xe4, 0xa0, 0xb7, 0x27, 0xa7, 0x67,
+  0x2f, 0xc6, 0xff, 0x54, 0x3d, 0x0d, 0x40, 0xd0, 0x09, 0x62, 0xf6, 0xf6,
+  0x9f, 0x81, 0xea, 0x5d, 0x00, 0x07, 0x21, 0x66, 0x6f, 0xcf, 0x49, 0xd0,
+  0x9e, 0x1a, 0x34, 0xe2, 0x41, 0x03, 0x39, 0x88, 0x72, 0xc2, 0x41, 0xfb,
+  0xb5, 0x74, 0xbd, 0x65, 0x41, 0x43, 0x05, 0xf0, 0xdb, 0x0a, 0xf0, 0x1f,
+  0x6a, 0x50, 0x25, 0x46, 0x2c, 0x07, 0xbd, 0x7c, 0xfe, 0xea, 0x7c, 0x04,
+  0xba, 0x42, 0x41, 0x97, 0xf5, 0x74, 0x9d, 0xd2, 0x74, 0x4d, 0xe4, 0xa0,
+  0x6f, 0x05, 0x45, 0x25, 0x4a, 0x90, 0xa0, 0xde, 0x54, 0x0e, 0xba, 0x38,
+  0x7b, 0x3b, 0xc2, 0xe2, 0x83, 0xb3, 0x98, 0x7a, 0x7e, 0xd1, 0x58, 0xa1,
+  0x26, 0xbf, 0x68, 0x92, 0x43, 0x4d, 0x7e, 0xb1, 0x20, 0x6d, 0x7e, 0x9d,
+  0xe3, 0x20, 0x5d, 0x7e, 0x11, 0x6d, 0x84, 0xba, 0xfc, 0x22, 0x49, 0x0e,
+  0x75, 0xf9, 0x45, 0x83, 0x34, 0xf9, 0xc5, 0x84, 0xd7, 0xe4, 0x17, 0x0b,
+  0xd2, 0xe5, 0x17, 0x05, 0xd4, 0xe5, 0x17, 0x0d, 0xd2, 0xe7, 0xd7, 0x39,
+  0x04, 0xe9, 0xf2, 0x8b, 0xa6, 0x4b, 0x93, 0x5f, 0x4c, 0x51, 0x9a, 0xfc,
+  0x62, 0x41, 0xda, 0xfc, 0x22, 0x3a, 0xbc, 0xe2, 0xa7, 0x02, 0xe2, 0x19,
+  0x36, 0xdf, 0x40, 0xe3, 0xf3, 0x77, 0xeb, 0x2c, 0x2d, 0xc5, 0x6a, 0xb8,
+  0x5c, 0xa0, 0x91, 0x7b, 0x92, 0x5d, 0x5d, 0xa5, 0x39, 0x38, 0x3b, 0x48,
+  0x37, 0x93, 0x74, 0x45, 0x2c, 0x4c, 0x14, 0xb7, 0x5d, 0x95, 0xb7, 0xae,
+  0xf9, 0x4a, 0x70, 0xa3, 0x40, 0x9f, 0x68, 0xcb, 0xb6, 0x12, 0x0d, 0x40,
+  0xd7, 0x8b, 0x65, 0x9e, 0x60, 0xf3, 0xc3, 0xcf, 0xe1, 0x9f, 0x0f, 0x1f,
+  0x82, 0x4b, 0x78, 0xba, 0x94, 0x1d, 0x24, 0xac, 0xb0, 0x31, 0xae, 0xec,
+  0x1e, 0x81, 0x37, 0x07, 0x4f, 0xaa, 0xcb, 0x56, 0x9e, 0xf1, 0x98, 0x15,
+  0x0d, 0x6e, 0x17, 0x04, 0x9a, 0x03, 0x0d, 0xc9, 0x48, 0x21, 0xd1, 0xc0,
+  0xd0, 0x86, 0x82, 0x53, 0x61, 0xc1, 0x55, 0x22, 0xd2, 0x64, 0x08, 0x48,
+  0x9f, 0x6b, 0x90, 0x48, 0xe3, 0xf1, 0xa4, 0x32, 0x7c, 0xc4, 0x32, 0xb5,
+  0xeb, 0x64, 0xa3, 0x1a, 0xd9, 0x33, 0x0d, 0x9d, 0x2c, 0xd6, 0xe7, 0x5a,
+  0xb9, 0x64, 0xb1, 0x88, 0xce, 0x91, 0xaa, 0xf5, 0x0a, 0x23, 0x0d, 0x8e,
+  0xc4, 0xf8, 0x50, 0xc7, 0x98, 0xb4, 0x3e, 0x32, 0x9d, 0x86, 0x8c, 0xb5,
+  0x44, 0x9c, 0xb0, 0xab, 0xd3, 0xda, 0xa9, 0x9a, 0x04, 0x30, 0xe8, 0xd1,
+  0xeb, 0xef, 0x5b, 0x25, 0xb7, 0x0e, 0x75, 0x34, 0x4a, 0xa6, 0x1f, 0x32,
+  0x12, 0xe6, 0x5e, 0x82, 0x05, 0x85, 0x56, 0xb7, 0x12, 0xec, 0x64, 0x92,
+  0xcd, 0xa2, 0x79, 0xa5, 0x18, 0x71, 0x6f, 0x7d, 0x3f, 0xd5, 0x2e, 0xaf,
+  0x39, 0xc4, 0xbd, 0xc3, 0x25, 0xfe, 0x77, 0xa5, 0x1c, 0x73, 0xa5, 0x06,
+  0xc7, 0x26, 0xff, 0xb5, 0x49, 0x25, 0xb2, 0xed, 0x18, 0xa7, 0x28, 0x74,
+  0x75, 0xd5, 0x94, 0x28, 0x41, 0x97, 0x2e, 0xa8, 0x82, 0x04, 0x1d, 0x29,
+  0x84, 0x2c, 0xb5, 0x86, 0x38, 0x44, 0x7f, 0x33, 0x58, 0x62, 0x14, 0x8f,
+  0x4b, 0x67, 0xf1, 0x07, 0xa1, 0xbb, 0xeb, 0x1b, 0xdf, 0xbd, 0x4b, 0xfc,
+  0x03, 0x08, 0x59, 0x12, 0xe3, 0xc1, 0x85, 0xce, 0x4f, 0xa9, 0xaa, 0x0c,
+  0xab, 0xd3, 0x0b, 0x33, 0xc3, 0x44, 0x62, 0x98, 0x68, 0x18, 0x2a, 0x23,
+  0x3f, 0x44, 0x0b, 0x5f, 0x88, 0x7c, 0x1d, 0x3a, 0x41, 0x67, 0x0c, 0x45,
+  0xd9, 0xdb, 0xae, 0xd8, 0x09, 0x8b, 0x9d, 0x70, 0x79, 0x45, 0x51, 0x88,
+  0x19, 0xf8, 0xf3, 0xef, 0x7f, 0x78, 0x02, 0xa5, 0x5e, 0x63, 0x0b, 0xce,
+  0x96, 0x3a, 0x28, 0x24, 0xa2, 0x59, 0xb1, 0x6d, 0x0d, 0xbc, 0xb6, 0x11,
+  0x2b, 0xd7, 0xdf, 0xa0, 0x8f, 0xed, 0xda, 0x65, 0xda, 0x7c, 0x75, 0x43,
+  0x42, 0x29, 0x32, 0xf4, 0x62, 0x03, 0xca, 0x4c, 0x48, 0x89, 0x84, 0x54,
+  0xd0, 0x32, 0x4a, 0x67, 0x40, 0x2a, 0x4a, 0xe2, 0x27, 0x4f, 0x21, 0xc9,
+  0xd3, 0x48, 0x1c, 0x11, 0x07, 0x83, 0x54, 0x0a, 0xca, 0x9a, 0x28, 0x28,
+  0xd1, 0x00, 0x25, 0x36, 0x20, 0x9a, 0x34, 0x43, 0x05, 0xa9, 0x92, 0x46,
+  0x44, 0xa2, 0x96, 0xee, 0x6a, 0xea, 0xa4, 0xa1, 0x36, 0x2b, 0x61, 0x78,
+  0x98, 0xaf, 0xbf, 0x15, 0x49, 0x56, 0x7e, 0x42, 0xa4, 0xac, 0xb0, 0x13,
+  0x17, 0x78, 0x62, 0x45, 0xcf, 0xea, 0x3a, 0xe0, 0x36, 0xfa, 0x35, 0x35,
+  0x68, 0xd0, 0x33, 0x01, 0xdd, 0x55, 0x90, 0x41, 0x23, 0x63, 0xac, 0x9d,
+  0xda, 0xee, 0x0a, 0xa5, 0x56, 0xec, 0xf8, 0xb4, 0xaa, 0x62, 0x33, 0xa6,
+  0xd8, 0x6d, 0xeb, 0x57, 0x2b, 0xba, 0x09, 0x96, 0x20, 0xa9, 0x24, 0x48,
+  0x54, 0x11, 0x12, 0x0f, 0x19, 0x92, 0xa6, 0x42, 0x28, 0x4a, 0x0e, 0xf1,
+  0x8d, 0xe0, 0x95, 0x10, 0x99, 0x2a, 0x44, 0xed, 0x0e, 0x41, 0xbd, 0xe2,
+  0x6d, 0x42, 0x08, 0x1b, 0x45, 0x10, 0xf1, 0xb7, 0x74, 0x23, 0xea, 0xdf,
+  0x90, 0x2d, 0xda, 0x58, 0x95, 0xce, 0x0c, 0xaa, 0xd4, 0xc5, 0x12, 0x12,
+  0x69, 0x48, 0x7b, 0xd5, 0x10, 0x16, 0x29, 0xbe, 0xf7, 0x23, 0x4e, 0xc8,
+  0x7d, 0x21, 0xe5, 0x32, 0x4f, 0x1d, 0xcd, 0x22, 0xb3, 0x06, 0x45, 0xd5,
+  0x1e, 0xdb, 0x82, 0x22, 0x55, 0xd5, 0x0a, 0x90, 0x30, 0x59, 0xb5, 0xd6,
+  0x7d, 0x8e, 0x95, 0x28, 0x58, 0x89, 0x3f, 0x58, 0xa6, 0x82, 0x91, 0xdc,
+  0x95, 0xf1, 0x32, 0x13, 0x9e, 0x3d, 0xa1, 0x90, 0x48, 0xb2, 0x18, 0x9c,
+  0xee, 0x77, 0xe8, 0xb2, 0x70, 0x3a, 0xe0, 0x4f, 0x7b, 0xfc, 0xa9, 0xaf,
+  0xb9, 0x20, 0x54, 0xfd, 0x51, 0xd2, 0x1e, 0x8f, 0x14, 0xf1, 0xa7, 0x90,
+  0x3f, 0x75, 0xb5, 0x95, 0x32, 0xed, 0x76, 0x30, 0x11, 0x44, 0x01, 0x00,
+  0xc4, 0x0f, 0x73, 0x07, 0x59, 0xd2, 0x7d, 0x1f, 0xcb, 0x5b, 0x39, 0x5d,
+  0xb9, 0x90, 0xb0, 0xae, 0x46, 0x8a, 0x4a, 0xb2, 0x9e, 0x47, 0xc2, 0x2a,
+  0x25, 0xd4, 0x15, 0x53, 0x29, 0x6b, 0xff, 0xaf, 0x4b, 0x59, 0x22, 0x65,
+  0x19, 0x77, 0x46, 0x07, 0x78, 0xec, 0x31, 0xaa, 0x1e, 0xc3, 0xea, 0xb1,
+  0xab, 0x6f, 0x7f, 0x64, 0xa1, 0xb6, 0x10, 0x22, 0x17, 0xa5, 0xe8, 0x6a,
+  0x59, 0x0b, 0x02, 0xf5, 0x3e, 0xa2, 0x14, 0x62, 0x6d, 0xa0, 0x87, 0xa3,
+  0x60, 0xb8, 0x06, 0xc5, 0x17, 0xff, 0x1d, 0xd0, 0xbf, 0x7b, 0xf4, 0xaf,
+  0x4f, 0xc1, 0x85, 0x1f, 0x26, 0xee, 0xd1, 0x48, 0x11, 0xfd, 0x1b, 0xd2,
+  0xbf, 0x82, 0x1a, 0xf1, 0x56, 0xc4, 0x16, 0x59, 0xcb, 0x87, 0x1d, 0x3e,
+  0x09, 0xcb, 0xc5, 0x94, 0x75, 0x15, 0x61, 0x98, 0x70, 0x5e, 0x25, 0x97,
+  0x27, 0xad, 0xaf, 0xe8, 0x85, 0xe9, 0x69, 0xff, 0x13, 0x27, 0x8d, 0xb9,
+  0x89, 0xa8, 0xb6, 0x80, 0x00, 0x5f, 0x78, 0x8b, 0x7c, 0x93, 0x25, 0xc4,
+  0x09, 0x25, 0x84, 0xae, 0xbe, 0xbf, 0xbb, 0x73, 0x71, 0xcb, 0x35, 0xb2,
+  0x77, 0x3b, 0xb2, 0x1c, 0x9e, 0xb2, 0xcb, 0x09, 0x16, 0xdf, 0x7a, 0x1f,
+  0x51, 0x78, 0x41, 0xf6, 0xb0, 0x6a, 0x10, 0xa5, 0x31, 0x97, 0xd4, 0x13,
+  0xc4, 0x78, 0xb8, 0xa5, 0xfe, 0xa7, 0x1b, 0xdb, 0x29, 0xcd, 0x41, 0x28,
+  0x34, 0x07, 0x26, 0xf8, 0xa4, 0xe5, 0x84, 0xcc, 0x24, 0xc8, 0xaa, 0x0a,
+  0x18, 0x20, 0x09, 0x41, 0x23, 0xa1, 0x6b, 0x1c, 0xe4, 0xec, 0x34, 0x33,
+  0x02, 0x3a, 0x05, 0xdd, 0x55, 0xd0, 0xf1, 0x38, 0x8a, 0x0f, 0xc2, 0x88,
+  0x27, 0x06, 0xf2, 0x3c, 0x5b, 0xd6, 0x32, 0xd9, 0x67, 0x24, 0x36, 0x5b,
+  0x3a, 0xa8, 0xf0, 0x5a, 0xfc, 0x54, 0x77, 0x85, 0x88, 0x87, 0x26, 0xc2,
+  0x41, 0x8b, 0xec, 0x75, 0x8a, 0xc3, 0x45, 0x22, 0x3a, 0x38, 0x7c, 0x14,
+  0xce, 0xa3, 0x22, 0xca, 0x58, 0x5e, 0x80, 0xa8, 0xa5, 0x7a, 0xda, 0x09,
+  0xa6, 0xda, 0x09, 0xb8, 0x8e, 0xf3, 0xb0, 0x85, 0x77, 0x38, 0x9d, 0x7c,
+  0x87, 0x77, 0x62, 0xab, 0x52, 0xb3, 0x59, 0x42, 0x95, 0x31, 0x42, 0xbe,
+  0x28, 0x53, 0xbc, 0x1a, 0x23, 0x7e, 0xcc, 0x1e, 0x62, 0xf3, 0x17, 0x14,
+  0xdf, 0xa7, 0x03, 0xc7, 0xa3, 0x7c, 0x3e, 0x45, 0xa8, 0xf8, 0x27, 0x46,
+  0x01, 0x92, 0xa6, 0x12, 0x28, 0x83, 0x66, 0xdc, 0x78, 0xe1, 0x44, 0xb3,
+  0x1b, 0xf0, 0x54, 0x65, 0xb4, 0xa6, 0x70, 0xf7, 0x02, 0x0a, 0x96, 0xad,
+  0xf0, 0xa5, 0xc8, 0x89, 0x29, 0x76, 0xe2, 0x15, 0x3d, 0x33, 0x45, 0xcf,
+  0xa4, 0xe8, 0x96, 0xac, 0xc3, 0x67, 0x93, 0x51, 0x3b, 0x45, 0x6e, 0xa4,
+  0x21, 0xad, 0xd9, 0xce, 0x4a, 0xa8, 0xb3, 0xec, 0xb2, 0x1a, 0x1a, 0x6d,
+  0xa7, 0xbd, 0x72, 0xb4, 0x5d, 0x04, 0x31, 0xa1, 0xd1, 0x68, 0x0b, 0x66,
+  0x81, 0x4c, 0xcc, 0x98, 0x99, 0x84, 0x49, 0xc6, 0xe8, 0x62, 0xd4, 0x4c,
+  0xc1, 0xad, 0xc1, 0x30, 0xcb, 0x7d, 0xac, 0x1a, 0x98, 0xa7, 0x54, 0x4d,
+  0xf6, 0xce, 0x8a, 0x2d, 0xfc, 0x90, 0x26, 0x6a, 0xa7, 0x55, 0xa5, 0x10,
+  0x4f, 0xd1, 0xdc, 0x50, 0xbc, 0x7d, 0xae, 0xb0, 0x12, 0x19, 0x2c, 0xf1,
+  0x47, 0x13, 0x17, 0x57, 0x32, 0x01, 0x91, 0x4e, 0xe8, 0x77, 0x38, 0x8c,
+  0x5a, 0x18, 0x40, 0x37, 0x6b, 0x94, 0x2e, 0x25, 0x47, 0x0d, 0x64, 0x6a,
+  0x36, 0xe9, 0xc9, 0xa4, 0x79, 0x60, 0xa5, 0xfc, 0x1a, 0x71, 0x92, 0xbc,
+  0xf3, 0x26, 0x96, 0xcf, 0xc6, 0x7b, 0x46, 0x41, 0x9a, 0x11, 0xd3, 0xc6,
+  0xf2, 0xd0, 0x44, 0x58, 0xcb, 0x21, 0x03, 0xa1, 0xc4, 0x5f, 0xd0, 0xbf,
+  0x41, 0x66, 0x1f, 0x01, 0x08, 0xa1, 0x87, 0x00, 0x98, 0xd0, 0x28, 0x80,
+  0xa3, 0xaa, 0xae, 0x23, 0xd2, 0xb6, 0x48, 0xd5, 0x15, 0x9a, 0x2b, 0xe9,
+  0x43, 0xad, 0xcd, 0xab, 0xb5, 0xd3, 0xd4, 0xfc, 0x14, 0x74, 0x4b, 0x1a,
+  0x0a, 0xe9, 0x0b, 0x34, 0x1a, 0xc6, 0xeb, 0x9d, 0x2a, 0x35, 0x52, 0x59,
+  0x04, 0x29, 0x38, 0x7f, 0xa1, 0x6e, 0xb1, 0x1e, 0x08, 0xbb, 0x47, 0xa0,
+  0xf9, 0xd9, 0x22, 0x14, 0xa6, 0x75, 0x35, 0xda, 0x25, 0xc9, 0x51, 0x48,
+  0xa3, 0xae, 0x8f, 0x12, 0xda, 0xbd, 0x45, 0x5f, 0xe6, 0x28, 0x65, 0xb0,
+  0x9c, 0x01, 0x4b, 0xdb, 0xc6, 0x96, 0x8e, 0xf7, 0x8b, 0x88, 0x19, 0x0a,
+  0xb0, 0x2f, 0x65, 0x7a, 0x43, 0x8a, 0x83, 0x45, 0x23, 0x6a, 0xa2, 0x81,
+  0xb5, 0xb5, 0xa0, 0xca, 0x30, 0x91, 0xe2, 0x7a, 0x89, 0xcb, 0xdb, 0x7a,
+  0xaa, 0x9f, 0x1d, 0xcd, 0xaa, 0xbc, 0x54, 0x56, 0xa0, 0x29, 0xda, 0x59,
+  0x39, 0x7b, 0x61, 0x81, 0x43, 0x22, 0x71, 0x48, 0x9c, 0x2c, 0x12, 0x89,
+  0x87, 0x74, 0xd2, 0xfa, 0xf5, 0xf3, 0xf3, 0xff, 0x7e, 0x75, 0xfa, 0xfc,
+  0x85, 0x70, 0x15, 0xe9, 0x1c, 0xfd, 0x3f, 0xd5, 0xf9, 0x48, 0xbb, 0x29,
+  0x89, 0x95, 0x07, 0x61, 0x9e, 0x92, 0x26, 0x7e, 0x5e, 0x06, 0xcc, 0xf7,
+  0x8b, 0x70, 0x0f, 0xa9, 0xb0, 0xb0, 0xb3, 0x95, 0x77, 0x34, 0x38, 0x6c,
+  0x06, 0xb0, 0xfc, 0x9a, 0xb9, 0x9f, 0xa4, 0x49, 0x0a, 0xdd, 0x68, 0x5a,
+  0xd5, 0x9d, 0xa7, 0x89, 0x3e, 0xd3, 0x78, 0xda, 0xf0, 0x9e, 0x0f, 0xc0,
+  0xd1, 0xa6, 0x5b, 0xd8, 0xc7, 0xa0, 0x8e, 0xb6, 0x70, 0xd1, 0xaa, 0xfc,
+  0x6d, 0x99, 0x62, 0x4a, 0x5b, 0x18, 0xd4, 0x7b, 0x16, 0x29, 0x3e, 0x95,
+  0xe3, 0x2d, 0x29, 0x2e, 0xe4, 0x82, 0xca, 0x38, 0xda, 0xa3, 0x9e, 0x29,
+  0x05, 0xc6, 0x43, 0x77, 0x64, 0x79, 0x1f, 0x05, 0x8c, 0x16, 0x2b, 0xde,
+  0x0e, 0xb9, 0x15, 0xc7, 0x81, 0xec, 0x2f, 0xca, 0x13, 0x9f, 0xa8, 0xe2,
+  0xe5, 0xa1, 0xec, 0x2f, 0x9f, 0x7e, 0xf8, 0xa4, 0x5b, 0x70, 0x6e, 0x46,
+  0xd9, 0x0f, 0x39, 0x7b, 0x77, 0xc2, 0x05, 0xa7, 0x65, 0x54, 0x82, 0xbe,
+  0x22, 0x41, 0x5f, 0x71, 0x12, 0x23, 0x28, 0xbc, 0x05, 0x25, 0xb4, 0x1d,
+  0xa8, 0x05, 0xa0, 0xd5, 0x82, 0xbd, 0x40, 0xe6, 0xa1, 0xaa, 0x35, 0x57,
+  0x8e, 0x71, 0x0a, 0x4a, 0xd7, 0x03, 0x24, 0x15, 0x00, 0x78, 0x10, 0x56,
+  0x01, 0x94, 0x5c, 0x17, 0x30, 0xd4, 0x10, 0x0e, 0x33, 0xd4, 0xc8, 0xa1,
+  0xe4, 0xbf, 0x11, 0x46, 0x90, 0xa6, 0xaf, 0x91, 0x46, 0xc9, 0x08, 0x0a,
+  0xc3, 0x5c, 0x35, 0xb1, 0x51, 0xb8, 0xa6, 0xc4, 0xb4, 0x68, 0x4d, 0x87,
+  0xba, 0xbb, 0xd3, 0xae, 0xa9, 0xcc, 0xcc, 0x64, 0xd0, 0xf7, 0x65, 0x82,
+  0x28, 0x29, 0x93, 0x6a, 0x42, 0x2b, 0xb0, 0x62, 0xca, 0x35, 0xab, 0xc5,
+  0x90, 0x24, 0xbc, 0xb4, 0xa3, 0x2f, 0x88, 0x86, 0x54, 0x0d, 0x75, 0xa9,
+  0xaa, 0x17, 0xc4, 0x06, 0xac, 0x1c, 0x69, 0xeb, 0xf3, 0xb4, 0xd5, 0x5b,
+  0xe4, 0xf3, 0x8b, 0xd3, 0xb3, 0x91, 0x57, 0x93, 0x0c, 0x63, 0x06, 0xdc,
+  0x28, 0xcb, 0xcd, 0x31, 0x44, 0x93, 0x8d, 0x31, 0x3f, 0x6e, 0x03, 0xbc,
+  0x22, 0x0d, 0x70, 0x4c, 0x1b, 0x60, 0xa1, 0xc1, 0x25, 0xa2, 0xf3, 0x8c,
+  0x66, 0xe3, 0x39, 0xaf, 0x26, 0x57, 0x1f, 0xd7, 0xb7, 0xd1, 0xad, 0x62,
+  0xb3, 0x9c, 0x90, 0x98, 0xbb, 0x9a, 0x5d, 0x63, 0x74, 0xdf, 0x86, 0x57,
+  0x2b, 0xbd, 0x6f, 0xd3, 0x6b, 0x8a, 0xdc, 0xa0, 0xf1, 0x35, 0x25, 0xc0,
+  0xb7, 0xf9, 0xb5, 0xc4, 0xdf, 0xa2, 0x01, 0xe6, 0xb3, 0x41, 0x28, 0x94,
+  0xb0, 0xfc, 0x14, 0xd4, 0xca, 0x44, 0xad, 0x15, 0x86, 0x53, 0xf5, 0x9a,
+  0x66, 0x85, 0xcf, 0x06, 0x8d, 0x50, 0xf5, 0xf6, 0xb8, 0x0e, 0xa5, 0x16,
+  0x0a, 0x19, 0xad, 0x16, 0xaa, 0x36, 0x0c, 0x4e, 0xc0, 0xc4, 0x0a, 0x58,
+  0x6f, 0xa3, 0xad, 0x89, 0xad, 0x9a, 0xb5, 0x0e, 0xa9, 0xc6, 0x74, 0x8d,
+  0xa9, 0x4e, 0xd3, 0xd2, 0xb7, 0xce, 0xc2, 0x8b, 0x95, 0x0b, 0x6d, 0xd1,
+  0xac, 0x5c, 0xa0, 0x21, 0xb3, 0x35, 0xcf, 0xc2, 0x8b, 0x55, 0x45, 0xc6,
+  0x44, 0xe9, 0xc8, 0xd4, 0x74, 0x0d, 0xc5, 0x74, 0x0d, 0x35, 0xe9, 0xd2,
+  0x14, 0x5a, 0x2f, 0x5e, 0xc6, 0xd4, 0xf5, 0xc5, 0xd4, 0xf5, 0x59, 0xea,
+  0xa4, 0xe6, 0x97, 0x9e, 0x49, 0xa1, 0xdb, 0xb9, 0x37, 0x65, 0x51, 0x8c,
+  0xaf, 0x88, 0x8b, 0x9b, 0x48, 0xb1, 0x71, 0x00, 0x3b, 0x24, 0x75, 0x6a,
+  0xc2, 0xce, 0xaa, 0x54, 0xd1, 0x93, 0xf1, 0x15, 0xf1, 0x6d, 0x19, 0xa9,
+  0x66, 0x0c, 0xba, 0xf8, 0xd4, 0xbd, 0x0e, 0x8b, 0x4c, 0x4d, 0x15, 0x38,
+  0x7f, 0xc5, 0x60, 0x83, 0xe9, 0x8d, 0x38, 0xd8, 0x09, 0xfe, 0xa8, 0xb6,
+  0x9b, 0xe3, 0x3c, 0x2b, 0xa7, 0xf3, 0x14, 0x5c, 0x32, 0xc0, 0x7e, 0xf3,
+  0x6c, 0x79, 0x8d, 0x9e, 0xec, 0xfb, 0xcd, 0xd5, 0xd1, 0xe2, 0x88, 0x58,
+  0x7c, 0xd3, 0xa7, 0x4b, 0x51, 0x64, 0x38, 0x2f, 0x6b, 0x9f, 0xe4, 0x55,
+  0xa7, 0x83, 0x6d, 0x30, 0xbb, 0x2e, 0x18, 0xf0, 0x11, 0xee, 0x86, 0xd9,
+  0x71, 0xc1, 0x24, 0xd9, 0x8d, 0x07, 0xcc, 0x63, 0x13, 0x4c, 0x22, 0x29,
+  0x27, 0xa9, 0xb2, 0xb1, 0x5a, 0xbb, 0xf2, 0x54, 0x4f, 0x22, 0xe9, 0xc7,
+  0x03, 0xc9, 0xa8, 0xa1, 0x44, 0x52, 0x91, 0x07, 0x92, 0x51, 0x49, 0x89,
+  0xa4, 0x25, 0x0f, 0x24, 0xaa, 0x27, 0xc5, 0x3c, 0x8c, 0x99, 0x86, 0x81,
+  0x4b, 0x7b, 0x93, 0x61, 0x19, 0x09, 0x53, 0x0d, 0xcb, 0x78, 0xcc, 0x78,
+  0x63, 0x8e, 0x89, 0xc3, 0x8c, 0x31, 0x01, 0xd7, 0x68, 0x8e, 0x46, 0x42,
+  0xad, 0x5c, 0xcd, 0x71, 0x71, 0xa8, 0x29, 0x2e, 0xf7, 0x3e, 0xa0, 0x17,
+  0x9a, 0x07, 0xbb, 0xe2, 0x1b, 0xd9, 0x73, 0x02, 0x13, 0x02, 0x75, 0x05,
+  0xa0, 0xe7, 0x4f, 0x03, 0xed, 0x71, 0x8d, 0xbc, 0x69, 0xb0, 0x31, 0xb6,
+  0x2d, 0xe5, 0x53, 0x7b, 0xba, 0xa7, 0xf6, 0x54, 0x4f, 0xd5, 0x34, 0xbf,
+  0x15, 0x23, 0x17, 0xef, 0xb0, 0xff, 0x5e, 0x3d, 0x63, 0x1a, 0x68, 0x8d,
+  0x6a, 0xe4, 0x4b, 0x83, 0x0d, 0x91, 0xf3, 0x89, 0xd9, 0x62, 0x92, 0x84,
+  0x99, 0x22, 0x5a, 0x25, 0xce, 0xed, 0x22, 0x0b, 0x9e, 0x00, 0x0c, 0x35,
+  0xa3, 0x22, 0xb0, 0x40, 0xcc, 0x5c, 0x10, 0x33, 0x27, 0x04, 0x39, 0x7f,
+  0x6f, 0xac, 0x28, 0x9c, 0xa2, 0x82, 0x10, 0x0c, 0x46, 0xd9, 0x75, 0x5d,
+  0x06, 0x1d, 0xd0, 0x50, 0x5b, 0x54, 0x23, 0x67, 0x16, 0x6e, 0xb3, 0x57,
+  0x4d, 0xcc, 0x89, 0x4f, 0x48, 0xb2, 0xd5, 0x01, 0x87, 0x7c, 0xd3, 0x9a,
+  0x98, 0x04, 0xf7, 0x65, 0x6b, 0x55, 0xfc, 0xa4, 0x1e, 0xdf, 0xe3, 0x9a,
+  0x37, 0xa0, 0x56, 0xee, 0x3b, 0xb3, 0x0a, 0x50, 0xbf, 0xae, 0x4c, 0x40,
+  0xf0, 0x12, 0x81, 0x5d, 0x56, 0x66, 0x19, 0x17, 0x2c, 0xdc, 0xe3, 0x02,
+  0xb6, 0x41, 0x59, 0x8d, 0x48, 0xc0, 0xc7, 0x35, 0x7d, 0xbe, 0x74, 0x2c,
+  0x0b, 0x23, 0x06, 0x8b, 0x65, 0xe9, 0xcf, 0xe3, 0xcf, 0x6d, 0x98, 0x10,
+  0x95, 0x36, 0x4d, 0xc4, 0x07, 0x6f, 0xfc, 0xcd, 0x76, 0x0c, 0x7e, 0x71,
+  0x32, 0x48, 0xa4, 0x7c, 0x70, 0x76, 0xd2, 0x7c, 0xa7, 0xb6, 0xc5, 0x86,
+  0xb8, 0x4c, 0x4b, 0xf0, 0xec, 0xc3, 0x04, 0xe7, 0x45, 0x03, 0x3e, 0x7f,
+  0x6e, 0xc5, 0x68, 0x99, 0x6f, 0x99, 0x98, 0x0f, 0xfe, 0x3c, 0x36, 0x5b,
+  0x33, 0xf9, 0x45, 0x61, 0x02, 0xe3, 0x6a, 0xf0, 0x29, 0x60, 0xb9, 0xa2,
+  0xeb, 0x6a, 0x6e, 0xf4, 0xcd, 0xc3, 0x9f, 0x26, 0xea, 0xb8, 0x0c, 0x8d,
+  0x17, 0x27, 0x7a, 0x93, 0x65, 0x8a, 0x69, 0xf4, 0xb5, 0x63, 0xc1, 0xdc,
+  0xb5, 0x63, 0x2e, 0x1a, 0x0a, 0x3a, 0x01, 0x1f, 0x36, 0x86, 0x41, 0xa4,
+  0x00, 0xda, 0x4c, 0xd2, 0xdd, 0x16, 0x86, 0x6c, 0x9b, 0x85, 0x4d, 0x44,
+  0xad, 0xba, 0xee, 0x92, 0x6b, 0xa0, 0xd8, 0x44, 0xd4, 0x6c, 0x73, 0x5c,
+  0x97, 0xbc, 0x8b, 0xe6, 0x02, 0x3b, 0x14, 0x9c, 0x48, 0x1a, 0x6e, 0x02,
+  0xec, 0x50, 0xb2, 0xd0, 0x7a, 0x89, 0x85, 0x57, 0x69, 0xbf, 0xf8, 0x93,
+  0xaf, 0x8e, 0x25, 0x58, 0xe3, 0x6c, 0xd0, 0x02, 0xeb, 0x96, 0x76, 0xd1,
+  0x50, 0x5c, 0x9b, 0x86, 0x65, 0xdc, 0x66, 0xf2, 0xba, 0x15, 0x9c, 0x28,
+  0x1a, 0xd6, 0xb7, 0x46, 0xd5, 0x63, 0x03, 0x25, 0x27, 0x8a, 0x96, 0x9b,
+  0x43, 0x7b, 0x48, 0xbd, 0x68, 0x2e, 0xb6, 0x43, 0xd9, 0x89, 0xaa, 0xed,
+  0x26, 0xd8, 0xaa, 0xc2, 0xf9, 0x7a, 0x07, 0xbe, 0xcc, 0xb1, 0x13, 0x14,
+  0xd3, 0xf5, 0xd5, 0xd5, 0x8c, 0xde, 0x92, 0x97, 0xe6, 0xf3, 0x75, 0xe9,
+  0xb2, 0xb2, 0x17, 0x2f, 0x60, 0xad, 0x65, 0xb9, 0xff, 0x05, 0xac, 0x4d,
+  0xaf, 0x01, 0x6d, 0x74, 0x01, 0xab, 0xa8, 0x35, 0xf1, 0x0e, 0x56, 0x8d,
+  0xd2, 0xfe, 0x87, 0x5c, 0x19, 0xab, 0x2a, 0xd8, 0xb0, 0x08, 0xc3, 0x9f,
+  0x94, 0xbb, 0x40, 0x87, 0xc2, 0x95, 0xa5, 0x43, 0xfb, 0x95, 0xa5, 0x64,
+  0x3c, 0x25, 0x8e, 0x08, 0x85, 0xab, 0x40, 0x87, 0xf6, 0x2b, 0x4b, 0x6b,
+  0x7a, 0x35, 0xae, 0x82, 0x54, 0x8f, 0xea, 0xe5, 0xaa, 0xc2, 0xad, 0xa5,
+  0x7d, 0xfb, 0xad, 0xa5, 0x74, 0x8c, 0x21, 0x8e, 0x96, 0xc4, 0xdb, 0x55,
+  0x35, 0xb7, 0x96, 0xea, 0x67, 0x34, 0xb4, 0x8c, 0x9b, 0x27, 0xc2, 0x3c,
+  0xdc, 0x34, 0x09, 0x5f, 0x2f, 0xe0, 0xf6, 0xb9, 0xd9, 0xd2, 0x08, 0x21,
+  0x10, 0xd8, 0x31, 0xa6, 0x99, 0x03, 0x03, 0x13, 0xb8, 0xe5, 0x30, 0x4e,
+  0xf1, 0x04, 0x12, 0xb7, 0x24, 0x0e, 0x14, 0x4c, 0xa2, 0x9d, 0xea, 0x54,
+  0x8b, 0x73, 0x4c, 0x77, 0x9e, 0xf5, 0xab, 0x66, 0x9b, 0x41, 0xfd, 0xd9,
+  0xb1, 0x1b, 0x8a, 0x3a, 0xc2, 0x4d, 0x41, 0x61, 0x9b, 0x7c, 0xb2, 0x98,
+  0x66, 0xc7, 0x3f, 0x46, 0xa8, 0xbd, 0x6f, 0xb1, 0x18, 0x11, 0x8e, 0xd1,
+  0x26, 0x7e, 0x11, 0xc5, 0x80, 0x1e, 0x0d, 0xb0, 0x1a, 0xf0, 0xd0, 0xf6,
+  0xcf, 0xe7, 0x36, 0x2b, 0xb9, 0xd8, 0x50, 0x03, 0x63, 0xec, 0x13, 0xc3,
+  0x76, 0x76, 0x95, 0x33, 0xa8, 0xdd, 0x69, 0x6f, 0xe0, 0xa0, 0x51, 0x4f,
+  0xac, 0xaa, 0x47, 0x2e, 0xfd, 0x42, 0xb1, 0xaf, 0x92, 0xa3, 0x2f, 0x6f,
+  0x55, 0xb8, 0x3d, 0x8b, 0x65, 0xa9, 0x59, 0x16, 0x37, 0xce, 0xd7, 0x9a,
+  0xe0, 0x5b, 0xe5, 0x6b, 0xdc, 0x20, 0x5f, 0x23, 0xc1, 0xb6, 0x93, 0x26,
+  0x22, 0xda, 0x48, 0xa7, 0xec, 0x30, 0x05, 0x2f, 0xaf, 0xfa, 0x1b, 0xaf,
+  0x49, 0x88, 0x78, 0x0e, 0x1c, 0xf5, 0x9a, 0xfa, 0x1e, 0x22, 0xc2, 0x3d,
+  0x04, 0x2e, 0x08, 0x48, 0xb8, 0x67, 0x70, 0xd3, 0xd3, 0xef, 0x3c, 0x91,
+  0x05, 0xbf, 0xd3, 0x96, 0xb6, 0x74, 0x72, 0x1f, 0x32, 0x94, 0x3b, 0x0f,
+  0xa3, 0xa9, 0x78, 0xd6, 0xae, 0x8c, 0xab, 0xe9, 0xa1, 0x32, 0xb0, 0x9f,
+  0x6a, 0x57, 0x98, 0xd8, 0xcb, 0xb6, 0x3f, 0x56, 0x01, 0x82, 0x07, 0xdf,
+  0x18, 0xa8, 0x90, 0x72, 0x8a, 0xb6, 0x25, 0xa3, 0xf4, 0xbf, 0x27, 0x06,
+  0x34, 0xa4, 0xdf, 0x02, 0x8d, 0x44, 0xa2, 0x36, 0x3b, 0xa7, 0x2f, 0x14,
+  0x1d, 0xed, 0x01, 0x45, 0x96, 0x6d, 0x57, 0xb5, 0x73, 0x83, 0xf5, 0x0c,
+  0xb5, 0xc6, 0xe5, 0xe7, 0xcb, 0xa5, 0x6b, 0xbf, 0x68, 0x77, 0x68, 0x2e,
+  0x23, 0xdc, 0xb6, 0x81, 0xdc, 0x5b, 0xcf, 0xdf, 0xe0, 0x02, 0x7b, 0x7c,
+  0x41, 0x58, 0x7d, 0xfb, 0x4d, 0x66, 0x9b, 0x98, 0xd9, 0x26, 0x77, 0xe4,
+  0x6b, 0x3b, 0xb6, 0x4b, 0x2f, 0xe6, 0xbb, 0xd2, 0x96, 0x76, 0x43, 0xd5,
+  0x35, 0xe5, 0x3f, 0xbb, 0x92, 0xde, 0x55, 0xc5, 0xc8, 0x75, 0x71, 0x7a,
+  0x96, 0x4c, 0x3c, 0x5d, 0x05, 0x73, 0xb0, 0x35, 0xdc, 0x59, 0xa7, 0x68,
+  0x9d, 0x26, 0xb8, 0x7e, 0xbe, 0xb4, 0xa6, 0x09, 0x35, 0x26, 0x11, 0xbb,
+  0x1e, 0x51, 0x4d, 0x8e, 0x81, 0xa3, 0x50, 0xba, 0xd4, 0x3c, 0x46, 0x21,
+  0x6d, 0x63, 0x7e, 0x28, 0x39, 0xac, 0x2f, 0x4b, 0x12, 0x8f, 0xc4, 0xc0,
+  0x23, 0xb9, 0x23, 0x13, 0x21, 0xa1, 0x3e, 0xb5, 0xa4, 0x96, 0xcd, 0xf5,
+  0xb2, 0x8a, 0xcd, 0x9c, 0x6c, 0x75, 0x44, 0x64, 0xe9, 0x53, 0x43, 0xb6,
+  0xe2, 0x69, 0xda, 0x26, 0x86, 0xe5, 0x77, 0x18, 0x75, 0x8a, 0x23, 0x6c,
+  0x83, 0xcf, 0x88, 0x8a, 0xcc, 0x68, 0x44, 0xcc, 0xdb, 0xc6, 0x0f, 0xde,
+  0xb1, 0xc2, 0x36, 0xb9, 0x07, 0xd0, 0x74, 0x55, 0x8c, 0x2c, 0xa4, 0xd0,
+  0xeb, 0x5a, 0xa5, 0x4c, 0x74, 0xfc, 0x12, 0xa7, 0x98, 0x96, 0x68, 0x54,
+  0xce, 0x88, 0xdd, 0x36, 0x4c, 0xfc, 0x53, 0x2c, 0x17, 0x37, 0x69, 0x5e,
+  0x30, 0x7f, 0x41, 0x35, 0xc7, 0x69, 0x47, 0xa7, 0x27, 0xdf, 0x8f, 0xce,
+  0x2e, 0xa8, 0xdd, 0x56, 0x8e, 0xaf, 0x1a, 0x26, 0x09, 0x2f, 0xe1, 0xff,
+  0xa1, 0xc9, 0x7f, 0x5a, 0x4e, 0xed, 0x6a, 0x63, 0xc5, 0x64, 0x4b, 0xbc,
+  0x5d, 0x58, 0x92, 0x34, 0x77, 0x79, 0x4a, 0x8b, 0x9d, 0xfe, 0xf3, 0x72,
+  0x97, 0x33, 0xb4, 0xd8, 0xed, 0x41, 0x4f, 0x4d, 0x37, 0xdb, 0xd3, 0x60,
+  0x17, 0xf4, 0x6a, 0x47, 0x5f, 0xa4, 0xf0, 0xf2, 0x66, 0x91, 0x8c, 0xc7,
+  0x84, 0x28, 0x6d, 0x0b, 0xec, 0x4a, 0xb8, 0x03, 0xbb, 0x06, 0xa3, 0x19,
+  0xe6, 0x09, 0x51, 0x6c, 0xb0, 0xdb, 0xe0, 0x0a, 0xc0, 0xb6, 0x01, 0x64,
+  0x95, 0x30, 0x36, 0xee, 0x95, 0x2f, 0xdd, 0x06, 0x3f, 0x3b, 0x37, 0xf5,
+  0xcb, 0x52, 0xf5, 0x43, 0xca, 0x1b, 0xec, 0xc5, 0xe6, 0x06, 0x7b, 0xac,
+  0xb9, 0xc1, 0xde, 0xb5, 0x6f, 0x4c, 0xfe, 0xbb, 0x15, 0x19, 0xb8, 0x87,
+  0x92, 0x50, 0xef, 0xc0, 0x5b, 0x1e, 0xb8, 0x76, 0x05, 0x2f, 0xe1, 0x91,
+  0x87, 0x97, 0x70, 0xc6, 0x44, 0x71, 0xcb, 0xe2, 0x76, 0x13, 0xee, 0xc7,
+  0x22, 0x93, 0x79, 0xf0, 0x9b, 0x68, 0xed, 0x6c, 0x2a, 0x2b, 0x22, 0x62,
+  0x75, 0x9a, 0xa3, 0x27, 0xcc, 0x18, 0x37, 0x93, 0xca, 0x57, 0x34, 0x95,
+  0xb0, 0x0d, 0xc9, 0x6b, 0xf4, 0x91, 0x16, 0x05, 0x25, 0xc1, 0x27, 0x0d,
+  0xdb, 0x25, 0x82, 0xe8, 0x8c, 0x3e, 0x86, 0xd5, 0x63, 0x54, 0x3d, 0x32,
+  0x15, 0xb2, 0xf6, 0x8a, 0xdc, 0xad, 0x0a, 0xcb, 0x5b, 0xf3, 0xac, 0xa8,
+  0x5b, 0xf4, 0x08, 0x4d, 0x2e, 0xbb, 0x01, 0xd4, 0x34, 0x37, 0x50, 0xa7,
+  0x04, 0x1e, 0xf7, 0xac, 0xe2, 0x3f, 0x11, 0xf9, 0xa3, 0xcb, 0x5b, 0x85,
+  0xfb, 0xa4, 0x21, 0x77, 0xd7, 0xc5, 0xab, 0x0d, 0xd9, 0x93, 0x8b, 0x47,
+  0x5d, 0x02, 0x30, 0x46, 0x1a, 0xad, 0x49, 0x97, 0xb1, 0xaa, 0x89, 0xaa,
+  0xee, 0x63, 0xad, 0xd9, 0xee, 0x52, 0x6a, 0x98, 0xce, 0xac, 0x57, 0x68,
+  0x34, 0xcc, 0x5d, 0x64, 0x98, 0x8f, 0xb3, 0x01, 0x6d, 0x3c, 0x9b, 0x09,
+  0x94, 0x34, 0xc7, 0xa3, 0x27, 0x90, 0xac, 0xf4, 0x3a, 0xcd, 0xb5, 0x26,
+  0x5d, 0x1d, 0x70, 0x7e, 0x7d, 0xb9, 0x2c, 0xa7, 0xdc, 0xf5, 0xee, 0x2c,
+  0x5e, 0xa4, 0x26, 0x87, 0x4b, 0xbc, 0xc4, 0xc2, 0x9a, 0x2e, 0xbb, 0x89,
+  0xba, 0xae, 0x19, 0x8d, 0x8f, 0x22, 0xbc, 0x44, 0x05, 0x3e, 0x85, 0xdb,
+  0x60, 0xe2, 0xc4, 0x5f, 0x4c, 0x3b, 0x70, 0x2a, 0xa3, 0xd0, 0x90, 0x07,
+  0x26, 0x4e, 0xe0, 0x13, 0x99, 0x73, 0xc2, 0x2f, 0xbe, 0x9c, 0x44, 0x4b,
+  0x39, 0x1f, 0x4e, 0x64, 0xd1, 0xf0, 0x91, 0x73, 0x17, 0x56, 0xe5, 0xc3,
+  0x4d, 0xfa, 0x8c, 0x7c, 0x2c, 0xb6, 0x60, 0xd5, 0xc9, 0xe3, 0xf5, 0xe5,
+  0xf6, 0xf9, 0xb0, 0xdb, 0x20, 0x1f, 0x28, 0xa3, 0x2d, 0xf3, 0x61, 0xb7,
+  0x41, 0x3e, 0x50, 0x4e, 0xdb, 0xe5, 0xc3, 0xae, 0x7f, 0x3e, 0x50, 0x3e,
+  0x3e, 0xf9, 0x60, 0xb4, 0xa4, 0xe3, 0x60, 0xf3, 0xf5, 0x6c, 0xb6, 0xbc,
+  0x83, 0x82, 0x76, 0x1a, 0x28, 0x88, 0xf3, 0xda, 0x4e, 0x45, 0x3b, 0x0d,
+  0x8a, 0xea, 0x22, 0xb1, 0x35, 0x80, 0xa2, 0x8a, 0xbe, 0x72, 0xaa, 0x88,
+  0x1a, 0x06, 0x78, 0xe1, 0xfd, 0xe9, 0x03, 0x88, 0x2f, 0xfd, 0xf4, 0x12,
+  0xee, 0x83, 0x13, 0x6b, 0xe3, 0x0f, 0xf6, 0x8b, 0x60, 0xc2, 0x68, 0xf2,
+  0x5f, 0x35, 0x5f, 0xa5, 0xef, 0xb6, 0xab, 0x97, 0x45, 0x1b, 0xbb, 0xad,
+  0xe4, 0x6f, 0xce, 0x3c, 0xe2, 0xbc, 0xb6, 0x2c, 0x79, 0x94, 0x99, 0x5f,
+  0xd1, 0xe3, 0xcc, 0xb6, 0x2b, 0x7a, 0xcf, 0x9e, 0xf9, 0x97, 0x3d, 0xce,
+  0xca, 0x5d, 0x41, 0x85, 0xc9, 0x2f, 0x76, 0xf9, 0xe9, 0x01, 0x7d, 0x5d,
+  0x6e, 0x9f, 0x3d, 0x87, 0xcd, 0x72, 0x87, 0xb0, 0xda, 0x32, 0x77, 0x0e,
+  0x9b, 0x65, 0xce, 0x75, 0xb9, 0x7d, 0xe6, 0x1c, 0x36, 0xca, 0x9b, 0xeb,
+  0xb2, 0x79, 0xde, 0x1c, 0xd2, 0xac, 0xb1, 0x58, 0xb4, 0xe2, 0x5c, 0x31,
+  0x4d, 0x08, 0x39, 0x81, 0xcd, 0x26, 0x96, 0x28, 0xdb, 0x05, 0x11, 0x0e,
+  0x1c, 0x18, 0x6b, 0x97, 0x14, 0x6b, 0x97, 0x14, 0x6b, 0xa7, 0x14, 0x6b,
+  0xb3, 0x14, 0xa8, 0x73, 0xb2, 0xeb, 0x82, 0x13, 0xb8, 0x10, 0xcc, 0x52,
+  0x54, 0x14, 0x0e, 0x0c, 0xb3, 0x2e, 0x38, 0x81, 0x0b, 0xc1, 0x29, 0x85,
+  0x45, 0x17, 0xa8, 0xbf, 0x9b, 0x66, 0xf6, 0xa4, 0x08, 0x24, 0x2e, 0x14,
+  0x8b, 0x28, 0x02, 0x89, 0x0d, 0x25, 0x77, 0xe8, 0x55, 0xa4, 0xb1, 0xe0,
+  0x00, 0x23, 0xc3, 0xea, 0x02, 0x01, 0x21, 0x04, 0x76, 0x04, 0xd3, 0xfa,
+  0x04, 0x47, 0xc8, 0x2c, 0x08, 0x7c, 0x6c, 0x6d, 0x84, 0xe0, 0x14, 0x36,
+  0x0c, 0x67, 0x41, 0x93, 0x88, 0x8c, 0xb5, 0xe6, 0xe6, 0xda, 0x5e, 0xed,
+  0x68, 0xb8, 0x23, 0xbe, 0xa5, 0xd2, 0x31, 0x02, 0x63, 0x59, 0xc5, 0x27,
+  0x34, 0x2d, 0x85, 0x9d, 0x86, 0xdb, 0x4e, 0x12, 0xd8, 0xaa, 0x2c, 0x0b,
+  0xb7, 0x9d, 0x26, 0xb0, 0xc6, 0xa7, 0xe1, 0x0e, 0xfe, 0x96, 0x7c, 0x60,
+  0x04, 0x0e, 0x09, 0x6c, 0x39, 0xb9, 0x71, 0x20, 0x10, 0x16, 0x96, 0x52,
+  0xc9, 0x08, 0x1c, 0x32, 0x58, 0x10, 0x18, 0x81, 0x5d, 0x06, 0x73, 0x3e,
+  0xb2, 0x70, 0xbb, 0x04, 0x96, 0xf8, 0x34, 0xdc, 0xc1, 0xdf, 0x95, 0x0f,
+  0xb6, 0x56, 0x86, 0x70, 0x70, 0xe5, 0x83, 0x0d, 0x81, 0xb0, 0x70, 0xe5,
+  0x83, 0xad, 0x7d, 0x21, 0x2c, 0x5c, 0xf9, 0x60, 0x41, 0x00, 0xb7, 0xfb,
+  0xf6, 0x3e, 0x8c, 0x11, 0xb8, 0x10, 0x2c, 0xbd, 0x07, 0xa7, 0x70, 0x61,
+  0x98, 0x13, 0x52, 0x51, 0x58, 0x4f, 0xbb, 0x58, 0xe5, 0x98, 0x3a, 0x5b,
+  0xca, 0x29, 0x5f, 0x5f, 0x70, 0x61, 0xd8, 0xe5, 0x70, 0xb4, 0xb5, 0x53,
+  0xf7, 0x08, 0x67, 0xca, 0xe7, 0xf2, 0x46, 0x10, 0x4e, 0xe1, 0xc2, 0xb0,
+  0xa4, 0x86, 0x53, 0xd8, 0x30, 0x5c, 0xa9, 0xd1, 0x8d, 0x51, 0xa4, 0xd3,
+  0x25, 0xb1, 0x63, 0x9c, 0x14, 0xd7, 0x86, 0x49, 0xba, 0xe8, 0x96, 0x5e,
+  0xc3, 0x8f, 0xbf, 0x59, 0x0f, 0x9c, 0xa0, 0x2d, 0xac, 0xc8, 0x15, 0xd3,
+  0xec, 0x4a, 0xf0, 0x6a, 0x0e, 0x40, 0xa2, 0x7d, 0xd6, 0x6c, 0xe6, 0x18,
+  0xef, 0x54, 0x14, 0xda, 0x63, 0x2f, 0x2c, 0xd8, 0x52, 0xe6, 0x39, 0x85,
+  0x15, 0x80, 0x1c, 0xf1, 0xb6, 0x01, 0x0c, 0xfa, 0x7a, 0x80, 0xdc, 0x99,
+  0x84, 0xdc, 0x9e, 0x84, 0xdc, 0x99, 0x84, 0xdc, 0x9e, 0x84, 0xdc, 0x99,
+  0x84, 0xdc, 0x91, 0x84, 0xd8, 0x99, 0x84, 0xd8, 0x9e, 0x84, 0xd8, 0x99,
+  0x84, 0xd8, 0x99, 0x0b, 0x78, 0x55, 0xc2, 0x9a, 0x0b, 0xd8, 0xe0, 0xc5,
+  0xac, 0x03, 0x3b, 0x40, 0x5e, 0x01, 0xa8, 0x9b, 0xd2, 0x97, 0xbc, 0x94,
+  0x55, 0x3b, 0x3a, 0x95, 0x48, 0x75, 0xea, 0xbc, 0x4e, 0xcd, 0xf9, 0xd7,
+  0xf7, 0x45, 0xcf, 0xbf, 0x3b, 0x7e, 0xc9, 0x76, 0x45, 0x75, 0xfb, 0x9f,
+  0x6c, 0x32, 0x89, 0x37, 0x41, 0xe5, 0x49, 0x26, 0xde, 0x3a, 0x99, 0x2c,
+  0xd7, 0x8b, 0x52, 0xdc, 0x18, 0x65, 0x34, 0xfa, 0xdd, 0x51, 0x9e, 0x6a,
+  0xf3, 0xfe, 0x28, 0x27, 0xa1, 0x97, 0x49, 0x11, 0x0e, 0x4e, 0x34, 0xc3,
+  0x56, 0xa9, 0x88, 0x16, 0xd6, 0xd0, 0xf4, 0x7b, 0xa6, 0x44, 0x27, 0x95,
+  0xaa, 0x79, 0xf1, 0x23, 0x59, 0xad, 0x96, 0x35, 0x1d, 0x39, 0x2e, 0x6c,
+  0x15, 0xb9, 0x58, 0xb2, 0x74, 0xe4, 0xb8, 0x76, 0x54, 0xe4, 0x62, 0x55,
+  0x90, 0xc9, 0x73, 0x59, 0x98, 0xdc, 0x21, 0x4c, 0x2e, 0x0b, 0x93, 0x3b,
+  0x84, 0xc9, 0x65, 0x61, 0x72, 0x97, 0x30, 0xb1, 0x2c, 0x4c, 0xec, 0x10,
+  0x26, 0x96, 0x85, 0x89, 0x79, 0x83, 0x2c, 0xf9, 0x58, 0xc1, 0x91, 0xbe,
+  0x17, 0x1c, 0xac, 0x2c, 0x3a, 0xb0, 0x21, 0x52, 0x74, 0x82, 0x74, 0xb3,
+  0xca, 0x4d, 0x7e, 0xaf, 0xd0, 0xdf, 0x0d, 0x76, 0xac, 0x72, 0x7b, 0x07,
+  0xc7, 0x2a, 0x1b, 0x62, 0x1a, 0xdd, 0xc2, 0x8c, 0x94, 0x32, 0xb2, 0x11,
+  0x7c, 0xa9, 0x50, 0x11, 0xc7, 0x34, 0xcb, 0x6e, 0xaa, 0xe6, 0xe5, 0xa6,
+  0x5f, 0xac, 0x3b, 0x01, 0x52, 0x20, 0xbc, 0xde, 0x12, 0x07, 0x2d, 0x3d,
+  0x30, 0x63, 0xc3, 0xd0, 0x07, 0x07, 0xe4, 0xdb, 0x13, 0x54, 0xb0, 0x35,
+  0x48, 0xb9, 0x3f, 0xd2, 0xe1, 0xa1, 0x1d, 0x29, 0x96, 0x91, 0x32, 0x8e,
+  0xc4, 0x62, 0xb7, 0x5a, 0xec, 0x3a, 0xc8, 0xb6, 0x08, 0x4e, 0x41, 0x7b,
+  0x61, 0x5b, 0x07, 0x4b, 0x93, 0xca, 0xfd, 0x9e, 0x20, 0x01, 0x11, 0x24,
+  0xbc, 0x52, 0x8c, 0x41, 0xbf, 0x59, 0x52, 0x7d, 0x90, 0xac, 0x49, 0xa5,
+  0x75, 0x48, 0x4c, 0xed, 0x10, 0xf4, 0x36, 0xdc, 0x26, 0x07, 0x68, 0x1d,
+  0xf0, 0x06, 0x73, 0x4b, 0x26, 0xe7, 0x03, 0x76, 0xed, 0x32, 0xbc, 0x73,
+  0x3e, 0x88, 0x69, 0xe6, 0xce, 0x5f, 0x48, 0x59, 0x69, 0x9e, 0x15, 0x62,
+  0x9a, 0x7d, 0xc0, 0xa4, 0x34, 0x4b, 0xae, 0x4b, 0xaa, 0x6c, 0xa0, 0x1b,
+  0xae, 0x8a, 0x6b, 0x29, 0x21, 0x9c, 0x58, 0x54, 0xac, 0xb9, 0x95, 0x14,
+  0x79, 0xb9, 0x54, 0xdd, 0x56, 0x55, 0x79, 0x61, 0x40, 0xcc, 0x9b, 0x23,
+  0xc6, 0x0e, 0xc4, 0x58, 0x46, 0xcc, 0x44, 0xc4, 0x4c, 0x87, 0xc8, 0x33,
+  0xc2, 0x9e, 0x6a, 0xf0, 0x64, 0x42, 0x4a, 0x7a, 0x85, 0x88, 0x5f, 0x8c,
+  0xa9, 0x36, 0x22, 0xe6, 0x0d, 0x11, 0xe5, 0x3a, 0x22, 0x82, 0x42, 0x47,
+  0xdd, 0xae, 0x57, 0x23, 0xba, 0x1a, 0x2d, 0xe0, 0x0e, 0x75, 0xda, 0x94,
+  0xab, 0x8b, 0x19, 0x37, 0xdf, 0x0a, 0x57, 0x97, 0x51, 0x0a, 0x6e, 0x2c,
+  0xe3, 0x66, 0x22, 0xae, 0x26, 0xaf, 0xe4, 0x7a, 0xe3, 0xd4, 0x03, 0xd5,
+  0x6f, 0x5f, 0xd4, 0x6f, 0xdf, 0xa8, 0x5f, 0x6d, 0xa6, 0x69, 0xf5, 0x60,
+  0xc7, 0xad, 0x26, 0x27, 0x70, 0xd2, 0xa1, 0x13, 0x90, 0x13, 0x0f, 0xf6,
+  0x03, 0x51, 0xf5, 0x39, 0x1d, 0xc4, 0x71, 0xcc, 0xa8, 0x04, 0x12, 0xd3,
+  0xcc, 0x90, 0x93, 0x98, 0x87, 0xce, 0x02, 0x89, 0x0d, 0x65, 0xed, 0x21,
+  0xcc, 0xda, 0x43, 0x9a, 0xb5, 0x87, 0x38, 0x6b, 0x87, 0x3c, 0xfc, 0x24,
+  0x8a, 0x6d, 0xbe, 0x2a, 0x11, 0x39, 0x0f, 0xac, 0xb8, 0x91, 0x28, 0x91,
+  0x8f, 0x4c, 0x66, 0x2d, 0xc9, 0x54, 0x3e, 0x52, 0xb9, 0xb0, 0x5c, 0xab,
+  0xf5, 0x22, 0x47, 0xb3, 0xd6, 0x65, 0x2a, 0x1f, 0xb9, 0x5c, 0x58, 0xd3,
+  0xda, 0x7c, 0xcc, 0x2c, 0x97, 0x79, 0x66, 0x29, 0x53, 0xf9, 0xc8, 0xe5,
+  0xc2, 0x9a, 0xd6, 0x66, 0xaa, 0xca, 0x2a, 0x17, 0x3d, 0x7b, 0x63, 0x5d,
+  0x6e, 0x13, 0x68, 0xf4, 0xd3, 0xc5, 0x8a, 0xc0, 0x32, 0x67, 0x15, 0x89,
+  0x6c, 0x30, 0xae, 0x42, 0xa5, 0x90, 0xd9, 0xa0, 0x5c, 0x65, 0x4a, 0x21,
+  0xb3, 0x79, 0xf3, 0x88, 0x67, 0x68, 0xcc, 0x93, 0xdb, 0x97, 0x8c, 0x2a,
+  0x12, 0x1b, 0x12, 0x39, 0x47, 0x69, 0x95, 0x4b, 0x20, 0xd1, 0x5a, 0x84,
+  0xf2, 0x0d, 0x55, 0x4e, 0x68, 0xd8, 0xba, 0xd5, 0x9c, 0x12, 0xc0, 0x47,
+  0x1c, 0x37, 0xc2, 0x11, 0x47, 0x44, 0x7f, 0x2b, 0xbc, 0x5e, 0x3a, 0x2f,
+  0x6a, 0x6c, 0x7a, 0xe2, 0x94, 0x4e, 0x52, 0x6e, 0xd5, 0xf3, 0x9b, 0xbc,
+  0xc3, 0xd9, 0xd8, 0xec, 0x1c, 0xd5, 0x34, 0x12, 0xab, 0xd7, 0x6a, 0x3e,
+  0x6f, 0x3b, 0x1a, 0x57, 0x5d, 0x85, 0x17, 0x52, 0x37, 0xda, 0xd5, 0xa1,
+  0x5b, 0x1a, 0x4a, 0xae, 0xcc, 0xc2, 0x3e, 0x4f, 0x3a, 0x41, 0xed, 0x23,
+  0x98, 0xc1, 0x63, 0x2b, 0x78, 0xd7, 0x99, 0x0d, 0x7a, 0x88, 0x33, 0x35,
+  0xd9, 0x06, 0x54, 0x8f, 0xf2, 0x31, 0x4e, 0xfa, 0x8d, 0xe8, 0x9f, 0x68,
+  0xa3, 0x32, 0x19, 0xc0, 0x47, 0x3a, 0xc1, 0x5f, 0xa6, 0xac, 0x36, 0xe1,
+  0xfc, 0x26, 0x39, 0xb7, 0xe9, 0x79, 0x66, 0xab, 0xbf, 0x19, 0xf4, 0x69,
+  0x7f, 0x2e, 0x88, 0xe8, 0x3e, 0x7f, 0x96, 0xd2, 0xcb, 0x3f, 0xe8, 0x19,
+  0xb4, 0x9e, 0x74, 0x06, 0x0d, 0x9f, 0x28, 0xeb, 0x59, 0xcf, 0xa0, 0xc1,
+  0xaf, 0x8a, 0xd0, 0x6f, 0xd7, 0x30, 0x06, 0xe4, 0x93, 0xd3, 0xf6, 0x58,
+  0x4c, 0xc7, 0x1d, 0x0e, 0xd1, 0x35, 0x4e, 0xc0, 0x5d, 0x84, 0x57, 0x33,
+  0xe1, 0x26, 0xce, 0x87, 0x9b, 0x5e, 0x64, 0xae, 0xb3, 0x59, 0xb2, 0xb1,
+  0x57, 0xd6, 0x85, 0xf0, 0x8a, 0x88, 0x3b, 0x1e, 0x57, 0xab, 0xaa, 0x35,
+  0x96, 0x7a, 0xbc, 0xde, 0xfc, 0xb8, 0x80, 0x87, 0xaf, 0x82, 0x7d, 0x43,
+  0xc5, 0x74, 0x5d, 0xab, 0xa3, 0xa4, 0x49, 0x73, 0xd2, 0x5a, 0x4a, 0x8f,
+  0xfe, 0x4e, 0x11, 0xad, 0x62, 0xb8, 0x08, 0x90, 0xb9, 0x08, 0xc1, 0xeb,
+  0x88, 0x87, 0x5c, 0xfb, 0x6c, 0x87, 0x3c, 0x28, 0xa5, 0x71, 0x11, 0xcf,
+  0x78, 0xcc, 0xc3, 0x1e, 0x91, 0x1e, 0xf4, 0x08, 0x07, 0x36, 0x71, 0xe9,
+  0xe9, 0xa2, 0x5a, 0x5b, 0xc1, 0xaf, 0xb7, 0x97, 0xbd, 0x2c, 0xa2, 0x96,
+  0x60, 0x0d, 0x6e, 0x16, 0x69, 0xd9, 0x0d, 0x6d, 0x8e, 0x1b, 0x05, 0xe8,
+  0x50, 0x7b, 0x52, 0x4d, 0xc1, 0x0e, 0x07, 0x53, 0x01, 0x3b, 0xdc, 0xf3,
+  0xc4, 0x96, 0x0b, 0xae, 0x01, 0x9b, 0x7a, 0x87, 0x24, 0xd0, 0xfb, 0x35,
+  0xe4, 0xca, 0x49, 0x66, 0x1d, 0x5f, 0xdf, 0x40, 0x89, 0xee, 0x2b, 0x59,
+  0x45, 0x76, 0x19, 0xd4, 0x91, 0xf3, 0x4e, 0x5a, 0x55, 0x6b, 0xfb, 0x46,
+  0xb0, 0x69, 0xe5, 0xf5, 0x8d, 0x58, 0xbb, 0x92, 0x9a, 0xb1, 0xa9, 0xf4,
+  0x5f, 0x3b, 0x47, 0x67, 0xef, 0xc7, 0xf4, 0xe2, 0xd4, 0xb3, 0x47, 0x2b,
+  0x0f, 0x18, 0x70, 0x71, 0x79, 0x88, 0x69, 0x97, 0x2c, 0x0f, 0xca, 0xb3,
+  0x8f, 0x22, 0x4f, 0x3d, 0x4b, 0xfd, 0xc6, 0x0e, 0xb2, 0x34, 0xfb, 0x1f,
+  0x47, 0x18, 0x39, 0xff, 0xab, 0x92, 0x52, 0x17, 0xa9, 0x2a, 0x09, 0x86,
+  0xd3, 0x8d, 0x7c, 0x72, 0xca, 0x2f, 0x3c, 0x20, 0x67, 0x18, 0xde, 0x67,
+  0x49, 0xba, 0x80, 0x9b, 0xdd, 0xd5, 0x63, 0x58, 0xc6, 0x51, 0x08, 0x8b,
+  0x5f, 0xd9, 0x4d, 0xd3, 0xf3, 0x37, 0x9a, 0x2b, 0x29, 0x30, 0x05, 0xad,
+  0x61, 0xef, 0xa8, 0x93, 0x54, 0xdb, 0x05, 0xb1, 0x15, 0xfa, 0xfb, 0xaa,
+  0x70, 0x58, 0xe1, 0x11, 0x09, 0xa9, 0x65, 0xd3, 0x46, 0xf0, 0xb5, 0x71,
+  0x94, 0x01, 0x1e, 0x5a, 0x60, 0xb6, 0x84, 0xd4, 0x00, 0x5e, 0xb0, 0xbb,
+  0xb4, 0xc2, 0x93, 0xe1, 0x84, 0x1e, 0x55, 0x1a, 0x55, 0xf9, 0x29, 0x9d,
+  0x76, 0xf2, 0xfe, 0x7a, 0xd7, 0xf2, 0x70, 0xa8, 0x5e, 0x64, 0xe2, 0xa5,
+  0x7d, 0x2d, 0x13, 0x47, 0x06, 0x88, 0x4c, 0xbc, 0xf2, 0x40, 0xcb, 0xc4,
+  0x91, 0x0d, 0x22, 0x93, 0xc6, 0x39, 0xa1, 0xbf, 0x5e, 0x57, 0x7b, 0x69,
+  0x1c, 0x0e, 0x6c, 0x99, 0xee, 0xa2, 0x0b, 0xd5, 0xdb, 0x5e, 0x8a, 0x42,
+  0x74, 0x18, 0x61, 0xb8, 0xe9, 0xc5, 0x24, 0x6b, 0xc8, 0x5c, 0x43, 0x54,
+  0x70, 0xb2, 0x2f, 0x2c, 0x2d, 0x5e, 0x62, 0x4b, 0x7b, 0x3d, 0xe9, 0x16,
+  0x01, 0xb9, 0x4e, 0x2d, 0x32, 0x8a, 0x43, 0x59, 0x3f, 0x31, 0x2b, 0x54,
+  0x41, 0x52, 0x69, 0xed, 0x55, 0x97, 0x2f, 0xb6, 0x3c, 0xab, 0xef, 0xa7,
+  0x8e, 0x7e, 0xb8, 0x18, 0x9d, 0xb0, 0x1b, 0x5b, 0x8a, 0x92, 0x1c, 0x35,
+  0xad, 0x5d, 0x0d, 0xc0, 0x8a, 0x03, 0xdb, 0x55, 0x65, 0xf9, 0x5e, 0xed,
+  0x5c, 0x15, 0x25, 0xe9, 0x19, 0x8a, 0x12, 0x6e, 0xf1, 0xae, 0x9f, 0x39,
+  0x6d, 0xb8, 0xb3, 0xc5, 0x87, 0xa8, 0xb5, 0x4b, 0x59, 0x84, 0xd1, 0xa9,
+  0xb4, 0x09, 0x4a, 0x13, 0x42, 0x13, 0x4f, 0xce, 0x4a, 0x0e, 0xab, 0x79,
+  0x36, 0x34, 0x09, 0x45, 0x87, 0x75, 0xaa, 0x68, 0xac, 0x26, 0x4c, 0xf7,
+  0x8d, 0x51, 0xe9, 0x3e, 0x08, 0x8f, 0x4a, 0x36, 0x44, 0x3c, 0x22, 0xd2,
+  0x9d, 0x09, 0x1e, 0x11, 0x3b, 0xb9, 0xef, 0xdb, 0x23, 0x86, 0x03, 0x71,
+  0xeb, 0x85, 0x5c, 0xa0, 0xe4, 0xc5, 0x91, 0x44, 0xa4, 0x2c, 0x59, 0x44,
+  0x1f, 0x8e, 0x64, 0xb8, 0xcd, 0x76, 0x51, 0x0a, 0xef, 0x88, 0x6b, 0x45,
+  0xaf, 0x6b, 0x7f, 0xbd, 0xae, 0x15, 0xbd, 0xae, 0x7d, 0x53, 0xb9, 0x56,
+  0xf4, 0xba, 0xf6, 0x16, 0x56, 0xd1, 0xab, 0x3f, 0x47, 0x45, 0xaf, 0xfe,
+  0x1c, 0x15, 0xbd, 0xca, 0x11, 0xab, 0x31, 0xc9, 0x75, 0x5c, 0x4e, 0xd1,
+  0xd8, 0xa3, 0x76, 0xfc, 0x7b, 0xfc, 0xed, 0xf3, 0x8b, 0xef, 0x46, 0x67,
+  0xc2, 0xd1, 0xef, 0xcc, 0x74, 0x65, 0x47, 0x5e, 0xbb, 0x45, 0xe9, 0x32,
+  0x2e, 0x52, 0x88, 0x10, 0xe0, 0xb9, 0x21, 0xd4, 0xba, 0x62, 0x12, 0xcf,
+  0x52, 0xd3, 0x51, 0xf0, 0xed, 0xaa, 0xe5, 0x8e, 0xc0, 0xb0, 0xcd, 0x2e,
+  0x26, 0xc1, 0x77, 0x58, 0xee, 0xb4, 0x41, 0x00, 0x38, 0xd7, 0xc6, 0xc7,
+  0x6d, 0x30, 0x4b, 0x85, 0x68, 0x3b, 0x54, 0x12, 0xcb, 0x25, 0x4b, 0x34,
+  0xe1, 0x78, 0xdb, 0x08, 0xe5, 0x18, 0x51, 0x90, 0xba, 0x31, 0xcc, 0xfe,
+  0x4a, 0xd7, 0x5e, 0xe8, 0x63, 0x7a, 0x5c, 0x15, 0x62, 0x88, 0xa8, 0xdc,
+  0x13, 0x82, 0x63, 0xaa, 0xf7, 0x84, 0x48, 0x51, 0x07, 0xfd, 0x4a, 0x5a,
+  0xcf, 0x7b, 0x36, 0x84, 0xf8, 0x78, 0x00, 0xac, 0x49, 0xb0, 0xf9, 0x92,
+  0x0d, 0x63, 0x64, 0x8f, 0x1b, 0x4a, 0xcc, 0x71, 0xd5, 0xeb, 0x49, 0xc4,
+  0x64, 0x6b, 0x34, 0x86, 0x63, 0x6b, 0x52, 0x6e, 0xb9, 0xdb, 0xc3, 0x0e,
+  0xe1, 0xba, 0x1f, 0x45, 0xea, 0xfc, 0x14, 0x85, 0xc1, 0x05, 0x0d, 0x19,
+  0xb8, 0xd9, 0xd1, 0xdf, 0x14, 0xa4, 0x52, 0x5b, 0xee, 0x23, 0xc2, 0x77,
+  0x71, 0x16, 0xea, 0x3e, 0xa7, 0xa8, 0xe2, 0x8a, 0x57, 0xad, 0xc4, 0xb5,
+  0xf4, 0x58, 0x26, 0xa8, 0xc4, 0x0c, 0x95, 0x78, 0x41, 0xc9, 0xea, 0x77,
+  0x29, 0x41, 0xa1, 0x76, 0xde, 0x97, 0xa4, 0x55, 0x85, 0xa6, 0xb4, 0x6a,
+  0xf9, 0x46, 0xe2, 0x76, 0xa2, 0x9f, 0xfe, 0x87, 0x46, 0xfd, 0xab, 0xa5,
+  0x5c, 0xd6, 0x5b, 0x2d, 0x54, 0x8f, 0x68, 0x01, 0x4c, 0xac, 0x80, 0x3e,
+  0x79, 0xa1, 0xa9, 0x0d, 0x1e, 0x6a, 0x69, 0x90, 0x23, 0x7d, 0x7b, 0x8e,
+  0x08, 0xb5, 0x48, 0x93, 0x16, 0x31, 0x54, 0x8f, 0x88, 0xbb, 0xa6, 0xff,
+  0x7c, 0x7d, 0xdc, 0x09, 0x5e, 0xfd, 0xfb, 0xe8, 0xe4, 0x02, 0x4f, 0x94,
+  0xdf, 0x9c, 0xbe, 0x81, 0x47, 0x75, 0x6a, 0xcc, 0x6c, 0x40, 0xc8, 0x0a,
+  0x51, 0xf9, 0xdb, 0x64, 0x51, 0x8e, 0x51, 0xb7, 0xd7, 0x92, 0xbe, 0xf3,
+  0x25, 0x38, 0xe9, 0xeb, 0x02, 0xf7, 0x2f, 0xa4, 0xf3, 0xb9, 0x0a, 0x5a,
+  0x9f, 0xc7, 0xc2, 0xba, 0x24, 0xe9, 0x11, 0x7a, 0x11, 0x09, 0x7e, 0x3f,
+  0xcd, 0x66, 0x29, 0xa2, 0xc0, 0x2b, 0xde, 0xa1, 0xb0, 0x28, 0x17, 0x63,
+  0xaf, 0x60, 0x21, 0xea, 0x0f, 0x1f, 0x3d, 0x92, 0x26, 0xfd, 0x8b, 0xda,
+  0x22, 0x03, 0x67, 0x2d, 0x2c, 0x38, 0x51, 0x71, 0x91, 0xb2, 0x35, 0xa1,
+  0x7a, 0xa1, 0x67, 0x4b, 0x18, 0xdb, 0x8a, 0x9f, 0x14, 0xef, 0x1a, 0x88,
+  0xe0, 0x1b, 0x51, 0x11, 0xb3, 0x65, 0x1b, 0xcc, 0x61, 0xc0, 0xc9, 0x9a,
+  0xf0, 0x55, 0x46, 0x80, 0xa3, 0x6d, 0x87, 0x88, 0x46, 0xb3, 0xbd, 0x20,
+  0xeb, 0x77, 0xf6, 0x09, 0xf4, 0xdb, 0xdd, 0x0c, 0xbb, 0xe4, 0xb7, 0x96,
+  0x34, 0x7d, 0x70, 0x70, 0x07, 0x4d, 0xcf, 0x9a, 0x6b, 0x7a, 0x9a, 0xd5,
+  0x34, 0xcd, 0xf5, 0x24, 0x49, 0x80, 0x08, 0xbf, 0x11, 0x55, 0x03, 0xf7,
+  0x2a, 0x33, 0x8d, 0xcf, 0x0c, 0x1a, 0x8f, 0x95, 0x4b, 0x2b, 0x57, 0xcb,
+  0x15, 0x22, 0x44, 0x71, 0xf0, 0x5e, 0x3c, 0x7e, 0x81, 0x58, 0x2a, 0xc1,
+  0xa0, 0x2f, 0x11, 0x0c, 0xfa, 0x08, 0x22, 0x5d, 0x24, 0x48, 0xbd, 0xa8,
+  0xc2, 0xc0, 0xde, 0xde, 0xf1, 0xc9, 0xc5, 0xd9, 0xf1, 0xc9, 0xf8, 0x3b,
+  0xa4, 0x8b, 0xa3, 0x57, 0x6f, 0x5f, 0x8c, 0x5e, 0x40, 0x85, 0xf9, 0xec,
+  0xfe, 0xb7, 0xdd, 0x0f, 0xe5, 0x54, 0x9e, 0x2d, 0x1e, 0x6f, 0xe6, 0x73,
+  0xf2, 0xf4, 0xf5, 0xf4, 0xe3, 0xf3, 0x80, 0x82, 0x3e, 0xe8, 0xf7, 0x3f,
+  0xa3, 0x65, 0x5e, 0xf9, 0x8b, 0x1a, 0xcc, 0x5e, 0xef, 0xb3, 0x70, 0x2f,
+  0x1a, 0xf4, 0xf7, 0xfa, 0xe1, 0x60, 0xd0, 0xfb, 0xac, 0x1b, 0xf6, 0x07,
+  0xdd, 0xe8, 0xb3, 0xa0, 0xfb, 0xf1, 0x45, 0xa9, 0xff, 0xd6, 0x45, 0x19,
+  0xe7, 0x48, 0x94, 0x7c, 0xb9, 0x2c, 0x6d, 0x74, 0xae, 0x70, 0x35, 0x71,
+  0xff, 0x4b, 0x7e, 0x8f, 0x77, 0x1e, 0xa0, 0xc9, 0xc2, 0xd1, 0x7f, 0x1d,
+  0x5f, 0x04, 0x9b, 0xe1, 0x20, 0x20, 0x85, 0xa0, 0xc8, 0x26, 0xc5, 0x93,
+  0xe0, 0xfc, 0x7c, 0x14, 0x1c, 0x08, 0x05, 0xe3, 0xf0, 0x01, 0x99, 0x3d,
+  0x65, 0x57, 0x0b, 0x54, 0x65, 0x83, 0xf1, 0x0f, 0x9a, 0xba, 0x58, 0xd5,
+  0x66, 0x6d, 0x28, 0x8a, 0xbc, 0x98, 0xcc, 0xd6, 0x49, 0x1a, 0x1c, 0x88,
+  0xb8, 0xe2, 0xd7, 0xf1, 0x3c, 0x9e, 0xcd, 0x96, 0x13, 0xf8, 0xfc, 0xa0,
+  0xbc, 0x5d, 0xa5, 0xc0, 0x8a, 0xde, 0xd6, 0x45, 0x17, 0xb2, 0xa0, 0x1d,
+  0xfc, 0x7e, 0x74, 0x74, 0x71, 0x7a, 0xd6, 0x42, 0x13, 0xe0, 0xa7, 0x5a,
+  0xaa, 0xf1, 0xda, 0x4d, 0x87, 0x06, 0x17, 0x57, 0x66, 0x2a, 0xdc, 0x19,
+  0x10, 0x3f, 0x4f, 0x35, 0x9a, 0x2a, 0x95, 0xd8, 0x5e, 0xf2, 0xed, 0xcb,
+  0x97, 0xaf, 0x46, 0xad, 0xdf, 0x3a, 0xc1, 0x6d, 0x07, 0xec, 0x8c, 0xdf,
+  0x83, 0x81, 0x57, 0xeb, 0x37, 0xbc, 0x3d, 0x35, 0x20, 0xae, 0x7f, 0x6f,
+  0x89, 0xf3, 0x34, 0xf2, 0xb2, 0x21, 0x1e, 0xca, 0xf0, 0xcb, 0x7b, 0xe9,
+  0x16, 0x49, 0x84, 0xf6, 0x1d, 0x52, 0xda, 0x78, 0x74, 0xd1, 0x0d, 0xf6,
+  0x75, 0x9f, 0xc3, 0x60, 0x50, 0xff, 0x8c, 0x88, 0x83, 0x9e, 0xe6, 0x73,
+  0x18, 0x04, 0x91, 0xe6, 0x73, 0x14, 0x04, 0x61, 0xfd, 0xf3, 0xc9, 0xc5,
+  0xf3, 0xa0, 0x2b, 0x8b, 0x32, 0xfa, 0xe1, 0x68, 0xf4, 0xe6, 0x02, 0x65,
+  0xde, 0xf7, 0xcf, 0x5f, 0x1d, 0xbf, 0x80, 0xde, 0xa0, 0xbb, 0x41, 0x25,
+  0x3b, 0xd4, 0x11, 0xbd, 0x18, 0x9d, 0x9c, 0x9e, 0xbd, 0x0e, 0x38, 0x51,
+  0xa4, 0x25, 0x3a, 0xfe, 0x7e, 0xfc, 0xef, 0xd1, 0xd9, 0x29, 0x23, 0xea,
+  0xeb, 0x88, 0x4e, 0xbf, 0x1f, 0x9d, 0xbd, 0x7c, 0x75, 0xfa, 0x2f, 0x46,
+  0x34, 0xd4, 0x11, 0xbd, 0x3d, 0x79, 0xc1, 0xa8, 0x80, 0x28, 0xec, 0xea,
+  0x05, 0x1f, 0xfd, 0xf0, 0xfc, 0xe8, 0x82, 0xc9, 0x14, 0x69, 0x89, 0xe0,
+  0xfe, 0x44, 0xda, 0xff, 0x02, 0x51, 0xef, 0x4a, 0xd6, 0x01, 0x04, 0x8b,
+  0x1a, 0x20, 0x54, 0xc3, 0x6e, 0x9d, 0x48, 0xd0, 0x00, 0x26, 0x0a, 0xbb,
+  0x3a, 0xa2, 0x4a, 0x03, 0x98, 0x28, 0xd2, 0x11, 0x09, 0x1a, 0xc0, 0x44,
+  0x7d, 0x1d, 0x91, 0xa0, 0x01, 0x4c, 0x34, 0xd4, 0x11, 0x09, 0x1a, 0x00,
+  0x22, 0x24, 0x92, 0x86, 0x48, 0xd0, 0x00, 0x26, 0xba, 0x1a, 0x2a, 0xe5,
+  0x80, 0x5c, 0x21, 0x73, 0x32, 0x7a, 0x7e, 0x36, 0x3a, 0xbf, 0xa8, 0xb2,
+  0xb8, 0xab, 0x21, 0x7a, 0x71, 0xfa, 0xaf, 0x93, 0x0a, 0x2a, 0xd2, 0x13,
+  0xbd, 0x7d, 0x13, 0x08, 0xfc, 0xfa, 0x7a, 0xa2, 0x8b, 0xd3, 0x7f, 0x3d,
+  0x3f, 0x7b, 0x41, 0x94, 0xd5, 0xdd, 0x0c, 0xf4, 0x44, 0xa2, 0xe8, 0x94,
+  0x48, 0xa2, 0x7a, 0xf9, 0xea, 0xed, 0xf9, 0x77, 0x18, 0x83, 0x91, 0x92,
+  0x91, 0x97, 0x89, 0xe8, 0xf4, 0x84, 0x42, 0x59, 0x89, 0x5e, 0xbe, 0x14,
+  0x74, 0x00, 0xc3, 0x78, 0x7c, 0xed, 0x4e, 0x50, 0x2e, 0x89, 0x13, 0xa7,
+  0x3c, 0x9e, 0x05, 0x37, 0xf1, 0x6c, 0x9d, 0xa2, 0xd7, 0x00, 0x4d, 0x02,
+  0x82, 0xc9, 0x3a, 0xcf, 0x53, 0xd4, 0x9a, 0x60, 0x32, 0xd8, 0x07, 0x9b,
+  0x2f, 0x13, 0x6c, 0x9f, 0x29, 0x8e, 0xe8, 0x78, 0xe3, 0x45, 0x9c, 0x92,
+  0x5d, 0xd1, 0xbb, 0xe3, 0xf9, 0xb8, 0x8d, 0xbc, 0x4e, 0xb0, 0xfb, 0xae,
+  0x83, 0xa0, 0x8b, 0x86, 0x63, 0xbb, 0xc3, 0xde, 0x70, 0x38, 0xe8, 0x0e,
+  0xbf, 0xee, 0x5e, 0xa1, 0xb1, 0x58, 0xf5, 0xf2, 0x14, 0x06, 0x4a, 0xd1,
+  0x2f, 0x51, 0x0f, 0x58, 0xb0, 0x91, 0x29, 0x1a, 0xd5, 0x3d, 0x13, 0x68,
+  0x82, 0x0f, 0x1f, 0x00, 0xe7, 0x99, 0x04, 0x82, 0xbf, 0x7d, 0xfe, 0x2c,
+  0xa8, 0x0f, 0x62, 0xe5, 0xe1, 0x77, 0x0b, 0x9c, 0x1e, 0x4d, 0x88, 0x77,
+  0x7e, 0xba, 0xef, 0x87, 0xe6, 0x51, 0x65, 0xbe, 0x9c, 0x3d, 0x46, 0x7d,
+  0x69, 0xb9, 0x2e, 0x10, 0xe1, 0x75, 0x56, 0x94, 0x69, 0xee, 0x98, 0xca,
+  0xa0, 0xb4, 0x5e, 0xa7, 0xe5, 0xa4, 0xa0, 0xbe, 0xb3, 0x74, 0x23, 0x54,
+  0x6a, 0x6f, 0x31, 0x1e, 0xc7, 0xc5, 0x7c, 0x3c, 0x86, 0x06, 0x79, 0x39,
+  0x8b, 0x4b, 0x34, 0x94, 0x1e, 0x8f, 0x5b, 0x0f, 0x8b, 0x72, 0xbe, 0x41,
+  0xb1, 0x83, 0x2f, 0xbb, 0x0f, 0x91, 0x06, 0x1e, 0x3e, 0x9b, 0x3f, 0x6c,
+  0xe5, 0x6d, 0x79, 0xe0, 0x5a, 0xb7, 0xaa, 0x60, 0x0e, 0xb9, 0x60, 0xb1,
+  0x1f, 0x58, 0xeb, 0x47, 0xf9, 0x7a, 0x86, 0xb3, 0x44, 0x64, 0x88, 0x58,
+  0x22, 0x8e, 0x71, 0x5b, 0x19, 0xe7, 0xc2, 0x92, 0xcb, 0xe8, 0x82, 0xb6,
+  0x2f, 0xc7, 0xa7, 0x27, 0xe3, 0xf3, 0x8b, 0xe7, 0x17, 0xa3, 0x16, 0xea,
+  0x14, 0x84, 0x04, 0x83, 0x21, 0x8b, 0xd2, 0x0a, 0xb5, 0x2d, 0x10, 0x10,
+  0x6e, 0x40, 0xe0, 0x75, 0xb8, 0x1e, 0x1f, 0x57, 0x92, 0xe3, 0x93, 0x6f,
+  0xc7, 0xaf, 0x4f, 0x5f, 0x98, 0x04, 0xa8, 0x2a, 0x52, 0x3d, 0xbe, 0x58,
+  0x7d, 0xcc, 0x08, 0x4a, 0x25, 0x93, 0x61, 0xce, 0x35, 0x9a, 0xe0, 0x2e,
+  0x53, 0x85, 0x5c, 0x50, 0x81, 0xff, 0x54, 0x95, 0x03, 0x9d, 0xa5, 0x74,
+  0x3d, 0x76, 0x0d, 0x1c, 0xeb, 0xc8, 0x1b, 0xbb, 0x52, 0x9b, 0x09, 0x59,
+  0xd6, 0x9e, 0x37, 0xb0, 0xa0, 0x50, 0x13, 0xb2, 0xaa, 0x57, 0x6f, 0x6c,
+  0x55, 0xd5, 0x8c, 0x01, 0x54, 0xc1, 0x02, 0xd6, 0xac, 0xe1, 0x06, 0x6b,
+  0xbc, 0x94, 0x80, 0x2f, 0x49, 0xb5, 0x5d, 0x64, 0xc4, 0x3c, 0x71, 0xaf,
+  0x0a, 0xa9, 0xf2, 0x51, 0x8a, 0x1c, 0xb5, 0x33, 0xbf, 0xa3, 0x56, 0xe6,
+  0x0f, 0x47, 0x65, 0x92, 0x01, 0x01, 0x8c, 0xb4, 0x53, 0x69, 0x8f, 0xae,
+  0x83, 0x06, 0x69, 0xc4, 0x9f, 0x42, 0xfe, 0xd4, 0xd5, 0xb2, 0x4b, 0xbb,
+  0x1d, 0x4c, 0x04, 0x51, 0xd2, 0x5e, 0x43, 0xde, 0xb9, 0xc0, 0xbc, 0xab,
+  0x61, 0x59, 0x89, 0xd1, 0xfb, 0xf8, 0xcc, 0xc3, 0x8a, 0x79, 0xac, 0x45,
+  0x27, 0xbe, 0xf6, 0xe1, 0xbf, 0xa6, 0x2a, 0x2d, 0x9c, 0xc0, 0x5d, 0xf2,
+  0x9f, 0x16, 0x58, 0x3a, 0x3a, 0x82, 0x33, 0x28, 0x14, 0x65, 0x36, 0x72,
+  0x66, 0xb7, 0xdc, 0x93, 0xf5, 0x31, 0x22, 0xc0, 0xce, 0x4a, 0xb1, 0xf2,
+  0x62, 0x1b, 0x13, 0x34, 0xde, 0x4e, 0x7b, 0xc5, 0xba, 0x83, 0x32, 0x5b,
+  0xdc, 0x4e, 0x26, 0xc1, 0x22, 0xbd, 0x41, 0x7d, 0x40, 0x3a, 0xcf, 0xc0,
+  0x10, 0x04, 0x0c, 0x76, 0xe7, 0xa8, 0x1b, 0xdc, 0x9d, 0x4c, 0xd3, 0xc9,
+  0xaf, 0x19, 0x5e, 0x98, 0x88, 0x93, 0xa2, 0x2a, 0xad, 0x78, 0x6f, 0x46,
+  0x14, 0x18, 0xc2, 0xd7, 0x48, 0x0a, 0x51, 0x22, 0xbb, 0xc4, 0x85, 0x43,
+  0x62, 0x41, 0xa9, 0x28, 0xcc, 0xa6, 0x7a, 0x80, 0x0b, 0x9d, 0x1a, 0x10,
+  0xb3, 0x9f, 0x01, 0xaa, 0x29, 0xe0, 0x3a, 0x67, 0x90, 0x56, 0x9e, 0xb9,
+  0x2f, 0x4f, 0xb2, 0x2a, 0xfb, 0x23, 0xd8, 0x47, 0xae, 0xb0, 0x2b, 0xd1,
+  0x15, 0xf6, 0x2d, 0xba, 0xc2, 0x3b, 0xd7, 0x8e, 0x84, 0x4d, 0xc7, 0xab,
+  0x8c, 0xef, 0xad, 0xc3, 0xa9, 0x57, 0x9a, 0x8b, 0x83, 0xbe, 0xc0, 0x4e,
+  0x12, 0xe2, 0x0a, 0xd6, 0x89, 0xa4, 0x2f, 0x90, 0xd9, 0x40, 0x06, 0x7e,
+  0x4c, 0xe1, 0x6c, 0x2d, 0x5c, 0x4d, 0x4c, 0x3f, 0xf4, 0xc8, 0x87, 0xd0,
+  0xe3, 0x06, 0x19, 0x51, 0xaa, 0xd9, 0x47, 0x95, 0xaa, 0xab, 0x4a, 0x15,
+  0x7a, 0x4a, 0x55, 0x8d, 0x0f, 0xd8, 0x85, 0xe2, 0x2c, 0x23, 0xd8, 0x2e,
+  0x55, 0x55, 0x15, 0x77, 0x5a, 0x55, 0xd9, 0x87, 0x91, 0x59, 0xbd, 0xce,
+  0x01, 0x06, 0x2f, 0xc3, 0x0c, 0x51, 0x21, 0xc9, 0xd3, 0x78, 0x5e, 0x23,
+  0xb1, 0xc9, 0x54, 0x58, 0x65, 0xc2, 0x92, 0xe0, 0x84, 0x5b, 0x53, 0x16,
+  0xda, 0x93, 0xb6, 0x22, 0x1a, 0x5c, 0x11, 0xbd, 0xad, 0x48, 0x2e, 0xaf,
+  0x48, 0xde, 0x72, 0xf4, 0x5a, 0x52, 0xab, 0x06, 0x86, 0xb1, 0xb0, 0x89,
+  0x90, 0x7b, 0x89, 0x00, 0x05, 0xea, 0x29, 0xfd, 0x10, 0x92, 0x0f, 0x11,
+  0xff, 0x10, 0x91, 0x0f, 0x21, 0xff, 0x20, 0x0b, 0x68, 0xe6, 0xcd, 0xea,
+  0x00, 0x2e, 0x5d, 0x75, 0xde, 0x62, 0x09, 0x53, 0xca, 0xd6, 0x15, 0x13,
+  0x8b, 0x49, 0x71, 0xc5, 0xc4, 0xea, 0xb9, 0x98, 0xce, 0xee, 0xce, 0xb4,
+  0xab, 0x32, 0x0d, 0xeb, 0x4c, 0xf9, 0xe5, 0xe6, 0xf2, 0xcd, 0xe6, 0x12,
+  0x2f, 0x6e, 0xde, 0xa9, 0xd1, 0x94, 0x50, 0x31, 0xc1, 0x18, 0x17, 0xca,
+  0x5b, 0x55, 0x2f, 0xe9, 0xd3, 0x65, 0x65, 0x16, 0xd8, 0x25, 0x37, 0x46,
+  0x75, 0x75, 0x35, 0x0b, 0x75, 0x06, 0x82, 0x47, 0x5b, 0xcb, 0x78, 0xc4,
+  0x78, 0x5b, 0xa1, 0x87, 0xb3, 0x55, 0xde, 0x5f, 0x9a, 0x2e, 0x27, 0xf4,
+  0x70, 0x14, 0xca, 0x13, 0xcc, 0x6f, 0x24, 0xb7, 0x61, 0xd8, 0xef, 0x49,
+  0xac, 0xae, 0x23, 0xb7, 0x61, 0x3c, 0xd6, 0xfb, 0xa8, 0x14, 0x15, 0xa2,
+  0x57, 0x3c, 0x74, 0xfb, 0xa0, 0xf4, 0x47, 0x54, 0xeb, 0x95, 0xc6, 0xed,
+  0xaa, 0xb1, 0xa3, 0xed, 0x36, 0x40, 0x03, 0x25, 0xd9, 0xd1, 0x76, 0x1a,
+  0xa0, 0x81, 0xba, 0xec, 0x68, 0x8f, 0x75, 0x68, 0xc6, 0xa4, 0x92, 0xfb,
+  0x96, 0x6b, 0x25, 0x9e, 0x4e, 0xe9, 0x5a, 0x0f, 0x51, 0x99, 0x5e, 0xa3,
+  0xe6, 0xb6, 0xf5, 0x65, 0xb7, 0xdd, 0xf9, 0xf2, 0xcb, 0xcd, 0x7c, 0xde,
+  0xfd, 0x69, 0xf1, 0x53, 0xf9, 0x50, 0x3a, 0x94, 0xf0, 0x10, 0x50, 0x10,
+  0x11, 0x09, 0x37, 0x93, 0x51, 0x2c, 0x4a, 0x06, 0x90, 0x74, 0x66, 0x98,
+  0x3f, 0x6c, 0x7d, 0x15, 0xb7, 0xf1, 0x1c, 0x31, 0x9d, 0x2f, 0xf3, 0xdb,
+  0x87, 0x6d, 0xff, 0xde, 0x90, 0xdc, 0x36, 0x6d, 0xaa, 0xb2, 0x21, 0xcc,
+  0xd5, 0x1f, 0x3b, 0x10, 0x4c, 0x4a, 0x90, 0x31, 0x44, 0x75, 0xc5, 0xd6,
+  0x61, 0x03, 0xa6, 0x2a, 0x8c, 0x78, 0x62, 0x53, 0x11, 0x77, 0x14, 0x5c,
+  0x2b, 0x30, 0xa4, 0x55, 0x83, 0x4b, 0x5b, 0x15, 0x96, 0x56, 0x7d, 0xe3,
+  0x62, 0x4d, 0x7c, 0x23, 0x61, 0x73, 0x4f, 0x69, 0xc9, 0x05, 0xf7, 0x96,
+  0xd6, 0xb0, 0xc1, 0x55, 0x7c, 0xf4, 0xaa, 0xbd, 0x98, 0x1c, 0xa2, 0x87,
+  0x1b, 0xf7, 0x82, 0x6f, 0xc8, 0xdb, 0x13, 0xcf, 0xfb, 0xf7, 0xb8, 0x54,
+  0x70, 0x89, 0xfd, 0x5f, 0x20, 0xd5, 0xe1, 0xdd, 0xa4, 0x42, 0xba, 0xf2,
+  0xe9, 0x39, 0xf0, 0x9f, 0x03, 0x5c, 0xc1, 0x31, 0xab, 0x2e, 0x61, 0xd5,
+  0x24, 0xc7, 0x41, 0x01, 0xde, 0xac, 0x0e, 0xfd, 0x58, 0xa1, 0x9e, 0x0b,
+  0x3b, 0x5f, 0xb7, 0x76, 0x5a, 0x0b, 0x53, 0xa7, 0x55, 0x3f, 0x85, 0x83,
+  0xbe, 0xb7, 0x2b, 0x1b, 0x63, 0x76, 0x89, 0x32, 0xf1, 0xe4, 0x6a, 0x49,
+  0x9a, 0x74, 0x6d, 0xb6, 0x27, 0x97, 0x3f, 0x9b, 0xb3, 0xe1, 0xf7, 0x5a,
+  0x37, 0x4e, 0xc8, 0x07, 0x4f, 0x0e, 0x9b, 0xed, 0x59, 0xfc, 0xa2, 0xb2,
+  0xc0, 0x2b, 0x8e, 0xf3, 0x15, 0x1a, 0x59, 0x14, 0xe6, 0xb3, 0x04, 0x64,
+  0x00, 0x84, 0x3d, 0x14, 0xbb, 0x3a, 0x63, 0xce, 0xd3, 0xec, 0x9b, 0x58,
+  0x00, 0x9c, 0x99, 0xb2, 0x43, 0x0b, 0x78, 0xe0, 0xc6, 0x4b, 0x1b, 0xe1,
+  0xb9, 0x05, 0xbc, 0x6e, 0x24, 0xe0, 0xa1, 0x1b, 0xaf, 0x91, 0x80, 0x87,
+  0x6e, 0x01, 0x17, 0xcd, 0xf2, 0xe4, 0x73, 0x0f, 0xc4, 0x06, 0x99, 0xc2,
+  0xab, 0x87, 0x57, 0xee, 0x2c, 0x1a, 0x64, 0x8f, 0x84, 0xec, 0x21, 0x74,
+  0x83, 0x8c, 0x12, 0xa1, 0xdd, 0x39, 0xb6, 0x68, 0x90, 0x65, 0x12, 0xb2,
+  0x5b, 0xe8, 0x65, 0xee, 0x1e, 0xa8, 0x57, 0x75, 0x18, 0x57, 0xa8, 0x18,
+  0x16, 0x30, 0x5b, 0x97, 0xa4, 0x6e, 0x39, 0xe0, 0xd7, 0x8b, 0xa6, 0x0c,
+  0xf0, 0x8e, 0x05, 0x39, 0xa0, 0xfb, 0x39, 0x67, 0x20, 0xdb, 0xf8, 0x1e,
+  0xbd, 0x7e, 0x33, 0x3e, 0x3f, 0xc7, 0x36, 0xbe, 0x1a, 0x63, 0x7b, 0x00,
+  0x87, 0xa0, 0x2f, 0xbe, 0x30, 0x0d, 0x43, 0x05, 0x73, 0x5e, 0xed, 0x10,
+  0x82, 0xc6, 0xa6, 0x37, 0x91, 0x91, 0x5b, 0x97, 0x68, 0x22, 0x29, 0x6b,
+  0xde, 0x16, 0xb5, 0x75, 0x9f, 0x67, 0xa5, 0xfe, 0x73, 0xaa, 0xfd, 0x7c,
+  0xad, 0xa7, 0xbe, 0xd6, 0x53, 0x2f, 0x0c, 0x3c, 0x17, 0x06, 0xa6, 0x0b,
+  0x03, 0xd7, 0x85, 0x81, 0xed, 0xc2, 0xc0, 0x17, 0x65, 0xa3, 0xf6, 0x3b,
+  0xce, 0x60, 0xfd, 0x45, 0x67, 0x63, 0xd4, 0xa8, 0x67, 0xa8, 0x69, 0x30,
+  0x4e, 0x06, 0x84, 0x49, 0x2b, 0x2e, 0x4c, 0x78, 0x4e, 0xa0, 0x3d, 0x45,
+  0x89, 0xa1, 0x66, 0xa5, 0x1f, 0xd4, 0x81, 0x1b, 0xc9, 0x34, 0x09, 0x56,
+  0x91, 0xdc, 0x42, 0x5d, 0x7b, 0x0a, 0x75, 0xe8, 0x46, 0xf2, 0x14, 0xea,
+  0xd0, 0x2d, 0xd4, 0xc2, 0x57, 0xeb, 0x9f, 0x57, 0x58, 0xd2, 0xea, 0xcf,
+  0x9a, 0x67, 0x9d, 0x9c, 0x91, 0x75, 0x22, 0x9c, 0x29, 0x72, 0x16, 0x69,
+  0x88, 0x52, 0x89, 0x28, 0xd5, 0x12, 0x5d, 0x4b, 0x48, 0xd7, 0x7a, 0xa4,
+  0x6b, 0x09, 0xe9, 0x5a, 0x8f, 0xb4, 0x90, 0x25, 0x27, 0xaf, 0x6c, 0x63,
+  0xd3, 0x78, 0x64, 0x91, 0x2b, 0x10, 0x2f, 0xb2, 0x14, 0x99, 0xb8, 0xca,
+  0x22, 0x34, 0x55, 0xd2, 0x65, 0x53, 0x57, 0xfa, 0x13, 0x4b, 0x02, 0x94,
+  0x13, 0x2b, 0xd6, 0xe4, 0xa5, 0xd8, 0x86, 0x22, 0x69, 0xe0, 0xb0, 0x89,
+  0x94, 0x9d, 0xf8, 0x90, 0x29, 0x9f, 0x4e, 0xc3, 0xf1, 0x4d, 0xe3, 0xc4,
+  0x5c, 0x3a, 0x2c, 0xcc, 0xd3, 0xc6, 0x4f, 0xb8, 0xc9, 0xf2, 0x54, 0xe7,
+  0x0e, 0x5c, 0x29, 0xac, 0xc1, 0x7a, 0xe2, 0xfa, 0xa4, 0x76, 0xd0, 0x97,
+  0x53, 0x2b, 0x9c, 0x62, 0x35, 0xa7, 0x59, 0x2a, 0x05, 0x08, 0x06, 0x41,
+  0x44, 0x45, 0xa6, 0x64, 0xa8, 0x4a, 0xa4, 0x50, 0x99, 0xc8, 0xe0, 0xfc,
+  0x17, 0x2b, 0x4f, 0x3c, 0x3b, 0x54, 0x22, 0x9a, 0xfe, 0x8d, 0xf2, 0x5e,
+  0x63, 0xa9, 0xd2, 0x99, 0x08, 0x31, 0xd1, 0x58, 0x64, 0x8b, 0xf5, 0x42,
+  0x36, 0x07, 0x89, 0xf3, 0x15, 0xeb, 0x50, 0x59, 0xb8, 0x1a, 0xba, 0xde,
+  0x0e, 0xe8, 0xee, 0x18, 0x86, 0x00, 0xba, 0x3f, 0x9f, 0xb3, 0xf9, 0x15,
+  0x3f, 0x2c, 0x4e, 0x3f, 0xd3, 0x45, 0x4a, 0xc5, 0x01, 0x04, 0x0b, 0x8d,
+  0xc8, 0xca, 0xa1, 0xe2, 0xf1, 0x81, 0x85, 0xf6, 0xe4, 0xd0, 0x81, 0x14,
+  0xea, 0xb1, 0x7d, 0x26, 0xdc, 0x6f, 0xee, 0x9e, 0x76, 0x88, 0xdb, 0x2a,
+  0xe4, 0xc6, 0xb6, 0x4b, 0xe1, 0xae, 0xbb, 0xcb, 0x1f, 0x43, 0xfb, 0xb6,
+  0x8a, 0x70, 0x0f, 0x7a, 0x53, 0x5e, 0x11, 0xb9, 0xf9, 0x9b, 0xde, 0xa5,
+  0x07, 0xcf, 0xf6, 0x4b, 0xfb, 0xf0, 0xc0, 0x63, 0x6a, 0x5a, 0xa5, 0x34,
+  0x73, 0xba, 0xa4, 0x9c, 0x7a, 0xde, 0xd7, 0x03, 0x62, 0x4e, 0xb3, 0xe9,
+  0x96, 0xfa, 0x63, 0x9a, 0xeb, 0x1a, 0xf5, 0xc7, 0x5a, 0x3d, 0xe5, 0x72,
+  0x53, 0x65, 0xd5, 0xce, 0x71, 0xd5, 0x22, 0xbe, 0x5c, 0x11, 0x7b, 0x6e,
+  0x81, 0x31, 0x20, 0xdc, 0xb1, 0x48, 0x5e, 0xc0, 0x37, 0x04, 0xf9, 0x12,
+  0x55, 0x5f, 0x22, 0xf2, 0xa5, 0x57, 0x7d, 0xe9, 0xd5, 0x8c, 0x37, 0x2e,
+  0xce, 0x9e, 0x9f, 0x9c, 0xbf, 0x39, 0x3d, 0x1f, 0xf5, 0xc7, 0x6f, 0xce,
+  0x5b, 0x79, 0xb7, 0x13, 0xe4, 0x21, 0xfa, 0x7f, 0x84, 0xfe, 0xdf, 0x6b,
+  0x07, 0xc9, 0x32, 0x10, 0x9c, 0xd9, 0x62, 0x45, 0x8d, 0xcb, 0x2e, 0xbd,
+  0xde, 0x5a, 0x2c, 0x71, 0x28, 0x26, 0x98, 0xfa, 0xe7, 0xa1, 0x78, 0x8f,
+  0x27, 0x8b, 0x10, 0x6a, 0x23, 0x44, 0x38, 0x42, 0x4f, 0x17, 0x21, 0x92,
+  0x22, 0x90, 0x72, 0x66, 0xe5, 0xd0, 0xd3, 0x46, 0xa8, 0x71, 0x00, 0x0c,
+  0x4a, 0x29, 0x66, 0x76, 0xd9, 0xed, 0x60, 0x31, 0x05, 0xba, 0x50, 0xa4,
+  0x63, 0xc5, 0xaf, 0x0c, 0x31, 0x5d, 0x57, 0xa0, 0x8b, 0xb4, 0x78, 0xf8,
+  0x84, 0x55, 0xd9, 0x13, 0xe8, 0x7a, 0x5a, 0xbc, 0x1e, 0xa6, 0x8b, 0xc8,
+  0x08, 0x9a, 0x19, 0xcd, 0x77, 0x89, 0x85, 0xc3, 0x24, 0x9e, 0x4c, 0x89,
+  0x8f, 0x3b, 0xb2, 0xa4, 0x1a, 0xa0, 0x81, 0x64, 0x9a, 0xc3, 0x4e, 0xb2,
+  0xda, 0xaa, 0xf1, 0x5d, 0x97, 0x55, 0x9e, 0x5e, 0xa5, 0xe5, 0x64, 0x4a,
+  0x77, 0x09, 0xf1, 0x77, 0xd8, 0x79, 0x21, 0xc6, 0xef, 0xa8, 0x33, 0xa5,
+  0xa5, 0x8c, 0xd8, 0x40, 0xa0, 0x00, 0xf2, 0x00, 0x41, 0x96, 0xad, 0x9c,
+  0xab, 0x74, 0x31, 0x49, 0x15, 0xb3, 0x09, 0xad, 0x7d, 0x12, 0x26, 0x24,
+  0x0b, 0xc2, 0xd2, 0x42, 0xf0, 0x1f, 0x92, 0x4d, 0xbb, 0xce, 0x52, 0xf6,
+  0x93, 0xd9, 0xb4, 0x53, 0xfb, 0xef, 0xf2, 0xef, 0xb3, 0xff, 0xee, 0xf6,
+  0xf7, 0xfb, 0x5d, 0x66, 0xff, 0x1d, 0x75, 0xc3, 0x3e, 0xd8, 0x7f, 0xef,
+  0x0d, 0xc2, 0x7b, 0xfb, 0xef, 0x4f, 0xf1, 0xb3, 0xda, 0x7f, 0x9f, 0x8f,
+  0x7a, 0xc1, 0x41, 0x69, 0xb6, 0x00, 0xbf, 0xb0, 0x5a, 0x80, 0x6b, 0x43,
+  0x05, 0x5b, 0xef, 0x95, 0x08, 0x2c, 0x4f, 0xd8, 0x89, 0xfb, 0x7e, 0xc9,
+  0xcb, 0xb3, 0xce, 0xbf, 0x33, 0x69, 0xee, 0x6c, 0x27, 0xe5, 0x6f, 0xe8,
+  0x49, 0xf9, 0x1b, 0xe1, 0xa4, 0xfc, 0x47, 0xf4, 0xfb, 0xcc, 0x0f, 0xfc,
+  0x89, 0x0e, 0xa0, 0xf9, 0xdd, 0x03, 0xd2, 0xc5, 0x07, 0xf4, 0x7c, 0x3a,
+  0x1c, 0xe4, 0x26, 0x8e, 0x77, 0x89, 0x11, 0xe7, 0x86, 0x2c, 0xad, 0xc3,
+  0x9f, 0xb6, 0x21, 0x3a, 0x3d, 0xfb, 0x8d, 0x0f, 0x9b, 0x0f, 0x1b, 0xc7,
+  0x56, 0xdc, 0x3c, 0x1b, 0x63, 0x93, 0xe8, 0xa3, 0x57, 0xa3, 0xd7, 0xa3,
+  0x93, 0x8b, 0x7f, 0x1d, 0x9f, 0x8f, 0x30, 0x88, 0x74, 0x3f, 0x88, 0x90,
+  0x84, 0xdb, 0x3a, 0xcc, 0x2d, 0xd9, 0x2b, 0xd8, 0xc8, 0xde, 0x84, 0x4d,
+  0x80, 0x4a, 0xa2, 0xee, 0x8c, 0xa7, 0x24, 0x73, 0x6b, 0x3c, 0xf5, 0xf2,
+  0x28, 0x2e, 0x61, 0x8b, 0xdc, 0xe6, 0x4b, 0x4f, 0x57, 0xdf, 0x52, 0x77,
+  0xc7, 0x21, 0x1a, 0xb3, 0x3e, 0x02, 0xf7, 0xf2, 0xf0, 0x5c, 0xf7, 0x1f,
+  0x18, 0x32, 0xb7, 0x2d, 0xa2, 0x5f, 0xc7, 0xaa, 0xa4, 0x0a, 0x9e, 0xf5,
+  0x24, 0x47, 0x44, 0xef, 0x0a, 0xc1, 0x11, 0x11, 0xdc, 0x67, 0x57, 0xb9,
+  0x0d, 0xc4, 0xef, 0x97, 0x3e, 0x8e, 0xc8, 0xc2, 0x81, 0xde, 0x13, 0x99,
+  0xa0, 0x9a, 0x2e, 0xce, 0xfd, 0x5b, 0xe2, 0x98, 0x0c, 0x5c, 0x52, 0x69,
+  0xcb, 0xb6, 0x62, 0x4a, 0x06, 0x29, 0xfc, 0xee, 0xf4, 0xec, 0xf8, 0xdf,
+  0xa7, 0x27, 0x17, 0xcf, 0x5f, 0xc9, 0x95, 0xf4, 0x3d, 0xb6, 0x41, 0xec,
+  0x04, 0xa0, 0xb3, 0xe5, 0xca, 0xaf, 0xba, 0x8a, 0x4a, 0x30, 0xd4, 0x5c,
+  0x9a, 0x7c, 0xf4, 0x88, 0x53, 0x4e, 0x29, 0xde, 0x97, 0x41, 0xd9, 0xa8,
+  0x4e, 0xff, 0x2e, 0xd4, 0x6a, 0xb8, 0x8a, 0x18, 0x87, 0x05, 0x8f, 0x03,
+  0xf0, 0xa9, 0xdd, 0x7a, 0x0f, 0x79, 0x1b, 0xa1, 0xac, 0x45, 0xca, 0x58,
+  0xae, 0x02, 0xfa, 0x0c, 0x99, 0xfb, 0xb3, 0x10, 0x4d, 0xfe, 0x3d, 0xc1,
+  0xd1, 0x6e, 0x29, 0xe9, 0x6e, 0xb0, 0xc0, 0x51, 0x85, 0x77, 0x1c, 0xfd,
+  0x69, 0x50, 0x3b, 0xd3, 0x5f, 0x22, 0xce, 0xf8, 0x14, 0x23, 0xfa, 0xe7,
+  0x09, 0x7a, 0x3b, 0x24, 0x27, 0xec, 0xd0, 0x3f, 0x4f, 0xaa, 0x34, 0xfd,
+  0x61, 0x68, 0x6b, 0xc4, 0x43, 0xfc, 0x42, 0x46, 0x40, 0x31, 0x93, 0x2f,
+  0xc1, 0xe1, 0x65, 0xb7, 0x98, 0x2e, 0xc1, 0xb3, 0xc1, 0x6e, 0x2f, 0xda,
+  0x1f, 0x60, 0x17, 0xe3, 0xfb, 0x83, 0xfd, 0x4e, 0xf0, 0xa8, 0xad, 0xc7,
+  0x90, 0xae, 0x9e, 0x71, 0x60, 0xec, 0x1a, 0x30, 0xe4, 0x4b, 0x70, 0x38,
+  0x08, 0x3e, 0x55, 0xef, 0x2f, 0x86, 0x2f, 0x84, 0x45, 0x0a, 0x4d, 0xdb,
+  0x40, 0x10, 0xa2, 0x10, 0x8d, 0x3b, 0x86, 0xbd, 0x41, 0x7f, 0x1f, 0x65,
+  0x14, 0x1a, 0xc6, 0x56, 0xef, 0x4e, 0xcd, 0x34, 0xc6, 0xdb, 0xb5, 0xb4,
+  0x0c, 0xd2, 0xc5, 0x6b, 0x1e, 0x4d, 0xc3, 0x5a, 0x6c, 0x1a, 0xd6, 0x6c,
+  0x32, 0xc4, 0x9a, 0x0d, 0xb9, 0x99, 0xe0, 0x61, 0x48, 0x79, 0x52, 0x8b,
+  0xd1, 0x41, 0xa5, 0x4c, 0x5b, 0x55, 0x86, 0xac, 0xaa, 0x48, 0x15, 0x85,
+  0x57, 0x8c, 0x1d, 0x56, 0xb8, 0x7f, 0x46, 0x25, 0x5b, 0xaa, 0x22, 0x3c,
+  0x84, 0x14, 0x79, 0x5d, 0x81, 0x27, 0x99, 0x06, 0x2d, 0x32, 0x79, 0x20,
+  0x05, 0x1f, 0x67, 0x21, 0xfa, 0x48, 0xfe, 0x3e, 0x61, 0x82, 0xfd, 0x61,
+  0x69, 0x8a, 0x4c, 0xaa, 0x14, 0x9c, 0xc2, 0x6a, 0x15, 0x49, 0xc6, 0xfd,
+  0x0b, 0xbb, 0x3e, 0xa5, 0xa6, 0x76, 0xad, 0x36, 0xb5, 0x9d, 0xe0, 0x57,
+  0x7b, 0x6b, 0x2b, 0x68, 0xee, 0x57, 0xdc, 0xc4, 0x3c, 0x82, 0xe3, 0xbb,
+  0x8a, 0x36, 0x7e, 0xc5, 0x11, 0xb0, 0x27, 0xff, 0x5f, 0xa1, 0x33, 0xfa,
+  0xb5, 0xba, 0x39, 0xe0, 0x57, 0x28, 0x3d, 0x03, 0xdc, 0x43, 0xb9, 0x15,
+  0x21, 0x4c, 0x22, 0x74, 0x83, 0x2d, 0x9f, 0x49, 0x04, 0x3b, 0xff, 0x39,
+  0x1c, 0xfc, 0x6d, 0xe3, 0xff, 0x6e, 0xd4, 0x1f, 0xf0, 0xf1, 0x7f, 0x6f,
+  0x6f, 0x0f, 0xc6, 0xff, 0xfd, 0x70, 0x70, 0x3f, 0xfe, 0xff, 0x14, 0x3f,
+  0xcb, 0xf8, 0xff, 0x40, 0x28, 0x14, 0xb5, 0xb3, 0x9f, 0xc3, 0x81, 0xed,
+  0xec, 0xa7, 0x2e, 0x54, 0x18, 0xf9, 0x67, 0xf2, 0xc8, 0x5f, 0x98, 0x0a,
+  0x6b, 0x22, 0xde, 0x1f, 0xef, 0xbe, 0xff, 0xdd, 0xff, 0xee, 0x7f, 0xf7,
+  0xbf, 0xfb, 0xdf, 0xfd, 0xef, 0xfe, 0x77, 0xff, 0xbb, 0xff, 0xdd, 0xff,
+  0xee, 0x7f, 0xf7, 0xbf, 0xfb, 0xdf, 0xfd, 0xef, 0xfe, 0x77, 0xff, 0xbb,
+  0xff, 0xdd, 0xff, 0xee, 0x7f, 0xf7, 0xbf, 0xfb, 0xdf, 0xfd, 0xaf, 0xe9,
+  0xef, 0xff, 0x02, 0x9b, 0xf0, 0x8b, 0x17, 0x00, 0x90, 0x01, 0x00
+};
+const unsigned int intrin_len = 16187;
@@ -0,0 +1,895 @@
+// Embedded: lib/tinycc/libtcc1.a
+// source generated by cjit/build/embed-path.sh
+// Sat Oct 17 04:50:04 UTC 2026
+// libtcc1.a
+const char libtcc1_a[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xec, 0x5d,
+  0x0f, 0x70, 0x1b, 0xd5, 0x99, 0x5f, 0xfd, 0xb3, 0xe5, 0x7f, 0x59, 0xc5,
+  0xf9, 0xe7, 0x24, 0x8e, 0x23, 0x43, 0x68, 0x30, 0x49, 0x1c, 0xcb, 0x51,
+  0x1c, 0x25, 0x85, 0xc4, 0xed, 0x20, 0xba, 0x50, 0x8b, 0x72, 0xe5, 0x32,
+  0xa4, 0x94, 0x3b, 0x47, 0x91, 0xed, 0xc4, 0x54, 0x91, 0x8d, 0xad, 0x80,
+  0xe1, 0xf8, 0x13, 0xa3, 0x38, 0x67, 0x8d, 0x62, 0x2e, 0x50, 0xe8, 0xb9,
+  0xcc, 0x15, 0x72, 0x6d, 0xa6, 0x85, 0x4e, 0x0a, 0x81, 0xa3, 0x89, 0xc3,
+  0x94, 0x9c, 0x45, 0x72, 0x8d, 0x29, 0xb9, 0x90, 0xa3, 0x0c, 0xe3, 0x00,
+  0x01, 0x71, 0x93, 0x0b, 0x52, 0x43, 0x5b, 0x15, 0xd2, 0x9e, 0xda, 0xeb,
+  0x91, 0x7b, 0x7f, 0xbe, 0xd5, 0xee, 0xbe, 0x7d, 0x1b, 0xcb, 0x91, 0xe8,
+  0xf8, 0x66, 0xb2, 0x33, 0xf6, 0x7b, 0xef, 0xb7, 0xbf, 0xf7, 0xbd, 0x6f,
+  0xbf, 0xef, 0x7d, 0x6f, 0xdf, 0xae, 0xdf, 0x5b, 0x07, 0x3b, 0x37, 0x85,
+  0x03, 0x01, 0x57, 0xbd, 0x5f, 0xf8, 0xfc, 0x8e, 0x06, 0x74, 0x34, 0xb9,
+  0xdd, 0x24, 0x45, 0x87, 0x36, 0x75, 0xb9, 0x1b, 0x1a, 0xdc, 0x0d, 0x82,
+  0x6b, 0x65, 0x63, 0x93, 0x7b, 0xe5, 0xaa, 0x26, 0xd7, 0xca, 0x26, 0xa1,
+  0xc1, 0xd5, 0xb8, 0x72, 0xe5, 0x2a, 0xc1, 0xd9, 0xf0, 0x39, 0xea, 0x94,
+  0x3d, 0xb6, 0xf5, 0x86, 0xfd, 0x3d, 0x48, 0x95, 0x9e, 0xae, 0xae, 0xf0,
+  0xc5, 0x78, 0x13, 0x9d, 0x67, 0x2f, 0xee, 0xff, 0xc9, 0x51, 0x7b, 0xad,
+  0xbf, 0x27, 0xb0, 0x65, 0x6d, 0xe9, 0x72, 0xa7, 0xf6, 0x68, 0xd0, 0xe5,
+  0x1b, 0x34, 0x78, 0xa3, 0xdb, 0xed, 0xa1, 0xb9, 0x8d, 0xa5, 0x48, 0xcc,
+  0xb7, 0x04, 0xa1, 0xe4, 0xad, 0xdc, 0x7f, 0x66, 0xef, 0x17, 0x84, 0x79,
+  0x41, 0x41, 0xa8, 0x19, 0xbc, 0xfc, 0x23, 0xff, 0x7c, 0xc3, 0x4d, 0x7f,
+  0xee, 0x18, 0x2c, 0xcc, 0xcf, 0x9d, 0x6d, 0x82, 0x30, 0x2c, 0x28, 0x3f,
+  0x2f, 0x1c, 0x17, 0x84, 0x83, 0x49, 0x41, 0xf8, 0xd9, 0x8e, 0xd6, 0xd6,
+  0x8e, 0x60, 0x97, 0x3f, 0xbc, 0x2d, 0xd4, 0xd6, 0xd9, 0xdb, 0x21, 0xa8,
+  0x4a, 0x6d, 0x9a, 0x52, 0x1f, 0x29, 0x75, 0xf6, 0x6d, 0x0b, 0xf5, 0xf6,
+  0x76, 0xb4, 0x75, 0xd2, 0x02, 0xe4, 0xb6, 0xde, 0xd7, 0xde, 0xd3, 0xd5,
+  0xab, 0x10, 0xda, 0xb2, 0x84, 0x36, 0x15, 0xa1, 0x4d, 0x21, 0xf4, 0x65,
+  0x09, 0x24, 0xe7, 0x0f, 0x06, 0xbb, 0x02, 0x7e, 0x04, 0x6c, 0xea, 0x42,
+  0x4d, 0xb5, 0x66, 0x8b, 0xfe, 0x70, 0xd7, 0xd6, 0xce, 0x40, 0x6b, 0x6f,
+  0xb8, 0xab, 0xa7, 0xbd, 0xd5, 0xa5, 0x00, 0xe1, 0x2d, 0x3d, 0xed, 0xfe,
+  0xb6, 0xd6, 0x8e, 0xf6, 0x50, 0xa0, 0x5d, 0x41, 0x91, 0xa6, 0x6d, 0x6a,
+  0x56, 0xa0, 0x6b, 0x6b, 0xb7, 0x1f, 0x55, 0x6c, 0xef, 0x0b, 0x6c, 0xf1,
+  0x87, 0x36, 0x6b, 0x24, 0xf0, 0x30, 0x7f, 0x1b, 0x16, 0x19, 0x0e, 0x6c,
+  0x51, 0x83, 0xbd, 0xdb, 0x36, 0xe9, 0x41, 0x7f, 0x88, 0xc3, 0xec, 0xea,
+  0xd1, 0x63, 0x7d, 0x3c, 0x30, 0xc4, 0xad, 0x4e, 0x01, 0xac, 0x83, 0x0e,
+  0xc4, 0x3a, 0xe8, 0x99, 0x21, 0x0e, 0x13, 0x35, 0xa7, 0xc3, 0xfa, 0x78,
+  0x60, 0x88, 0xa9, 0x4e, 0x4d, 0xdc, 0xc8, 0x18, 0xb3, 0xf1, 0x22, 0xc6,
+  0x6c, 0xe4, 0x18, 0xb3, 0x91, 0x67, 0xcc, 0x46, 0x9e, 0x31, 0x1b, 0x79,
+  0xc6, 0x6c, 0xe4, 0x18, 0xb3, 0x91, 0x67, 0xcc, 0x46, 0xae, 0x31, 0x1b,
+  0x79, 0xc6, 0xd4, 0x81, 0x58, 0x07, 0x3d, 0x33, 0xc4, 0x61, 0xa2, 0xe6,
+  0x74, 0x58, 0x1f, 0x0f, 0x0c, 0x31, 0xd5, 0xa9, 0x31, 0xdd, 0x8c, 0x31,
+  0xdd, 0x17, 0x31, 0xa6, 0x9b, 0x63, 0x4c, 0x37, 0xcf, 0x98, 0x6e, 0x9e,
+  0x31, 0xdd, 0x3c, 0x63, 0xba, 0x39, 0xc6, 0x74, 0xf3, 0x8c, 0xe9, 0xe6,
+  0x1a, 0xd3, 0xcd, 0x33, 0xa6, 0x0e, 0xc4, 0x3a, 0xe8, 0x99, 0x21, 0x0e,
+  0x13, 0x35, 0xa7, 0xc3, 0xfa, 0x78, 0x60, 0x88, 0xa9, 0x4e, 0x8d, 0xe9,
+  0x61, 0x8c, 0xe9, 0xb9, 0x88, 0x31, 0x3d, 0x1c, 0x63, 0x7a, 0x78, 0xc6,
+  0xf4, 0xf0, 0x8c, 0xe9, 0xe1, 0x19, 0xd3, 0xc3, 0x31, 0xa6, 0x87, 0x67,
+  0x4c, 0x0f, 0xd7, 0x98, 0x1e, 0x9e, 0x31, 0x75, 0x20, 0xd6, 0x41, 0xcf,
+  0x0c, 0x71, 0x98, 0xa8, 0x39, 0x1d, 0xd6, 0xc7, 0x03, 0x43, 0x4c, 0xf5,
+  0xde, 0xce, 0xcd, 0x21, 0x7f, 0x90, 0x1d, 0x38, 0x3b, 0x7b, 0x91, 0x51,
+  0x03, 0xdf, 0x6a, 0xed, 0xe8, 0x69, 0x57, 0xa1, 0xe1, 0xf6, 0xde, 0x30,
+  0x69, 0xbe, 0xb7, 0x3d, 0xac, 0xb2, 0x76, 0xb0, 0x1d, 0x4d, 0x90, 0xd0,
+  0x48, 0xbd, 0xad, 0x33, 0x18, 0xee, 0x0c, 0xb5, 0x76, 0x74, 0xf4, 0x6a,
+  0x4b, 0xc1, 0x20, 0x53, 0x56, 0x15, 0x03, 0xc1, 0xfb, 0xb4, 0xa5, 0x20,
+  0x73, 0x56, 0x53, 0x0c, 0xdf, 0xa7, 0x2d, 0x05, 0x99, 0xb3, 0xda, 0xba,
+  0x3d, 0xbd, 0x9b, 0xd8, 0x72, 0x50, 0xc7, 0x50, 0x03, 0xdd, 0x5d, 0xdd,
+  0x01, 0x74, 0xbb, 0x09, 0x73, 0xa0, 0x20, 0x8f, 0xa7, 0xc1, 0xfc, 0x3d,
+  0x9d, 0xe1, 0x7b, 0x75, 0x40, 0x50, 0xcf, 0xc1, 0x08, 0xed, 0xc2, 0xc4,
+  0x9e, 0x81, 0xae, 0xbb, 0xdb, 0x7b, 0xfc, 0x9b, 0xb1, 0x99, 0x03, 0xf7,
+  0x6e, 0x6e, 0xed, 0xee, 0xe9, 0xea, 0xe8, 0x0c, 0xb6, 0xb7, 0x76, 0x6c,
+  0x0b, 0xa1, 0xce, 0x1a, 0x0a, 0xb7, 0xf7, 0x70, 0x4f, 0xf4, 0x75, 0x62,
+  0x2d, 0xd1, 0xcc, 0xbc, 0x35, 0xdc, 0xe3, 0x0f, 0xb4, 0xb7, 0xde, 0x83,
+  0x24, 0x63, 0x11, 0x77, 0xfb, 0x5b, 0xfd, 0x3d, 0x9b, 0xe1, 0x54, 0xd0,
+  0x7f, 0xdf, 0xbd, 0x58, 0x46, 0x0f, 0xd6, 0xab, 0xad, 0xb7, 0xab, 0x15,
+  0xf5, 0xfc, 0xb6, 0x60, 0xbb, 0x10, 0x84, 0x39, 0x7d, 0xd7, 0xf2, 0x8b,
+  0xcf, 0xe5, 0x5c, 0x64, 0x5a, 0xee, 0x74, 0xae, 0x68, 0x5c, 0xd1, 0x28,
+  0xcf, 0xe5, 0x1e, 0xf2, 0xb6, 0xdc, 0x60, 0x36, 0x99, 0xb2, 0xf3, 0x43,
+  0x93, 0xb0, 0x56, 0x30, 0x71, 0xe6, 0x8d, 0x64, 0xd6, 0x07, 0x47, 0x33,
+  0xfc, 0x2e, 0x11, 0xec, 0xc2, 0x7a, 0x29, 0xfa, 0x5f, 0x52, 0xff, 0xc7,
+  0x4e, 0x04, 0x48, 0xd1, 0x07, 0x32, 0x52, 0xcc, 0x9b, 0x91, 0xa2, 0xde,
+  0x74, 0xcc, 0x7b, 0x3e, 0x92, 0x11, 0xc4, 0x5d, 0xd3, 0x30, 0x1e, 0xf3,
+  0xa6, 0x3f, 0x95, 0xc4, 0x6b, 0x46, 0x53, 0xab, 0xa0, 0x74, 0xcb, 0x07,
+  0x4b, 0x17, 0x49, 0x91, 0xa3, 0xf6, 0x53, 0xa3, 0xef, 0x3e, 0x90, 0x38,
+  0x3d, 0xfe, 0xee, 0x32, 0x2c, 0xef, 0xdd, 0xad, 0x89, 0xf7, 0xe3, 0x32,
+  0xb2, 0x35, 0x71, 0xea, 0x8e, 0x45, 0xe9, 0x4f, 0x45, 0xc7, 0xf5, 0x8b,
+  0xd2, 0x29, 0x7c, 0xf6, 0xb5, 0x23, 0x39, 0xb6, 0xf4, 0xc9, 0xa4, 0x5b,
+  0x3a, 0x8d, 0x5a, 0xfa, 0x64, 0x12, 0x2d, 0x4d, 0x67, 0x64, 0xa7, 0x96,
+  0x4d, 0xa2, 0x31, 0x7d, 0x13, 0x1d, 0xe2, 0xdb, 0xde, 0x4c, 0x87, 0x18,
+  0xc2, 0xbf, 0x1e, 0xf4, 0x9e, 0x87, 0x56, 0x06, 0x44, 0x2c, 0x74, 0x44,
+  0x36, 0x79, 0x0a, 0x4d, 0xe6, 0x04, 0x74, 0x2a, 0x9e, 0x9c, 0xd3, 0x9f,
+  0xb8, 0x80, 0xf2, 0x91, 0xe4, 0x83, 0x91, 0x64, 0x15, 0xd5, 0x0a, 0x21,
+  0x17, 0x1e, 0x12, 0xfa, 0xc7, 0x04, 0x61, 0x3b, 0x52, 0xd8, 0x9b, 0x44,
+  0xaa, 0x44, 0x32, 0x75, 0xe2, 0x2e, 0x8d, 0x88, 0xed, 0xa9, 0x28, 0x11,
+  0x91, 0x26, 0xd7, 0x30, 0x83, 0xaa, 0x9c, 0x8c, 0xf9, 0xd2, 0xd2, 0x2f,
+  0x13, 0xb8, 0x52, 0x6a, 0x9d, 0x7c, 0x3a, 0x25, 0xee, 0x5a, 0x84, 0xf2,
+  0xa4, 0x22, 0x3a, 0x5f, 0x37, 0x26, 0xc5, 0x7c, 0x49, 0x29, 0xea, 0x4b,
+  0x44, 0xe3, 0xa8, 0x4a, 0x42, 0xfa, 0x65, 0x92, 0xf0, 0x19, 0x05, 0x97,
+  0x50, 0x05, 0xfb, 0x13, 0xb8, 0x2d, 0xdc, 0xc6, 0x8e, 0x59, 0x1a, 0x02,
+  0x11, 0x82, 0x64, 0xa1, 0xaa, 0xb8, 0x61, 0xae, 0x09, 0x6c, 0x02, 0x29,
+  0x84, 0x7c, 0x19, 0x71, 0xf9, 0xd8, 0x7e, 0xe1, 0x3e, 0x8b, 0xf8, 0xed,
+  0x51, 0xf1, 0xc0, 0x68, 0xd4, 0xfb, 0x31, 0x11, 0x88, 0x4f, 0xa7, 0xaa,
+  0x28, 0x05, 0xb9, 0x24, 0x26, 0xd3, 0xed, 0xe2, 0x6d, 0xf1, 0x94, 0x4d,
+  0xc6, 0xb1, 0x15, 0x93, 0x38, 0x97, 0x4c, 0x92, 0x76, 0x89, 0x8d, 0x54,
+  0x02, 0x66, 0xb3, 0x6a, 0xa5, 0x91, 0x5a, 0x29, 0x2b, 0xf8, 0x30, 0xab,
+  0x57, 0x83, 0xac, 0xd7, 0xa7, 0x48, 0x5e, 0x06, 0xe7, 0xd2, 0xf8, 0xbc,
+  0xc4, 0x73, 0xce, 0xfb, 0xe0, 0x9c, 0xcc, 0x4c, 0xe4, 0x8a, 0x62, 0x41,
+  0xe8, 0x4f, 0x7e, 0x66, 0xc1, 0x2e, 0x5a, 0x89, 0x34, 0x27, 0x95, 0x0e,
+  0x5d, 0x20, 0x87, 0x28, 0x48, 0xb5, 0x63, 0xd2, 0x21, 0x5a, 0xcb, 0x21,
+  0x48, 0x25, 0xd8, 0x1c, 0x09, 0xa2, 0x5d, 0xb9, 0x81, 0xbb, 0x3e, 0x56,
+  0xbb, 0x2b, 0x11, 0xf3, 0x7d, 0x4c, 0xdd, 0x95, 0x00, 0x77, 0xa1, 0xd3,
+  0xc7, 0x35, 0xee, 0xfa, 0x98, 0xb8, 0x0b, 0x51, 0x7c, 0xe3, 0xc4, 0x5d,
+  0xe3, 0xd4, 0x5d, 0x89, 0x4b, 0x70, 0x57, 0x82, 0xba, 0x2b, 0x81, 0x1b,
+  0xd6, 0xbb, 0x0b, 0x99, 0x85, 0xd8, 0x1f, 0xa5, 0x3e, 0x64, 0x1e, 0x43,
+  0x7f, 0xcd, 0xa5, 0x9c, 0xac, 0xbf, 0x50, 0xde, 0xde, 0x21, 0x3b, 0x2c,
+  0x6b, 0xdb, 0x04, 0xce, 0x25, 0xf2, 0x76, 0xd8, 0xbb, 0x5b, 0x1d, 0x38,
+  0xd4, 0xd2, 0xa7, 0xc7, 0x15, 0x5f, 0x55, 0x23, 0x5c, 0x3c, 0xe8, 0xcd,
+  0xf0, 0x1c, 0xf7, 0x34, 0x9c, 0x43, 0x6e, 0x7b, 0x88, 0xb8, 0x6d, 0x1d,
+  0x76, 0x5b, 0xb3, 0xec, 0x36, 0xd9, 0x39, 0x82, 0xf8, 0x08, 0xe3, 0x9c,
+  0x0e, 0xd9, 0xfa, 0x71, 0x71, 0x88, 0x91, 0xf9, 0xd5, 0x89, 0x9d, 0x41,
+  0x9b, 0x44, 0xd1, 0x2a, 0x4c, 0xc2, 0xf2, 0x0e, 0x7c, 0x7d, 0x30, 0xa4,
+  0x38, 0xde, 0x3f, 0xf5, 0x41, 0xe2, 0x0f, 0x47, 0x6d, 0xe2, 0xe3, 0xd4,
+  0xde, 0xe7, 0x15, 0x6b, 0x95, 0x82, 0x19, 0x12, 0x29, 0x0b, 0xcd, 0xc9,
+  0x55, 0xef, 0x5f, 0x24, 0x9c, 0x1e, 0xa7, 0x16, 0x8e, 0x1c, 0x75, 0x20,
+  0xf1, 0x99, 0x98, 0xba, 0x9e, 0xce, 0xca, 0x19, 0x95, 0x95, 0x33, 0xaf,
+  0x1d, 0x11, 0x34, 0xc7, 0xf6, 0x75, 0xcd, 0x93, 0x2a, 0x5f, 0xec, 0xd8,
+  0x6e, 0x90, 0xd7, 0x1c, 0xf8, 0x9e, 0x64, 0x15, 0x7e, 0x77, 0x81, 0xc5,
+  0xe7, 0x92, 0x73, 0x96, 0x6c, 0xd9, 0x01, 0xe9, 0x12, 0xc0, 0x1d, 0x0c,
+  0x7e, 0x1d, 0xe0, 0x4e, 0x06, 0xdf, 0x00, 0xb8, 0xfc, 0x22, 0xc7, 0x0a,
+  0xe9, 0x03, 0x80, 0x7b, 0xa0, 0x6c, 0x87, 0xf4, 0x07, 0x80, 0x37, 0x33,
+  0x72, 0xca, 0xd0, 0x4f, 0xa5, 0xea, 0x0e, 0x7a, 0x27, 0xa4, 0x0b, 0x00,
+  0xbf, 0x93, 0xc1, 0x97, 0x03, 0xfe, 0x16, 0x94, 0x03, 0x90, 0x7e, 0x09,
+  0xf0, 0x55, 0x20, 0xca, 0x02, 0xe9, 0xcd, 0x80, 0xaf, 0x31, 0xd3, 0xf2,
+  0x30, 0xf0, 0xef, 0x40, 0x3f, 0xd3, 0x91, 0x3e, 0xb7, 0x30, 0xfa, 0x77,
+  0x00, 0xff, 0x4d, 0xe0, 0xcf, 0x01, 0x39, 0xbd, 0x80, 0xa7, 0xc0, 0x74,
+  0x4f, 0x02, 0xff, 0x61, 0x90, 0xb3, 0x81, 0xb9, 0xde, 0x5d, 0xc0, 0x8f,
+  0x80, 0xe0, 0x04, 0xe0, 0xdf, 0x05, 0x3c, 0x60, 0xa3, 0xe5, 0x9d, 0x02,
+  0x73, 0xc8, 0x93, 0x93, 0x80, 0xa0, 0x7d, 0x0d, 0xd1, 0x52, 0xdf, 0xc4,
+  0xbc, 0x8a, 0x68, 0xa9, 0x5f, 0xc5, 0xbc, 0x8e, 0x68, 0xa9, 0xf7, 0x18,
+  0xbd, 0x92, 0x68, 0xa9, 0x5f, 0x3d, 0xf1, 0x6b, 0x89, 0x96, 0x7a, 0x57,
+  0xc3, 0xc4, 0xef, 0x26, 0x10, 0xcb, 0x95, 0x55, 0xf7, 0x06, 0x48, 0xcd,
+  0xf0, 0xf3, 0x67, 0x3a, 0x72, 0x5f, 0xd8, 0xaf, 0xc2, 0x2d, 0x2a, 0x7c,
+  0x81, 0x49, 0xc1, 0xad, 0x2a, 0xfc, 0x66, 0xb3, 0x82, 0xdb, 0x54, 0xf8,
+  0x03, 0x80, 0x97, 0xa0, 0x9f, 0x0a, 0x15, 0xfe, 0x3d, 0xb3, 0xe2, 0xb7,
+  0x32, 0x15, 0xfe, 0xbf, 0x16, 0x45, 0x4e, 0x91, 0x0a, 0x5f, 0x66, 0x55,
+  0xe4, 0x38, 0xd4, 0xed, 0x5a, 0x15, 0x39, 0xd3, 0x54, 0x78, 0xb7, 0x4d,
+  0x91, 0x53, 0xac, 0xbe, 0x2e, 0x9b, 0xc2, 0x9f, 0xae, 0xc2, 0xb3, 0x06,
+  0xa9, 0x0f, 0xb7, 0xf7, 0x85, 0x85, 0xfa, 0x36, 0x7f, 0xd8, 0x4f, 0x7f,
+  0xd7, 0xf7, 0x74, 0x09, 0xf5, 0x9b, 0x7a, 0x7b, 0x85, 0xfa, 0xde, 0x7b,
+  0xb7, 0x86, 0xfd, 0x9b, 0x50, 0x1a, 0xee, 0x21, 0x69, 0x4f, 0x7b, 0xd0,
+  0x0f, 0xf4, 0xde, 0x2d, 0x00, 0xe6, 0x7b, 0x98, 0xe0, 0xa7, 0x88, 0xc1,
+  0x9b, 0x21, 0x4d, 0xd9, 0xb4, 0xb8, 0x9d, 0xe1, 0x15, 0x43, 0x7d, 0x0b,
+  0x83, 0x37, 0xb0, 0x02, 0x0d, 0xea, 0x57, 0x4c, 0x50, 0x7f, 0x23, 0x83,
+  0x3b, 0x98, 0xf2, 0x6c, 0x90, 0xc9, 0xd6, 0xdf, 0x9d, 0x63, 0xfb, 0xf3,
+  0x05, 0xea, 0x33, 0xf6, 0x90, 0xeb, 0x8f, 0x41, 0xff, 0x2b, 0x82, 0xba,
+  0x72, 0xfd, 0x2a, 0x48, 0xaf, 0xe4, 0xb4, 0x8d, 0x8f, 0x8d, 0x40, 0x7c,
+  0x86, 0xc1, 0xd9, 0xb9, 0x3f, 0x1e, 0x47, 0xad, 0x82, 0xfe, 0x70, 0x94,
+  0x80, 0xbe, 0x50, 0xc1, 0x06, 0x75, 0xd9, 0xf6, 0x9b, 0x0c, 0xda, 0x77,
+  0xc2, 0xf3, 0x44, 0xf3, 0x04, 0xed, 0xd3, 0x37, 0x85, 0xd9, 0x47, 0x9b,
+  0x09, 0x9f, 0x6d, 0x3c, 0xab, 0x9b, 0x9c, 0x93, 0x7d, 0xb6, 0x69, 0x56,
+  0x81, 0xcd, 0xf0, 0x1b, 0x3f, 0xdb, 0xdc, 0x2e, 0x45, 0x33, 0x92, 0x8d,
+  0xdc, 0xde, 0xaf, 0x4a, 0xe3, 0xe9, 0xdb, 0x0e, 0x7c, 0x4e, 0xaa, 0x3b,
+  0x2a, 0x45, 0x13, 0x5f, 0x3f, 0xc2, 0x11, 0xa4, 0xba, 0x06, 0xde, 0xbd,
+  0x6a, 0x3a, 0x9c, 0xad, 0x66, 0x70, 0x6c, 0x0a, 0x07, 0x4f, 0x33, 0xb8,
+  0xf8, 0x5b, 0xe5, 0xd7, 0xa7, 0xdd, 0x2b, 0x34, 0xa7, 0x2b, 0x21, 0xc5,
+  0xfe, 0x51, 0x8f, 0x55, 0x59, 0xc2, 0x14, 0x8f, 0xdd, 0x1a, 0x06, 0xcf,
+  0x35, 0x76, 0x37, 0x1a, 0xb4, 0x97, 0x6b, 0xec, 0xe6, 0x5a, 0xdf, 0x28,
+  0x76, 0x73, 0xad, 0x6f, 0x14, 0xbb, 0x1b, 0x99, 0xb4, 0x08, 0xda, 0xc8,
+  0x35, 0x76, 0x47, 0x21, 0x9d, 0xc9, 0xe0, 0xb9, 0xc6, 0x6e, 0x82, 0x69,
+  0x67, 0xb2, 0xb1, 0x2b, 0x37, 0xd4, 0x3c, 0x41, 0xfb, 0xb4, 0xd7, 0x2e,
+  0xdb, 0x14, 0x86, 0xf0, 0x9d, 0x28, 0x76, 0x57, 0xaf, 0x6e, 0x9c, 0x74,
+  0xec, 0xee, 0xb9, 0x58, 0xec, 0x46, 0x7f, 0x2e, 0xd9, 0xf0, 0x80, 0xac,
+  0x0b, 0xdf, 0x8f, 0x70, 0x04, 0xdf, 0x42, 0x26, 0xc3, 0x1b, 0x6e, 0xbf,
+  0x58, 0x28, 0x1b, 0xc6, 0x72, 0x35, 0x9c, 0x5d, 0xc2, 0xe0, 0xb8, 0xcf,
+  0xf1, 0x62, 0x79, 0xa1, 0xa0, 0xbf, 0x37, 0x68, 0x0e, 0xc5, 0x58, 0xb7,
+  0xb2, 0x7f, 0x26, 0x41, 0x61, 0x2f, 0x23, 0xa1, 0xf6, 0x7b, 0x5a, 0x7b,
+  0xda, 0x37, 0x77, 0x76, 0x85, 0x98, 0xea, 0xb3, 0x20, 0x65, 0xc7, 0x82,
+  0xab, 0x54, 0xb8, 0x7a, 0x7e, 0x32, 0xd5, 0xc7, 0x86, 0x65, 0x0c, 0x9e,
+  0xeb, 0xd8, 0xd0, 0x6d, 0xd0, 0x5e, 0xae, 0x63, 0x43, 0xae, 0xf5, 0x8d,
+  0xc6, 0x86, 0x5c, 0xeb, 0x1b, 0x8d, 0x0d, 0x72, 0xfd, 0x3e, 0x48, 0x27,
+  0x3b, 0x36, 0xa4, 0x21, 0x6d, 0x64, 0xf0, 0x5c, 0xc7, 0x86, 0x06, 0x20,
+  0xca, 0xcf, 0x41, 0x93, 0x1d, 0x1b, 0x36, 0xe6, 0x38, 0x36, 0xf4, 0x86,
+  0xdb, 0xe8, 0xfb, 0xe6, 0x1c, 0xc7, 0x06, 0x97, 0x7b, 0x75, 0x53, 0xc3,
+  0x24, 0xc7, 0x86, 0x06, 0x8f, 0x92, 0x6f, 0x86, 0xdf, 0xbc, 0x77, 0x96,
+  0xd1, 0x6d, 0xe8, 0x51, 0x7f, 0x3d, 0x7e, 0x2d, 0x95, 0x11, 0x0f, 0xf8,
+  0xd2, 0x83, 0xf6, 0x11, 0xf2, 0xd8, 0x1b, 0x3d, 0x46, 0x06, 0x08, 0xcd,
+  0x03, 0xb8, 0xcc, 0x1f, 0x31, 0xab, 0x18, 0xb4, 0xa2, 0x42, 0x6c, 0x66,
+  0x05, 0x47, 0x7d, 0x89, 0x96, 0xa8, 0x77, 0xbc, 0x25, 0xea, 0x3b, 0x89,
+  0xdf, 0x2b, 0x20, 0xee, 0xa0, 0xf7, 0x04, 0xbc, 0x56, 0x1c, 0x95, 0x62,
+  0xeb, 0xd1, 0x43, 0xbc, 0x2f, 0x29, 0x1e, 0xf0, 0x9e, 0x48, 0x8b, 0xfb,
+  0x4b, 0x07, 0xbd, 0x6f, 0x50, 0x92, 0xef, 0x8d, 0x41, 0x3b, 0x02, 0xdf,
+  0x40, 0xb9, 0x13, 0xab, 0xc7, 0xe8, 0xa3, 0xbe, 0xfe, 0xe5, 0x24, 0xb4,
+  0x41, 0x9e, 0xdc, 0xf1, 0x80, 0x47, 0xa4, 0x1e, 0x23, 0x45, 0xa2, 0x1c,
+  0xaa, 0x34, 0xe8, 0x3d, 0x8b, 0xe4, 0xa4, 0x07, 0xbd, 0x1f, 0x8d, 0x60,
+  0x77, 0xde, 0x18, 0x8d, 0x43, 0x3a, 0x3a, 0x62, 0x22, 0xe9, 0x11, 0x74,
+  0xfa, 0xa3, 0x1b, 0xa3, 0xaf, 0x4a, 0x43, 0xde, 0xb3, 0x8a, 0x8c, 0x96,
+  0xe8, 0x9b, 0x2d, 0xd1, 0x53, 0x1a, 0x49, 0xe4, 0x75, 0xc1, 0x7e, 0x3c,
+  0x96, 0x1e, 0xf0, 0x9e, 0xcd, 0x43, 0x97, 0xb3, 0xd8, 0xce, 0xa6, 0xb1,
+  0x42, 0x69, 0xf4, 0x63, 0xaa, 0xd1, 0x47, 0xf9, 0x6a, 0x54, 0x37, 0xe5,
+  0x34, 0xaa, 0x9d, 0x72, 0x1a, 0x95, 0x4c, 0x39, 0x8d, 0x5c, 0x53, 0x4e,
+  0xa3, 0xda, 0xb1, 0x48, 0xfa, 0x42, 0xa1, 0x94, 0xfa, 0x51, 0x81, 0x94,
+  0x2a, 0x78, 0xb8, 0xe5, 0x3d, 0x00, 0x14, 0x3c, 0xdc, 0xf2, 0xd6, 0xa8,
+  0xe0, 0xe1, 0x96, 0xb7, 0x46, 0x05, 0x0f, 0xb7, 0xbc, 0x35, 0x2a, 0x78,
+  0xb8, 0x15, 0xc0, 0x6b, 0x85, 0x0f, 0x37, 0x63, 0xa5, 0xc8, 0xdd, 0xfe,
+  0xa0, 0x2f, 0xdd, 0x11, 0xbd, 0xa4, 0x79, 0xc2, 0xc1, 0x49, 0xcc, 0x13,
+  0x0e, 0x0a, 0x1d, 0x51, 0xef, 0x71, 0xcd, 0x44, 0xe1, 0x20, 0x9a, 0x28,
+  0x1c, 0xf4, 0x1e, 0x4f, 0x77, 0x88, 0x2f, 0x94, 0xa2, 0x93, 0x27, 0x28,
+  0xcf, 0x77, 0x02, 0x69, 0x83, 0xf0, 0x13, 0x28, 0x7b, 0x3c, 0x8f, 0xb9,
+  0xc2, 0xc1, 0x51, 0x24, 0xf3, 0x0c, 0x12, 0x84, 0xae, 0xce, 0x7b, 0xd6,
+  0xd0, 0x9e, 0x07, 0xbd, 0x67, 0xa9, 0x3d, 0xcf, 0x4c, 0x6c, 0xcf, 0xe7,
+  0xb1, 0x3d, 0x0f, 0x7a, 0xcf, 0xe4, 0xa3, 0xcd, 0x19, 0x6c, 0x6f, 0xd3,
+  0x58, 0xc1, 0x74, 0x7a, 0x96, 0xea, 0x74, 0x29, 0x1d, 0x4f, 0xab, 0x53,
+  0xdd, 0x14, 0xd4, 0xa9, 0x76, 0x0a, 0xea, 0x54, 0x32, 0x05, 0x75, 0x72,
+  0x4d, 0x41, 0x9d, 0xc8, 0x48, 0x56, 0x30, 0xb5, 0x7e, 0x58, 0x28, 0xb5,
+  0x0a, 0x1f, 0x7a, 0xf9, 0x0f, 0x07, 0x85, 0x0f, 0xbd, 0xfc, 0x75, 0x2a,
+  0x7c, 0xe8, 0xe5, 0xaf, 0x53, 0xe1, 0x43, 0x2f, 0x7f, 0x9d, 0x0a, 0x1f,
+  0x7a, 0x85, 0xf0, 0xdd, 0xe7, 0x10, 0x7a, 0xc6, 0x6a, 0xe1, 0xfa, 0x31,
+  0x5f, 0xfa, 0x92, 0xe6, 0x10, 0xb1, 0xdc, 0xa7, 0x10, 0x31, 0x21, 0xea,
+  0x1d, 0x53, 0x4f, 0x20, 0x62, 0xbe, 0x64, 0xcc, 0x3b, 0x96, 0x46, 0xb3,
+  0x07, 0x3a, 0xb3, 0x48, 0xc7, 0x7c, 0xc7, 0xa3, 0xf6, 0x98, 0xf7, 0x78,
+  0xcc, 0x37, 0x76, 0xe9, 0x13, 0x07, 0xb2, 0x50, 0x22, 0x8d, 0xac, 0x69,
+  0x64, 0xbc, 0x98, 0xf7, 0x0c, 0xb5, 0x5d, 0x62, 0x62, 0xdb, 0xbd, 0x88,
+  0x6c, 0xc7, 0x2e, 0x39, 0xc9, 0x5d, 0x8b, 0x44, 0x0c, 0x8f, 0x57, 0x05,
+  0x52, 0xe5, 0x27, 0x44, 0x95, 0x4b, 0xe8, 0x5c, 0x59, 0x55, 0xea, 0xa6,
+  0x8e, 0x2a, 0xb5, 0x53, 0x47, 0x95, 0x92, 0xa9, 0xa3, 0x8a, 0x6b, 0xea,
+  0xa8, 0x42, 0x86, 0xa0, 0x02, 0x69, 0xf3, 0xe3, 0xbc, 0xb5, 0x29, 0x70,
+  0x10, 0xe5, 0x13, 0xcf, 0x05, 0x0e, 0xa2, 0x7c, 0x54, 0x29, 0x70, 0x10,
+  0xe5, 0xa3, 0x4a, 0x81, 0x83, 0x28, 0x1f, 0x55, 0x0a, 0x1c, 0x44, 0xf9,
+  0x39, 0xa8, 0xd0, 0x41, 0x64, 0xac, 0x0d, 0xa9, 0x8e, 0xd7, 0x23, 0x5e,
+  0xd2, 0x6d, 0x5c, 0x52, 0xdd, 0xc7, 0x6f, 0x61, 0x25, 0x33, 0xf7, 0x71,
+  0xc4, 0xa5, 0x77, 0x70, 0x72, 0x27, 0x1f, 0x41, 0x77, 0xf2, 0x11, 0xb2,
+  0xa0, 0x36, 0xe6, 0x1d, 0x4d, 0x4b, 0xe8, 0x66, 0x2e, 0xd1, 0xdb, 0x3c,
+  0xe2, 0xf9, 0xc6, 0x90, 0x36, 0x28, 0x8b, 0x57, 0x1e, 0x8e, 0x4a, 0xba,
+  0x5b, 0x7a, 0x43, 0xae, 0x06, 0x45, 0x12, 0xc7, 0xe5, 0x45, 0x90, 0x46,
+  0xb6, 0xc4, 0xeb, 0x13, 0xa9, 0x31, 0xc7, 0x73, 0x7b, 0x11, 0x80, 0xd7,
+  0x40, 0x5e, 0xb2, 0x2a, 0xe3, 0xc4, 0xd4, 0xa6, 0xb1, 0x82, 0x69, 0xf4,
+  0x0c, 0xd5, 0x28, 0x91, 0xa7, 0x46, 0x75, 0x53, 0x4e, 0xa3, 0xda, 0x29,
+  0xa7, 0x51, 0xc9, 0x94, 0xd3, 0xc8, 0x35, 0xe5, 0x34, 0x42, 0x5e, 0x43,
+  0x43, 0x57, 0xc1, 0xb4, 0xda, 0x5b, 0x18, 0xad, 0x0a, 0x1f, 0x6f, 0xf9,
+  0x8e, 0x00, 0x85, 0x8f, 0xb7, 0x7c, 0x35, 0x2a, 0x7c, 0xbc, 0xe5, 0xab,
+  0x51, 0xe1, 0xe3, 0x2d, 0x5f, 0x8d, 0x0a, 0x1f, 0x6f, 0x05, 0xf0, 0xda,
+  0xe7, 0x10, 0x6f, 0xe3, 0xba, 0x9b, 0xbf, 0x0e, 0x48, 0x4b, 0x91, 0xf2,
+  0x45, 0x9c, 0x7d, 0x46, 0x48, 0xfb, 0x14, 0x5e, 0xf7, 0x4d, 0x9a, 0x1f,
+  0xf4, 0xfe, 0x36, 0xd5, 0xae, 0x2e, 0x6c, 0x50, 0x17, 0xbe, 0xaa, 0x2e,
+  0xac, 0x15, 0x60, 0xc7, 0x01, 0x2e, 0xe0, 0xa5, 0xcc, 0x44, 0xd3, 0x48,
+  0xc6, 0x24, 0xee, 0x78, 0x01, 0x2b, 0x15, 0xc9, 0x98, 0xc5, 0x1d, 0x2f,
+  0xd1, 0x9c, 0x55, 0xdc, 0x71, 0x90, 0xe6, 0xec, 0xe2, 0x8e, 0x97, 0x51,
+  0x2e, 0xf5, 0x2a, 0x7e, 0x55, 0x71, 0xd8, 0xfb, 0x5b, 0x76, 0x89, 0xbf,
+  0xfe, 0x30, 0x5a, 0x0b, 0x85, 0xd7, 0xd2, 0xa8, 0xd7, 0xbc, 0xcb, 0x6b,
+  0x47, 0x6a, 0x00, 0xbf, 0xcb, 0x49, 0xcb, 0x73, 0x00, 0x77, 0x03, 0x2e,
+  0xf3, 0xea, 0x20, 0xbd, 0x1e, 0xf0, 0x6f, 0x40, 0xb9, 0x0d, 0xd2, 0x8d,
+  0x80, 0xbf, 0x02, 0xe5, 0x5d, 0x90, 0x86, 0x01, 0xbf, 0x11, 0x9a, 0x7e,
+  0x0c, 0xf0, 0x28, 0xe0, 0xef, 0x32, 0xf8, 0x53, 0x80, 0x6f, 0x35, 0x6b,
+  0xf1, 0x7f, 0x01, 0xfc, 0x02, 0x83, 0x1f, 0x03, 0xfc, 0x51, 0x8b, 0x16,
+  0x7f, 0x0f, 0xf0, 0x2b, 0x61, 0x01, 0xcd, 0x13, 0x80, 0x7f, 0x02, 0xf8,
+  0x88, 0x55, 0xcb, 0x2f, 0x36, 0x51, 0xfc, 0x26, 0x9b, 0x16, 0xaf, 0x06,
+  0xfc, 0x3d, 0x06, 0x77, 0x01, 0x1e, 0x2a, 0xd2, 0xe2, 0x5e, 0xc0, 0xc9,
+  0xe2, 0x27, 0x15, 0x7e, 0x3b, 0xe0, 0x8f, 0x15, 0x6b, 0xf5, 0xe9, 0x06,
+  0x7c, 0x31, 0x2c, 0xde, 0x91, 0x57, 0xb9, 0xf7, 0x03, 0xbe, 0x01, 0x70,
+  0xd9, 0xfe, 0x8f, 0x02, 0xde, 0x0f, 0xf8, 0x16, 0xc0, 0x7f, 0x02, 0x78,
+  0x0a, 0xf0, 0x47, 0x00, 0x8f, 0x03, 0x7e, 0x0f, 0xac, 0x05, 0x7e, 0x1c,
+  0xf0, 0xb7, 0x01, 0x2f, 0x2b, 0xd5, 0xe2, 0xe7, 0x00, 0x7f, 0x9a, 0xc1,
+  0xf1, 0x42, 0x28, 0x8c, 0xaf, 0x28, 0xd3, 0xe2, 0x33, 0x01, 0x3f, 0xc6,
+  0xe0, 0x75, 0x80, 0x7f, 0xb3, 0x9c, 0x96, 0xff, 0x11, 0xf0, 0x75, 0x80,
+  0x7f, 0x52, 0xae, 0xe5, 0xff, 0x35, 0xe0, 0x3b, 0x2b, 0xb4, 0x78, 0x27,
+  0xe0, 0xf3, 0xa6, 0x69, 0xf1, 0x07, 0x01, 0x7f, 0x8e, 0xc1, 0x1f, 0x03,
+  0xfc, 0xcb, 0xa2, 0x16, 0xff, 0x11, 0xe0, 0x6f, 0x8b, 0x5a, 0x7d, 0x5e,
+  0x01, 0x7c, 0x2b, 0x2c, 0xfc, 0x5b, 0x0e, 0xf8, 0x09, 0xc0, 0xff, 0x09,
+  0xf0, 0xab, 0x01, 0x7f, 0x1f, 0xf0, 0xa3, 0x80, 0xff, 0x2d, 0xe0, 0x7f,
+  0x02, 0xfc, 0x0a, 0xba, 0x80, 0x38, 0xbb, 0xc7, 0x62, 0x9a, 0x85, 0xe2,
+  0xcf, 0x00, 0x1e, 0x03, 0xfc, 0x4a, 0xc0, 0x57, 0x54, 0x6a, 0x71, 0x0f,
+  0xe0, 0x87, 0x19, 0xdc, 0x07, 0xf8, 0x8d, 0x33, 0xb4, 0xb8, 0x1f, 0xf0,
+  0xb7, 0x18, 0xfc, 0x6e, 0xc0, 0x5b, 0x61, 0x01, 0xaa, 0xdc, 0x1f, 0x76,
+  0x01, 0xfe, 0xeb, 0x99, 0x5a, 0xfe, 0x3f, 0x03, 0xde, 0x37, 0x4b, 0x8b,
+  0x1f, 0x00, 0xdc, 0x32, 0x5b, 0x8b, 0xbf, 0x0e, 0xf8, 0x23, 0x0c, 0xfe,
+  0x01, 0xe0, 0x73, 0xe7, 0x68, 0xf1, 0xf3, 0x80, 0xef, 0x9d, 0xa3, 0xd5,
+  0xa7, 0xd4, 0x4a, 0xf1, 0xc6, 0x2a, 0x5a, 0x96, 0xfb, 0xff, 0x7c, 0xc0,
+  0x03, 0x80, 0xcb, 0xfd, 0x7f, 0x09, 0xe0, 0xbb, 0x00, 0xef, 0x04, 0xfc,
+  0x2b, 0x80, 0xff, 0xbe, 0x4a, 0xdb, 0xee, 0x37, 0x01, 0xdf, 0x3e, 0x97,
+  0x96, 0xe5, 0x78, 0xec, 0x06, 0xbc, 0x72, 0x9e, 0x16, 0x1f, 0x00, 0x7c,
+  0x2f, 0x83, 0x3f, 0x09, 0x78, 0xd3, 0x7c, 0x2d, 0xfe, 0x1c, 0xe0, 0x63,
+  0x0c, 0x7e, 0x04, 0xf0, 0xdb, 0x61, 0x21, 0xf9, 0x77, 0x00, 0x3f, 0x05,
+  0x78, 0xba, 0x5a, 0xcb, 0xff, 0x0d, 0xe0, 0x0f, 0x2f, 0xd0, 0xe2, 0x16,
+  0x1b, 0xc5, 0x67, 0xd6, 0x68, 0xf1, 0x2a, 0xc0, 0x7f, 0xc8, 0xe0, 0x4b,
+  0x01, 0xf7, 0x2c, 0xd4, 0xe2, 0x5f, 0x02, 0xfc, 0x17, 0x0b, 0xb5, 0xfa,
+  0xdc, 0x06, 0xf8, 0x46, 0x27, 0x2d, 0x43, 0x37, 0x15, 0xb6, 0x02, 0x3e,
+  0x08, 0xf8, 0x6e, 0x81, 0x39, 0x94, 0xc5, 0x81, 0x81, 0xcb, 0xdf, 0x08,
+  0xb9, 0xfc, 0x8d, 0x90, 0xcb, 0xdf, 0x08, 0xb9, 0xfc, 0x8d, 0x90, 0xcb,
+  0xdf, 0x08, 0xf9, 0x8b, 0x7e, 0x23, 0x44, 0x73, 0x5c, 0x03, 0x29, 0x9e,
+  0xd6, 0xaa, 0xf7, 0x3e, 0xb6, 0x18, 0xe0, 0x29, 0x15, 0xae, 0xde, 0x73,
+  0xb0, 0xc2, 0xa4, 0xe0, 0xea, 0x3d, 0x91, 0xdb, 0x4c, 0x7c, 0xfe, 0xbf,
+  0x19, 0xf0, 0x8b, 0xcd, 0x7c, 0xfe, 0x6d, 0x66, 0x3e, 0xff, 0xbb, 0x06,
+  0xfc, 0x94, 0x01, 0x7f, 0x89, 0x85, 0xcf, 0xff, 0x3b, 0x0b, 0x9f, 0xff,
+  0x8a, 0x01, 0xbf, 0xc2, 0xca, 0xe7, 0x7f, 0xcd, 0xca, 0xe7, 0x7f, 0xdf,
+  0x80, 0x7f, 0xc6, 0x80, 0xef, 0xb6, 0xf1, 0xf9, 0x77, 0xdb, 0xf8, 0xfc,
+  0x9f, 0x1b, 0xf0, 0xed, 0x45, 0x7c, 0xfe, 0x86, 0x22, 0x3e, 0xff, 0x49,
+  0x03, 0xfe, 0xaf, 0x0c, 0xf8, 0x4b, 0x8b, 0xf9, 0xfc, 0xfb, 0x8b, 0xf9,
+  0xfc, 0xc3, 0x06, 0xfc, 0xe9, 0x76, 0x3e, 0xff, 0xeb, 0x2a, 0x5c, 0xdd,
+  0x0f, 0xc3, 0x06, 0xf8, 0xac, 0x12, 0x05, 0x9f, 0xa9, 0xc2, 0xfd, 0x2a,
+  0x7c, 0x96, 0x0a, 0xff, 0x81, 0x01, 0xff, 0xf7, 0x06, 0xfc, 0x55, 0xa5,
+  0x7c, 0x7e, 0xb4, 0x94, 0xcf, 0x7f, 0xdd, 0x80, 0xbf, 0xa0, 0x8c, 0xcf,
+  0x6f, 0x2d, 0xe3, 0xf3, 0x5f, 0x30, 0xe0, 0x7f, 0x6a, 0xc0, 0xf7, 0x96,
+  0xf3, 0xf9, 0x7f, 0x5f, 0xce, 0xe7, 0xbf, 0x67, 0xc0, 0xaf, 0xa9, 0xe0,
+  0xf3, 0xbb, 0x2b, 0xf8, 0xfc, 0x17, 0x0d, 0xf8, 0xd6, 0x69, 0x7c, 0xfe,
+  0x0d, 0xd3, 0xf8, 0xfc, 0x61, 0x03, 0xfe, 0x3b, 0x06, 0xfc, 0xa5, 0x22,
+  0x9f, 0x1f, 0x12, 0xf9, 0xfc, 0x51, 0x03, 0xbe, 0xd9, 0xc1, 0xe7, 0xdf,
+  0xe6, 0xe0, 0xf3, 0xbf, 0xa3, 0xc2, 0xd5, 0xfd, 0x70, 0xc4, 0x00, 0xbf,
+  0x79, 0xba, 0x82, 0x2f, 0x52, 0xe1, 0xdf, 0x56, 0xe1, 0x57, 0xa9, 0xf0,
+  0xb7, 0x0c, 0xf8, 0x35, 0x95, 0x7c, 0x7e, 0x6b, 0x25, 0x9f, 0xff, 0xac,
+  0x01, 0xff, 0x57, 0x06, 0x7c, 0xf7, 0x0c, 0x3e, 0x7f, 0xdb, 0x0c, 0x3e,
+  0xff, 0x5f, 0x0d, 0xf8, 0xf2, 0x46, 0x46, 0x96, 0x7f, 0xd3, 0x4c, 0x3e,
+  0x3f, 0x66, 0xc0, 0x1f, 0x37, 0xe0, 0xcf, 0x9d, 0xc5, 0xe7, 0x07, 0x66,
+  0xf1, 0xf9, 0x7b, 0x0d, 0xf8, 0xbf, 0x31, 0xe0, 0x2f, 0x9f, 0xcd, 0xe7,
+  0xdf, 0x3b, 0x9b, 0xcf, 0x7f, 0xd9, 0x80, 0x6f, 0x9d, 0xc3, 0xe7, 0x7b,
+  0xe7, 0xf0, 0xf9, 0xff, 0x60, 0xc0, 0x3f, 0x69, 0xc0, 0x5f, 0x50, 0xc5,
+  0xe7, 0xff, 0x8d, 0x0a, 0x57, 0xf7, 0xc3, 0x87, 0x0c, 0xf0, 0xda, 0xb9,
+  0x0a, 0xee, 0x56, 0xe1, 0x77, 0xaa, 0xf0, 0x95, 0x2a, 0x7c, 0x9f, 0x01,
+  0xff, 0xcf, 0x06, 0xfc, 0xb5, 0xf3, 0xf8, 0xfc, 0x47, 0xe6, 0xf1, 0xf9,
+  0x27, 0x0d, 0xf8, 0xce, 0xf9, 0x7c, 0xfe, 0xa6, 0xf9, 0x7c, 0xfe, 0x8b,
+  0x06, 0xfc, 0xf3, 0x06, 0xfc, 0xeb, 0xab, 0xf9, 0xfc, 0x9d, 0xd5, 0x7c,
+  0xfe, 0x3b, 0x06, 0xfc, 0xea, 0x05, 0x7c, 0x7e, 0x70, 0x01, 0x9f, 0xff,
+  0x9c, 0x01, 0xff, 0x33, 0x03, 0x7e, 0x73, 0x0d, 0x9f, 0xbf, 0xbb, 0x86,
+  0xcf, 0x7f, 0xd3, 0x80, 0x7f, 0xc5, 0x42, 0x3e, 0xbf, 0x6d, 0x21, 0x9f,
+  0xff, 0x92, 0x01, 0xff, 0x0f, 0x06, 0xfc, 0x9b, 0x9c, 0x7c, 0xfe, 0x54,
+  0xdf, 0xab, 0x5a, 0x55, 0xab, 0xc5, 0x73, 0xdd, 0xab, 0xba, 0x91, 0xa9,
+  0x67, 0x54, 0xdf, 0x70, 0x1f, 0x7b, 0x8e, 0xf5, 0x0d, 0xf7, 0xb1, 0xe7,
+  0x58, 0xdf, 0x70, 0x1f, 0x3b, 0xd4, 0xef, 0x03, 0xc3, 0x14, 0x01, 0x2f,
+  0xd7, 0xbd, 0xaa, 0x89, 0xc5, 0x34, 0x8d, 0xd8, 0xb4, 0x78, 0xae, 0x7b,
+  0x55, 0xbb, 0x61, 0x93, 0xf0, 0x76, 0x98, 0x3f, 0xd9, 0x84, 0xc9, 0xed,
+  0x55, 0x4d, 0xaf, 0xa2, 0x69, 0x33, 0x83, 0xeb, 0xf6, 0xb1, 0xab, 0x37,
+  0xaa, 0xe6, 0xb0, 0x57, 0x75, 0xd5, 0x25, 0xec, 0x63, 0xaf, 0xe2, 0xec,
+  0x63, 0xb7, 0xa3, 0x9e, 0x43, 0xfe, 0xc8, 0xb3, 0xb3, 0xf8, 0x88, 0x6b,
+  0x14, 0xfd, 0xe2, 0xd4, 0x53, 0xeb, 0xcc, 0xfb, 0xdb, 0x0c, 0x36, 0x4d,
+  0x25, 0xa7, 0x45, 0x27, 0xe0, 0xac, 0xaf, 0xe5, 0x8b, 0xbd, 0x35, 0xb7,
+  0xcf, 0x44, 0x4e, 0xea, 0x1b, 0x13, 0x05, 0x0b, 0x48, 0x61, 0xe2, 0x98,
+  0xac, 0x60, 0xf0, 0x5c, 0x63, 0xf2, 0x16, 0x81, 0x7f, 0xe4, 0x1a, 0x93,
+  0xb9, 0xd6, 0x37, 0x8a, 0xc9, 0x5c, 0xeb, 0x1b, 0xc5, 0xa4, 0x5c, 0x7f,
+  0x23, 0xa4, 0x93, 0x8d, 0x49, 0xf9, 0x3b, 0x47, 0xcb, 0x19, 0x9c, 0x17,
+  0x93, 0xdc, 0x98, 0x86, 0x74, 0xe5, 0x04, 0xf5, 0xe1, 0x1b, 0x9a, 0xb9,
+  0x7f, 0xb3, 0xd2, 0xed, 0xf1, 0x4c, 0x36, 0xa6, 0x36, 0x96, 0x29, 0xf9,
+  0x66, 0xf8, 0xad, 0xda, 0xff, 0x2d, 0xff, 0x39, 0x96, 0xfc, 0xe9, 0x34,
+  0xe6, 0xcb, 0xd4, 0x8d, 0xa1, 0x5f, 0xb5, 0xf1, 0x11, 0xd7, 0x4f, 0xef,
+  0x2f, 0x16, 0x9f, 0x1f, 0x8b, 0xa7, 0xe6, 0x4b, 0x43, 0x64, 0x64, 0x92,
+  0x4c, 0xf8, 0x4c, 0xe4, 0x8f, 0x82, 0xf8, 0x44, 0x5c, 0x3c, 0xf0, 0x9a,
+  0x78, 0x40, 0x30, 0x8d, 0xe9, 0x97, 0x78, 0x8d, 0xc8, 0x4d, 0xc1, 0xb7,
+  0xd3, 0x48, 0x52, 0x1b, 0x97, 0x46, 0xb6, 0x7a, 0x9e, 0x38, 0x1e, 0x38,
+  0xbd, 0xdc, 0x2c, 0x21, 0xa1, 0x52, 0x3c, 0xb5, 0x46, 0x91, 0x4a, 0x28,
+  0x13, 0xc8, 0x8d, 0x79, 0x33, 0xf1, 0xa4, 0x09, 0x11, 0x4b, 0xe2, 0x51,
+  0x1f, 0x2d, 0x99, 0x35, 0x25, 0xab, 0xa6, 0x64, 0xd7, 0x94, 0x1c, 0xaa,
+  0xd2, 0xa1, 0xd3, 0xfb, 0x8e, 0xa2, 0xeb, 0x8a, 0xc7, 0x93, 0xe8, 0xba,
+  0x2a, 0xa8, 0x06, 0xa8, 0xd9, 0x92, 0x28, 0xe7, 0x5a, 0xf0, 0xdf, 0x8f,
+  0x51, 0xab, 0x44, 0xbf, 0x92, 0xb8, 0x84, 0x04, 0x00, 0x64, 0xd6, 0x43,
+  0x56, 0x3d, 0x64, 0xd7, 0x43, 0x0e, 0x3d, 0xe4, 0x64, 0xa1, 0x43, 0xd1,
+  0xd2, 0xd7, 0x5f, 0xba, 0xeb, 0x7b, 0xff, 0x6d, 0x41, 0x96, 0x8a, 0x23,
+  0xc2, 0x9a, 0x89, 0xf4, 0xcc, 0xc5, 0x73, 0xea, 0x8d, 0xf9, 0xf9, 0xf8,
+  0x8a, 0x27, 0x27, 0x46, 0xbf, 0x2a, 0x38, 0x84, 0xdf, 0x03, 0xe0, 0x3c,
+  0x5e, 0x78, 0x48, 0x0c, 0x9f, 0x30, 0x41, 0x26, 0xa3, 0xf1, 0x5c, 0x46,
+  0xe3, 0xb9, 0x8c, 0xc6, 0x73, 0x19, 0x8d, 0xe7, 0x32, 0xf9, 0x78, 0x8e,
+  0xe8, 0x54, 0x2e, 0xc8, 0xeb, 0x00, 0xc8, 0x1a, 0x07, 0x30, 0x7a, 0xc2,
+  0xa4, 0xe4, 0x33, 0x7a, 0xff, 0x66, 0xf4, 0xfe, 0xcd, 0xe8, 0xfd, 0x9b,
+  0xd1, 0xfb, 0x37, 0xa3, 0xf7, 0x6f, 0x26, 0x7f, 0xff, 0xd2, 0xbe, 0xdf,
+  0x9f, 0x58, 0x8f, 0x0e, 0xec, 0x66, 0xb0, 0x47, 0x7f, 0x62, 0x05, 0x3a,
+  0x10, 0x10, 0x4f, 0x99, 0xfb, 0x3f, 0xc4, 0x79, 0xbc, 0x56, 0x59, 0x89,
+  0x06, 0x53, 0xbc, 0xff, 0x43, 0x11, 0x1d, 0x60, 0x3d, 0x13, 0x3a, 0x88,
+  0xf5, 0xaa, 0x22, 0x89, 0x75, 0xc6, 0x7d, 0xfd, 0xd0, 0x7a, 0x38, 0xf0,
+  0xc2, 0x10, 0xd2, 0x2d, 0x54, 0x9a, 0xaf, 0x80, 0x43, 0x3e, 0x87, 0x5a,
+  0x96, 0x5e, 0x56, 0xc0, 0xff, 0xa0, 0xcb, 0xa4, 0xb4, 0x21, 0x61, 0x42,
+  0xfd, 0x49, 0x84, 0x03, 0x77, 0xae, 0xac, 0x30, 0x13, 0x1c, 0x60, 0x06,
+  0x8f, 0x14, 0x49, 0x3c, 0x84, 0x5c, 0xe3, 0xc4, 0x31, 0xf1, 0x17, 0xb0,
+  0x81, 0x69, 0x8a, 0xda, 0xc0, 0xa4, 0xd8, 0x80, 0xbd, 0x79, 0x54, 0x9b,
+  0x17, 0x4c, 0xab, 0xb2, 0xd4, 0xcc, 0x9e, 0x29, 0xce, 0x9d, 0x6e, 0xb5,
+  0x2f, 0x9c, 0x5f, 0x31, 0x67, 0xd6, 0x0c, 0x47, 0xf1, 0xbc, 0xf2, 0xca,
+  0xa2, 0x32, 0x5b, 0x69, 0xc9, 0xc2, 0xd9, 0x35, 0xb3, 0x2a, 0x4b, 0x17,
+  0x98, 0x67, 0x4e, 0x17, 0x2b, 0x4a, 0x8a, 0xaa, 0x4d, 0x73, 0x66, 0x94,
+  0x59, 0x1c, 0xd3, 0x8a, 0xab, 0xca, 0xad, 0xf6, 0xb9, 0xb6, 0x79, 0xe8,
+  0x4e, 0x69, 0x32, 0xaf, 0xb4, 0x14, 0x37, 0xcd, 0xb7, 0x7e, 0xa1, 0xce,
+  0x7e, 0xc5, 0xaa, 0x86, 0xea, 0xb5, 0xb6, 0xc5, 0xf5, 0x4b, 0xaf, 0x99,
+  0x5d, 0x52, 0x75, 0xe5, 0x17, 0x3d, 0xae, 0xca, 0x05, 0x65, 0xeb, 0xdc,
+  0x45, 0xf3, 0xae, 0xba, 0xba, 0x76, 0xf9, 0x75, 0xcb, 0x96, 0xcc, 0x9a,
+  0xb3, 0x66, 0x7a, 0xe9, 0x8a, 0xb9, 0x8b, 0x9c, 0xd7, 0xce, 0x5c, 0xed,
+  0x68, 0x5c, 0x38, 0x43, 0xac, 0x99, 0x56, 0x51, 0xbe, 0xce, 0xb1, 0xb6,
+  0x58, 0x5c, 0x74, 0x9d, 0xa5, 0x68, 0xda, 0xec, 0x79, 0x57, 0x2e, 0xbf,
+  0xd6, 0x5c, 0x62, 0xab, 0x2e, 0xab, 0x98, 0x75, 0xcd, 0x8c, 0xb9, 0x0b,
+  0xaf, 0xb8, 0xba, 0xde, 0xfd, 0x45, 0xd3, 0x74, 0xfb, 0x55, 0xd6, 0x39,
+  0xf3, 0x1b, 0x4a, 0x17, 0x94, 0x2f, 0x99, 0xe9, 0xac, 0x5b, 0x59, 0xf9,
+  0x85, 0x2a, 0x57, 0xcd, 0xd2, 0xda, 0xa6, 0xc5, 0x8d, 0xcb, 0x56, 0xad,
+  0xf0, 0xac, 0x5e, 0xc3, 0xb9, 0x33, 0xc9, 0xf7, 0x2d, 0xfe, 0x9c, 0xad,
+  0x4c, 0xd0, 0x7e, 0xd3, 0xd2, 0x09, 0xe9, 0x6c, 0x41, 0xfb, 0xed, 0x4a,
+  0x39, 0xad, 0x15, 0xb4, 0xdf, 0xa2, 0x94, 0xd3, 0xa5, 0x80, 0x6f, 0x67,
+  0x70, 0x3c, 0xed, 0x55, 0xcf, 0x09, 0xe5, 0x6f, 0x1e, 0x7a, 0x01, 0x97,
+  0xcb, 0x1b, 0x20, 0x5d, 0x6f, 0x80, 0xb7, 0x01, 0xfe, 0x14, 0x94, 0xe5,
+  0xff, 0x97, 0xd2, 0x03, 0x78, 0x25, 0x34, 0xf1, 0x0c, 0xe0, 0x0f, 0x1b,
+  0xe0, 0x8f, 0x02, 0xfe, 0x32, 0xe0, 0x1e, 0xc0, 0x9f, 0x06, 0xfc, 0x13,
+  0xc0, 0x25, 0xc0, 0x9f, 0x37, 0xc0, 0x0f, 0x0b, 0xda, 0x6f, 0x63, 0xca,
+  0x7f, 0x9f, 0x3e, 0x01, 0xf8, 0x71, 0xb3, 0x52, 0xc6, 0x47, 0xc2, 0x00,
+  0xff, 0x1d, 0xe0, 0x4f, 0x5a, 0x94, 0xeb, 0xc4, 0x87, 0x15, 0xd6, 0xaf,
+  0x7c, 0x06, 0xf8, 0x1e, 0xc0, 0xe7, 0x1a, 0xe0, 0xcb, 0x00, 0x7f, 0xca,
+  0xaa, 0x95, 0xb3, 0x16, 0x70, 0xb3, 0x4d, 0xcb, 0xff, 0x2b, 0x03, 0x3c,
+  0x3b, 0x59, 0x0a, 0x08, 0x68, 0xf6, 0x1c, 0x6c, 0x6f, 0x75, 0xb5, 0xae,
+  0x68, 0x84, 0x6c, 0xa3, 0x92, 0x75, 0xb5, 0x36, 0xb9, 0xb3, 0x68, 0x93,
+  0xfb, 0xf2, 0x27, 0xdc, 0x27, 0xf1, 0x09, 0x77, 0xcd, 0xb1, 0x14, 0x52,
+  0xf6, 0x1b, 0xa0, 0x0f, 0xab, 0x70, 0xf5, 0xdf, 0x25, 0xac, 0x26, 0x05,
+  0x57, 0xbf, 0x27, 0xdb, 0xa7, 0xc2, 0xd5, 0x7f, 0xaf, 0x38, 0x6b, 0xe2,
+  0xcb, 0xaf, 0x37, 0xf3, 0xe5, 0x1f, 0x36, 0xf3, 0xe5, 0xef, 0xb2, 0xf0,
+  0xe5, 0x4f, 0xf5, 0xf7, 0x25, 0xdf, 0x67, 0x9e, 0xf7, 0x73, 0x7d, 0x36,
+  0x4b, 0x33, 0xf5, 0x8c, 0xea, 0x1b, 0x3d, 0x9b, 0xc9, 0xf5, 0x47, 0x27,
+  0xa8, 0x6f, 0xf4, 0x6c, 0xb6, 0x3f, 0xcf, 0x6f, 0x76, 0xca, 0xf5, 0x9b,
+  0xe1, 0x64, 0x91, 0xa0, 0x7c, 0xb7, 0x13, 0x1f, 0x13, 0x3d, 0x9b, 0xa5,
+  0x81, 0x18, 0x60, 0x1e, 0x76, 0x72, 0x7d, 0x5f, 0x22, 0x7f, 0xc3, 0x7f,
+  0x14, 0xca, 0x93, 0x7d, 0x5f, 0xe2, 0x84, 0xe7, 0xa9, 0x66, 0x06, 0x67,
+  0xdb, 0x0f, 0x07, 0xba, 0xee, 0x56, 0xde, 0x96, 0xe4, 0xf0, 0x6d, 0x2f,
+  0x57, 0x93, 0xab, 0x69, 0x92, 0xcf, 0x76, 0x4e, 0xd5, 0x87, 0xf7, 0x9a,
+  0xe1, 0xb7, 0xea, 0xd9, 0x4e, 0x5e, 0x11, 0x4c, 0x5e, 0x9f, 0x74, 0x44,
+  0xbd, 0x27, 0xc9, 0x8c, 0x1f, 0x65, 0xde, 0x54, 0xcd, 0xfd, 0xf1, 0x62,
+  0x60, 0x75, 0x29, 0x01, 0x3b, 0x89, 0x92, 0x23, 0x07, 0x4c, 0x78, 0xfd,
+  0xef, 0xab, 0x23, 0x5f, 0x16, 0xd4, 0xeb, 0x88, 0x5b, 0xa2, 0x6f, 0xaa,
+  0x37, 0x1c, 0xc9, 0x9f, 0xea, 0x67, 0x3f, 0x00, 0x8e, 0x6f, 0x97, 0xd2,
+  0x90, 0xf7, 0x24, 0x16, 0x50, 0x4c, 0x05, 0x20, 0x26, 0x5b, 0x3f, 0xfb,
+  0xe5, 0x6f, 0x52, 0x8a, 0x09, 0x78, 0x69, 0xee, 0x00, 0xf6, 0x48, 0x6a,
+  0x14, 0x85, 0xb0, 0xfc, 0xdc, 0x21, 0x57, 0xd5, 0x6e, 0x2b, 0x72, 0x0a,
+  0xaa, 0xf5, 0xce, 0xea, 0x2b, 0x48, 0xe2, 0x0d, 0x3b, 0x81, 0x51, 0x79,
+  0xea, 0x45, 0x26, 0x7f, 0xe9, 0x68, 0x3c, 0x32, 0x8a, 0x1e, 0x4c, 0xd2,
+  0xf8, 0x41, 0x73, 0x07, 0xa9, 0x1a, 0xf3, 0x26, 0xd1, 0x5c, 0x8b, 0xce,
+  0xe2, 0x23, 0xf1, 0x0b, 0x98, 0x87, 0x26, 0xe0, 0x74, 0xd1, 0x78, 0xf2,
+  0x1c, 0xde, 0x16, 0x9c, 0xe4, 0xb7, 0x45, 0xb7, 0x1f, 0x25, 0xe5, 0x7d,
+  0x41, 0x44, 0x50, 0x64, 0xd4, 0x4e, 0x3e, 0x59, 0x1e, 0x89, 0xdb, 0x63,
+  0x42, 0xac, 0x64, 0xf5, 0x98, 0xb8, 0x93, 0x5c, 0xc6, 0x4a, 0xb9, 0x25,
+  0x3d, 0x81, 0xbc, 0xf0, 0x23, 0x5f, 0x2a, 0x27, 0xca, 0x93, 0x6f, 0xf8,
+  0x8e, 0xe0, 0x91, 0x8b, 0xe6, 0x4c, 0x86, 0xd7, 0xca, 0x6b, 0x1f, 0x89,
+  0xd6, 0xb4, 0x1b, 0x95, 0xdb, 0x55, 0x4e, 0xd0, 0xf6, 0x3a, 0x38, 0x0a,
+  0xe1, 0x7d, 0x55, 0xb1, 0x12, 0x29, 0xcb, 0xf1, 0x5c, 0x94, 0xb3, 0x73,
+  0x62, 0xbd, 0x2f, 0x7a, 0x2d, 0xbb, 0x05, 0xd5, 0x7c, 0x1b, 0xeb, 0xaf,
+  0xed, 0x8b, 0xe4, 0x69, 0x6d, 0xd4, 0x2a, 0x4f, 0xa2, 0xd1, 0x13, 0x27,
+  0xe9, 0x24, 0xbf, 0xb6, 0xc1, 0x93, 0x1c, 0xdd, 0xe3, 0x35, 0x96, 0xdd,
+  0x43, 0x46, 0x37, 0x84, 0x8d, 0xa3, 0x14, 0xef, 0x11, 0x3b, 0x49, 0x9e,
+  0xfb, 0x76, 0x5c, 0x47, 0xaf, 0xe0, 0x24, 0xdd, 0x26, 0x86, 0xd9, 0xb8,
+  0xfb, 0x8e, 0x90, 0x0d, 0x64, 0xc7, 0xb2, 0x3d, 0x8f, 0xf6, 0xb4, 0xe9,
+  0x32, 0x37, 0x32, 0x5a, 0x45, 0x77, 0x98, 0x9d, 0x3c, 0xf7, 0xd3, 0xac,
+  0xa8, 0x81, 0x3f, 0x92, 0x7e, 0xed, 0xcc, 0xaa, 0x98, 0x6d, 0x56, 0x69,
+  0x6e, 0xe0, 0x1a, 0xd2, 0xd9, 0xe5, 0xce, 0x0a, 0xdf, 0xf8, 0xa7, 0x8d,
+  0xa9, 0x96, 0xdd, 0x23, 0x2d, 0x53, 0x5f, 0x29, 0x82, 0xc6, 0xb2, 0x5b,
+  0xd4, 0x70, 0xbb, 0x76, 0xf2, 0xdf, 0x10, 0xb2, 0xc5, 0x72, 0x6d, 0xd1,
+  0x21, 0xff, 0xb3, 0x04, 0x2c, 0xdd, 0x9e, 0x55, 0x95, 0x01, 0xc7, 0xa9,
+  0x2a, 0x15, 0xca, 0x95, 0x8f, 0xa7, 0xc0, 0x0c, 0xd8, 0x38, 0xfb, 0x51,
+  0xba, 0x5f, 0xbe, 0x44, 0x62, 0x23, 0xb8, 0xee, 0xfd, 0xca, 0x75, 0xef,
+  0x3f, 0xf7, 0x8e, 0x02, 0xf8, 0x4e, 0x52, 0xb9, 0xa3, 0xa8, 0x68, 0x52,
+  0xc5, 0x92, 0xda, 0x29, 0xd7, 0x5b, 0xb3, 0x4e, 0xd9, 0x83, 0xd2, 0x3d,
+  0x59, 0xeb, 0xe8, 0xab, 0xc8, 0x1f, 0xf4, 0x57, 0xb4, 0x46, 0x4f, 0x55,
+  0x91, 0x0f, 0x8b, 0xc9, 0x39, 0xfa, 0xcc, 0x34, 0x42, 0x47, 0x94, 0x7d,
+  0xb2, 0x51, 0x62, 0xbe, 0x7d, 0x31, 0x61, 0x75, 0x5c, 0x8c, 0xe0, 0xcf,
+  0xba, 0xa7, 0xf0, 0x85, 0xc5, 0xbc, 0xfb, 0x70, 0x1c, 0x9b, 0x10, 0xe9,
+  0xdc, 0x29, 0xd9, 0x3a, 0x88, 0x26, 0x05, 0x5e, 0x93, 0xe2, 0x1f, 0xda,
+  0xf0, 0x55, 0x10, 0x51, 0xc3, 0xe8, 0xdc, 0x30, 0xf8, 0x7e, 0xcf, 0xc5,
+  0x7c, 0x8f, 0xef, 0x41, 0xe7, 0x9e, 0x65, 0x1b, 0x1c, 0xd8, 0x69, 0xca,
+  0x76, 0x09, 0x3b, 0xb1, 0x44, 0x24, 0x5e, 0x0e, 0x51, 0xf4, 0xf0, 0x31,
+  0xa5, 0xbb, 0x94, 0x67, 0xcf, 0x95, 0xa0, 0x61, 0x05, 0xb7, 0x07, 0x62,
+  0x2b, 0x55, 0x9c, 0x98, 0x10, 0x4f, 0x98, 0x68, 0x18, 0x58, 0x09, 0xec,
+  0x1b, 0x89, 0x9a, 0xb2, 0x9e, 0xa5, 0x02, 0x50, 0xba, 0x1e, 0xa5, 0xaf,
+  0x96, 0xc7, 0x2a, 0xa5, 0xf8, 0x7f, 0xda, 0x88, 0xe6, 0x51, 0xdf, 0x6e,
+  0x29, 0xba, 0x7e, 0x10, 0x31, 0x07, 0xe9, 0x15, 0xec, 0x56, 0x5d, 0x01,
+  0x96, 0x22, 0xa9, 0xc5, 0x08, 0x93, 0xed, 0x88, 0x87, 0x2d, 0x59, 0x15,
+  0x65, 0x2d, 0xec, 0xa8, 0xcd, 0x91, 0x58, 0x49, 0xf4, 0x17, 0x91, 0x38,
+  0x7e, 0x41, 0xb2, 0x1b, 0x5b, 0x0d, 0x75, 0x01, 0xac, 0x10, 0xb4, 0x6e,
+  0x3a, 0x99, 0x35, 0x6e, 0xcc, 0xb7, 0x87, 0xf6, 0x8f, 0x61, 0x62, 0x24,
+  0xa4, 0xf1, 0x88, 0x5d, 0x6e, 0x95, 0xdc, 0x27, 0x68, 0x53, 0xf0, 0x30,
+  0x9b, 0xbd, 0xea, 0x61, 0x6d, 0xf7, 0xc6, 0x45, 0x87, 0xb6, 0xa8, 0xeb,
+  0xd8, 0x19, 0x68, 0x40, 0xd3, 0xf3, 0x0e, 0x50, 0x0f, 0x0d, 0x83, 0x17,
+  0x86, 0xb1, 0x11, 0x19, 0x0f, 0x0d, 0xc3, 0xa5, 0xd1, 0x73, 0x7c, 0x0f,
+  0x11, 0x8e, 0x91, 0x87, 0x86, 0x21, 0x10, 0xb0, 0x00, 0x94, 0xae, 0x47,
+  0xe9, 0xab, 0x0e, 0xe2, 0x21, 0xeb, 0x64, 0x3c, 0x34, 0xac, 0x8e, 0xba,
+  0x49, 0x78, 0xa8, 0xda, 0x9c, 0x55, 0x51, 0xd6, 0xa2, 0xdc, 0xc8, 0x43,
+  0x56, 0x8d, 0x87, 0xb6, 0x73, 0x5d, 0x11, 0x1d, 0xe8, 0xbb, 0x40, 0x36,
+  0xe7, 0x6c, 0x97, 0x62, 0x43, 0x24, 0x1b, 0x4f, 0xd9, 0xa5, 0xfe, 0x0f,
+  0x51, 0x4e, 0x44, 0xd1, 0x83, 0xfc, 0x94, 0x72, 0x12, 0x83, 0x6f, 0x27,
+  0xe3, 0x6f, 0x96, 0xb3, 0x48, 0x77, 0x52, 0xbe, 0x67, 0xda, 0x65, 0x33,
+  0xa8, 0xda, 0xdb, 0xad, 0x37, 0x40, 0x86, 0x38, 0x02, 0x39, 0x30, 0xb5,
+  0xe6, 0x33, 0xa2, 0x00, 0xd2, 0x29, 0x4e, 0x86, 0x08, 0x8c, 0xed, 0xfb,
+  0x1f, 0x3d, 0x66, 0xf9, 0x13, 0xdd, 0x45, 0xa4, 0x1d, 0xd4, 0x8b, 0x4d,
+  0xfa, 0x2e, 0x8b, 0x6e, 0x49, 0xb2, 0x2b, 0xa8, 0x51, 0xf1, 0x86, 0xa5,
+  0xec, 0x68, 0x8d, 0xb7, 0x2d, 0x11, 0x95, 0x54, 0x23, 0x00, 0xdd, 0xb9,
+  0x44, 0x54, 0x84, 0x01, 0xe7, 0xbc, 0x12, 0xff, 0xe7, 0xe9, 0x80, 0x13,
+  0x55, 0x06, 0x9c, 0xf3, 0x30, 0xe0, 0x9c, 0x57, 0x0f, 0x38, 0xe7, 0x99,
+  0x01, 0x67, 0xa0, 0x9b, 0x58, 0x96, 0x26, 0xc4, 0x5d, 0x43, 0x34, 0x8b,
+  0x87, 0x06, 0x9e, 0x82, 0x8e, 0xdc, 0x14, 0x4c, 0xdd, 0x4f, 0x3d, 0xa6,
+  0xbe, 0x37, 0xa5, 0xce, 0x7d, 0xc6, 0x6c, 0xb1, 0xda, 0xbd, 0x58, 0xbb,
+  0xf1, 0x0b, 0xdf, 0xba, 0x0f, 0x99, 0xe4, 0x98, 0x82, 0x7f, 0x00, 0x43,
+  0x7a, 0x7d, 0x0d, 0x1d, 0xaf, 0xd3, 0x78, 0x52, 0xe6, 0x58, 0x4c, 0x5d,
+  0x36, 0x34, 0x30, 0x36, 0x8e, 0x04, 0x92, 0x76, 0x61, 0xf0, 0xc6, 0xc6,
+  0xbe, 0x0b, 0xdb, 0x67, 0x8d, 0xc0, 0x70, 0x94, 0xfd, 0x63, 0x84, 0xd4,
+  0x22, 0xdf, 0x5f, 0x88, 0xe3, 0x06, 0x46, 0x31, 0x69, 0x08, 0xb6, 0x96,
+  0x2b, 0x5d, 0x9c, 0xe2, 0xba, 0x99, 0x9f, 0x49, 0x1c, 0x80, 0xd7, 0xb3,
+  0xc9, 0x98, 0xef, 0x0c, 0xea, 0xd1, 0x72, 0xb4, 0x63, 0xc9, 0x61, 0x8b,
+  0x7c, 0x67, 0xa1, 0xb5, 0x41, 0x88, 0x2a, 0xbe, 0xa2, 0x03, 0xfb, 0x09,
+  0x92, 0xd3, 0xd5, 0xd4, 0x69, 0xa3, 0xce, 0xe0, 0x7a, 0x06, 0xc8, 0xed,
+  0x60, 0xdf, 0xc4, 0xc4, 0x1d, 0x3b, 0xd5, 0xf2, 0xb2, 0xfd, 0x7d, 0x1c,
+  0xdf, 0xef, 0x88, 0xd2, 0x43, 0xf4, 0x92, 0x07, 0x9e, 0xa1, 0xba, 0x63,
+  0x4d, 0x89, 0xab, 0x01, 0xd0, 0xd9, 0x45, 0xb9, 0x2d, 0x2d, 0xe5, 0x49,
+  0x1e, 0x22, 0x97, 0x4a, 0xfe, 0x54, 0x82, 0xdb, 0x10, 0x0f, 0xa3, 0xd1,
+  0xcc, 0x09, 0xff, 0xb2, 0xe6, 0x26, 0xb3, 0xdc, 0x91, 0x07, 0x7e, 0x36,
+  0x0e, 0xa1, 0x84, 0xfb, 0xf2, 0x10, 0x2e, 0xd1, 0xee, 0x3c, 0x03, 0x51,
+  0x52, 0x78, 0xd9, 0x51, 0x8c, 0x50, 0x68, 0x8f, 0x26, 0xd9, 0x73, 0x27,
+  0xe5, 0xf8, 0xa4, 0x7c, 0xb6, 0x5f, 0x0f, 0x23, 0x0c, 0x84, 0x3f, 0xae,
+  0x64, 0x77, 0x2b, 0xd9, 0xbd, 0xf4, 0x02, 0x31, 0x8f, 0xdc, 0xec, 0x86,
+  0xf6, 0x66, 0x5b, 0x1d, 0x36, 0x65, 0x5b, 0xdd, 0xab, 0xb4, 0x8a, 0xb3,
+  0xe7, 0xfe, 0x5d, 0xa9, 0x52, 0x45, 0xab, 0xd0, 0x86, 0xad, 0xd9, 0x86,
+  0x07, 0xa9, 0xdc, 0x41, 0x22, 0x2d, 0x3a, 0xb0, 0x03, 0xa7, 0xa4, 0xdd,
+  0xd8, 0x10, 0xce, 0xe3, 0xa9, 0xea, 0x5e, 0x21, 0xe7, 0xce, 0x7c, 0x6f,
+  0x2e, 0x9d, 0xf9, 0x6b, 0xbc, 0xce, 0x3c, 0x10, 0x06, 0xd7, 0xe5, 0xdc,
+  0x9f, 0x63, 0xa4, 0x0a, 0x35, 0x52, 0x4a, 0x22, 0x4f, 0x31, 0x03, 0xbd,
+  0x44, 0xc8, 0x11, 0x94, 0xeb, 0xd3, 0x89, 0x53, 0xab, 0xac, 0xd9, 0x52,
+  0x89, 0x37, 0x2c, 0x0e, 0xdc, 0x4c, 0x24, 0x62, 0xdb, 0x93, 0xde, 0x41,
+  0xfa, 0x31, 0x35, 0x0b, 0xbd, 0x2b, 0x66, 0xc3, 0x02, 0x0d, 0xd7, 0x72,
+  0x1f, 0x81, 0xce, 0x67, 0x12, 0x0f, 0x93, 0x86, 0x23, 0x99, 0xff, 0x6b,
+  0xef, 0x7a, 0x80, 0xa3, 0x2a, 0xce, 0xf8, 0x3b, 0x0c, 0x10, 0x02, 0x7a,
+  0x29, 0x30, 0x10, 0xc0, 0x3f, 0x47, 0xb8, 0xd3, 0x44, 0x85, 0x86, 0x3f,
+  0x41, 0x88, 0x0e, 0x0d, 0x62, 0xf0, 0xb4, 0xa4, 0x8d, 0xfc, 0x99, 0x02,
+  0xa2, 0xc7, 0x71, 0xb9, 0xc0, 0xe9, 0xe5, 0x72, 0xde, 0x5d, 0xf8, 0x23,
+  0xa8, 0x50, 0x12, 0x31, 0x3e, 0x70, 0xd4, 0x42, 0x41, 0xc7, 0xb6, 0xa9,
+  0xda, 0x0e, 0x55, 0x1c, 0x1d, 0xab, 0x33, 0x29, 0x3a, 0xd3, 0x04, 0x1c,
+  0x87, 0x32, 0xb6, 0x03, 0x4c, 0xb5, 0xb1, 0xc5, 0x7a, 0x28, 0x0e, 0x39,
+  0x61, 0x4a, 0xb0, 0x7f, 0xcc, 0x4c, 0xd5, 0x74, 0xbf, 0xdd, 0x6f, 0xdf,
+  0xfb, 0xde, 0xbb, 0xb7, 0xc9, 0x85, 0x76, 0x2c, 0xe3, 0xf0, 0xe6, 0xe6,
+  0xde, 0xbd, 0xdf, 0x7d, 0xfb, 0x7d, 0xfb, 0x76, 0xf7, 0xed, 0xee, 0xdb,
+  0xdf, 0xb7, 0xbb, 0xd7, 0xe2, 0x0e, 0x49, 0x5c, 0x4f, 0xa6, 0x9e, 0xd5,
+  0x1f, 0x99, 0xcf, 0xbe, 0x34, 0x8a, 0x0a, 0x56, 0x2c, 0x3d, 0x99, 0x07,
+  0xbf, 0xe8, 0xed, 0x35, 0x2a, 0x95, 0x76, 0xac, 0x54, 0x70, 0x49, 0x07,
+  0x6b, 0x53, 0x62, 0x74, 0xed, 0x44, 0xed, 0x6c, 0x26, 0xa5, 0xe8, 0x9a,
+  0xf3, 0xa8, 0x96, 0x89, 0xe4, 0x3c, 0x62, 0x4b, 0x3c, 0xd2, 0xde, 0x59,
+  0xd2, 0x2f, 0x73, 0x5f, 0x81, 0x7c, 0xe2, 0x0d, 0x6d, 0x6d, 0xac, 0x32,
+  0x39, 0x2e, 0xaa, 0x48, 0xa3, 0x07, 0x6f, 0x66, 0x6d, 0x9b, 0xac, 0x40,
+  0xc9, 0xfb, 0xc3, 0xdb, 0xf8, 0x6a, 0x20, 0x65, 0x74, 0x11, 0x9e, 0xd8,
+  0x97, 0x7f, 0x9b, 0x96, 0xb1, 0x15, 0x38, 0x83, 0xe7, 0x2e, 0x3c, 0x9f,
+  0xc4, 0x73, 0x5a, 0x98, 0x95, 0x1d, 0x68, 0x28, 0x29, 0xa7, 0xb8, 0xe6,
+  0x33, 0xd8, 0x32, 0x9c, 0x21, 0xcd, 0xc8, 0x2b, 0x96, 0x66, 0xe4, 0x45,
+  0x4d, 0xd1, 0x8c, 0xbc, 0xe2, 0xdc, 0x8c, 0x54, 0xed, 0x65, 0x75, 0x21,
+  0x0a, 0xca, 0x68, 0xc0, 0xeb, 0xde, 0x5e, 0xfe, 0x68, 0x55, 0x77, 0x0b,
+  0xad, 0x35, 0xa6, 0xd6, 0x6e, 0x14, 0xee, 0x3e, 0xfd, 0xbe, 0x5e, 0x75,
+  0x12, 0x2f, 0x4e, 0x62, 0x88, 0x22, 0x98, 0xde, 0x6b, 0x79, 0xac, 0x78,
+  0xcb, 0x2d, 0x1e, 0x89, 0x5d, 0x50, 0x20, 0x58, 0x97, 0xdc, 0xd5, 0xd1,
+  0x52, 0x9d, 0x3e, 0xfd, 0x7a, 0x66, 0xb9, 0x68, 0x68, 0xe8, 0xcb, 0x40,
+  0x66, 0x78, 0x2f, 0x5f, 0x3d, 0x87, 0xe7, 0x26, 0x34, 0xf0, 0xfc, 0x35,
+  0x8e, 0xe9, 0xd7, 0xab, 0xd2, 0x7c, 0x7f, 0xc1, 0xbf, 0xbb, 0x1f, 0xe4,
+  0xcc, 0xd5, 0x67, 0xee, 0x65, 0x87, 0x98, 0x1c, 0xc7, 0x3e, 0x73, 0xdf,
+  0x7d, 0xa8, 0xce, 0xfd, 0x5e, 0x75, 0x2b, 0x6c, 0x65, 0xd6, 0xca, 0x6e,
+  0xe7, 0xb6, 0x96, 0x76, 0x96, 0x54, 0x62, 0x1a, 0xb1, 0xbd, 0x2c, 0xc8,
+  0xbc, 0x80, 0x62, 0xef, 0xd2, 0xcc, 0xbe, 0x8f, 0x2d, 0xb9, 0x61, 0x46,
+  0x27, 0xbf, 0x82, 0xb7, 0x0c, 0x1a, 0xbc, 0xd5, 0xd2, 0x1e, 0x54, 0xed,
+  0xc1, 0x08, 0xee, 0x14, 0xbd, 0x26, 0xa3, 0xd5, 0x9b, 0x33, 0xd4, 0xc8,
+  0xe4, 0xac, 0xcc, 0xfd, 0xa6, 0xe4, 0x9d, 0x53, 0x3e, 0x41, 0x64, 0x99,
+  0x18, 0xe4, 0x4b, 0x87, 0x25, 0xaf, 0xaa, 0x79, 0x5e, 0x75, 0x40, 0x5e,
+  0x41, 0x9a, 0xb2, 0xfc, 0xe2, 0x95, 0x07, 0x93, 0xe1, 0xf5, 0x13, 0xcf,
+  0xb5, 0x83, 0x98, 0xbe, 0xb9, 0x64, 0x99, 0x32, 0x11, 0xe7, 0x0f, 0x1e,
+  0x68, 0x22, 0xe2, 0xfd, 0x33, 0x15, 0x3b, 0x85, 0x8a, 0x46, 0x51, 0x24,
+  0xf6, 0x58, 0x6b, 0xf9, 0x26, 0xa7, 0x5a, 0xfe, 0x76, 0x6e, 0x68, 0x27,
+  0x1a, 0xda, 0xd9, 0xb2, 0x23, 0x25, 0xaa, 0xf0, 0x26, 0x51, 0xfb, 0xea,
+  0x4e, 0x75, 0x39, 0xbd, 0x1f, 0xb3, 0x2e, 0x5a, 0xdb, 0x2b, 0x1b, 0xb8,
+  0xac, 0x92, 0xf2, 0xf5, 0xe4, 0xa9, 0x22, 0x3b, 0xf7, 0x9e, 0x4f, 0x76,
+  0xf6, 0x9d, 0x91, 0x59, 0xb9, 0x98, 0x7d, 0x83, 0x1b, 0x45, 0x5f, 0xcc,
+  0xf1, 0x1e, 0xa0, 0x71, 0x8e, 0x0b, 0x23, 0xaa, 0x7b, 0xcc, 0x03, 0x99,
+  0x68, 0xdf, 0x32, 0x3c, 0x1d, 0x5a, 0x9a, 0x57, 0x9a, 0x1d, 0x8b, 0x15,
+  0xbc, 0xc5, 0x8f, 0xf3, 0x16, 0x3f, 0x2a, 0x5a, 0x7c, 0x6c, 0xc4, 0x96,
+  0xf2, 0x22, 0x6a, 0x24, 0x75, 0x56, 0x74, 0xf3, 0x5c, 0x7d, 0x47, 0x77,
+  0x71, 0x0e, 0xd1, 0xad, 0xc9, 0x29, 0xba, 0x7e, 0x12, 0xc7, 0xc5, 0x22,
+  0x8e, 0xcd, 0x9b, 0x44, 0x0b, 0xed, 0xe7, 0x2d, 0x34, 0x64, 0x61, 0xa1,
+  0x91, 0x85, 0xfc, 0x9e, 0x32, 0x3e, 0x22, 0xa0, 0xef, 0x80, 0x3b, 0xe6,
+  0x83, 0x6a, 0x97, 0x11, 0x58, 0x24, 0x84, 0xce, 0x63, 0xaa, 0xef, 0xa8,
+  0xc9, 0xbe, 0x7b, 0x1e, 0x3f, 0x91, 0xa8, 0x24, 0x25, 0xf8, 0x2b, 0xac,
+  0xf8, 0x3a, 0xf5, 0x15, 0x48, 0x2d, 0xc5, 0x6e, 0x03, 0x1f, 0xea, 0xd1,
+  0xb9, 0x38, 0xf6, 0xc2, 0x44, 0xc8, 0x9d, 0xec, 0x35, 0x05, 0x3b, 0x53,
+  0xff, 0x97, 0xc7, 0xec, 0xfe, 0x5e, 0x8c, 0x05, 0x66, 0xf0, 0xd6, 0x11,
+  0xae, 0x9c, 0x63, 0x71, 0x42, 0xa4, 0xd7, 0x4a, 0x23, 0x9d, 0x61, 0xbc,
+  0x9e, 0xc4, 0xa2, 0x6a, 0x67, 0x4e, 0x51, 0x78, 0x94, 0xa7, 0xcc, 0x0a,
+  0x99, 0x50, 0x95, 0x54, 0x49, 0x3b, 0x57, 0x72, 0x10, 0xad, 0xe4, 0xa4,
+  0xee, 0xc6, 0xff, 0x2e, 0x3c, 0x49, 0xd6, 0xcc, 0xc7, 0xd0, 0x4d, 0x8b,
+  0xb3, 0x2e, 0x59, 0xe6, 0xb7, 0xe2, 0x6d, 0x38, 0x97, 0x54, 0xb9, 0xf5,
+  0x7f, 0x95, 0x37, 0xa7, 0x1f, 0xe3, 0x8d, 0xa8, 0xb9, 0x50, 0x97, 0xa5,
+  0x67, 0xb0, 0xb2, 0x87, 0xc7, 0xa8, 0x4d, 0x18, 0x7d, 0xd1, 0xda, 0x04,
+  0xb4, 0x59, 0x9a, 0x80, 0xef, 0xaa, 0xda, 0xd1, 0xb6, 0x7e, 0x9a, 0x80,
+  0x22, 0x63, 0x50, 0xd1, 0x6c, 0xe4, 0x4f, 0xef, 0x97, 0x01, 0x1d, 0xfe,
+  0x24, 0x1d, 0x87, 0x36, 0x33, 0xb2, 0x6d, 0xa2, 0xe7, 0x20, 0x44, 0x32,
+  0xb7, 0x8a, 0x6e, 0x8e, 0x31, 0x7a, 0x8c, 0x4e, 0x16, 0x89, 0xeb, 0xb4,
+  0x6a, 0xbe, 0xcd, 0x90, 0x27, 0x9c, 0x48, 0x34, 0x24, 0x3c, 0x96, 0x3d,
+  0xac, 0x0b, 0xb4, 0x85, 0xe1, 0xf3, 0xfd, 0xd3, 0xd7, 0xa8, 0x95, 0x55,
+  0xcc, 0x8f, 0x44, 0xc3, 0x15, 0xca, 0x33, 0x13, 0xf1, 0x45, 0xa3, 0x8d,
+  0xbe, 0x50, 0x81, 0x36, 0x2f, 0x18, 0x8b, 0x35, 0xa4, 0x3c, 0xa1, 0x44,
+  0x38, 0x98, 0x0a, 0x7b, 0xa4, 0x16, 0x0f, 0xec, 0x90, 0x5d, 0xe1, 0xf1,
+  0x25, 0x0b, 0x34, 0xc9, 0x1f, 0x4d, 0xae, 0xe0, 0xfc, 0x51, 0xc5, 0xc2,
+  0xc6, 0x58, 0xb2, 0xc2, 0xd7, 0x98, 0xfd, 0xc7, 0xdc, 0x68, 0xb4, 0xc2,
+  0x97, 0xf4, 0x80, 0x05, 0x10, 0xf0, 0xcc, 0x6f, 0x8c, 0x85, 0x52, 0x91,
+  0x06, 0x2e, 0xed, 0xf1, 0x4d, 0x29, 0x9b, 0x56, 0xe7, 0xf3, 0x19, 0x7b,
+  0x59, 0x2f, 0xab, 0x4c, 0x64, 0x29, 0xe0, 0x71, 0x03, 0x0d, 0x7d, 0x04,
+  0x5c, 0x56, 0x69, 0x86, 0xf2, 0x95, 0x37, 0x32, 0xf1, 0x6c, 0x35, 0x18,
+  0x1c, 0x54, 0xd9, 0xcd, 0xaa, 0xc2, 0x4f, 0x82, 0x43, 0x02, 0xbe, 0x59,
+  0x2c, 0x6d, 0xae, 0x35, 0xae, 0x66, 0xb3, 0xab, 0x6c, 0x5b, 0x08, 0xf4,
+  0x7f, 0xa8, 0x7c, 0x4d, 0xa0, 0x99, 0x1d, 0x44, 0x18, 0xb6, 0xbf, 0xe2,
+  0xb9, 0x42, 0xb3, 0xfa, 0xa0, 0xc8, 0x5f, 0xf3, 0x51, 0x5e, 0xca, 0x49,
+  0xea, 0xbc, 0x06, 0xf1, 0xdb, 0x51, 0xd5, 0x66, 0xc4, 0x97, 0x23, 0x7e,
+  0x18, 0xf1, 0x77, 0x10, 0xaf, 0x45, 0xfc, 0xc7, 0xc8, 0x85, 0xde, 0x81,
+  0x73, 0xfe, 0xb6, 0xa3, 0x5d, 0x69, 0x4f, 0xee, 0x95, 0xb7, 0x17, 0x71,
+  0x9c, 0x3a, 0xa0, 0xe1, 0x54, 0x07, 0xed, 0x25, 0xc4, 0x6f, 0xb2, 0xe1,
+  0x6d, 0xa8, 0xff, 0x14, 0xce, 0xd1, 0x5b, 0x82, 0x84, 0xe8, 0x9f, 0x51,
+  0x5e, 0xae, 0x31, 0x23, 0xed, 0x9c, 0x45, 0x7c, 0x05, 0x49, 0x17, 0x38,
+  0xfe, 0x8d, 0x78, 0xad, 0x0d, 0x87, 0x24, 0x03, 0x3c, 0x6a, 0xc3, 0x2f,
+  0x45, 0x3c, 0x65, 0xc3, 0xc7, 0x21, 0xbe, 0xc9, 0x66, 0xf7, 0x4a, 0xc4,
+  0x1f, 0xb2, 0xc9, 0xcf, 0x46, 0x7c, 0x1b, 0x5e, 0x4b, 0x57, 0xfd, 0x5b,
+  0x10, 0x97, 0xbe, 0x33, 0x38, 0x85, 0x86, 0xaf, 0x81, 0x03, 0x78, 0x07,
+  0x5e, 0xcf, 0xc4, 0xf3, 0xf7, 0x10, 0xef, 0xb1, 0xe9, 0x5f, 0x84, 0xb8,
+  0xcc, 0x7a, 0xc9, 0x57, 0xdf, 0x8d, 0xf8, 0x20, 0xc4, 0xa7, 0x20, 0x1e,
+  0x42, 0x5c, 0xee, 0x0f, 0x25, 0xf5, 0xac, 0x41, 0x7c, 0x16, 0xe2, 0xc6,
+  0x1a, 0x0f, 0x88, 0xcb, 0xb5, 0x79, 0x7c, 0x88, 0x27, 0x10, 0x8f, 0xdb,
+  0xf4, 0xac, 0x43, 0x7c, 0xbd, 0x4d, 0xcf, 0x26, 0xc4, 0x5b, 0x6c, 0xf8,
+  0x16, 0xc4, 0x9f, 0x46, 0x1c, 0xa7, 0xfc, 0x69, 0x0f, 0xcb, 0xf4, 0x41,
+  0x5c, 0xfa, 0x81, 0xeb, 0x88, 0xbf, 0x6e, 0xd3, 0x03, 0x53, 0xa5, 0x9c,
+  0xf6, 0x65, 0xbb, 0x52, 0x81, 0x4f, 0x52, 0xe0, 0xa5, 0x0a, 0xfc, 0x3b,
+  0x0a, 0x7c, 0x9d, 0x02, 0x7f, 0x50, 0x81, 0x37, 0x2b, 0xf0, 0x27, 0x14,
+  0xf8, 0x1e, 0x05, 0xde, 0xaa, 0xc0, 0x5f, 0x55, 0xe0, 0xef, 0x28, 0xf0,
+  0x63, 0x0a, 0xfc, 0x43, 0x05, 0xfe, 0x0f, 0x05, 0x3e, 0xd8, 0xe5, 0x8c,
+  0x8f, 0x54, 0xe0, 0x93, 0xd0, 0x47, 0xea, 0x26, 0xcc, 0xf0, 0xb3, 0x58,
+  0xa9, 0xce, 0x51, 0xc8, 0x2f, 0x55, 0xe0, 0x8f, 0x2b, 0xf0, 0xdd, 0x0a,
+  0xdc, 0x38, 0xb8, 0x73, 0x43, 0x48, 0x6b, 0x88, 0x87, 0x63, 0x01, 0xf8,
+  0x1d, 0x80, 0x36, 0x4a, 0x5b, 0x1d, 0x4e, 0xc5, 0x23, 0xb5, 0x1c, 0xd5,
+  0xea, 0x42, 0xc2, 0x0f, 0x89, 0x35, 0x8b, 0xb1, 0x06, 0x98, 0x53, 0x1f,
+  0x84, 0x76, 0x40, 0x5b, 0x30, 0x65, 0x5a, 0xb9, 0x56, 0x57, 0xcb, 0x45,
+  0x98, 0x78, 0x60, 0x6d, 0x30, 0xda, 0x18, 0xd6, 0x92, 0x0d, 0x89, 0x54,
+  0xa0, 0x8e, 0xb5, 0x15, 0xe2, 0x57, 0x34, 0x12, 0x43, 0xcc, 0xd2, 0x9c,
+  0x6a, 0xc9, 0x54, 0x22, 0xca, 0xc2, 0xb1, 0x53, 0xa8, 0x3e, 0xae, 0xd5,
+  0xf3, 0x76, 0x17, 0x34, 0xce, 0x84, 0xb5, 0x52, 0x98, 0x21, 0xad, 0x2e,
+  0x9e, 0x88, 0xc4, 0x52, 0x75, 0x5a, 0x22, 0x6c, 0xfc, 0x77, 0x03, 0x7c,
+  0xcd, 0xd2, 0xee, 0x03, 0x75, 0x5a, 0x7d, 0x38, 0xb1, 0x3a, 0x6c, 0x53,
+  0x5a, 0xc7, 0xa2, 0x91, 0x04, 0x9d, 0x89, 0xd0, 0x9a, 0x04, 0x08, 0xc3,
+  0x96, 0xca, 0x91, 0x64, 0x43, 0x68, 0xf6, 0xec, 0x40, 0x32, 0x19, 0x0a,
+  0xc6, 0x60, 0x07, 0xe6, 0xe9, 0x65, 0x20, 0xc1, 0x3e, 0xf0, 0x7b, 0x2a,
+  0x7c, 0x4d, 0x03, 0x20, 0x06, 0xf1, 0x60, 0x17, 0xd3, 0x79, 0x9c, 0x78,
+  0xf0, 0xe9, 0x33, 0xe0, 0xab, 0x9c, 0xe9, 0x10, 0xab, 0x35, 0x58, 0x8d,
+  0xb1, 0xbf, 0x66, 0x6a, 0x75, 0xc9, 0x70, 0xf8, 0x5e, 0xf8, 0x09, 0x71,
+  0x9b, 0x3e, 0x0b, 0xbe, 0x66, 0xb3, 0xaf, 0x19, 0x65, 0x5a, 0x1d, 0x4f,
+  0x17, 0xf6, 0x13, 0x4c, 0xcc, 0x98, 0x06, 0x5f, 0xd3, 0xe1, 0x0b, 0x74,
+  0xce, 0x28, 0x87, 0xaf, 0x99, 0xf0, 0x05, 0xe1, 0x66, 0x40, 0xb8, 0x19,
+  0x10, 0xae, 0x9c, 0x85, 0x0b, 0x45, 0x1b, 0x92, 0xec, 0x56, 0xe4, 0xa2,
+  0x05, 0x73, 0x30, 0x9b, 0xa0, 0xba, 0x2f, 0xd6, 0x4c, 0x9f, 0xa8, 0x30,
+  0xc1, 0x27, 0x11, 0xfc, 0x17, 0x04, 0xa7, 0x73, 0x25, 0x7f, 0x4d, 0x70,
+  0x3a, 0x57, 0xf2, 0x30, 0xe2, 0x76, 0x5f, 0xac, 0x4e, 0x22, 0x7f, 0x35,
+  0xc1, 0x4f, 0x91, 0x35, 0x06, 0xae, 0x21, 0xf8, 0x55, 0x64, 0xcd, 0x80,
+  0x12, 0x82, 0xdf, 0x4d, 0xf0, 0x52, 0x82, 0xaf, 0x23, 0xbe, 0x5e, 0xf9,
+  0x04, 0xdf, 0x82, 0x38, 0x34, 0x73, 0xd7, 0x12, 0xfc, 0x09, 0xa2, 0xe7,
+  0x3a, 0x82, 0x6f, 0xca, 0x73, 0x8e, 0xcf, 0x04, 0xb2, 0x36, 0x00, 0x8d,
+  0xcf, 0x07, 0x04, 0xbf, 0x9e, 0xe0, 0xd2, 0xb9, 0x6b, 0x10, 0xda, 0x96,
+  0x78, 0xc1, 0x10, 0xe7, 0xf8, 0x8c, 0x27, 0x6b, 0x03, 0xd0, 0xf8, 0x34,
+  0x2b, 0xd6, 0x12, 0x78, 0x68, 0xa8, 0xb3, 0xdd, 0x67, 0x87, 0x9a, 0x76,
+  0x0b, 0x08, 0xbe, 0x6f, 0xa8, 0xb3, 0xdd, 0x37, 0x87, 0x3a, 0xdb, 0x2d,
+  0xcc, 0x77, 0xb6, 0xbb, 0x59, 0x81, 0x7f, 0x9e, 0x6f, 0xda, 0xa5, 0xbe,
+  0x76, 0x93, 0xc8, 0x1a, 0x00, 0x93, 0x09, 0xbe, 0x67, 0x98, 0x29, 0x4f,
+  0xf7, 0xed, 0x7e, 0x4b, 0x21, 0x3f, 0x9b, 0xac, 0x01, 0x30, 0x85, 0xe0,
+  0xcb, 0x09, 0xfe, 0x6d, 0x9a, 0x6e, 0x05, 0xa6, 0xfe, 0x11, 0x04, 0xff,
+  0x19, 0x91, 0x2f, 0x23, 0xf8, 0x87, 0x04, 0xa7, 0xf9, 0x3e, 0x74, 0xb8,
+  0xb3, 0xdd, 0xa2, 0xe1, 0xa6, 0x7e, 0xba, 0x4f, 0xf9, 0xb5, 0x44, 0x7e,
+  0x2a, 0xc1, 0xe7, 0x12, 0x79, 0xba, 0xef, 0xf8, 0x22, 0x85, 0xfc, 0x1a,
+  0x22, 0xef, 0x26, 0x78, 0x9c, 0xc8, 0xd3, 0x78, 0xbe, 0x4a, 0xf0, 0x69,
+  0x04, 0x3f, 0x40, 0xf4, 0xd0, 0x7d, 0xd0, 0x0f, 0x2b, 0xf4, 0x0c, 0x21,
+  0x6b, 0x0f, 0xd0, 0xfb, 0xbd, 0x86, 0xe0, 0xd3, 0x09, 0xbe, 0xe4, 0x52,
+  0x53, 0x3f, 0xdd, 0x1f, 0xbd, 0x81, 0xc8, 0xd3, 0x74, 0x7e, 0x9e, 0xc8,
+  0x8f, 0x24, 0x78, 0x87, 0x42, 0xfe, 0x4e, 0xb2, 0x56, 0x01, 0x2d, 0x6f,
+  0x09, 0x82, 0x53, 0x1f, 0xd1, 0x27, 0x2f, 0x33, 0xf5, 0x8f, 0x22, 0xf8,
+  0x33, 0x88, 0xdb, 0xcb, 0xff, 0xcb, 0x44, 0x0f, 0x2d, 0xff, 0xed, 0x04,
+  0xa7, 0xfb, 0xc1, 0x9f, 0x20, 0x38, 0xdd, 0x87, 0x7e, 0x30, 0x59, 0x0b,
+  0x81, 0xce, 0xcd, 0x1d, 0xe9, 0x36, 0xe3, 0x43, 0xd7, 0x42, 0x28, 0x75,
+  0x3b, 0xdb, 0xbd, 0xa7, 0xd0, 0x94, 0x1f, 0x43, 0xf0, 0x9f, 0x12, 0x9c,
+  0xae, 0x9d, 0x40, 0xd7, 0x48, 0xa0, 0x7a, 0x3e, 0x20, 0xf2, 0x63, 0x09,
+  0x7e, 0x96, 0xc8, 0xcf, 0x24, 0xf8, 0x98, 0x91, 0xa6, 0xfc, 0x38, 0x82,
+  0xdf, 0x41, 0xf0, 0x22, 0x82, 0xdf, 0x3b, 0xd2, 0xd9, 0xee, 0x19, 0x82,
+  0xd3, 0xf2, 0x33, 0x71, 0x94, 0xa9, 0x67, 0x3c, 0xc1, 0x6f, 0x1c, 0xe5,
+  0xac, 0xe7, 0x13, 0x22, 0x7f, 0x39, 0xc1, 0xc7, 0x8f, 0x36, 0xf1, 0x09,
+  0x04, 0x9f, 0x3a, 0xda, 0x59, 0xcf, 0x22, 0xb2, 0x96, 0x00, 0x8d, 0xcf,
+  0x23, 0x63, 0x4c, 0x3d, 0x57, 0x10, 0xfc, 0xd9, 0x31, 0xce, 0x7a, 0xde,
+  0x57, 0xe8, 0x19, 0x3e, 0xd6, 0xd4, 0x73, 0x25, 0xc1, 0x7d, 0x63, 0x9d,
+  0xf5, 0x2c, 0x27, 0xf2, 0x57, 0x11, 0x3c, 0xa5, 0x90, 0x7f, 0x9a, 0xc8,
+  0x7b, 0x08, 0xfe, 0x9a, 0x42, 0xfe, 0x2c, 0xc1, 0x69, 0x3c, 0xbd, 0x45,
+  0xa6, 0x9e, 0x89, 0x04, 0x9f, 0x53, 0xe4, 0xac, 0x67, 0x01, 0xc1, 0x6f,
+  0x20, 0xf8, 0x1f, 0x09, 0x3e, 0x8b, 0xe0, 0xe7, 0x14, 0xf8, 0xe8, 0x71,
+  0xce, 0xb8, 0x6f, 0x9c, 0xb3, 0xfe, 0x0b, 0xdd, 0x37, 0xfb, 0xba, 0x71,
+  0x56, 0x3c, 0x57, 0xdf, 0xec, 0xb8, 0x2d, 0x9c, 0x2a, 0xbc, 0x72, 0xdf,
+  0x65, 0x0c, 0xff, 0xb6, 0xcd, 0xd9, 0x37, 0x57, 0xdf, 0xec, 0xca, 0x09,
+  0xb9, 0xd9, 0x57, 0xf9, 0x66, 0xcb, 0xf0, 0x4b, 0xb1, 0xbf, 0x03, 0xe9,
+  0x53, 0xac, 0xe5, 0xee, 0x9b, 0xdd, 0xea, 0x11, 0xe7, 0x67, 0xce, 0xd3,
+  0x37, 0xbb, 0xb2, 0x18, 0xf5, 0xa0, 0xc1, 0x81, 0xfa, 0x66, 0xa7, 0x71,
+  0x91, 0xae, 0x4a, 0x1b, 0x6e, 0xb7, 0x1f, 0x89, 0xb1, 0x82, 0xd4, 0x58,
+  0x1f, 0x8e, 0xe1, 0xa6, 0xec, 0xfd, 0xf9, 0x66, 0xcf, 0x2c, 0x87, 0xef,
+  0x81, 0xf9, 0x66, 0x1f, 0x19, 0x43, 0xee, 0x0b, 0xbf, 0x87, 0xb3, 0xde,
+  0x1a, 0xf2, 0xeb, 0x00, 0x58, 0x99, 0x6b, 0xab, 0xd3, 0x87, 0x75, 0x7a,
+  0x5a, 0x5b, 0x11, 0xbe, 0x8f, 0x81, 0x60, 0x9b, 0xcb, 0x08, 0x65, 0x70,
+  0x9f, 0xe6, 0x9c, 0xc7, 0x66, 0x9b, 0x23, 0xf6, 0xcf, 0x35, 0xe4, 0xd5,
+  0xc5, 0xa8, 0x69, 0xb7, 0xa4, 0xcd, 0xb9, 0x16, 0x8b, 0x5d, 0x0b, 0x2b,
+  0x0e, 0x8b, 0x43, 0xa3, 0xf7, 0x96, 0x2e, 0xe6, 0x27, 0xa2, 0x7b, 0x8e,
+  0xa9, 0xa2, 0xa3, 0xed, 0x12, 0xcd, 0xbe, 0x52, 0x74, 0x8f, 0xa0, 0xeb,
+  0xbb, 0xed, 0x8a, 0x9d, 0x16, 0x8b, 0x16, 0xee, 0x36, 0x2f, 0x40, 0x28,
+  0xe7, 0xad, 0x9c, 0x88, 0x93, 0x84, 0x25, 0x6d, 0x74, 0xab, 0x7b, 0x8c,
+  0xc5, 0x15, 0x77, 0xb2, 0x66, 0xae, 0x72, 0x7d, 0x84, 0x90, 0xc0, 0xe8,
+  0x2d, 0x72, 0x04, 0x9c, 0xc9, 0xad, 0xc1, 0xc5, 0x26, 0x18, 0x98, 0x1c,
+  0xc6, 0x50, 0xf2, 0x11, 0xc3, 0x0b, 0x56, 0x38, 0x46, 0x1e, 0x02, 0xef,
+  0xe7, 0x96, 0xc3, 0x7e, 0xe1, 0x79, 0xd7, 0x2e, 0x06, 0x91, 0xf3, 0xfd,
+  0x5b, 0x3e, 0x62, 0xb5, 0x99, 0x86, 0x1e, 0x78, 0xed, 0xc2, 0xfd, 0x4e,
+  0x2e, 0xae, 0xdd, 0x63, 0x38, 0xe6, 0xa2, 0x1b, 0xf5, 0x7e, 0xed, 0xf0,
+  0xd3, 0x37, 0x72, 0xfd, 0xee, 0x97, 0x0f, 0xfb, 0xf5, 0x25, 0x5d, 0x7e,
+  0xd7, 0x51, 0x7f, 0xc7, 0x09, 0x97, 0xbe, 0xa4, 0xdb, 0x1f, 0x3a, 0xe6,
+  0x1f, 0x76, 0x94, 0x05, 0x70, 0xde, 0x35, 0x43, 0xa6, 0x03, 0xf1, 0x8f,
+  0x70, 0x16, 0x74, 0xf5, 0x21, 0xe8, 0xa1, 0x69, 0xab, 0x70, 0x22, 0xb7,
+  0xbb, 0x82, 0x5f, 0x2e, 0x52, 0xc3, 0xf6, 0xdf, 0x6e, 0xe0, 0xa2, 0x4c,
+  0x27, 0xef, 0xec, 0x25, 0xc8, 0x65, 0x12, 0x57, 0x59, 0x3d, 0xf3, 0x25,
+  0x89, 0x7a, 0x1c, 0xcf, 0x9d, 0x86, 0x7f, 0x5a, 0xd3, 0x28, 0x41, 0xfd,
+  0x74, 0xcb, 0xd2, 0x06, 0x31, 0x80, 0x71, 0x5a, 0xbd, 0xea, 0xb8, 0x5e,
+  0xdd, 0x09, 0xcc, 0xda, 0x0a, 0x7e, 0xd5, 0xc9, 0xa5, 0x87, 0x8b, 0xdf,
+  0xe0, 0xb7, 0x29, 0x1c, 0xd1, 0xc1, 0xd7, 0x08, 0x75, 0x42, 0x8a, 0x87,
+  0xda, 0xfd, 0x1d, 0xe9, 0x3c, 0xa3, 0x64, 0xf0, 0x04, 0x49, 0x93, 0x02,
+  0x93, 0xe6, 0xd7, 0x66, 0xe9, 0xd8, 0xa5, 0xa1, 0x75, 0xe1, 0x6a, 0xda,
+  0xc5, 0xac, 0x4a, 0x1d, 0x70, 0xe3, 0xdc, 0xad, 0x4b, 0x6c, 0x3f, 0xe2,
+  0x62, 0x7f, 0x21, 0x8f, 0x71, 0xdc, 0xa0, 0x05, 0x99, 0x2e, 0xc9, 0x0b,
+  0x56, 0x77, 0x89, 0x5c, 0xef, 0x22, 0xce, 0x32, 0x5d, 0xa0, 0x80, 0x17,
+  0x9c, 0xea, 0x6e, 0x7a, 0x8f, 0xce, 0xee, 0xd0, 0xb8, 0xdb, 0x40, 0x77,
+  0xe6, 0x43, 0xe1, 0xe8, 0x27, 0xe2, 0xd9, 0x54, 0x21, 0x12, 0x03, 0xa2,
+  0x05, 0xb7, 0xa5, 0x74, 0x26, 0x24, 0x77, 0x4b, 0x3c, 0x09, 0x31, 0xbf,
+  0x8f, 0x98, 0xfa, 0x6c, 0x5e, 0xfc, 0x97, 0xa0, 0x7a, 0x56, 0xe2, 0xf9,
+  0x63, 0x6f, 0xee, 0x98, 0xd0, 0xaa, 0x65, 0x7b, 0xa4, 0x41, 0x85, 0x63,
+  0x99, 0x72, 0x81, 0xb3, 0x41, 0x8e, 0x1b, 0x82, 0x55, 0x47, 0x8c, 0x1a,
+  0x49, 0x98, 0x1a, 0x61, 0xaa, 0xc9, 0xe4, 0x19, 0x31, 0x12, 0x2e, 0x93,
+  0xd4, 0xb9, 0x8a, 0x03, 0x76, 0x9f, 0x55, 0x71, 0xe2, 0xf9, 0x35, 0x47,
+  0x86, 0xcd, 0x4d, 0xb5, 0x55, 0x61, 0x66, 0x4a, 0x1e, 0x7f, 0xe2, 0x4f,
+  0x5a, 0x7c, 0x96, 0xa8, 0xf9, 0xf5, 0x42, 0x9a, 0xb8, 0x07, 0x0d, 0xb2,
+  0xd7, 0x41, 0x96, 0x95, 0xf4, 0x37, 0xfb, 0xb9, 0x4f, 0x2c, 0xc4, 0xe5,
+  0xa9, 0x4b, 0x90, 0xea, 0xe2, 0x10, 0x67, 0x9f, 0x36, 0x9f, 0x96, 0x45,
+  0x3e, 0xed, 0x37, 0x7c, 0x67, 0x35, 0xff, 0x96, 0x1e, 0x68, 0x37, 0xdc,
+  0x0f, 0x8f, 0x95, 0xc2, 0x12, 0xef, 0x02, 0x3c, 0x63, 0xab, 0xc1, 0x8d,
+  0x47, 0xc9, 0xf4, 0xbe, 0xe5, 0x65, 0x11, 0xe8, 0xb5, 0x35, 0x83, 0xcc,
+  0x19, 0x0c, 0xdd, 0xa6, 0x0b, 0x6d, 0xf7, 0xe9, 0x63, 0x28, 0x5d, 0xc4,
+  0xa5, 0xc1, 0xcb, 0x17, 0xaa, 0x29, 0x56, 0x58, 0x79, 0xe1, 0x12, 0x4e,
+  0xcb, 0xd2, 0xff, 0xc0, 0x9c, 0x74, 0x2c, 0x1e, 0x49, 0xe3, 0x1f, 0x98,
+  0x0d, 0xcd, 0x9f, 0x86, 0x4e, 0x93, 0x46, 0xae, 0x4a, 0x9b, 0x8f, 0xcd,
+  0xb6, 0x5e, 0x20, 0x70, 0x3b, 0x6d, 0xe5, 0xc9, 0x3a, 0x03, 0x44, 0x3a,
+  0x35, 0x70, 0xbd, 0x82, 0x3f, 0x44, 0xef, 0x06, 0xee, 0x3e, 0xca, 0x7e,
+  0xf3, 0x22, 0x4d, 0x0b, 0x02, 0x6b, 0x52, 0x68, 0xa9, 0x3e, 0x88, 0x99,
+  0x48, 0x3c, 0xc1, 0x76, 0x70, 0x4e, 0x8f, 0x7a, 0xca, 0x3a, 0xa7, 0x59,
+  0x3b, 0xaf, 0x95, 0x79, 0x84, 0xe7, 0x8b, 0x44, 0x7a, 0xc4, 0x56, 0x30,
+  0x74, 0x6e, 0x40, 0xda, 0x3d, 0x40, 0x67, 0x7a, 0x80, 0x99, 0xc7, 0x1d,
+  0x9a, 0x2f, 0x43, 0x67, 0xd3, 0xa5, 0xc6, 0x55, 0x7b, 0x7e, 0x66, 0x18,
+  0x2f, 0x85, 0x55, 0x8f, 0xf3, 0x47, 0x49, 0x38, 0x08, 0xc4, 0x1d, 0xd3,
+  0xe7, 0x66, 0x23, 0x7d, 0x60, 0xae, 0x71, 0x4b, 0x73, 0x94, 0xc7, 0x83,
+  0xd5, 0x18, 0xbf, 0xe9, 0xc2, 0x4e, 0x8d, 0x7f, 0xea, 0x31, 0xff, 0xe7,
+  0xe7, 0xc0, 0x0f, 0x40, 0xf5, 0x57, 0xc7, 0x47, 0x2c, 0xbf, 0x3e, 0xf5,
+  0x60, 0x26, 0x17, 0xd6, 0xe8, 0x5a, 0x0d, 0x7b, 0x7a, 0x6b, 0x16, 0x02,
+  0xd9, 0xcc, 0x93, 0xaa, 0x43, 0xe7, 0x7a, 0x21, 0x29, 0x65, 0xea, 0x39,
+  0xb9, 0x60, 0xc9, 0xf2, 0x9e, 0x75, 0x8f, 0x5b, 0xdf, 0xf2, 0x90, 0x67,
+  0x39, 0xf3, 0x93, 0x2f, 0xf9, 0x26, 0x50, 0x70, 0x27, 0x8f, 0xed, 0xd3,
+  0x0c, 0x4a, 0x37, 0x8d, 0xd3, 0xaa, 0xd2, 0xa7, 0x3f, 0x52, 0xdc, 0x41,
+  0x3c, 0xc7, 0x3b, 0x68, 0xd9, 0xc5, 0x93, 0x41, 0xde, 0x32, 0x3f, 0x41,
+  0xde, 0x74, 0x70, 0x17, 0xbe, 0x76, 0x79, 0x37, 0xb4, 0x2c, 0xe4, 0x70,
+  0x1b, 0x99, 0x65, 0x0c, 0xcf, 0x44, 0xbf, 0xb0, 0xd5, 0x31, 0x59, 0x0f,
+  0xb9, 0x89, 0xc9, 0x1c, 0xb6, 0x53, 0xc4, 0xca, 0x63, 0xf1, 0xbc, 0x79,
+  0x81, 0xc5, 0x0b, 0xe7, 0xce, 0x63, 0x79, 0x99, 0x4a, 0x04, 0x43, 0xe1,
+  0x29, 0xf7, 0x24, 0x1b, 0x62, 0xda, 0x3a, 0x7a, 0xb1, 0xb1, 0x98, 0x5f,
+  0x54, 0xad, 0x65, 0x1d, 0xce, 0x64, 0x71, 0xc5, 0x9d, 0x05, 0x9a, 0x2f,
+  0xae, 0xf9, 0x92, 0x1b, 0x8b, 0x63, 0xc1, 0xfa, 0x70, 0x71, 0x45, 0xb1,
+  0x2f, 0x59, 0x7c, 0x7d, 0x71, 0x7c, 0x0d, 0xfc, 0x0a, 0xb1, 0x5f, 0x20,
+  0x03, 0x94, 0xf0, 0x14, 0x5f, 0xd9, 0xf4, 0x46, 0xf6, 0x47, 0xa4, 0x96,
+  0x5d, 0xd7, 0x32, 0x5c, 0xfc, 0x78, 0x40, 0xbb, 0xbe, 0x80, 0x7d, 0x36,
+  0x8a, 0x10, 0x55, 0xb9, 0x04, 0x28, 0xb8, 0xeb, 0x81, 0x82, 0xbe, 0xef,
+  0x42, 0xcd, 0x8d, 0x5e, 0xc6, 0xff, 0x33, 0x7b, 0xeb, 0xb2, 0x2f, 0x3e,
+  0x1a, 0x71, 0x79, 0x2d, 0x25, 0xae, 0x40, 0x7c, 0x84, 0x0d, 0xbf, 0x9a,
+  0xe3, 0xe6, 0x5b, 0x87, 0xc4, 0xa1, 0xcf, 0x40, 0xb9, 0x57, 0xb9, 0x0e,
+  0xfd, 0x1d, 0x88, 0xcb, 0xeb, 0xbf, 0xe1, 0xf9, 0x49, 0xc4, 0xc7, 0x62,
+  0x90, 0x02, 0xc9, 0x71, 0xb9, 0x04, 0x9e, 0x44, 0x13, 0xf2, 0x2d, 0x71,
+  0x0c, 0xe2, 0xef, 0x22, 0xfe, 0x2e, 0xca, 0x37, 0x48, 0xee, 0x0f, 0x0f,
+  0x99, 0x40, 0x3f, 0x44, 0x5c, 0x5e, 0xcb, 0x98, 0x6d, 0x43, 0x5c, 0x2e,
+  0xa7, 0x23, 0xcf, 0xdb, 0x11, 0x97, 0xdd, 0x7d, 0x79, 0x87, 0xbb, 0x11,
+  0x2f, 0xb2, 0xc9, 0x3f, 0x87, 0xf8, 0x24, 0xbc, 0xc6, 0xa1, 0x14, 0xed,
+  0x10, 0xe2, 0x72, 0xcd, 0x20, 0x19, 0xb3, 0xf7, 0x24, 0xb7, 0x88, 0xd7,
+  0x37, 0xe2, 0xf9, 0x2f, 0x88, 0x27, 0x6d, 0xf2, 0x69, 0xc4, 0xd7, 0xe2,
+  0xb5, 0xe4, 0x2e, 0x3f, 0x41, 0xfc, 0x79, 0xbc, 0x96, 0xd3, 0x88, 0xa1,
+  0x3d, 0x75, 0xe2, 0x7a, 0x96, 0x2b, 0xf0, 0xa0, 0x02, 0x5f, 0xab, 0xc0,
+  0x9f, 0x52, 0xe0, 0xbf, 0x54, 0xe0, 0xfb, 0x15, 0xf8, 0x1f, 0x14, 0xb8,
+  0xdc, 0x87, 0x64, 0x22, 0x26, 0xbc, 0x2c, 0x2f, 0xff, 0x44, 0xfc, 0x76,
+  0x1b, 0x3e, 0xd1, 0x65, 0xf2, 0xc8, 0xf4, 0x28, 0x57, 0xe0, 0x7e, 0x05,
+  0x17, 0x56, 0xa3, 0xc0, 0x7f, 0xa0, 0xc0, 0xef, 0x42, 0xce, 0xee, 0x05,
+  0x2c, 0xf8, 0xf9, 0x98, 0x01, 0x29, 0x85, 0xfc, 0x46, 0x05, 0xfe, 0x84,
+  0x02, 0x7f, 0x46, 0x81, 0xef, 0x55, 0xe0, 0xaf, 0x28, 0xf0, 0x76, 0x05,
+  0xfe, 0x7b, 0x05, 0xfe, 0xa9, 0x02, 0x3f, 0xa7, 0xe2, 0x10, 0xc9, 0xcb,
+  0x77, 0x48, 0x4b, 0x44, 0x62, 0xab, 0x93, 0x5a, 0x6c, 0x55, 0x40, 0xfc,
+  0x80, 0xef, 0xc0, 0xbd, 0xe1, 0x0d, 0xe2, 0x47, 0x03, 0x2c, 0xcd, 0x2d,
+  0xa1, 0x40, 0x24, 0x16, 0x49, 0x69, 0x71, 0xdc, 0xef, 0x00, 0x00, 0xe1,
+  0x27, 0xa3, 0xc5, 0xc2, 0xeb, 0x78, 0x68, 0x2d, 0x24, 0x48, 0xbf, 0xbe,
+  0x97, 0x8a, 0x77, 0x58, 0x22, 0x3d, 0x11, 0x0e, 0x35, 0x24, 0x6a, 0x0d,
+  0xd5, 0xdc, 0xaa, 0xbc, 0x00, 0x72, 0x30, 0x1e, 0x0e, 0x45, 0xea, 0x22,
+  0x21, 0x03, 0x4b, 0x12, 0x2c, 0xc4, 0x57, 0x0b, 0x67, 0x52, 0xa9, 0x48,
+  0x3d, 0x2c, 0x23, 0x1e, 0xda, 0xb0, 0x3a, 0x10, 0x4f, 0x34, 0x00, 0x1d,
+  0xca, 0x09, 0xcd, 0x00, 0xbb, 0xcd, 0x70, 0xc2, 0xf1, 0x8f, 0xf5, 0xec,
+  0x76, 0xf8, 0x2f, 0x20, 0x11, 0xc5, 0x26, 0x0e, 0xec, 0x2a, 0xc9, 0x99,
+  0xc3, 0x60, 0x22, 0x15, 0x08, 0x04, 0x52, 0xa1, 0x10, 0xc1, 0x1a, 0xe2,
+  0x16, 0x48, 0x72, 0x9c, 0x48, 0x8a, 0x0a, 0x82, 0x53, 0x08, 0xf0, 0xd6,
+  0x26, 0xb0, 0x2e, 0x11, 0x49, 0x85, 0x05, 0xb9, 0xc8, 0xe2, 0x17, 0x8e,
+  0xad, 0x95, 0xfc, 0x2c, 0xa7, 0x1a, 0x4d, 0x92, 0xd1, 0x20, 0x1d, 0xa7,
+  0x6b, 0x71, 0xee, 0xc4, 0x24, 0x18, 0x47, 0xc9, 0xa5, 0xda, 0x17, 0x9b,
+  0x5f, 0x95, 0x0c, 0x07, 0x13, 0xa1, 0x35, 0x82, 0x91, 0x4c, 0xc6, 0x50,
+  0xca, 0x89, 0x9a, 0xb4, 0xb3, 0x92, 0xe2, 0x90, 0x43, 0x54, 0xf6, 0xf5,
+  0x1d, 0x64, 0x7d, 0x08, 0x18, 0x1d, 0x13, 0xff, 0x3e, 0xc1, 0xe9, 0x18,
+  0xf7, 0x8f, 0x88, 0x1e, 0xca, 0x41, 0x3e, 0x47, 0xe4, 0xe9, 0x58, 0xf6,
+  0x6b, 0x44, 0x9e, 0x72, 0x09, 0x67, 0x14, 0x78, 0x2f, 0xd1, 0x43, 0xc7,
+  0xca, 0x27, 0x13, 0x5f, 0x11, 0xca, 0x69, 0xdd, 0x40, 0x70, 0xca, 0x8d,
+  0x7d, 0xc7, 0x65, 0xea, 0xa1, 0x63, 0xe2, 0x55, 0x44, 0x9e, 0xa6, 0x43,
+  0x35, 0x91, 0xa7, 0x63, 0xdf, 0xb5, 0x04, 0xa7, 0x5c, 0x45, 0x93, 0x42,
+  0xcf, 0x76, 0x22, 0x4f, 0xc7, 0xd6, 0x5b, 0x09, 0x4e, 0xc7, 0xc4, 0x6f,
+  0x21, 0x1c, 0x2d, 0xe5, 0x56, 0xeb, 0x15, 0xb8, 0xe4, 0x74, 0xa1, 0xdb,
+  0xeb, 0x21, 0x78, 0x31, 0xe1, 0x62, 0xe9, 0x18, 0xf4, 0x83, 0x84, 0x8b,
+  0xa5, 0x9c, 0xf4, 0x19, 0x82, 0x53, 0x4e, 0x7a, 0x48, 0x9e, 0xb3, 0xfe,
+  0xdb, 0xf2, 0xcc, 0xfb, 0xa5, 0x9c, 0x6b, 0x82, 0x70, 0xba, 0x94, 0xc3,
+  0x6e, 0x23, 0xf2, 0x94, 0xcb, 0x69, 0x27, 0xf2, 0x94, 0xab, 0xfe, 0x93,
+  0x82, 0x1b, 0x3e, 0x41, 0xf4, 0x50, 0xae, 0xb1, 0x97, 0xe0, 0x94, 0x23,
+  0x1c, 0x33, 0xd8, 0xc4, 0x29, 0x17, 0x58, 0xa2, 0xe0, 0x98, 0x97, 0x13,
+  0x79, 0xca, 0x05, 0x6e, 0x20, 0xf2, 0x94, 0x0b, 0x7f, 0x94, 0xe0, 0x94,
+  0x03, 0xde, 0x45, 0xf4, 0x50, 0x2e, 0x70, 0x1f, 0x91, 0xa7, 0xdc, 0xd8,
+  0x1b, 0x44, 0x9e, 0x96, 0xff, 0x43, 0x44, 0x9e, 0x72, 0x06, 0x57, 0x11,
+  0xee, 0x99, 0xa6, 0xff, 0x42, 0x05, 0x57, 0xbd, 0x9b, 0xc8, 0x53, 0xee,
+  0x90, 0xae, 0x6f, 0x4f, 0x39, 0xe0, 0x66, 0xc2, 0x31, 0x53, 0xee, 0xf0,
+  0x59, 0xc2, 0x49, 0xd3, 0xf8, 0xbf, 0x44, 0xe4, 0x29, 0x17, 0xb8, 0x80,
+  0x70, 0xcf, 0x94, 0x93, 0x8b, 0x0c, 0x73, 0xd6, 0x73, 0x3f, 0x91, 0xa7,
+  0xdc, 0xdb, 0x13, 0x0a, 0xf9, 0x56, 0x82, 0x53, 0x0e, 0x66, 0x1f, 0xc1,
+  0x29, 0x57, 0xad, 0xf5, 0x73, 0xc0, 0x63, 0xe9, 0x73, 0xfa, 0xe3, 0xfc,
+  0xb8, 0x92, 0x3a, 0xd6, 0x5c, 0x06, 0x82, 0x89, 0x44, 0x70, 0x03, 0xc2,
+  0x14, 0xf8, 0x3a, 0xd7, 0x20, 0x7d, 0x75, 0x98, 0x15, 0xcf, 0x95, 0x4b,
+  0xd1, 0x08, 0x57, 0xdf, 0x57, 0x78, 0x15, 0x97, 0x52, 0x88, 0xe1, 0x7f,
+  0xd5, 0x4f, 0x78, 0x15, 0x97, 0xd2, 0x8e, 0xe1, 0xed, 0x7d, 0x98, 0x5c,
+  0xb9, 0x14, 0x19, 0x7e, 0x33, 0xde, 0xc0, 0x10, 0x62, 0x0b, 0x8e, 0xfe,
+  0xb8, 0x94, 0x4a, 0xe4, 0x8e, 0xff, 0x75, 0xbe, 0x5c, 0x0a, 0x3a, 0xf7,
+  0xf5, 0xe0, 0x9f, 0x7d, 0x71, 0x29, 0x6e, 0x87, 0x38, 0x54, 0xe2, 0x0b,
+  0x8d, 0xfd, 0x7e, 0xed, 0xd7, 0x37, 0x2b, 0xec, 0xd7, 0x8c, 0xb1, 0xda,
+  0x19, 0x8c, 0x61, 0xed, 0xf6, 0x17, 0x39, 0xd8, 0x86, 0x23, 0x8e, 0xe1,
+  0xef, 0xb2, 0xe1, 0xf6, 0xfb, 0x5f, 0x1b, 0x0c, 0x44, 0x23, 0xc9, 0x54,
+  0xce, 0x6b, 0xa8, 0x4e, 0x2d, 0x2f, 0x1b, 0x30, 0x97, 0xd3, 0x4a, 0x22,
+  0x58, 0x89, 0xdf, 0x0e, 0xeb, 0xec, 0xd0, 0x7d, 0xab, 0xf5, 0xaa, 0xae,
+  0xad, 0xed, 0x43, 0xb7, 0xa6, 0x7b, 0xf8, 0xf8, 0x59, 0x5a, 0xfe, 0x4e,
+  0x67, 0x3e, 0x16, 0x03, 0xdd, 0x3d, 0xba, 0xa6, 0x57, 0x77, 0xb9, 0x0e,
+  0x6d, 0xed, 0x29, 0x73, 0x6f, 0x03, 0x6e, 0x14, 0x47, 0x68, 0x3b, 0x11,
+  0x87, 0xa9, 0xbe, 0x64, 0xf6, 0xbc, 0x5e, 0xdd, 0xa3, 0x0f, 0xc3, 0x39,
+  0x2c, 0xd5, 0x5d, 0x30, 0xf0, 0x5c, 0x7a, 0x28, 0xf3, 0x06, 0x8c, 0x7a,
+  0xe3, 0x9c, 0x89, 0x1e, 0x31, 0x75, 0x65, 0x4b, 0x0f, 0xac, 0x5d, 0xeb,
+  0xde, 0x7a, 0x4e, 0x33, 0x51, 0xa1, 0x55, 0x68, 0xe9, 0x84, 0x01, 0xec,
+  0x2e, 0xd8, 0xf7, 0xb2, 0x79, 0xa2, 0x29, 0x52, 0x88, 0x13, 0xfa, 0xf3,
+  0xa4, 0x0d, 0xff, 0xd6, 0xae, 0xc2, 0xcc, 0x0a, 0x47, 0xcd, 0xbb, 0xfb,
+  0x0e, 0x26, 0xd7, 0x06, 0x80, 0x25, 0x2d, 0xd8, 0xf9, 0x40, 0x9e, 0x3e,
+  0x12, 0x48, 0x03, 0xd7, 0x51, 0x4e, 0x8c, 0xc0, 0x8c, 0xd1, 0x36, 0x59,
+  0x02, 0x2c, 0xe3, 0xd5, 0x9d, 0x74, 0x2e, 0x83, 0x73, 0xc4, 0xfb, 0xb0,
+  0xea, 0xc9, 0xc0, 0x72, 0x78, 0x19, 0x12, 0x38, 0x1f, 0x93, 0x89, 0x8f,
+  0x68, 0x6a, 0x72, 0xee, 0xb4, 0xa1, 0xc4, 0x58, 0xc2, 0x40, 0x5f, 0x92,
+  0x06, 0xee, 0x45, 0x44, 0x71, 0x6b, 0xc6, 0xb5, 0x9f, 0xeb, 0xe0, 0x34,
+  0x42, 0xba, 0xf4, 0x00, 0xfc, 0x35, 0xf1, 0xa8, 0x88, 0x5e, 0xbe, 0x4d,
+  0xb3, 0x0e, 0x03, 0xf8, 0x19, 0xc8, 0x3a, 0x11, 0x69, 0x73, 0xf0, 0x11,
+  0x1e, 0x69, 0xbd, 0xaa, 0x5b, 0x8c, 0x99, 0x7e, 0x05, 0x53, 0x4b, 0x5c,
+  0xee, 0xa6, 0xa5, 0xfc, 0xc7, 0x20, 0x77, 0xd3, 0x9d, 0xac, 0x31, 0xc8,
+  0xfc, 0xae, 0x17, 0x68, 0x13, 0x87, 0xa2, 0x66, 0x94, 0x71, 0xd5, 0x9a,
+  0x88, 0x74, 0xcd, 0x42, 0xb9, 0x86, 0x16, 0xb4, 0x6f, 0x4e, 0xef, 0x5a,
+  0x13, 0x14, 0xb8, 0x71, 0xc8, 0x87, 0x07, 0xde, 0x9a, 0xd8, 0xef, 0x60,
+  0x62, 0xb5, 0x56, 0x1f, 0xae, 0x0f, 0xc5, 0x37, 0x68, 0xc1, 0x55, 0xf0,
+  0x3e, 0x61, 0x3b, 0x16, 0x91, 0xbe, 0x23, 0xed, 0x73, 0xe7, 0x93, 0x3e,
+  0x22, 0xed, 0x83, 0x5e, 0xe8, 0x3c, 0x7f, 0xa5, 0xad, 0xe2, 0xce, 0xb5,
+  0x6d, 0xda, 0xec, 0x54, 0xe1, 0x3b, 0x84, 0x57, 0xb5, 0x4d, 0xb9, 0x86,
+  0x57, 0xb5, 0x4d, 0xb9, 0x86, 0x57, 0xb5, 0x4d, 0x32, 0xfc, 0x7a, 0xbc,
+  0x1e, 0xe8, 0xfa, 0xd8, 0x12, 0xb4, 0x8f, 0x97, 0xe4, 0xda, 0x36, 0x95,
+  0x61, 0x78, 0xb9, 0xf7, 0xed, 0x40, 0x79, 0xfe, 0x95, 0x08, 0x56, 0xf6,
+  0x63, 0x3f, 0x1a, 0xbc, 0x7f, 0xc3, 0xe4, 0x55, 0x91, 0x58, 0x2d, 0xb6,
+  0x0e, 0xfd, 0xaf, 0xc1, 0x36, 0xad, 0x6c, 0xa0, 0x6d, 0x83, 0x87, 0x24,
+  0x70, 0x25, 0x7e, 0x43, 0xdb, 0xc0, 0xda, 0x05, 0xa8, 0x11, 0xdc, 0xa5,
+  0x79, 0x5e, 0x77, 0xe9, 0x02, 0x6f, 0xa1, 0xbb, 0x74, 0xb1, 0xd7, 0xe3,
+  0x2e, 0x5d, 0xe1, 0x2d, 0x73, 0x97, 0xd6, 0x7a, 0x2b, 0xdd, 0xa5, 0x51,
+  0x6f, 0x8d, 0xbb, 0x34, 0xe5, 0x5d, 0xe9, 0x2e, 0xdd, 0xe4, 0x8d, 0xfb,
+  0x5b, 0x9a, 0xbc, 0x9b, 0x35, 0xa8, 0x79, 0xde, 0xf4, 0x3e, 0xc2, 0xcf,
+  0xaf, 0x79, 0xc5, 0x42, 0x59, 0x3b, 0xbd, 0x7b, 0xf8, 0x79, 0xbb, 0xb7,
+  0x95, 0x9d, 0x17, 0x30, 0xb9, 0xbd, 0xfc, 0xbc, 0xdd, 0x0b, 0xf5, 0xb1,
+  0x5f, 0x7f, 0xd3, 0xdb, 0xc6, 0xcf, 0xaf, 0x79, 0xdb, 0x35, 0xac, 0x8a,
+  0x6e, 0x6b, 0x39, 0xe8, 0x2e, 0x61, 0x66, 0x4b, 0xc0, 0x6c, 0x09, 0x98,
+  0x2d, 0x01, 0xb3, 0x25, 0x60, 0xb6, 0x04, 0xcc, 0x96, 0x80, 0xd9, 0x12,
+  0x30, 0xab, 0xa3, 0x59, 0x1d, 0xcd, 0xea, 0x68, 0x56, 0x47, 0xb3, 0x3a,
+  0x9a, 0xd5, 0xd1, 0xac, 0x8e, 0x66, 0xb7, 0xbc, 0x75, 0x88, 0x9d, 0xe6,
+  0xf6, 0x7e, 0xec, 0x90, 0x22, 0xd9, 0x79, 0xa2, 0xda, 0x2f, 0xb9, 0xd0,
+  0x21, 0x45, 0x55, 0x73, 0x0e, 0x48, 0x66, 0x2e, 0xc2, 0x71, 0x0e, 0x40,
+  0x60, 0x80, 0x25, 0xb1, 0x81, 0x02, 0x20, 0xa2, 0x89, 0xb9, 0x05, 0x9a,
+  0x96, 0x5d, 0x57, 0x19, 0xfa, 0x2e, 0xf0, 0xba, 0xe9, 0x94, 0x0d, 0xcf,
+  0xb5, 0x6e, 0x2a, 0x73, 0x2a, 0xa4, 0x0e, 0xe1, 0x55, 0x75, 0x53, 0xae,
+  0xe1, 0x55, 0x75, 0x53, 0xae, 0xe1, 0x55, 0x75, 0x93, 0x0c, 0xbf, 0x12,
+  0xaf, 0x07, 0x5a, 0x37, 0x3d, 0x8e, 0xe1, 0xa7, 0xd8, 0xf0, 0x5c, 0xeb,
+  0xa6, 0x76, 0x97, 0xd5, 0xce, 0x80, 0x7d, 0x90, 0x30, 0x7c, 0x65, 0x3f,
+  0xf6, 0x6b, 0x93, 0x0d, 0x6b, 0x82, 0xb1, 0xda, 0x68, 0x38, 0xc7, 0xba,
+  0x69, 0xd6, 0x4c, 0xec, 0xb6, 0x0e, 0xa4, 0x6e, 0x22, 0x60, 0x25, 0x7e,
+  0x0f, 0xcb, 0xde, 0xed, 0x42, 0x79, 0xf4, 0xf5, 0xec, 0x7e, 0x6b, 0x90,
+  0x99, 0x7b, 0x59, 0x1a, 0xcd, 0x9b, 0x83, 0x9e, 0x05, 0xbb, 0x0a, 0x88,
+  0x4b, 0x07, 0xfd, 0x8e, 0x4d, 0xd9, 0x40, 0x9f, 0x4d, 0x21, 0xf8, 0xb5,
+  0x3d, 0x9b, 0xf6, 0x23, 0xd7, 0x67, 0x53, 0x86, 0xef, 0xef, 0x9d, 0xea,
+  0x42, 0xdf, 0x57, 0xc3, 0x8f, 0xe7, 0x81, 0x3e, 0x9b, 0xad, 0x78, 0x1e,
+  0x6f, 0xc3, 0x73, 0x7e, 0x36, 0x6d, 0x76, 0x06, 0x2b, 0xec, 0x2b, 0x9f,
+  0x4d, 0x3c, 0x57, 0xf6, 0x63, 0xff, 0xe2, 0x71, 0xf1, 0xb8, 0x78, 0x5c,
+  0x3c, 0x2e, 0x1e, 0xdf, 0xcc, 0xe3, 0x3f, 0xdc, 0xa0, 0x4c, 0xce, 0x00,
+  0xc8, 0x00, 0x00
+};
+const unsigned int libtcc1_a_len = 10647;
@@ -73,36 +73,6 @@ char* file_load(const char *filename, unsigned int *len) {
     return contents;
 }
 
-char *load_stdin() {
-#if defined(WINDOWS)
-  return NULL;
-#else
-  char *code = NULL;
-  char *line = NULL;
-  size_t len = 0;
-  ssize_t rd;
-  fflush(stdout);
-  fflush(stderr);
-  while(1) {
-    rd = getline(&line, &len, stdin);
-    if(rd == -1) { // ctrl+d
-      free(line);
-      break;
-    }
-    code = realloc(code, (code?strlen(code):0) + len + 1);
-    if (!code) {
-      _err("Memory allocation error");
-      free(line);
-      return NULL;
-    }
-    strcat(code, line);
-    free(line);
-    line = NULL;
-  }
-  return(code);
-#endif
-}
-
 bool write_to_file(const char *path, const char *filename, const char *buf, unsigned int len) {
   FILE *fd;
   size_t written;
@@ -165,42 +135,41 @@ bool rm_recursive(char *path) {
 
 #if !defined(WINDOWS)
 
-static char *full_content = NULL;
-
+static char **dir_files = NULL;
+static int dir_nb_files = 0;
+static size_t dir_root_len = 0;
 
-static int file_load_ftw(const char *pathname,
+static int file_list_ftw(const char *pathname,
                          const struct stat *sbuf,
                          int type, struct FTW *ftwb) {
-    unsigned int len;
-    char *content = NULL;
-    if (type == FTW_F) {
-        size_t pathlen = strlen(pathname);
-        if (pathname[pathlen-1] == 'c' &&
-            pathname[pathlen-2] == '.') {
-            content = file_load(pathname, &len);
-            if (content == NULL) {
-                _err("Error: file_load %s",pathname);
-                return -1;
-            }
-            if (full_content == NULL) {
-                full_content = content;
-            } else {
-                full_content = realloc(full_content, strlen(full_content) + strlen(content) + 1);
-                if (full_content == NULL) {
-                    _err("Error: realloc full_content");
-                    return -1;
-                }
-                strcat(full_content, content);
-            }
-        }
+    char **files;
+    if (type != FTW_F)
+        return 0;
+    // skip hidden files and everything inside hidden folders
+    if (strstr(pathname + dir_root_len, "/."))
+        return 0;
+    files = realloc(dir_files, (dir_nb_files + 1) * sizeof(char*));
+    if (files == NULL) {
+        _err("Error: realloc dir_files");
+        return -1;
     }
+    dir_files = files;
+    dir_files[dir_nb_files] = malloc(strlen(pathname) + 1);
+    strcpy(dir_files[dir_nb_files], pathname);
+    dir_nb_files++;
     return 0;
 }
 
-/* dir_load: nftw version */
-char *dir_load(const char *path)
+static int file_list_cmp(const void *a, const void *b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/* dir_list: nftw version, returns the sorted paths of all files in
+   the tree, the list and the paths need free */
+char **dir_list(const char *path, int *count)
 {
     struct stat sb;
+    char **files;
 
     if (stat(path, &sb) != 0) {
         _err("Error: %s",path);
@@ -211,20 +180,31 @@ char *dir_load(const char *path)
         _err("Error: %s is not a directory",path);
         return NULL;
     }
-    if (nftw(path, file_load_ftw, 10, FTW_DEPTH|FTW_MOUNT|FTW_PHYS) < 0) {
+    dir_files = NULL;
+    dir_nb_files = 0;
+    dir_root_len = strlen(path);
+    while (dir_root_len > 1 && path[dir_root_len - 1] == '/')
+        dir_root_len--;
+    if (nftw(path, file_list_ftw, 10, FTW_MOUNT|FTW_PHYS) < 0) {
         _err("Error: nftw path %s",path);
         _err("%s",strerror(errno));
+        while (dir_nb_files--) free(dir_files[dir_nb_files]);
+        free(dir_files);
         return NULL;
     }
-    return full_content;
+    qsort(dir_files, dir_nb_files, sizeof(char*), file_list_cmp);
+    files = dir_files;
+    *count = dir_nb_files;
+    dir_files = NULL;
+    return files ? files : calloc(1, sizeof(char*));
 }
 
 
 #else
-char *dir_load(const char *path)
+char **dir_list(const char *path, int *count)
 {
     /* FIXME */
-    _err("Error: dir_load not implemented on Windows");
+    _err("Error: dir_list not implemented on Windows");
     return NULL;
 }
 
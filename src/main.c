@@ -63,7 +63,7 @@ const char cli_help[] =
 	"CJIT %s by Dyne.org\n"
 	"\n"
 	"Synopsis: cjit [options] files(*) -- app arguments\n"
-	"  (*) can be any source (.c) or built object (dll, dylib, .so)\n"
+	"  (*) can be any source (.c), folder of sources or built object (dll, dylib, .so)\n"
 	"Options:\n"
 	" -h \t print this help\n"
 	" -v \t print version information\n"
@@ -76,8 +76,12 @@ const char cli_help[] =
 	" -e fun\t entry point function (default 'main')\n"
 	" -p pid\t write pid of executed program to file\n"
 	" -c \t compile a single source file, do not execute\n"
+	" -j num\t compile source files in 'num' parallel jobs\n"
 	" -o exe\t compile to an 'exe' file, do not execute\n"
 	" --temp\t create the runtime temporary dir and exit\n"
+	" --hotlines[=num]\t print the 'num' (20) most executed lines\n"
+	" --annotate\t print the sources with execution counts\n"
+	" --fast-malloc\t use the bundled thread-caching malloc\n"
 #if defined(SELFHOST)
 	" --src\t  extract source code to cjit_source\n"
 #endif
@@ -100,11 +104,14 @@ int main(int argc, char **argv) {
 #endif
 	  { "temp", ko_no_argument, 401 },
 	  { "xtgz", ko_required_argument, 501 },
+	  { "hotlines", ko_optional_argument, 601 },
+	  { "annotate", ko_no_argument, 602 },
+	  { "fast-malloc", ko_no_argument, 603 },
 	  { NULL, 0, 0 }
   };
   ketopt_t opt = KETOPT_INIT;
   // tolerated and ignored: -f -W -O -g -U -E -S -M
-  while ((c = ketopt(&opt, argc, argv, 1, "qhvD:L:l:C:I:e:p:co:f:W:O:gU:ESM:m:", longopts)) >= 0) {
+  while ((c = ketopt(&opt, argc, argv, 1, "qhvD:L:l:C:I:e:p:co:j:f:W:O:gU:ESM:m:", longopts)) >= 0) {
 	  if(c == 'q') {
 		  CJIT->quiet = true;
 	  }
@@ -120,9 +127,9 @@ int main(int argc, char **argv) {
 		  int _res;
 		  _res = parse_value(opt.arg);
 		  if(_res==0) { // -Dsym (no key=value)
-			  tcc_define_symbol(CJIT->TCC, opt.arg, NULL);
+			  cjit_define_symbol(CJIT, opt.arg, NULL);
 		  } else if(_res>0) { // -Dkey=value
-			  tcc_define_symbol(CJIT->TCC, opt.arg, &opt.arg[_res]);
+			  cjit_define_symbol(CJIT, opt.arg, &opt.arg[_res]);
 		  } else { // invalid char
 			  _err("Invalid char used in -D define symbol: %s", opt.arg);
 			  cjit_free(CJIT);
@@ -135,6 +142,8 @@ int main(int argc, char **argv) {
 		  CJIT->output_filename = malloc(strlen(opt.arg)+1);
 		  strcpy(CJIT->output_filename,opt.arg);
 		  CJIT->tcc_output = TCC_OUTPUT_EXE;
+	  } else if (c == 'j') { // parallel compilation jobs
+		  CJIT->jobs = atoi(opt.arg);
 	  } else if (c == 'L') { // library path
 		  if(!CJIT->quiet)_err("lib path: %s",opt.arg);
 		  tcc_add_library_path(CJIT->TCC, opt.arg);
@@ -143,10 +152,10 @@ int main(int argc, char **argv) {
 		  tcc_add_library(CJIT->TCC, opt.arg);
 	  } else if (c == 'C') { // cflags compiler options
 		  if(!CJIT->quiet)_err("cflags: %s",opt.arg);
-		  tcc_set_options(CJIT->TCC, opt.arg);
+		  cjit_set_options(CJIT, opt.arg);
 	  } else if (c == 'I') { // include paths in cflags
 		  if(!CJIT->quiet)_err("inc: %s",opt.arg);
-		  tcc_add_include_path(CJIT->TCC, opt.arg);
+		  cjit_add_include_path(CJIT, opt.arg);
 	  } else if (c == 'e') { // entry point (default main)
 		  if(!CJIT->quiet)_err("entry: %s",opt.arg);
 		  if(CJIT->entry) free(CJIT->entry);
@@ -180,6 +189,19 @@ int main(int argc, char **argv) {
 		  if(!len) exit(1);
 		  muntargz_to_path(".",targz,len);
 		  exit(0);
+	  } else if (c == 601 || c == 602) { // --hotlines --annotate
+		  if (c == 601) CJIT->hotlines = opt.arg? atoi(opt.arg) : 20;
+		  else CJIT->annotate = true;
+		  if (c == 601 && CJIT->hotlines <= 0) {
+			  _err("Invalid number of lines for --hotlines: %s",
+			       opt.arg);
+			  cjit_free(CJIT);
+			  exit(1);
+		  }
+		  // counted by the code -ftest-coverage adds to each block
+		  cjit_set_options(CJIT, "-ftest-coverage");
+	  } else if (c == 603) { // --fast-malloc
+		  CJIT->fast_malloc = true;
 	  }
 	  else if (c == '?') _err("unknown opt: -%c\n", opt.opt? opt.opt : ':');
 	  else if (c == ':') _err("missing arg: -%c\n", opt.opt? opt.opt : ':');
@@ -187,6 +209,8 @@ int main(int argc, char **argv) {
 		  arg_separator = opt.ind+1; break;
 	  }
   }
+  // counters in a single .tcov section, not one per object of the jobs
+  if(CJIT->hotlines || CJIT->annotate) CJIT->jobs = 0;
   if(!CJIT->quiet) _err("CJIT %s by Dyne.org",VERSION);
 
   // If no arguments then start the REPL
@@ -209,7 +233,6 @@ int main(int argc, char **argv) {
   // number of args at the left hand of arg separator, or all of them
   int left_args = arg_separator? arg_separator: argc;
 
-  char *stdin_code = NULL;
   if(opt.ind >= argc) {
 #if defined(_WIN32)
 	  _err("No files specified on commandline");
@@ -218,15 +241,10 @@ int main(int argc, char **argv) {
 	  ////////////////////////////
 	  // Processs code from STDIN
 	  if(!CJIT->quiet)_err("No files specified on commandline, reading code from stdin");
-	  stdin_code = load_stdin(); // allocated returned buffer, needs free
-	  if(!stdin_code) {
-		  _err("Error reading from standard input");
-		  goto endgame;
-	  }
 	  cjit_setup(CJIT);
-	  if( tcc_compile_string(CJIT->TCC,stdin_code) < 0) {
+	  // compiled while it is read, not after loading it all
+	  if( tcc_compile_file(CJIT->TCC,"-","<stdin>",0) < 0) {
 		  _err("Code runtime error in stdin");
-		  free(stdin_code);
 		  goto endgame;
 	  }
 	  // end of STDIN
@@ -248,6 +266,8 @@ int main(int argc, char **argv) {
   } else if(opt.ind < left_args) {
 	  // process files on commandline before separator
 	  if(!CJIT->quiet)_err("Source code:");
+	  // compile the sources in parallel jobs if asked to (-j)
+	  cjit_start_jobs(CJIT, &argv[opt.ind], left_args - opt.ind);
 	  for (i = opt.ind; i < left_args; ++i) {
 		  const char *code_path = argv[i];
 		  if(!CJIT->quiet)_err("%c %s",(*code_path=='-'?'|':'+'),
@@ -257,17 +277,12 @@ int main(int argc, char **argv) {
 			  _err("Code from standard input not supported on Windows");
 			  goto endgame;
 #endif
-			  stdin_code = load_stdin(); // allocated returned buffer, needs free
-			  if(!stdin_code) {
-				  _err("Error reading from standard input");
-				  goto endgame;
-			  }
 			  cjit_setup(CJIT);
-			  if( tcc_compile_string(CJIT->TCC,stdin_code) < 0) {
+			  // compiled while it is read, not after loading it all
+			  if( tcc_compile_file(CJIT->TCC,"-","<stdin>",0) < 0) {
 				  _err("Code runtime error in stdin");
-				  free(stdin_code);
 				  goto endgame;
-			  } else free(stdin_code);
+			  }
 		  } else { // load any file path
 			  cjit_add_file(CJIT, code_path);
 		  }
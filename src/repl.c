@@ -34,18 +34,39 @@
 
 // TODO: rudimental start at a repl, needs development
 
+#if !defined(WINDOWS)
+static bool cli_grow(char **code, size_t *size, size_t need) {
+    char *grown;
+    size_t newsize = *size;
+    while (newsize < need)
+        newsize *= 2;
+    if (newsize == *size)
+        return true;
+    grown = realloc(*code, newsize);
+    if (!grown) {
+        _err("Memory allocation error");
+        return false;
+    }
+    *code = grown;
+    *size = newsize;
+    return true;
+}
+#endif
+
 int cjit_cli_tty(CJITState *cjit) {
     char *line = NULL;
     size_t len = 0;
     ssize_t rd;
     int res = 0;
     const char intro[]="#include <stdio.h>\n#include <stdlib.h>\nint main(int argc, char **argv) {\n";
-    char *code = malloc(sizeof(intro));
+    // lines are appended at 'used', the buffer doubles when full
+    size_t used = sizeof(intro) - 1, size = 4096;
+    char *code = malloc(size);
     if (!code) {
         _err("Memory allocation error");
         return 2;
     }
-    strcpy(code, intro);
+    memcpy(code, intro, used + 1);
 #if defined(WINDOWS)
     _err("Missing source code argument");
 #else // WINDOWS
@@ -55,15 +76,13 @@ int cjit_cli_tty(CJITState *cjit) {
       rd = getline(&line, &len, stdin);
       if (rd == -1) {
         /* This is CTRL + D */
-        code = realloc(code, strlen(code) + 4);
-        if (!code) {
-          _err("Memory allocation error");
+        free(line);
+        line = NULL;
+        if (!cli_grow(&code, &size, used + 4)) {
           res = 2;
           break;
         }
-        free(line);
-        line = NULL;
-        strcat(code, "\n}\n");
+        memcpy(code + used, "\n}\n", 4);
         // run the code from main
 #ifdef VERBOSE_CLI
         _err("Compiling code\n");
@@ -91,16 +110,15 @@ int cjit_cli_tty(CJITState *cjit) {
         code = NULL;
         break;
       }
-      code = realloc(code, strlen(code) + len + 1);
-      if (!code) {
-        _err("Memory allocation error");
+      if (!cli_grow(&code, &size, used + rd + 1)) {
         res = 2;
         break;
       }
-      strcat(code, line);
-      free(line);
-      line = NULL;
+      memcpy(code + used, line, rd + 1);
+      used += rd;
     }
+    free(line);
+    free(code);
 #endif // WINDOWS
     return res;
 }
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <cjit_alloc.h>
+
+// large blocks of 1 to 7 spans are split from and merged into the free
+// ones: returns NULL when one of them lost its content
+static void *work(void *arg) {
+	char *v[256];
+	int i, k;
+	for (k = 0; k < 100; k++) {
+		for (i = 0; i < 256; i++) {
+			v[i] = malloc(i * 131 + 1);
+			memset(v[i], k, i * 131 + 1);
+		}
+		for (i = 0; i < 256; i += 3) {
+			v[i] = realloc(v[i], 40000 + (i + k) % 7 * 65536);
+			if (v[i][i * 131] != (char)k)
+				arg = NULL;
+		}
+		for (i = 0; i < 256; i++)
+			free(v[i]);
+	}
+	return arg;
+}
+
+// frees only, what another thread allocated
+static void *drop(void *arg) {
+	char **v = arg;
+	int i;
+	for (i = 0; i < 256; i++)
+		free(v[i]);
+	return NULL;
+}
+
+int main(void) {
+	pthread_t t[4];
+	cjit_arena *arena = cjit_arena_new(0);
+	cjit_pool *pool = cjit_pool_new(24);
+	char *s = strdup("blocks"), *a, *b, *v[256];
+	void *ok;
+	long sum = 0;
+	int i, bad = 0;
+	for (i = 0; i < 4; i++)
+		pthread_create(&t[i], NULL, work, s);
+	for (i = 0; i < 4; i++) {
+		pthread_join(t[i], &ok);
+		if (!ok)
+			bad = 1;
+	}
+	for (i = 0; i < 256; i++)
+		v[i] = malloc(16 << (i % 11));
+	pthread_create(&t[0], NULL, drop, v);
+	pthread_join(t[0], NULL);
+	for (i = 0; i < 10000; i++) {
+		int *n = cjit_arena_alloc(arena, sizeof *n);
+		*n = i;
+		sum += *n;
+	}
+	cjit_arena_delete(arena);
+	a = cjit_pool_alloc(pool);
+	cjit_pool_free(pool, a);
+	b = cjit_pool_alloc(pool);
+	printf("%s %ld %s\n", bad ? "corrupted" : s, sum,
+	       a == b ? "reused" : "new");
+	cjit_pool_delete(pool);
+	free(s);
+	return 0;
+}
@@ -16,6 +16,7 @@ load bats_setup
     run ${CJIT} -q test/cflags.c
     assert_failure
     assert_output --partial 'Please compile with -DALLOWED=1'
+    assert_output --partial 'test/cflags.c:8: error'
 }
 
 @test "Compile to object and execute" {
@@ -51,6 +52,80 @@ load bats_setup
     assert_line --partial 'hello from myfunc3'
 }
 
+@test "Execute multiple files in parallel jobs" {
+    run ${CJIT} -q -j 4 test/multifile/*
+    assert_success
+    assert_line --partial 'hello from myfunc'
+    assert_line --partial 'hello from myfunc2'
+    assert_line --partial 'hello from myfunc3'
+}
+
+@test "Execute a folder of sources, then again from cache" {
+    run ${CJIT} -q test/multifile
+    assert_success
+    assert_line --partial 'hello from myfunc'
+    assert_line --partial 'hello from myfunc3'
+    run ${CJIT} -q test/multifile
+    assert_success
+    assert_line --partial 'hello from myfunc'
+    assert_line --partial 'hello from myfunc3'
+}
+
+@test "Execute a folder again once a header appears" {
+    mkdir -p "$TMP"/proj
+    printf '#include <stdio.h>\n#if __has_include("config.h")\n#include "config.h"\n#else\n#define NAME "default"\n#endif\nint main() { puts(NAME); return 0; }\n' > "$TMP"/proj/main.c
+    run ${CJIT} -q "$TMP"/proj
+    assert_success
+    assert_output 'default'
+    run ${CJIT} -q "$TMP"/proj
+    assert_success
+    assert_output 'default'
+    echo '#define NAME "config"' > "$TMP"/proj/config.h
+    run ${CJIT} -q "$TMP"/proj
+    assert_success
+    assert_output 'config'
+}
+
+@test "Execute from cached headers until a header appears" {
+    printf '#include <stdio.h>\n#if __has_include("config.h")\n#include "config.h"\n#else\n#define NAME "default"\n#endif\nint main() { puts(NAME); return 0; }\n' > "$TMP"/pch.c
+    run ${CJIT} -q "$TMP"/pch.c
+    assert_success
+    assert_output 'default'
+    run ${CJIT} -q "$TMP"/pch.c
+    assert_success
+    assert_output 'default'
+    echo '#define NAME "config"' > "$TMP"/config.h
+    run ${CJIT} -q "$TMP"/pch.c
+    assert_success
+    assert_output 'config'
+}
+
+@test "Execute when the cached headers are damaged" {
+    printf '#include <stdio.h>\nint main() { puts("cached"); return 0; }\n' > "$TMP"/damaged.c
+    run ${CJIT} -q "$TMP"/damaged.c
+    assert_success
+    assert_output 'cached'
+    for f in `${CJIT} --temp`/pch/*.pch; do
+        head -c $(( `wc -c < "$f"` * 9 / 10 )) "$f" > "$TMP"/cut.pch
+        mv "$TMP"/cut.pch "$f"
+    done
+    run ${CJIT} -q "$TMP"/damaged.c
+    assert_success
+    assert_output 'cached'
+    run ${CJIT} -q "$TMP"/damaged.c
+    assert_success
+    assert_output 'cached'
+}
+
+@test "Execute source from standard input" {
+    run bash -c "${CJIT} -q < test/hello.c"
+    assert_success
+    assert_output 'Hello World!'
+    run bash -c "${CJIT} -q test/multifile/myfunc*.c - < test/multifile/main.c"
+    assert_success
+    assert_line --partial 'hello from myfunc3'
+}
+
 @test "Pass arguments to executed source" {
     run ${CJIT} -q test/cargs.c -- a b c
     assert_success
@@ -59,3 +134,81 @@ load bats_setup
     assert_line --partial '2: b'
     assert_line --partial '3: c'
 }
+
+@test "Use x86 SIMD intrinsics" {
+    case `uname -m` in
+        x86_64|amd64|i?86) ;;
+        *) skip "x86 only" ;;
+    esac
+    run ${CJIT} -q test/simd.c
+    assert_success
+    assert_output '3 2 9'
+}
+
+@test "Execute with the bundled allocator, arenas and pools" {
+    run ${CJIT} -q test/alloc.c
+    assert_success
+    assert_output 'blocks 49995000 reused'
+    run ${CJIT} -q --fast-malloc test/alloc.c
+    assert_success
+    assert_output 'blocks 49995000 reused'
+    # the size classes of the bundled allocator: 17 -> 32, 300 -> 320
+    printf '#include <stdio.h>\n#include <stdlib.h>\n#include <malloc.h>\nint main() { printf("%%zu %%zu\\n", malloc_usable_size(malloc(17)), malloc_usable_size(malloc(300))); return 0; }\n' > "$TMP"/classes.c
+    run ${CJIT} -q --fast-malloc "$TMP"/classes.c
+    assert_success
+    assert_output '32 320'
+    run ${CJIT} -q "$TMP"/classes.c
+    assert_success
+    refute_output '32 320'
+}
+
+@test "Execute with the code on huge pages" {
+    run ${CJIT} -q -C -fhuge-pages test/hello.c
+    assert_success
+    assert_output 'Hello World!'
+}
+
+@test "Execute with library functions bound on first call" {
+    run ${CJIT} -q -C -flazy-binding test/hello.c
+    assert_success
+    assert_output 'Hello World!'
+}
+
+@test "Execute with unreferenced functions dropped" {
+    run ${CJIT} -q -C -Wl,--gc-sections test/hello.c
+    assert_success
+    assert_output 'Hello World!'
+}
+
+@test "Count the most executed lines" {
+    run ${CJIT} -q --hotlines=3 test/hello.c
+    assert_success
+    assert_line --partial 'Hot lines (2 line executions)'
+    assert_line --regexp '^ +1 +50.0%  test/hello.c:5 main: fprintf'
+    assert_line --regexp '^ +2 +100.0% +1  main \(test/hello.c:5\)'
+    run ${CJIT} -q --annotate test/hello.c
+    assert_success
+    assert_line --regexp '^ +1: +6:.*return\(0\);'
+    run ${CJIT} -q --hotlines=0 test/hello.c
+    assert_failure
+    assert_line --partial 'Invalid number of lines for --hotlines: 0'
+}
+
+@test "Count the executed lines of a folder: not supported" {
+    run ${CJIT} -q --hotlines=5 test/multifile
+    assert_failure
+    assert_line --partial '--hotlines and --annotate cannot run a folder'
+    refute_line --partial 'No execution counts found'
+}
+
+@test "Trace the calls of the functions" {
+    rm -f /tmp/cjit-trace.json
+    run env TCC_TRACE=/tmp/cjit-trace.json ${CJIT} -q -C -finstrument-functions test/hello.c
+    assert_success
+    assert_output 'Hello World!'
+    run cat /tmp/cjit-trace.json
+    assert_line --partial '"traceEvents"'
+    assert_line --regexp '^\{"name":"main","ph":"B",'
+    assert_line --regexp '^\{"name":"main","ph":"E",'
+    rm -f /tmp/cjit-trace.json
+}
@@ -0,0 +1,13 @@
+#include <stdio.h>
+#include <immintrin.h>
+
+int main(void) {
+	float in[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	float out[8];
+	__m128 a = _mm_loadu_ps(in);
+	__m128 b = _mm_mul_ps(a, _mm_set1_ps(2.0f));
+	__m256 c = _mm256_add_ps(_mm256_loadu_ps(in), _mm256_set1_ps(1.0f));
+	_mm256_storeu_ps(out, c);
+	printf("%g %g %g\n", _mm_cvtss_f32(_mm_add_ss(a, b)), out[0], out[7]);
+	return 0;
+}